@@ -28,7 +28,8 @@ public:
 	 * @param InSender - The IPv4 endpoint of the sender.
 	 */
 	FReassembledUdpMessage(int32 MessageSize, int32 SegmentCount, uint64 InSequence, const FIPv4Endpoint& InSender)
-		: PendingSegments(true, SegmentCount)
+		: CumulativeSegment(0)
+		, PendingSegments(true, SegmentCount)
 		, PendingSegmentsCount(SegmentCount)
 		, ReceivedBytes(0)
 		, Sender(InSender)
@@ -55,6 +56,37 @@ public:
 		return LastSegmentTime;
 	}
 
+	/**
+	 * Gets and clears the segments that were received since the last acknowledgment.
+	 *
+	 * @param OutCumulativeSegment - Will hold the number of the first segment that hasn't been received yet.
+	 * @param OutSegments - Will hold the received segments above the cumulative segment.
+	 *
+	 * @return true if any segments need to be acknowledged, false otherwise.
+	 */
+	bool GetUnacknowledgedSegments(uint16& OutCumulativeSegment, TArray<uint16>& OutSegments)
+	{
+		if (UnacknowledgedSegments.Num() == 0)
+		{
+			return false;
+		}
+
+		OutCumulativeSegment = CumulativeSegment;
+		OutSegments.Reset();
+
+		for (int32 Index = 0; Index < UnacknowledgedSegments.Num(); ++Index)
+		{
+			if (UnacknowledgedSegments[Index] > CumulativeSegment)
+			{
+				OutSegments.Add(UnacknowledgedSegments[Index]);
+			}
+		}
+
+		UnacknowledgedSegments.Reset();
+
+		return true;
+	}
+
 	/**
 	 * Gets the list of segments that haven't been received yet.
 	 *
@@ -143,8 +175,20 @@ public:
 				--PendingSegmentsCount;
 
 				ReceivedBytes += SegmentData.Num();
+
+				while ((CumulativeSegment < PendingSegments.Num()) && !PendingSegments[CumulativeSegment])
+				{
+					++CumulativeSegment;
+				}
+			}
+			else
+			{
+				return;
 			}
 		}
+
+		// duplicates are acknowledged again, because the sender may have missed the previous acknowledgment
+		UnacknowledgedSegments.Add(SegmentNumber);
 	}
 
 public:
@@ -171,6 +215,9 @@ public:
 
 private:
 
+	// Holds the number of the first segment that hasn't been received yet.
+	uint16 CumulativeSegment;
+
 	// Holds the message data.
 	TArray<uint8> Data;
 
@@ -194,6 +241,9 @@ private:
 
 	// Holds the message sequence.
 	uint64 Sequence;
+
+	// Holds the segments that were received since the last acknowledgment.
+	TArray<uint16> UnacknowledgedSegments;
 };
 
 
@@ -64,7 +64,7 @@ bool FUdpMessageSegmenterTest::RunTest( const FString& Parameters )
 
 		while (Segmenter.GetNextPendingSegment(OutData, OutSegmentNumber))
 		{
-			Segmenter.MarkAsSent(OutSegmentNumber);
+			Segmenter.MarkAsSent(OutSegmentNumber, FDateTime::UtcNow());
 
 			++GeneratedSegmentCount;
 		}
@@ -11,6 +11,13 @@
  *****************************************************************************/
 
 const int32 FUdpMessageProcessor::DeadHelloIntervals = 5;
+const float FUdpMessageProcessor::InitialCongestionWindow = 16.0f;
+const float FUdpMessageProcessor::MaxCongestionWindow = 1024.0f;
+const int32 FUdpMessageProcessor::MaxSegmentBuffers = 2048;
+const int32 FUdpMessageProcessor::MaxUnreliableSegmentsPerUpdate = 64;
+const float FUdpMessageProcessor::MinCongestionWindow = 2.0f;
+const FTimespan FUdpMessageProcessor::MinRetransmitTimeout = FTimespan::FromMilliseconds(100.0);
+const uint16 FUdpMessageProcessor::SegmentSize = 1024;
 
 
 /* FUdpMessageProcessor structors
@@ -21,6 +28,7 @@ FUdpMessageProcessor::FUdpMessageProcessor( FSocket* InSocket, const FGuid& InNo
 	, LastSentMessage(-1)
 	, LocalNodeId(InNodeId)
 	, MulticastEndpoint(InMulticastEndpoint)
+	, NextSegmentBuffer(0)
 	, Sender(NULL)
 	, Socket(InSocket)
 	, Stopping(false)
@@ -106,16 +114,16 @@ uint32 FUdpMessageProcessor::Run( )
 {
 	while (!Stopping)
 	{
-		if (WorkEvent->Wait(CalculateWaitTime()))
-		{
-			CurrentTime = FDateTime::UtcNow();
+		// nodes are updated even if there is no new work, so that lost segments get retransmitted
+		WorkEvent->Wait(CalculateWaitTime());
 
-			ConsumeInboundSegments();
-			ConsumeOutboundMessages();
+		CurrentTime = FDateTime::UtcNow();
 
-			UpdateKnownNodes();
-			UpdateStaticNodes();
-		}
+		ConsumeInboundSegments();
+		ConsumeOutboundMessages();
+
+		UpdateKnownNodes();
+		UpdateStaticNodes();
 	}
 	
 	delete Beacon;
@@ -139,8 +147,33 @@ void FUdpMessageProcessor::Stop( )
 /* FUdpMessageProcessor implementation
  *****************************************************************************/
 
-void FUdpMessageProcessor::AcknowledgeReceipt( int32 MessageId, const FNodeInfo& NodeInfo )
+void FUdpMessageProcessor::AcknowledgeReceipts( FNodeInfo& NodeInfo )
 {
+	FUdpMessageSegment::FAcknowledgeChunk AcknowledgeChunk;
+
+	AcknowledgeChunk.MessageIds = NodeInfo.PendingAcknowledgments;
+	NodeInfo.PendingAcknowledgments.Reset();
+
+	int32 ChunkSize = AcknowledgeChunk.MessageIds.Num() * sizeof(int32);
+
+	for (TMap<int32, FReassembledUdpMessagePtr>::TConstIterator It(NodeInfo.ReassembledMessages); It; ++It)
+	{
+		FUdpMessageSegment::FSegmentAcknowledgment SegmentAcknowledgment;
+
+		if (It.Value()->GetUnacknowledgedSegments(SegmentAcknowledgment.CumulativeSegment, SegmentAcknowledgment.Segments))
+		{
+			SegmentAcknowledgment.MessageId = It.Key();
+			AcknowledgeChunk.Segments.Add(SegmentAcknowledgment);
+
+			ChunkSize += sizeof(int32) + sizeof(uint16) + sizeof(int32) + SegmentAcknowledgment.Segments.Num() * sizeof(uint16);
+		}
+	}
+
+	if ((AcknowledgeChunk.MessageIds.Num() == 0) && (AcknowledgeChunk.Segments.Num() == 0))
+	{
+		return;
+	}
+
 	FUdpMessageSegment::FHeader Header;
 
 	Header.RecipientNodeId = NodeInfo.NodeId;
@@ -148,18 +181,85 @@ void FUdpMessageProcessor::AcknowledgeReceipt( int32 MessageId, const FNodeInfo&
 	Header.ProtocolVersion = UDP_MESSAGING_TRANSPORT_PROTOCOL_VERSION;
 	Header.SegmentType = EUdpMessageSegments::Acknowledge;
 
-	FUdpMessageSegment::FAcknowledgeChunk AcknowledgeChunk;
+	// acknowledgments are small, so they usually fit into a single datagram
+	if (ChunkSize <= SegmentSize)
+	{
+		TSharedRef<TArray<uint8>, ESPMode::ThreadSafe> Buffer = AcquireSegmentBuffer();
+		FMemoryWriter Writer(*Buffer);
+
+		Writer << Header;
+		Writer << AcknowledgeChunk;
 
-	AcknowledgeChunk.MessageId = MessageId;
+		Sender->Send(Buffer, NodeInfo.Endpoint);
 
-	FArrayWriter Writer;
+		return;
+	}
 
-	Writer << Header;
-	Writer << AcknowledgeChunk;
+	// otherwise split them up
+	FUdpMessageSegment::FAcknowledgeChunk PartialChunk;
+	int32 PartialChunkSize = 0;
 
-	int32 Sent;
+	for (int32 Index = 0; Index < AcknowledgeChunk.MessageIds.Num() + AcknowledgeChunk.Segments.Num(); ++Index)
+	{
+		if (Index < AcknowledgeChunk.MessageIds.Num())
+		{
+			PartialChunk.MessageIds.Add(AcknowledgeChunk.MessageIds[Index]);
+			PartialChunkSize += sizeof(int32);
+		}
+		else
+		{
+			const FUdpMessageSegment::FSegmentAcknowledgment& SegmentAcknowledgment = AcknowledgeChunk.Segments[Index - AcknowledgeChunk.MessageIds.Num()];
 
-	Socket->SendTo(Writer.GetData(), Writer.Num(), Sent, *NodeInfo.Endpoint.ToInternetAddr());
+			PartialChunk.Segments.Add(SegmentAcknowledgment);
+			PartialChunkSize += sizeof(int32) + sizeof(uint16) + sizeof(int32) + SegmentAcknowledgment.Segments.Num() * sizeof(uint16);
+		}
+
+		if ((PartialChunkSize >= SegmentSize) || (Index == AcknowledgeChunk.MessageIds.Num() + AcknowledgeChunk.Segments.Num() - 1))
+		{
+			TSharedRef<TArray<uint8>, ESPMode::ThreadSafe> Buffer = AcquireSegmentBuffer();
+			FMemoryWriter Writer(*Buffer);
+
+			Writer << Header;
+			Writer << PartialChunk;
+
+			Sender->Send(Buffer, NodeInfo.Endpoint);
+
+			PartialChunk.MessageIds.Reset();
+			PartialChunk.Segments.Reset();
+			PartialChunkSize = 0;
+		}
+	}
+}
+
+
+TSharedRef<TArray<uint8>, ESPMode::ThreadSafe> FUdpMessageProcessor::AcquireSegmentBuffer( )
+{
+	// the socket sender releases buffers in the order they were sent, so the oldest buffer is checked first
+	if (SegmentBuffers.Num() > 0)
+	{
+		NextSegmentBuffer %= SegmentBuffers.Num();
+
+		TSharedPtr<TArray<uint8>, ESPMode::ThreadSafe>& Buffer = SegmentBuffers[NextSegmentBuffer];
+
+		if (Buffer.IsUnique())
+		{
+			++NextSegmentBuffer;
+			Buffer->Reset();
+
+			return Buffer.ToSharedRef();
+		}
+	}
+
+	TSharedRef<TArray<uint8>, ESPMode::ThreadSafe> NewBuffer = MakeShareable(new TArray<uint8>());
+
+	if (SegmentBuffers.Num() < MaxSegmentBuffers)
+	{
+		// insert as the newest buffer, right behind the oldest one
+		SegmentBuffers.Insert(NewBuffer, NextSegmentBuffer);
+		++NextSegmentBuffer;
+	}
+
+	return NewBuffer;
 }
 
 
@@ -249,11 +349,11 @@ void FUdpMessageProcessor::ConsumeOutboundMessages( )
 			for (TMap<FIPv4Endpoint, FNodeInfo>::TIterator It(StaticNodes); It; ++It)
 			{
 				FNodeInfo& NodeInfo = It.Value();
-				NodeInfo.Segmenters.Add(LastSentMessage, MakeShareable(new FUdpMessageSegmenter(OutboundMessage.MessageData.ToSharedRef(), 1024)));
+				NodeInfo.Segmenters.Add(LastSentMessage, MakeShareable(new FUdpMessageSegmenter(OutboundMessage.MessageData.ToSharedRef(), SegmentSize)));
 			}
 		}
 
-		RecipientNodeInfo.Segmenters.Add(LastSentMessage, MakeShareable(new FUdpMessageSegmenter(OutboundMessage.MessageData.ToSharedRef(), 1024)));
+		RecipientNodeInfo.Segmenters.Add(LastSentMessage, MakeShareable(new FUdpMessageSegmenter(OutboundMessage.MessageData.ToSharedRef(), SegmentSize)));
 	}
 }
 
@@ -292,7 +392,41 @@ void FUdpMessageProcessor::ProcessAcknowledgeSegment( FInboundSegment& Segment,
 
 	*Segment.Data << AcknowledgeChunk;
 
-	NodeInfo.Segmenters.Remove(AcknowledgeChunk.MessageId);
+	int32 NumAcknowledged = 0;
+	FTimespan RoundTripTime = FTimespan::Zero();
+
+	// completely received messages
+	for (int32 Index = 0; Index < AcknowledgeChunk.MessageIds.Num(); ++Index)
+	{
+		TSharedPtr<FUdpMessageSegmenter> Segmenter = NodeInfo.Segmenters.FindRef(AcknowledgeChunk.MessageIds[Index]);
+
+		if (Segmenter.IsValid())
+		{
+			NumAcknowledged += Segmenter->MarkAsAcknowledged();
+			NodeInfo.Segmenters.Remove(AcknowledgeChunk.MessageIds[Index]);
+		}
+	}
+
+	// partially received messages
+	for (int32 Index = 0; Index < AcknowledgeChunk.Segments.Num(); ++Index)
+	{
+		const FUdpMessageSegment::FSegmentAcknowledgment& SegmentAcknowledgment = AcknowledgeChunk.Segments[Index];
+		TSharedPtr<FUdpMessageSegmenter> Segmenter = NodeInfo.Segmenters.FindRef(SegmentAcknowledgment.MessageId);
+
+		if (Segmenter.IsValid())
+		{
+			FTimespan SegmentRoundTripTime;
+
+			NumAcknowledged += Segmenter->MarkAsAcknowledged(SegmentAcknowledgment, CurrentTime, SegmentRoundTripTime);
+
+			if ((SegmentRoundTripTime > FTimespan::Zero()) && ((RoundTripTime == FTimespan::Zero()) || (SegmentRoundTripTime < RoundTripTime)))
+			{
+				RoundTripTime = SegmentRoundTripTime;
+			}
+		}
+	}
+
+	NodeInfo.HandleSegmentsAcknowledged(NumAcknowledged, RoundTripTime);
 }
 
 
@@ -324,6 +458,14 @@ void FUdpMessageProcessor::ProcessDataSegment( FInboundSegment& Segment, FNodeIn
 		return;
 	}
 
+	// Discard retransmitted segments of messages that were already delivered, but acknowledge them again
+	if (NodeInfo.ReceivedMessages.Contains(DataChunk.MessageId))
+	{
+		NodeInfo.PendingAcknowledgments.AddUnique(DataChunk.MessageId);
+
+		return;
+	}
+
 	FReassembledUdpMessagePtr& Message = NodeInfo.ReassembledMessages.FindOrAdd(DataChunk.MessageId);
 
 	// Reassemble message
@@ -337,7 +479,8 @@ void FUdpMessageProcessor::ProcessDataSegment( FInboundSegment& Segment, FNodeIn
 	// Deliver or re-sequence message
 	if (Message->IsComplete())
 	{
-		AcknowledgeReceipt(DataChunk.MessageId, NodeInfo);
+		NodeInfo.PendingAcknowledgments.Add(DataChunk.MessageId);
+		NodeInfo.ReceivedMessages.Add(DataChunk.MessageId, CurrentTime);
 
 		if (Message->GetSequence() == 0)
 		{
@@ -441,6 +584,16 @@ void FUdpMessageProcessor::UpdateKnownNodes( )
 		}
 		else
 		{
+			// forget delivered messages once their senders would have given up on retransmitting them
+			for (TMap<int32, FDateTime>::TIterator ReceivedIt(NodeInfo.ReceivedMessages); ReceivedIt; ++ReceivedIt)
+			{
+				if (ReceivedIt.Value() + 2 * DeadHelloTimespan <= CurrentTime)
+				{
+					ReceivedIt.RemoveCurrent();
+				}
+			}
+
+			AcknowledgeReceipts(NodeInfo);
 			UpdateSegmenters(NodeInfo);
 		}
 	}
@@ -464,44 +617,84 @@ void FUdpMessageProcessor::UpdateSegmenters( FNodeInfo& NodeInfo )
 	Header.ProtocolVersion = UDP_MESSAGING_TRANSPORT_PROTOCOL_VERSION;
 	Header.SegmentType = EUdpMessageSegments::Data;
 
-	for (TMap<int32, TSharedPtr<FUdpMessageSegmenter> >::TIterator It2(NodeInfo.Segmenters); It2; ++It2)
+	// multicast and static nodes don't acknowledge segments, so their messages are sent only once
+	const bool Reliable = NodeInfo.NodeId.IsValid();
+	const FTimespan RetransmitTimeout = NodeInfo.GetRetransmitTimeout();
+	const FTimespan StalledTimespan = DeadHelloIntervals * Beacon->GetBeaconInterval();
+
+	int32 LostSegments = 0;
+	int32 SegmentsInFlight = 0;
+
+	// remove finished messages and find lost segments
+	for (TMap<int32, TSharedPtr<FUdpMessageSegmenter> >::TIterator It(NodeInfo.Segmenters); It; ++It)
 	{
-		TSharedPtr<FUdpMessageSegmenter>& Segmenter = It2.Value();
+		TSharedPtr<FUdpMessageSegmenter>& Segmenter = It.Value();
 
 		Segmenter->Initialize();
 
-		if (Segmenter->IsInitialized())
+		if (Segmenter->IsInvalid())
 		{
-			FUdpMessageSegment::FDataChunk DataChunk;
-
-			while (Segmenter->GetNextPendingSegment(DataChunk.Data, DataChunk.SegmentNumber))
+			It.RemoveCurrent();
+		}
+		else if (Reliable && Segmenter->IsInitialized())
+		{
+			if (Segmenter->IsAcknowledged() || ((Segmenter->GetLastProgressTime() != FDateTime::MinValue()) && (Segmenter->GetLastProgressTime() + StalledTimespan <= CurrentTime)))
+			{
+				It.RemoveCurrent();
+			}
+			else
 			{
-				DataChunk.MessageId = It2.Key();
-				DataChunk.MessageSize = Segmenter->GetMessageSize();
-				DataChunk.SegmentOffset = 1024 * DataChunk.SegmentNumber;
-				DataChunk.Sequence = 0;
-				DataChunk.TotalSegments = Segmenter->GetSegmentCount();
+				LostSegments += Segmenter->MarkLostSegments(CurrentTime, RetransmitTimeout);
+				SegmentsInFlight += Segmenter->GetInFlightSegmentsCount();
+			}
+		}
+	}
 
-				FArrayWriter Writer;
+	if (LostSegments > 0)
+	{
+		NodeInfo.HandleSegmentsLost(CurrentTime);
+	}
 
-				Writer << Header;
-				Writer << DataChunk;
+	// send as many pending segments as the congestion window allows
+	int32 SendBudget = Reliable ? (FMath::Trunc(NodeInfo.CongestionWindow) - SegmentsInFlight) : MaxUnreliableSegmentsPerUpdate;
 
-				if (Sender->Send(MakeShareable(new TArray<uint8>(Writer)), NodeInfo.Endpoint))
-				{
-					Segmenter->MarkAsSent(DataChunk.SegmentNumber);
-				}
-				else
-				{
-					return;
-				}
+	FUdpMessageSegment::FDataChunk DataChunk;
+
+	for (TMap<int32, TSharedPtr<FUdpMessageSegmenter> >::TIterator It(NodeInfo.Segmenters); It && (SendBudget > 0); ++It)
+	{
+		TSharedPtr<FUdpMessageSegmenter>& Segmenter = It.Value();
+
+		if (!Segmenter->IsInitialized())
+		{
+			continue;
+		}
+
+		while ((SendBudget > 0) && Segmenter->GetNextPendingSegment(DataChunk.Data, DataChunk.SegmentNumber))
+		{
+			DataChunk.MessageId = It.Key();
+			DataChunk.MessageSize = Segmenter->GetMessageSize();
+			DataChunk.SegmentOffset = SegmentSize * DataChunk.SegmentNumber;
+			DataChunk.Sequence = 0;
+			DataChunk.TotalSegments = Segmenter->GetSegmentCount();
+
+			TSharedRef<TArray<uint8>, ESPMode::ThreadSafe> Buffer = AcquireSegmentBuffer();
+			FMemoryWriter Writer(*Buffer);
+
+			Writer << Header;
+			Writer << DataChunk;
+
+			if (!Sender->Send(Buffer, NodeInfo.Endpoint))
+			{
+				return;
 			}
 
-			It2.RemoveCurrent();
+			Segmenter->MarkAsSent(DataChunk.SegmentNumber, CurrentTime);
+			--SendBudget;
 		}
-		else if (Segmenter->IsInvalid())
+
+		if (!Reliable && Segmenter->IsComplete())
 		{
-			It2.RemoveCurrent();
+			It.RemoveCurrent();
 		}
 	}
 }
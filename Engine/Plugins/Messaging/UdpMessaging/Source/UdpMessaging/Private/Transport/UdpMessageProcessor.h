@@ -16,36 +16,98 @@ class FUdpMessageProcessor
 	// Structure for known remote endpoints.
 	struct FNodeInfo
 	{
+		// Holds the congestion window, in segments.
+		float CongestionWindow;
+
 		// Holds the node's IP endpoint.
 		FIPv4Endpoint Endpoint;
 
+		// Holds the time at which the congestion window was last reduced due to segment loss.
+		FDateTime LastLossTime;
+
 		// Holds the time at which the last Hello was received.
 		FDateTime LastSegmentReceivedTime;
 
 		// Holds the endpoint's node identifier.
 		FGuid NodeId;
 
+		// Holds the identifiers of completely received messages that haven't been acknowledged yet.
+		TArray<int32> PendingAcknowledgments;
+
 		// Holds the collection of reassembled messages.
 		TMap<int32, FReassembledUdpMessagePtr> ReassembledMessages;
 
+		// Holds the identifiers and completion times of recently received messages (to drop duplicates).
+		TMap<int32, FDateTime> ReceivedMessages;
+
 		// Holds the message resequencer.
 		FUdpMessageResequencer Resequencer;
 
+		// Holds the smoothed round trip time.
+		FTimespan RoundTripTime;
+
 		// Holds the collection of message segmenters.
 		TMap<int32, TSharedPtr<FUdpMessageSegmenter> > Segmenters;
 
+		// Holds the congestion window size at which slow start ends.
+		float SlowStartThreshold;
+
 		// Default constructor.
 		FNodeInfo( )
-			: LastSegmentReceivedTime(FDateTime::MinValue())
+			: CongestionWindow(InitialCongestionWindow)
+			, LastLossTime(FDateTime::MinValue())
+			, LastSegmentReceivedTime(FDateTime::MinValue())
 			, NodeId()
+			, RoundTripTime(FTimespan::FromMilliseconds(100.0))
+			, SlowStartThreshold(MaxCongestionWindow)
 		{ }
 
+		// Gets the time after which an unacknowledged segment is considered lost.
+		FTimespan GetRetransmitTimeout( ) const
+		{
+			// allow for acknowledgments being batched once per tick on either side
+			FTimespan Timeout = RoundTripTime * 2.0f + FTimespan::FromMilliseconds(20.0);
+
+			return (Timeout < MinRetransmitTimeout) ? MinRetransmitTimeout : Timeout;
+		}
+
+		// Grows the congestion window for the given number of acknowledged segments.
+		void HandleSegmentsAcknowledged( int32 NumSegments, const FTimespan& RoundTripSample )
+		{
+			if (RoundTripSample > FTimespan::Zero())
+			{
+				RoundTripTime = FTimespan((RoundTripTime.GetTicks() * 7 + RoundTripSample.GetTicks()) / 8);
+			}
+
+			for (int32 Index = 0; Index < NumSegments; ++Index)
+			{
+				// exponential growth during slow start, linear growth afterwards
+				CongestionWindow += (CongestionWindow < SlowStartThreshold) ? 1.0f : (1.0f / CongestionWindow);
+			}
+
+			CongestionWindow = FMath::Min(CongestionWindow, MaxCongestionWindow);
+		}
+
+		// Shrinks the congestion window after segments were lost.
+		void HandleSegmentsLost( const FDateTime& CurrentTime )
+		{
+			// only react once per round trip, as all segments in flight are likely to be lost together
+			if (LastLossTime + RoundTripTime <= CurrentTime)
+			{
+				SlowStartThreshold = FMath::Max(CongestionWindow * 0.5f, MinCongestionWindow);
+				CongestionWindow = SlowStartThreshold;
+				LastLossTime = CurrentTime;
+			}
+		}
+
 		// Resets the endpoint info.
 		void ResetIfRestarted( const FGuid& NewNodeId )
 		{
 			if (NewNodeId != NodeId)
 			{
+				PendingAcknowledgments.Reset();
 				ReassembledMessages.Reset();
+				ReceivedMessages.Reset();
 				Resequencer.Reset();
 
 				NodeId = NewNodeId;
@@ -177,14 +239,20 @@ public:
 protected:
 
 	/**
-	 * Acknowledges receipt of a message.
+	 * Sends the acknowledgments for all messages and segments received from a node since the last update.
+	 *
+	 * @param NodeInfo - Details for the node to send the acknowledgments to.
+	 */
+	void AcknowledgeReceipts( FNodeInfo& NodeInfo );
+
+	/**
+	 * Gets a buffer for an outbound segment.
 	 *
-	 * @param MessageId - The identifier of the message to acknowledge.
-	 * @param NodeInfo - Details for the node to send the acknowledgment to.
+	 * Buffers are recycled once the socket sender has released them.
 	 *
-	 * @todo gmp: batch multiple of these into a single message
+	 * @return An empty buffer.
 	 */
-	void AcknowledgeReceipt( int32 MessageId, const FNodeInfo& NodeInfo );
+	TSharedRef<TArray<uint8>, ESPMode::ThreadSafe> AcquireSegmentBuffer( );
 
 	/**
 	 * Calculates the time span that the thread should wait for work.
@@ -333,6 +401,12 @@ private:
 	// Holds the local node identifier.
 	FGuid LocalNodeId;
 
+	// Holds the index of the oldest buffer in the segment buffer pool.
+	int32 NextSegmentBuffer;
+
+	// Holds a pool of reusable outbound segment buffers.
+	TArray<TSharedPtr<TArray<uint8>, ESPMode::ThreadSafe> > SegmentBuffers;
+
 	// Holds the multicast endpoint.
 	FIPv4Endpoint MulticastEndpoint;
 
@@ -369,4 +443,25 @@ private:
 
 	// Defines the maximum number of Hello segments that can be dropped before a remote endpoint is considered dead.
 	static const int32 DeadHelloIntervals;
+
+	// Defines the initial congestion window, in segments.
+	static const float InitialCongestionWindow;
+
+	// Defines the maximum congestion window, in segments.
+	static const float MaxCongestionWindow;
+
+	// Defines the maximum number of pooled segment buffers.
+	static const int32 MaxSegmentBuffers;
+
+	// Defines the maximum number of segments sent per update to nodes that don't acknowledge (multicast & static).
+	static const int32 MaxUnreliableSegmentsPerUpdate;
+
+	// Defines the minimum congestion window, in segments.
+	static const float MinCongestionWindow;
+
+	// Defines the minimum time after which an unacknowledged segment is considered lost.
+	static const FTimespan MinRetransmitTimeout;
+
+	// Defines the size of message data segments.
+	static const uint16 SegmentSize;
 };
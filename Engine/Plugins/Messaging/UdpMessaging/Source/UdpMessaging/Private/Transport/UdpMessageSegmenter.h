@@ -11,7 +11,8 @@
  * Implements a message segmenter.
  *
  * This class breaks up a message into smaller sized segments that fit into UDP datagrams.
- * It also tracks the segments that still need to be sent.
+ * It also tracks the segments that still need to be sent, the segments that are in flight
+ * and the segments that have been acknowledged by the recipient.
  */
 class FUdpMessageSegmenter
 {
@@ -21,7 +22,10 @@ public:
 	 * Default constructor.
 	 */
 	FUdpMessageSegmenter( )
-		: MessageReader(NULL)
+		: AcknowledgedSegmentsCount(0)
+		, CumulativeSegment(0)
+		, MessageReader(NULL)
+		, PendingSegmentsCount(0)
 	{ }
 
 	/**
@@ -30,8 +34,12 @@ public:
 	 * @param InMessage - The message to segment.
 	 */
 	FUdpMessageSegmenter(const IMessageDataRef& InMessage, uint16 InSegmentSize)
-		: Message(InMessage)
+		: AcknowledgedSegmentsCount(0)
+		, CumulativeSegment(0)
+		, LastProgressTime(FDateTime::MinValue())
+		, Message(InMessage)
 		, MessageReader(NULL)
+		, PendingSegmentsCount(0)
 		, SegmentSize(InSegmentSize)
 	{ }
 
@@ -48,6 +56,26 @@ public:
 
 public:
 
+	/**
+	 * Gets the number of segments that were sent, but neither acknowledged nor considered lost yet.
+	 *
+	 * @return Number of segments in flight.
+	 */
+	int32 GetInFlightSegmentsCount() const
+	{
+		return PendingSegments.Num() - PendingSegmentsCount - AcknowledgedSegmentsCount;
+	}
+
+	/**
+	 * Gets the time at which a segment was last sent for the first time or acknowledged.
+	 *
+	 * @return Time of last progress, or FDateTime::MinValue() if nothing has been sent yet.
+	 */
+	const FDateTime& GetLastProgressTime() const
+	{
+		return LastProgressTime;
+	}
+
 	/**
 	 * Gets the total size of the message in bytes.
 	 *
@@ -139,9 +167,22 @@ public:
 			MessageReader = Message->CreateReader();
 			PendingSegmentsCount = (MessageReader->TotalSize() + SegmentSize - 1) / SegmentSize;
 			PendingSegments.Init(true, PendingSegmentsCount);
+			AcknowledgedSegments.Init(false, PendingSegmentsCount);
+			RetransmittedSegments.Init(false, PendingSegmentsCount);
+			SentTimes.Init(FDateTime::MinValue(), PendingSegmentsCount);
 		}
 	}
 
+	/**
+	 * Checks whether all segments have been acknowledged by the recipient.
+	 *
+	 * @return true if all segments were acknowledged, false otherwise.
+	 */
+	bool IsAcknowledged() const
+	{
+		return IsInitialized() && (AcknowledgedSegmentsCount == PendingSegments.Num());
+	}
+
 	/**
 	 * Checks whether all segments have been sent.
 	 *
@@ -172,17 +213,87 @@ public:
 		return (Message->GetState() == EMessageDataState::Invalid);
 	}
 
+	/**
+	 * Marks all segments as acknowledged.
+	 *
+	 * @return The number of segments that were newly acknowledged.
+	 */
+	int32 MarkAsAcknowledged()
+	{
+		int32 NumAcknowledged = 0;
+
+		for (int32 Segment = CumulativeSegment; Segment < PendingSegments.Num(); ++Segment)
+		{
+			if (AcknowledgeSegment(Segment))
+			{
+				++NumAcknowledged;
+			}
+		}
+
+		return NumAcknowledged;
+	}
+
+	/**
+	 * Marks the segments in the given acknowledgment as acknowledged.
+	 *
+	 * @param Acknowledgment - The cumulative and selective segment acknowledgment.
+	 * @param CurrentTime - The current time.
+	 * @param OutRoundTripTime - Will hold the shortest round trip time measured, or zero if none could be measured.
+	 *
+	 * @return The number of segments that were newly acknowledged.
+	 */
+	int32 MarkAsAcknowledged(const FUdpMessageSegment::FSegmentAcknowledgment& Acknowledgment, const FDateTime& CurrentTime, FTimespan& OutRoundTripTime)
+	{
+		int32 NumAcknowledged = 0;
+
+		OutRoundTripTime = FTimespan::Zero();
+
+		// cumulative part
+		const int32 Cumulative = FMath::Min<int32>(Acknowledgment.CumulativeSegment, PendingSegments.Num());
+
+		for (int32 Segment = CumulativeSegment; Segment < Cumulative; ++Segment)
+		{
+			if (AcknowledgeSegment(Segment, CurrentTime, OutRoundTripTime))
+			{
+				++NumAcknowledged;
+			}
+		}
+
+		// selective part
+		for (int32 Index = 0; Index < Acknowledgment.Segments.Num(); ++Index)
+		{
+			if ((Acknowledgment.Segments[Index] < PendingSegments.Num()) && AcknowledgeSegment(Acknowledgment.Segments[Index], CurrentTime, OutRoundTripTime))
+			{
+				++NumAcknowledged;
+			}
+		}
+
+		return NumAcknowledged;
+	}
+
 	/**
 	 * Marks the specified segment as sent.
 	 *
 	 * @param Segment - The sent segment.
+	 * @param CurrentTime - The current time.
 	 */
-	void MarkAsSent(uint16 Segment)
+	void MarkAsSent(uint16 Segment, const FDateTime& CurrentTime)
 	{
-		if (Segment < PendingSegments.Num())
+		if ((Segment < PendingSegments.Num()) && PendingSegments[Segment])
 		{
 			PendingSegments[Segment] = false;
 			--PendingSegmentsCount;
+
+			if (SentTimes[Segment] == FDateTime::MinValue())
+			{
+				LastProgressTime = CurrentTime;
+			}
+			else
+			{
+				RetransmittedSegments[Segment] = true;
+			}
+
+			SentTimes[Segment] = CurrentTime;
 		}
 	}
 
@@ -191,7 +302,10 @@ public:
 	 */
 	void MarkForRetransmission()
 	{
-		PendingSegments.Init(true, PendingSegments.Num());
+		for (int32 Segment = CumulativeSegment; Segment < PendingSegments.Num(); ++Segment)
+		{
+			RetransmitSegment(Segment);
+		}
 	}
 
 	/**
@@ -207,13 +321,131 @@ public:
 
 			if (Segment < PendingSegments.Num())
 			{
-				PendingSegments[Segment] = true;
+				RetransmitSegment(Segment);
 			}
 		}
 	}
 
+	/**
+	 * Marks segments that have been in flight for too long for retransmission.
+	 *
+	 * @param CurrentTime - The current time.
+	 * @param Timeout - The time after which an unacknowledged segment is considered lost.
+	 *
+	 * @return The number of segments that were considered lost.
+	 */
+	int32 MarkLostSegments(const FDateTime& CurrentTime, const FTimespan& Timeout)
+	{
+		int32 NumLost = 0;
+
+		for (int32 Segment = CumulativeSegment; Segment < PendingSegments.Num(); ++Segment)
+		{
+			if (!PendingSegments[Segment] && !AcknowledgedSegments[Segment] && (SentTimes[Segment] + Timeout <= CurrentTime))
+			{
+				RetransmitSegment(Segment);
+				++NumLost;
+			}
+		}
+
+		return NumLost;
+	}
+
+protected:
+
+	/**
+	 * Marks a single segment as acknowledged.
+	 *
+	 * @param Segment - The segment to acknowledge.
+	 *
+	 * @return true if the segment was newly acknowledged, false otherwise.
+	 */
+	bool AcknowledgeSegment(int32 Segment)
+	{
+		if (AcknowledgedSegments[Segment])
+		{
+			return false;
+		}
+
+		if (PendingSegments[Segment])
+		{
+			PendingSegments[Segment] = false;
+			--PendingSegmentsCount;
+		}
+
+		AcknowledgedSegments[Segment] = true;
+		++AcknowledgedSegmentsCount;
+
+		while ((CumulativeSegment < AcknowledgedSegments.Num()) && AcknowledgedSegments[CumulativeSegment])
+		{
+			++CumulativeSegment;
+		}
+
+		return true;
+	}
+
+	/**
+	 * Marks a single segment as acknowledged and measures its round trip time.
+	 *
+	 * Retransmitted segments are not measured, because it is ambiguous which transmission was acknowledged.
+	 *
+	 * @param Segment - The segment to acknowledge.
+	 * @param CurrentTime - The current time.
+	 * @param InOutRoundTripTime - Holds the shortest round trip time measured so far (zero = none).
+	 *
+	 * @return true if the segment was newly acknowledged, false otherwise.
+	 */
+	bool AcknowledgeSegment(int32 Segment, const FDateTime& CurrentTime, FTimespan& InOutRoundTripTime)
+	{
+		const bool WasInFlight = !PendingSegments[Segment] && (SentTimes[Segment] != FDateTime::MinValue());
+
+		if (!AcknowledgeSegment(Segment))
+		{
+			return false;
+		}
+
+		LastProgressTime = CurrentTime;
+
+		if (WasInFlight && !RetransmittedSegments[Segment])
+		{
+			FTimespan RoundTripTime = CurrentTime - SentTimes[Segment];
+
+			if ((InOutRoundTripTime == FTimespan::Zero()) || (RoundTripTime < InOutRoundTripTime))
+			{
+				InOutRoundTripTime = RoundTripTime;
+			}
+		}
+
+		return true;
+	}
+
+	/**
+	 * Marks a single unacknowledged segment for retransmission.
+	 *
+	 * @param Segment - The segment to retransmit.
+	 */
+	void RetransmitSegment(int32 Segment)
+	{
+		if (!PendingSegments[Segment] && !AcknowledgedSegments[Segment])
+		{
+			PendingSegments[Segment] = true;
+			++PendingSegmentsCount;
+		}
+	}
+
 private:
 
+	// Holds an array of bits that indicate which segments have been acknowledged.
+	TBitArray<> AcknowledgedSegments;
+
+	// Holds the number of segments that have been acknowledged.
+	uint16 AcknowledgedSegmentsCount;
+
+	// Holds the number of the first segment that hasn't been acknowledged yet.
+	uint16 CumulativeSegment;
+
+	// Holds the time at which a segment was last sent for the first time or acknowledged.
+	FDateTime LastProgressTime;
+
 	// Holds the message.
 	IMessageDataPtr Message;
 
@@ -226,6 +458,12 @@ private:
 	// Holds the number of segments that haven't been sent yet.
 	uint16 PendingSegmentsCount;
 
+	// Holds an array of bits that indicate which segments have been sent more than once.
+	TBitArray<> RetransmittedSegments;
+
 	// Holds the segment size.
 	uint16 SegmentSize;
+
+	// Holds the times at which the segments were last sent.
+	TArray<FDateTime> SentTimes;
 };
@@ -128,15 +128,61 @@ namespace FUdpMessageSegment
 	};
 
 
+	/**
+	 * Structure for the segment acknowledgments of a message that is still being received.
+	 */
+	struct FSegmentAcknowledgment
+	{
+		/**
+		 * Holds the identifier of the message that the segments belong to.
+		 */
+		int32 MessageId;
+
+		/**
+		 * Holds the number of the first segment that hasn't been received yet (all segments below it were received).
+		 */
+		uint16 CumulativeSegment;
+
+		/**
+		 * Holds the segments above the cumulative segment that were received since the last acknowledgment.
+		 */
+		TArray<uint16> Segments;
+
+
+	public:
+
+		/**
+		 * Serializes the given acknowledgment from or into the specified archive.
+		 *
+		 * @param Ar - The archive to serialize from or into.
+		 * @param Acknowledgment - The acknowledgment to serialize.
+		 *
+		 * @return The archive.
+		 */
+		friend FArchive& operator<< (FArchive& Ar, FSegmentAcknowledgment& Acknowledgment)
+		{
+			return Ar << Acknowledgment.MessageId << Acknowledgment.CumulativeSegment << Acknowledgment.Segments;
+		}
+	};
+
+
 	/**
 	 * Structure for the header of Acknowledge segments.
+	 *
+	 * A recipient sends at most one Acknowledge segment per sender and processor tick, which
+	 * batches the acknowledgments for all messages and message segments received during the tick.
 	 */
 	struct FAcknowledgeChunk
 	{
 		/** 
-		 * Holds the identifier of the message that was received successfully.
+		 * Holds the identifiers of the messages that were received successfully.
 		 */
-		int32 MessageId;
+		TArray<int32> MessageIds;
+
+		/**
+		 * Holds the acknowledgments for segments of messages that are still being received.
+		 */
+		TArray<FSegmentAcknowledgment> Segments;
 
 
 	public:
@@ -151,7 +197,7 @@ namespace FUdpMessageSegment
 		 */
 		friend FArchive& operator<< (FArchive& Ar, FAcknowledgeChunk& Header)
 		{
-			return Ar << Header.MessageId;
+			return Ar << Header.MessageIds << Header.Segments;
 		}
 	};
 
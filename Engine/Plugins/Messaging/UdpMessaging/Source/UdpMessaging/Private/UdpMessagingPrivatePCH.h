@@ -30,7 +30,7 @@
 /**
  * Defines the protocol version of the UDP message transport.
  */
-#define UDP_MESSAGING_TRANSPORT_PROTOCOL_VERSION 9
+#define UDP_MESSAGING_TRANSPORT_PROTOCOL_VERSION 10
 
 
 /* Private includes
@@ -16,6 +16,8 @@
 // * ComputeNewVerts() is moving the vert
 // * SetAttributeWeights() should be called to define weight for UV/color/pos
 // * Magic numbers: "degreeLimit"  is number of adjacent triangles, unlikely it needs to be tweaked, same for "degreePenalty"
+// * A chain of LODs can be generated in one pass by calling SimplifyMeshProgressive() with decreasing triangle counts and taking an OutputMeshSnapshot() after each
+// * Vertex quadrics are cached once InitCosts() was called, they are computed in parallel and kept up to date after each collapse
 
 
 
@@ -41,13 +43,38 @@ public:
 	void				InitCosts();
 
 	void				SimplifyMesh( float maxError, int minTris );
+	// collapses edges without the final cleanup, can be called repeatedly with decreasing triangle counts
+	void				SimplifyMeshProgressive( float maxError, int minTris );
 
 	int					GetNumVerts() const { return numVerts; }
 	int					GetNumTris() const { return numTris; }
+	// largest cost of all collapses so far, the square of an upper bound for the distance of the verts to the original surface
+	float				GetMaxCollapseCost() const { return maxCollapseCost; }
 
 	void				OutputMesh( T* Verts, uint32* Indexes );
+	// outputs the current mesh without modifying the simplifier, degenerate triangles are skipped
+	// Verts and Indexes need room for 3 * GetNumTris() elements, TriSources (optional) receives the source triangle of each output triangle
+	void				OutputMeshSnapshot( T* Verts, uint32* Indexes, uint32* TriSources, int& OutNumVerts, int& OutNumTris ) const;
 
 protected:
+	// computes the quadrics of a range of verts, called by ParallelForRanges
+	struct FVertQuadricsRange
+	{
+		FVertQuadricsRange( TMeshSimplifier* InSimplifier )
+			: Simplifier( InSimplifier )
+		{}
+
+		void operator()( int FirstVert, int LastVert )
+		{
+			for( int i = FirstVert; i < LastVert; i++ )
+			{
+				Simplifier->vertQuadrics[i] = Simplifier->ComputeQuadric( &Simplifier->sVerts[i] );
+			}
+		}
+
+		TMeshSimplifier*	Simplifier;
+	};
+
 	void				LockVertFlags( uint32 flag );
 	void				UnlockVertFlags( uint32 flag );
 
@@ -66,6 +93,9 @@ protected:
 	void				InitVert( TSimpVert<T>* v );
 
 	QuadricType			GetQuadric( TSimpVert<T>* v );
+	QuadricType			ComputeQuadric( TSimpVert<T>* v );
+	void				InitVertQuadrics();
+	void				UpdateVertQuadric( TSimpVert<T>* v );
 	FQuadric			GetEdgeQuadric( TSimpVert<T>* v );
 
 	// TODO move away from pointers and remove these functions
@@ -100,7 +130,11 @@ protected:
 	int					numVerts;
 	int					numTris;
 
+	float				maxCollapseCost;
+
 	TArray< TSimpEdge<T> >	edges;
+	// cached quadric of each vert, empty until InitCosts()
+	TArray< QuadricType >	vertQuadrics;
 	FHashTable				edgeHash;
 	FBinaryHeap<float>		edgeHeap;
 
@@ -145,6 +179,8 @@ TMeshSimplifier<T, NumAttributes>::TMeshSimplifier( const T* Verts, uint32 NumVe
 	this->numVerts = numSVerts;
 	this->numTris = numSTris;
 
+	maxCollapseCost = 0.0f;
+
 	sVerts = new TSimpVert<T>[ numSVerts ];
 	sTris = new TSimpTri<T>[ numSTris ];
 
@@ -164,13 +200,20 @@ TMeshSimplifier<T, NumAttributes>::TMeshSimplifier( const T* Verts, uint32 NumVe
 
 	GroupVerts();
 
-	int maxEdgeSize = FMath::Min( 3 * numSTris, 3 * numSVerts - 6 );
-	edges.SetNum( maxEdgeSize );
+	// each triangle adds at most 3 edges
+	edges.Reserve( 3 * numSTris );
 	for( int i = 0; i < numSVerts; i++ )
 	{
 		InitVert( &sVerts[i] );
 	}
 
+	// edges are only referenced by pointer once all have been added
+	for( int i = 0; i < edges.Num(); i++ )
+	{
+		edges[i].next = &edges[i];
+		edges[i].prev = &edges[i];
+	}
+
 	GroupEdges();
 
 	edgeHash.Resize( edges.Num() );
@@ -343,8 +386,7 @@ void TMeshSimplifier<T, NumAttributes>::InitVert( TSimpVert<T>* v )
 		if( v0 < v1 )
 		{
 			// add edge
-			edges.AddUninitialized();
-			TSimpEdge<T>& edge = edges.Last();
+			TSimpEdge<T>& edge = *new( edges ) TSimpEdge<T>();
 			edge.v0 = v0;
 			edge.v1 = v1;
 		}
@@ -448,9 +490,23 @@ void TMeshSimplifier<T, NumAttributes>::GroupEdges()
 	}
 }
 
+template< typename T, uint32 NumAttributes >
+void TMeshSimplifier<T, NumAttributes>::InitVertQuadrics()
+{
+	vertQuadrics.Empty( numSVerts );
+	vertQuadrics.AddUninitialized( numSVerts );
+
+	// vert quadrics only read the mesh, so the verts are split between this thread and background tasks
+	const int MinVertsPerTask = 4096;
+	FVertQuadricsRange VertQuadrics( this );
+	ParallelForRanges( numSVerts, VertQuadrics, MinVertsPerTask );
+}
+
 template< typename T, uint32 NumAttributes >
 void TMeshSimplifier<T, NumAttributes>::InitCosts()
 {
+	InitVertQuadrics();
+
 	for( int i = 0; i < edges.Num(); i++ )
 	{
 		float cost = ComputeEdgeCollapseCost( &edges[i] );
@@ -459,7 +515,27 @@ void TMeshSimplifier<T, NumAttributes>::InitCosts()
 }
 
 template< typename T, uint32 NumAttributes >
-TQuadricAttr< NumAttributes > TMeshSimplifier<T, NumAttributes>::GetQuadric( TSimpVert<T>* v )
+FORCEINLINE TQuadricAttr< NumAttributes > TMeshSimplifier<T, NumAttributes>::GetQuadric( TSimpVert<T>* v )
+{
+	if( vertQuadrics.Num() )
+	{
+		return vertQuadrics[ GetVertIndex( v ) ];
+	}
+
+	return ComputeQuadric( v );
+}
+
+template< typename T, uint32 NumAttributes >
+FORCEINLINE void TMeshSimplifier<T, NumAttributes>::UpdateVertQuadric( TSimpVert<T>* v )
+{
+	if( vertQuadrics.Num() )
+	{
+		vertQuadrics[ GetVertIndex( v ) ] = ComputeQuadric( v );
+	}
+}
+
+template< typename T, uint32 NumAttributes >
+TQuadricAttr< NumAttributes > TMeshSimplifier<T, NumAttributes>::ComputeQuadric( TSimpVert<T>* v )
 {
 #if SIMP_CACHE
 	uint32 vertKey = GetVertIndex( v );
@@ -1246,6 +1322,61 @@ void TMeshSimplifier<T, NumAttributes>::Collapse( TSimpEdge<T>* edge )
 
 template< typename T, uint32 NumAttributes >
 void TMeshSimplifier<T, NumAttributes>::SimplifyMesh( float maxError, int minTris )
+{
+	SimplifyMeshProgressive( maxError, minTris );
+
+	// remove degenerate triangles
+	// not sure why this happens
+	for( int i = 0; i < numSTris; i++ ) {
+		TSimpTri<T>* tri = &sTris[i];
+
+		if( tri->TestFlags( SIMP_REMOVED ) )
+			continue;
+
+		const FVector& p0 = tri->verts[0]->GetPos();
+		const FVector& p1 = tri->verts[1]->GetPos();
+		const FVector& p2 = tri->verts[2]->GetPos();
+		const FVector n = ( p2 - p0 ) ^ ( p1 - p0 );
+
+		if( n.SizeSquared() == 0.0f )
+		{
+			numTris--;
+			tri->EnableFlags( SIMP_REMOVED );
+
+			// remove references to tri
+			for( int j = 0; j < 3; j++ ) {
+				TSimpVert<T>* vert = tri->verts[j];
+				vert->adjTris.Remove( tri );
+				// orphaned verts are removed below
+				UpdateVertQuadric( vert );
+			}
+		}
+	}
+
+	// remove orphaned verts
+	for( int i = 0; i < numSVerts; i++ ) {
+		TSimpVert<T>* vert = &sVerts[i];
+
+		if( vert->TestFlags( SIMP_REMOVED ) )
+			continue;
+
+		if( vert->adjTris.Num() == 0 ) {
+			numVerts--;
+			vert->EnableFlags( SIMP_REMOVED );
+
+			// ungroup
+			vert->prev->next = vert->next;
+			vert->next->prev = vert->prev;
+			vert->next = vert;
+			vert->prev = vert;
+		}
+	}
+
+	//common->Printf( "simplified numVerts %i, numTris %i\n", numVerts, numTris );
+}
+
+template< typename T, uint32 NumAttributes >
+void TMeshSimplifier<T, NumAttributes>::SimplifyMeshProgressive( float maxError, int minTris )
 {
 	TSimpVert<T>* v;
 	TSimpEdge<T>* e;
@@ -1258,7 +1389,8 @@ void TMeshSimplifier<T, NumAttributes>::SimplifyMesh( float maxError, int minTri
 		// get the next vertex to collapse
 		uint32 TopIndex = edgeHeap.Top();
 
-		if( edgeHeap.GetKey( TopIndex ) > maxError )
+		const float topCost = edgeHeap.GetKey( TopIndex );
+		if( topCost > maxError )
 		{
 			break;
 		}
@@ -1291,6 +1423,8 @@ void TMeshSimplifier<T, NumAttributes>::SimplifyMesh( float maxError, int minTri
 			continue;
 		}
 
+		maxCollapseCost = FMath::Max( maxCollapseCost, topCost );
+
 		v = top->v0;
 		do {
 			GatherUpdates( v );
@@ -1490,7 +1624,11 @@ void TMeshSimplifier<T, NumAttributes>::SimplifyMesh( float maxError, int minTri
 				vert->next->prev = vert->prev;
 				vert->next = vert;
 				vert->prev = vert;
+				continue;
 			}
+
+			// all triangles that changed are adjacent to an updated vert
+			UpdateVertQuadric( vert );
 		}
 		updateVertsNum = 0;
 		
@@ -1591,48 +1729,6 @@ void TMeshSimplifier<T, NumAttributes>::SimplifyMesh( float maxError, int minTri
 		}
 		updateEdgesNum = 0;
 	}
-
-	// remove degenerate triangles
-	// not sure why this happens
-	for( int i = 0; i < numSTris; i++ ) {
-		TSimpTri<T>* tri = &sTris[i];
-
-		if( tri->TestFlags( SIMP_REMOVED ) )
-			continue;
-
-		const FVector& p0 = tri->verts[0]->GetPos();
-		const FVector& p1 = tri->verts[1]->GetPos();
-		const FVector& p2 = tri->verts[2]->GetPos();
-		const FVector n = ( p2 - p0 ) ^ ( p1 - p0 );
-
-		if( n.SizeSquared() == 0.0f )
-		{
-			numTris--;
-			tri->EnableFlags( SIMP_REMOVED );
-
-			// remove references to tri
-			for( int j = 0; j < 3; j++ ) {
-				TSimpVert<T>* vert = tri->verts[j];
-				vert->adjTris.Remove( tri );
-				// orphaned verts are removed below
-			}
-		}
-	}
-
-	// remove orphaned verts
-	for( int i = 0; i < numSVerts; i++ ) {
-		TSimpVert<T>* vert = &sVerts[i];
-
-		if( vert->TestFlags( SIMP_REMOVED ) )
-			continue;
-
-		if( vert->adjTris.Num() == 0 ) {
-			numVerts--;
-			vert->EnableFlags( SIMP_REMOVED );
-		}
-	}
-
-	//common->Printf( "simplified numVerts %i, numTris %i\n", numVerts, numTris );
 }
 
 template< typename T, uint32 NumAttributes >
@@ -1688,4 +1784,61 @@ void TMeshSimplifier<T, NumAttributes>::OutputMesh( T* verts, uint32* indexes )
 	
 	numVerts = numV;
 	numTris = numI / 3;
-}
\ No newline at end of file
+}
+
+template< typename T, uint32 NumAttributes >
+void TMeshSimplifier<T, NumAttributes>::OutputMeshSnapshot( T* verts, uint32* indexes, uint32* triSources, int& OutNumVerts, int& OutNumTris ) const {
+	FHashTable hashTable( 1024, GetNumVerts() );
+
+	int numV = 0;
+	int numI = 0;
+
+	for( int i = 0; i < numSTris; i++ ) {
+		const TSimpTri<T>& tri = sTris[i];
+
+		if( tri.TestFlags( SIMP_REMOVED ) )
+			continue;
+
+		// degenerates are only removed at the end of SimplifyMesh(), skip them here instead
+		const FVector& p0 = tri.verts[0]->GetPos();
+		const FVector& p1 = tri.verts[1]->GetPos();
+		const FVector& p2 = tri.verts[2]->GetPos();
+		if( ( ( p2 - p0 ) ^ ( p1 - p0 ) ).SizeSquared() == 0.0f )
+			continue;
+
+		if( triSources )
+		{
+			triSources[ numI / 3 ] = i;
+		}
+
+		for( int j = 0; j < 3; j++ )
+		{
+			const TSimpVert<T>* vert = tri.verts[j];
+			checkSlow( !vert->TestFlags( SIMP_REMOVED ) );
+
+			uint32 hash = HashPoint( vert->GetPos() );
+			uint32 f;
+			for( f = hashTable.First( hash ); hashTable.IsValid(f); f = hashTable.Next( f ) )
+			{
+				if( vert->vert == verts[f] )
+					break;
+			}
+			if( !hashTable.IsValid(f) )
+			{
+				hashTable.Add( hash, numV );
+				verts[ numV ] = vert->vert;
+				indexes[ numI++ ] = numV;
+				numV++;
+			}
+			else
+			{
+				indexes[ numI++ ] = f;
+			}
+		}
+	}
+
+	check( numI <= numTris * 3 );
+
+	OutNumVerts = numV;
+	OutNumTris = numI / 3;
+}
@@ -5,6 +5,7 @@
 #include "MeshUtilities.h"
 
 #include "MeshSimplify.h"
+#include "HashTable.h"
 
 class FQuadricSimplifierMeshReductionModule : public IMeshReductionModule
 {
@@ -48,11 +49,22 @@ public:
 
 	bool		operator==(	const VertType& a ) const
 	{
-		return	Position == a.Position &&
-				Normal == a.Normal &&
-				Tangents[0] == a.Tangents[0] &&
-				Tangents[1] == a.Tangents[1] &&
-				TexCoords == a.TexCoords;
+		if(	Position	!= a.Position ||
+			Normal		!= a.Normal ||
+			Tangents[0]	!= a.Tangents[0] ||
+			Tangents[1]	!= a.Tangents[1] )
+		{
+			return false;
+		}
+
+		for( uint32 i = 0; i < NumTexCoords; i++ )
+		{
+			if( TexCoords[i] != a.TexCoords[i] )
+			{
+				return false;
+			}
+		}
+		return true;
 	}
 
 	VertType	operator+( const VertType& a ) const
@@ -112,7 +124,7 @@ class FQuadricSimplifierMeshReduction : public IMeshReduction
 public:
 	virtual const FString& GetVersionString() const OVERRIDE
 	{
-		static FString Version = TEXT("1.0");
+		static FString Version = TEXT("1.1");
 		return Version;
 	}
 
@@ -121,241 +133,304 @@ public:
 		float& OutMaxDeviation,
 		const FRawMesh& InMesh,
 		const FMeshReductionSettings& InSettings
-		)
+		) OVERRIDE
 	{
-#if 0
-		TMap<int32,int32> FinalVerts;
-		TArray<int32> DupVerts;
-		int32 NumFaces = InMesh.WedgeIndices.Num() / 3;
+		TArray<FRawMesh*> ReducedMeshes;
+		ReducedMeshes.Add(&OutReducedMesh);
+		TArray<FMeshReductionSettings> Settings;
+		Settings.Add(InSettings);
+		TArray<float> MaxDeviations;
+
+		ReduceLODChain(ReducedMeshes, MaxDeviations, InMesh, Settings);
+		OutMaxDeviation = MaxDeviations[0];
+	}
+
+	virtual void ReduceLODChain(
+		const TArray<FRawMesh*>& OutReducedMeshes,
+		TArray<float>& OutMaxDeviations,
+		const FRawMesh& InMesh,
+		const TArray<FMeshReductionSettings>& InSettings
+		) OVERRIDE
+	{
+		check(OutReducedMeshes.Num() == InSettings.Num());
+
+		OutMaxDeviations.Empty(InSettings.Num());
+		OutMaxDeviations.AddZeroed(InSettings.Num());
 
-		// Process each face, build vertex buffer and per-section index buffers.
-		for(int32 FaceIndex = 0; FaceIndex < NumFaces; FaceIndex++)
+		int32 NumTexCoords = 1;
+		while (NumTexCoords < MAX_MESH_TEXTURE_COORDS && InMesh.WedgeTexCoords[NumTexCoords].Num() == InMesh.WedgeIndices.Num())
 		{
-			int32 VertexIndices[3];
-			FVector CornerPositions[3];
+			NumTexCoords++;
+		}
 
-			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
-			{
-				CornerPositions[CornerIndex] = InMesh.VertexPositions[ InMesh.WedgeIndices[ FaceIndex * 3 + CornerIndex ] ];
-			}
+		switch (NumTexCoords)
+		{
+		case 1:		ReduceLODChainTempl<1>(OutReducedMeshes, OutMaxDeviations, InMesh, InSettings); break;
+		case 2:		ReduceLODChainTempl<2>(OutReducedMeshes, OutMaxDeviations, InMesh, InSettings); break;
+		case 3:		ReduceLODChainTempl<3>(OutReducedMeshes, OutMaxDeviations, InMesh, InSettings); break;
+		default:	ReduceLODChainTempl<4>(OutReducedMeshes, OutMaxDeviations, InMesh, InSettings); break;
+		}
+	}
 
-			// Don't process degenerate triangles.
-			if( PointsEqual(CornerPositions[0],CornerPositions[1], ComparisonThreshold) ||
-				PointsEqual(CornerPositions[1],CornerPositions[2], ComparisonThreshold) ||
-				PointsEqual(CornerPositions[2],CornerPositions[0], ComparisonThreshold) )
-			{
-				continue;
-			}
+	virtual bool ReduceSkeletalMesh(
+		USkeletalMesh* SkeletalMesh,
+		int32 LODIndex,
+		const FSkeletalMeshOptimizationSettings& Settings,
+		bool bCalcLODDistance
+		)
+	{
+		return false;
+	}
 
-			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
-			{
-				int32 WedgeIndex = FaceIndex * 3 + CornerIndex;
-				FStaticMeshBuildVertex ThisVertex = BuildStaticMeshVertex(InMesh, WedgeIndex);
+	static FQuadricSimplifierMeshReduction* Create()
+	{
+		return new FQuadricSimplifierMeshReduction;
+	}
 
-				int32 Index = INDEX_NONE;
-				for (int32 k = 0; k < DupVerts.Num(); k++)
-				{
-					if (DupVerts[k] >= WedgeIndex)
-					{
-						// the verts beyond me haven't been placed yet, so these duplicates are not relevant
-						break;
-					}
+private:
+	/**
+	 * Returns the quadric error a level of detail may reach. The position part of the error is the sum of squared distances
+	 * to the original planes around a vert, so the square of MaxDeviation bounds the distance to each of them.
+	 */
+	static float GetMaxQuadricError(const FMeshReductionSettings& Settings)
+	{
+		// collapses that would flip triangles are penalized far above this
+		const float MaxQuadricError = 200000.0f;
+		return Settings.MaxDeviation > 0.0f ? FMath::Min(FMath::Square(Settings.MaxDeviation), MaxQuadricError) : MaxQuadricError;
+	}
 
-					int32 *Location = FinalVerts.Find(DupVerts[k]);
-					if (Location != NULL
-						&& AreVerticesEqual(ThisVertex, OutVertices[*Location], ComparisonThreshold))
-					{
-						Index = *Location;
-						break;
-					}
-				}
-				if (Index == INDEX_NONE)
-				{
-					Index = OutVertices.Add(ThisVertex);
-					FinalVerts.Add(WedgeIndex,Index);
-				}
-				VertexIndices[CornerIndex] = Index;
-			}
+	/**
+	 * Reduces the mesh to all requested levels of detail in one progressive pass. The simplifier is set up once
+	 * and the mesh is snapshotted whenever the triangle count or the error limit of the next level of detail has been reached.
+	 * The reported deviation is the square root of the largest collapse cost, an upper bound for the distance to the original surface.
+	 */
+	template< uint32 NumTexCoords >
+	void ReduceLODChainTempl(
+		const TArray<FRawMesh*>& OutReducedMeshes,
+		TArray<float>& OutMaxDeviations,
+		const FRawMesh& InMesh,
+		const TArray<FMeshReductionSettings>& InSettings
+		)
+	{
+		typedef TVertSimp< NumTexCoords > VertType;
+		const uint32 NumAttributes = ( sizeof( VertType ) - sizeof( FVector ) ) / sizeof(float);
 
-			// Reject degenerate triangles.
-			if( VertexIndices[0] == VertexIndices[1] ||
-				VertexIndices[1] == VertexIndices[2] ||
-				VertexIndices[2] == VertexIndices[0] )
-			{
-				continue;
-			}
+		TArray< VertType > Verts;
+		TArray< uint32 > Indexes;
+		TArray< int32 > SourceFaces;
+		CreateSimplifierMesh< NumTexCoords >(Verts, Indexes, SourceFaces, InMesh);
 
-			// Put the indices in the material index buffer.
-			int32 SectionIndex = FMath::Clamp(RawMesh.FaceMaterialIndices[FaceIndex], 0, OutPerSectionIndices.Num());
-			TArray<uint32>& SectionIndices = OutPerSectionIndices[SectionIndex];
-			for (int32 CornerIndex = 0; CornerIndex < 3; CornerIndex++)
+		if (Indexes.Num() == 0)
+		{
+			for (int32 LODIndex = 0; LODIndex < OutReducedMeshes.Num(); ++LODIndex)
 			{
-				SectionIndices.Add(VertexIndices[CornerIndex]);
+				OutReducedMeshes[LODIndex]->Empty();
 			}
+			return;
 		}
-#endif
 
+		TMeshSimplifier< VertType, NumAttributes >* MeshSimp = new TMeshSimplifier< VertType, NumAttributes >( Verts.GetData(), Verts.Num(), Indexes.GetData(), Indexes.Num() );
 
+		const float AttributeWeights[] =
+		{
+			16.0f, 16.0f, 16.0f,	// Normal
+			0.1f, 0.1f, 0.1f,		// Tangent[0]
+			0.1f, 0.1f, 0.1f,		// Tangent[1]
+			0.5f, 0.5f,				// TexCoord[0]
+			0.5f, 0.5f,				// TexCoord[1]
+			0.5f, 0.5f,				// TexCoord[2]
+			0.5f, 0.5f				// TexCoord[3]
+		};
+		checkAtCompileTime( ARRAY_COUNT( AttributeWeights ) >= NumAttributes, AttributeWeightsTooSmall );
 
+		MeshSimp->SetAttributeWeights( AttributeWeights );
+		MeshSimp->SetBoundaryLocked();
+		MeshSimp->InitCosts();
 
-		uint32 NumVerts = 0;
-		uint32 NumIndexes = 0;
+		// Simplify towards the smallest triangle count and the largest error, snapshotting each level of detail on the way.
+		const int32 NumTris = Indexes.Num() / 3;
+		TArray<int32> LODOrder;
+		for (int32 LODIndex = 0; LODIndex < InSettings.Num(); ++LODIndex)
+		{
+			LODOrder.Add(LODIndex);
+		}
+		struct FCompareTargetTriangles
+		{
+			const TArray<FMeshReductionSettings>& Settings;
+			FCompareTargetTriangles(const TArray<FMeshReductionSettings>& InSettings) : Settings(InSettings) {}
+			bool operator()(int32 A, int32 B) const
+			{
+				if (Settings[A].PercentTriangles != Settings[B].PercentTriangles)
+				{
+					return Settings[A].PercentTriangles > Settings[B].PercentTriangles;
+				}
+				return GetMaxQuadricError(Settings[A]) < GetMaxQuadricError(Settings[B]);
+			}
+		};
+		LODOrder.Sort(FCompareTargetTriangles(InSettings));
 
-		TVertSimp<1>* Verts = new TVertSimp<1>[ NumVerts ];
+		for (int32 OrderIndex = 0; OrderIndex < LODOrder.Num(); ++OrderIndex)
+		{
+			const int32 LODIndex = LODOrder[OrderIndex];
+			const int32 TargetTris = (int32)(NumTris * FMath::Clamp(InSettings[LODIndex].PercentTriangles, 0.0f, 1.0f));
 
+			MeshSimp->SimplifyMeshProgressive( GetMaxQuadricError(InSettings[LODIndex]), TargetTris );
+			OutMaxDeviations[LODIndex] = FMath::Sqrt( MeshSimp->GetMaxCollapseCost() );
 
-#if 0
-		int32 NumVertices = InMesh.VertexPositions.Num();
-		int32 NumWedges = InMesh.WedgeIndices.Num();
-		int32 NumTris = NumWedges / 3;
+			int32 MaxOutputVerts = MeshSimp->GetNumTris() * 3;
+			TArray< VertType > OutVerts;
+			TArray< uint32 > OutIndexes;
+			TArray< uint32 > OutTriSources;
+			OutVerts.AddUninitialized(MaxOutputVerts);
+			OutIndexes.AddUninitialized(MaxOutputVerts);
+			OutTriSources.AddUninitialized(MeshSimp->GetNumTris());
 
-		if (NumWedges == 0)
-		{
-			return NULL;
+			int OutNumVerts = 0;
+			int OutNumTris = 0;
+			MeshSimp->OutputMeshSnapshot( OutVerts.GetData(), OutIndexes.GetData(), OutTriSources.GetData(), OutNumVerts, OutNumTris );
+
+			CreateRawMeshFromSimplifierMesh< NumTexCoords >(*OutReducedMeshes[LODIndex], OutVerts.GetData(), OutNumVerts, OutIndexes.GetData(), OutTriSources.GetData(), OutNumTris, SourceFaces, InMesh);
 		}
 
-		for(int32 TexCoordIndex = 0; TexCoordIndex < MAX_MESH_TEXTURE_COORDS; ++TexCoordIndex)
+		delete MeshSimp;
+	}
+
+	/**
+	 * Converts the wedges of a raw mesh to unique simplifier verts. Triangles with coincident corners are skipped,
+	 * as every vert given to the simplifier must be referenced by a proper triangle.
+	 */
+	template< uint32 NumTexCoords >
+	static void CreateSimplifierMesh(
+		TArray< TVertSimp< NumTexCoords > >& OutVerts,
+		TArray< uint32 >& OutIndexes,
+		TArray< int32 >& OutSourceFaces,
+		const FRawMesh& InMesh
+		)
+	{
+		const int32 NumWedges = InMesh.WedgeIndices.Num();
+		const int32 NumFaces = NumWedges / 3;
+		const bool bHasNormals = InMesh.WedgeTangentZ.Num() == NumWedges;
+		const bool bHasTangents = InMesh.WedgeTangentX.Num() == NumWedges && InMesh.WedgeTangentY.Num() == NumWedges;
+
+		OutVerts.Empty(NumWedges);
+		OutIndexes.Empty(NumWedges);
+		OutSourceFaces.Empty(NumFaces);
+
+		FHashTable HashTable( 4096, NumWedges );
+
+		for (int32 FaceIndex = 0; FaceIndex < NumFaces; ++FaceIndex)
 		{
-			if (RawMesh.WedgeTexCoords[TexCoordIndex].Num() == NumWedges)
+			TVertSimp< NumTexCoords > Corners[3];
+			for (int32 CornerIndex = 0; CornerIndex < 3; ++CornerIndex)
 			{
-				GeometryData->AddTexCoords(TexCoordIndex);
-				SimplygonSDK::spRealArray TexCoords = GeometryData->GetTexCoords(TexCoordIndex);
-				check(TexCoords->GetTupleSize() == 2);
-				for (int32 WedgeIndex = 0; WedgeIndex < NumWedges; ++WedgeIndex)
+				const int32 WedgeIndex = FaceIndex * 3 + CornerIndex;
+				TVertSimp< NumTexCoords >& Corner = Corners[CornerIndex];
+
+				Corner.Position = InMesh.VertexPositions[InMesh.WedgeIndices[WedgeIndex]];
+				Corner.Normal = bHasNormals ? InMesh.WedgeTangentZ[WedgeIndex] : FVector::ZeroVector;
+				Corner.Tangents[0] = bHasTangents ? InMesh.WedgeTangentX[WedgeIndex] : FVector::ZeroVector;
+				Corner.Tangents[1] = bHasTangents ? InMesh.WedgeTangentY[WedgeIndex] : FVector::ZeroVector;
+				for (uint32 TexCoordIndex = 0; TexCoordIndex < NumTexCoords; ++TexCoordIndex)
 				{
-					TexCoords->SetTuple(WedgeIndex, (float*)&RawMesh.WedgeTexCoords[TexCoordIndex][WedgeIndex]);
+					Corner.TexCoords[TexCoordIndex] = InMesh.WedgeTexCoords[TexCoordIndex][WedgeIndex];
 				}
 			}
-		}
 
-		if (RawMesh.WedgeColors.Num() == NumWedges)
-		{
-			GeometryData->AddColors(0);
-			SimplygonSDK::spRealArray LinearColors = GeometryData->GetColors(0);
-			check(LinearColors);
-			check(LinearColors->GetTupleSize() == 4);
-			for (int32 WedgeIndex = 0; WedgeIndex < NumWedges; ++WedgeIndex)
+			if (Corners[0].Position == Corners[1].Position
+				|| Corners[1].Position == Corners[2].Position
+				|| Corners[2].Position == Corners[0].Position)
 			{
-				FLinearColor LinearColor(RawMesh.WedgeColors[WedgeIndex]);
-				LinearColors->SetTuple(WedgeIndex, (float*)&LinearColor);
+				continue;
 			}
-		}
 
-		if (InMesh.WedgeTangentZ.Num() == NumWedges)
-		{
-			if (InMesh.WedgeTangentX.Num() == NumWedges && InMesh.WedgeTangentY.Num() == NumWedges)
+			// Weld wedges with identical attributes so the simplifier sees a connected mesh.
+			for (int32 CornerIndex = 0; CornerIndex < 3; ++CornerIndex)
 			{
-				GeometryData->AddTangents(0);
-				SimplygonSDK::spRealArray Tangents = GeometryData->GetTangents(0);
-				for (int32 WedgeIndex = 0; WedgeIndex < NumWedges; ++WedgeIndex)
+				const TVertSimp< NumTexCoords >& Corner = Corners[CornerIndex];
+				const uint32 Hash = FCrc::MemCrc32(&Corner.Position, sizeof(FVector));
+
+				uint32 VertIndex;
+				for (VertIndex = HashTable.First(Hash); HashTable.IsValid(VertIndex); VertIndex = HashTable.Next(VertIndex))
 				{
-					Tangents->SetTuple(WedgeIndex, (float*)&RawMesh.WedgeTangentX[WedgeIndex]);
+					if (OutVerts[VertIndex] == Corner)
+					{
+						break;
+					}
 				}
-
-				GeometryData->AddBitangents(0);
-				SimplygonSDK::spRealArray Bitangents = GeometryData->GetBitangents(0);
-				for (int32 WedgeIndex = 0; WedgeIndex < NumWedges; ++WedgeIndex)
+				if (!HashTable.IsValid(VertIndex))
 				{
-					Bitangents->SetTuple(WedgeIndex, (float*)&RawMesh.WedgeTangentY[WedgeIndex]);
+					VertIndex = OutVerts.Add(Corner);
+					HashTable.Add(Hash, VertIndex);
 				}
+				OutIndexes.Add(VertIndex);
 			}
-			GeometryData->AddNormals();
-			SimplygonSDK::spRealArray Normals = GeometryData->GetNormals();
-			for (int32 WedgeIndex = 0; WedgeIndex < NumWedges; ++WedgeIndex)
-			{
-				Normals->SetTuple(WedgeIndex, (float*)&RawMesh.WedgeTangentZ[WedgeIndex]);
-			}
+			OutSourceFaces.Add(FaceIndex);
 		}
+	}
 
-		// Per-triangle data.
-		/*for (int32 TriIndex = 0; TriIndex < NumTris; ++TriIndex)
-		{
-			MaterialIndices->SetItem(TriIndex, RawMesh.FaceMaterialIndices[TriIndex]);
-			GroupIds->SetItem(TriIndex, RawMesh.FaceSmoothingMasks[TriIndex]);
-		}*/
+	/**
+	 * Creates a raw mesh from the output of the simplifier. Per-face data is taken from the source faces of the triangles.
+	 */
+	template< uint32 NumTexCoords >
+	static void CreateRawMeshFromSimplifierMesh(
+		FRawMesh& OutRawMesh,
+		const TVertSimp< NumTexCoords >* Verts,
+		int32 NumVerts,
+		const uint32* Indexes,
+		const uint32* TriSources,
+		int32 NumTris,
+		const TArray< int32 >& SourceFaces,
+		const FRawMesh& InMesh
+		)
+	{
+		const int32 NumWedges = NumTris * 3;
+		const bool bHasNormals = InMesh.WedgeTangentZ.Num() == InMesh.WedgeIndices.Num();
+		const bool bHasTangents = InMesh.WedgeTangentX.Num() == InMesh.WedgeIndices.Num() && InMesh.WedgeTangentY.Num() == InMesh.WedgeIndices.Num();
 
-		for( uint32 i = 0; i < NumVerts; i++ )
-		{
-			Verts[i].Position		= InMesh.VertexPositions[i];
-			Verts[i].TexCoords[0]	= tri->verts[i].st;
-			Verts[i].Normal			= tri->verts[i].normal;
-			Verts[i].Tangents[0]	= tri->verts[i].tangents[0];
-			Verts[i].Tangents[1]	= tri->verts[i].tangents[1];
-		}
+		OutRawMesh.Empty();
 
-		for( uint32 i = 0; i < NumVerts; i++ )
+		OutRawMesh.VertexPositions.Empty(NumVerts);
+		for (int32 VertIndex = 0; VertIndex < NumVerts; ++VertIndex)
 		{
-			Verts[i].Position.x = 0.0625f * FMath::Round( 16.0f * Verts[i].Position.X );
-			Verts[i].Position.y = 0.0625f * FMath::Round( 16.0f * Verts[i].Position.Y );
-			Verts[i].Position.z = 0.0625f * FMath::Round( 16.0f * Verts[i].Position.Z );
+			OutRawMesh.VertexPositions.Add(Verts[VertIndex].Position);
 		}
 
-		for( uint32 i = 0; i < NumVerts; i++ )
+		OutRawMesh.WedgeIndices.Empty(NumWedges);
+		for (uint32 TexCoordIndex = 0; TexCoordIndex < NumTexCoords; ++TexCoordIndex)
 		{
-			Verts[i].Normal			= InMesh.WedgeTangentZ[i];
-			Verts[i].Tangents[0]	= tri->verts[i].tangents[0];
-			Verts[i].Tangents[1]	= tri->verts[i].tangents[1];
+			OutRawMesh.WedgeTexCoords[TexCoordIndex].Empty(NumWedges);
 		}
-#endif
 
-		uint32* Indexes = new uint32[ NumIndexes ];
-
-		for( uint32 i = 0; i < NumIndexes; i++ )
+		for (int32 WedgeIndex = 0; WedgeIndex < NumWedges; ++WedgeIndex)
 		{
-			 Indexes[i] = InMesh.WedgeIndices[i];
-		}
+			const TVertSimp< NumTexCoords >& Vert = Verts[Indexes[WedgeIndex]];
 
-		const uint32 NumAttributes = ( sizeof( TVertSimp<1> ) - sizeof( FVector ) ) / sizeof(float);
-		TMeshSimplifier< TVertSimp<1>, NumAttributes >* MeshSimp = new TMeshSimplifier< TVertSimp<1>, NumAttributes >( Verts, NumVerts, Indexes, NumIndexes );
+			OutRawMesh.WedgeIndices.Add(Indexes[WedgeIndex]);
+			if (bHasTangents)
+			{
+				OutRawMesh.WedgeTangentX.Add(Vert.Tangents[0]);
+				OutRawMesh.WedgeTangentY.Add(Vert.Tangents[1]);
+			}
+			if (bHasNormals)
+			{
+				OutRawMesh.WedgeTangentZ.Add(Vert.Normal);
+			}
+			for (uint32 TexCoordIndex = 0; TexCoordIndex < NumTexCoords; ++TexCoordIndex)
+			{
+				OutRawMesh.WedgeTexCoords[TexCoordIndex].Add(Vert.TexCoords[TexCoordIndex]);
+			}
+		}
 
-		const float AttributeWeights[] =
+		OutRawMesh.FaceMaterialIndices.Empty(NumTris);
+		OutRawMesh.FaceSmoothingMasks.Empty(NumTris);
+		for (int32 TriIndex = 0; TriIndex < NumTris; ++TriIndex)
 		{
-			16.0f, 16.0f, 16.0f,	// Normal
-			0.1f, 0.1f, 0.1f,		// Tangent[0]
-			0.1f, 0.1f, 0.1f,		// Tangent[1]
-			0.5f, 0.5f,				// TexCoord[0]
-			0.5f, 0.5f,				// TexCoord[1]
-			0.5f, 0.5f,				// TexCoord[2]
-			0.5f, 0.5f				// TexCoord[3]
-		};
-
-		MeshSimp->SetAttributeWeights( AttributeWeights );
-		MeshSimp->SetBoundaryLocked();
-		MeshSimp->InitCosts();
-
-		int32 NumTris = NumIndexes / 3;
-
-		MeshSimp->SimplifyMesh( 200000.0f, NumTris * InSettings.PercentTriangles );
-
-		NumVerts = MeshSimp->GetNumVerts();
-		NumIndexes = MeshSimp->GetNumTris() * 3;
-
-		MeshSimp->OutputMesh( Verts, Indexes );
-		delete MeshSimp;
-
-		delete[] Verts;
-		delete[] Indexes;
-
-	//	CreateRawMeshFromGeometry(OutReducedMesh, GeometryData, WINDING_Keep);
-	//	OutMaxDeviation = ReductionProcessor->GetMaxDeviation();
-	}
-
-	virtual bool ReduceSkeletalMesh(
-		USkeletalMesh* SkeletalMesh,
-		int32 LODIndex,
-		const FSkeletalMeshOptimizationSettings& Settings,
-		bool bCalcLODDistance
-		)
-	{
-		return false;
-	}
-
-	static FQuadricSimplifierMeshReduction* Create()
-	{
-		return new FQuadricSimplifierMeshReduction;
+			const int32 SourceFace = SourceFaces[TriSources[TriIndex]];
+			OutRawMesh.FaceMaterialIndices.Add(InMesh.FaceMaterialIndices[SourceFace]);
+			OutRawMesh.FaceSmoothingMasks.Add(InMesh.FaceSmoothingMasks[SourceFace]);
+		}
 	}
 
-private:
 #if 0
 	SimplygonSDK::spGeometryData CreateGeometryFromRawMesh(const FRawMesh& RawMesh)
 	{
@@ -769,6 +769,9 @@ struct FCompareIndexAndZ
 	FORCEINLINE bool operator()(FIndexAndZ const& A, FIndexAndZ const& B) const { return A.Z < B.Z; }
 };
 
+/** Below this amount of faces per task, the overhead of starting tasks dominates when processing faces with ParallelForRanges. */
+static const int32 MinFacesPerTask = 4096;
+
 static int32 ComputeNumTexCoords(FRawMesh const& RawMesh, int32 MaxSupportedTexCoords)
 {
 	int32 NumWedges = RawMesh.WedgeIndices.Num();
@@ -1000,20 +1003,36 @@ public:
 	}
 };
 
-static void ComputeTriangleTangents(
-	TArray<FVector>& TriangleTangentX,
-	TArray<FVector>& TriangleTangentY,
-	TArray<FVector>& TriangleTangentZ,
-	FRawMesh const& RawMesh,
-	float ComparisonThreshold
-	)
+/** Computes the tangent basis of triangles, each triangle only writes its own entries. */
+class FTriangleTangentsProcessor
 {
-	int32 NumTriangles = RawMesh.WedgeIndices.Num() / 3;
-	TriangleTangentX.Empty(NumTriangles);
-	TriangleTangentY.Empty(NumTriangles);
-	TriangleTangentZ.Empty(NumTriangles);
+public:
+	FTriangleTangentsProcessor(
+		TArray<FVector>& InTriangleTangentX,
+		TArray<FVector>& InTriangleTangentY,
+		TArray<FVector>& InTriangleTangentZ,
+		FRawMesh const& InRawMesh,
+		float InComparisonThreshold
+		)
+		: TriangleTangentX(InTriangleTangentX)
+		, TriangleTangentY(InTriangleTangentY)
+		, TriangleTangentZ(InTriangleTangentZ)
+		, RawMesh(InRawMesh)
+		, ComparisonThreshold(InComparisonThreshold)
+	{
+	}
+
+	/** Processes faces [FirstFace, LastFace), called by ParallelForRanges. */
+	void operator()(int32 FirstFace, int32 LastFace)
+	{
+		for (int32 TriangleIndex = FirstFace; TriangleIndex < LastFace; TriangleIndex++)
+		{
+			ProcessTriangle(TriangleIndex);
+		}
+	}
 
-	for (int32 TriangleIndex = 0;TriangleIndex < NumTriangles; TriangleIndex++)
+private:
+	void ProcessTriangle(int32 TriangleIndex)
 	{
 		int32 UVIndex = 0;
 
@@ -1044,9 +1063,9 @@ static void ComputeTriangleTangents(
 		// Use InverseSlow to catch singular matrices.  InverseSafe can miss this sometimes.
 		const FMatrix TextureToLocal = ParameterToTexture.InverseSlow() * ParameterToLocal;
 
-		TriangleTangentX.Add(TextureToLocal.TransformVector(FVector(1,0,0)).SafeNormal());
-		TriangleTangentY.Add(TextureToLocal.TransformVector(FVector(0,1,0)).SafeNormal());
-		TriangleTangentZ.Add(Normal);
+		TriangleTangentX[TriangleIndex] = TextureToLocal.TransformVector(FVector(1,0,0)).SafeNormal();
+		TriangleTangentY[TriangleIndex] = TextureToLocal.TransformVector(FVector(0,1,0)).SafeNormal();
+		TriangleTangentZ[TriangleIndex] = Normal;
 
 		FVector::CreateOrthonormalBasis(
 			TriangleTangentX[TriangleIndex],
@@ -1055,6 +1074,32 @@ static void ComputeTriangleTangents(
 			);
 	}
 
+	TArray<FVector>& TriangleTangentX;
+	TArray<FVector>& TriangleTangentY;
+	TArray<FVector>& TriangleTangentZ;
+	FRawMesh const& RawMesh;
+	float ComparisonThreshold;
+};
+
+static void ComputeTriangleTangents(
+	TArray<FVector>& TriangleTangentX,
+	TArray<FVector>& TriangleTangentY,
+	TArray<FVector>& TriangleTangentZ,
+	FRawMesh const& RawMesh,
+	float ComparisonThreshold
+	)
+{
+	int32 NumTriangles = RawMesh.WedgeIndices.Num() / 3;
+	TriangleTangentX.Empty(NumTriangles);
+	TriangleTangentY.Empty(NumTriangles);
+	TriangleTangentZ.Empty(NumTriangles);
+	TriangleTangentX.AddUninitialized(NumTriangles);
+	TriangleTangentY.AddUninitialized(NumTriangles);
+	TriangleTangentZ.AddUninitialized(NumTriangles);
+
+	FTriangleTangentsProcessor Processor(TriangleTangentX, TriangleTangentY, TriangleTangentZ, RawMesh, ComparisonThreshold);
+	ParallelForRanges(NumTriangles, Processor, MinFacesPerTask);
+
 	check(TriangleTangentX.Num() == NumTriangles);
 	check(TriangleTangentY.Num() == NumTriangles);
 	check(TriangleTangentZ.Num() == NumTriangles);
@@ -1062,6 +1107,8 @@ static void ComputeTriangleTangents(
 
 /**
  * Create a table that maps the corner of each face to its overlapping corners.
+ * Corners are bucketed in a uniform grid with cells at least twice the comparison threshold wide,
+ * so each corner only needs to be compared against the corners in at most 2x2x2 neighboring cells.
  * @param OutOverlappingCorners - Maps a corner index to the indices of all overlapping corners.
  * @param RawMesh - The mesh for which to compute overlapping corners.
  */
@@ -1072,36 +1119,78 @@ static void FindOverlappingCorners(
 	)
 {
 	int32 NumWedges = RawMesh.WedgeIndices.Num();
-
-	// Create a list of vertex Z/index pairs
-	TArray<FIndexAndZ> VertIndexAndZ;
-	VertIndexAndZ.Empty(NumWedges);
-	for(int32 WedgeIndex = 0; WedgeIndex < NumWedges; WedgeIndex++)
+	if (NumWedges == 0)
 	{
-		new(VertIndexAndZ) FIndexAndZ(WedgeIndex, GetPositionForWedge(RawMesh, WedgeIndex));
+		return;
 	}
 
-	// Sort the vertices by z value
-	VertIndexAndZ.Sort(FCompareIndexAndZ());
+	// Each cell coordinate is packed into 21 bits of the cell key.
+	const int32 MaxCellCoord = (1 << 21) - 1;
 
-	// Search for duplicates, quickly!
-	for (int32 i = 0; i < VertIndexAndZ.Num(); i++)
+	const FBox Bounds(RawMesh.VertexPositions);
+	const FVector GridOrigin = Bounds.Min;
+	const float MaxExtent = (Bounds.Max - Bounds.Min).GetMax();
+	const float CellSize = FMath::Max3(ComparisonThreshold * 2.0f, MaxExtent / (float)(1 << 20), THRESH_POINTS_ARE_SAME);
+	const float InvCellSize = 1.0f / CellSize;
+
+	// Most recently added corner for each occupied cell, the corners of a cell are linked through NextCornerInCell.
+	TMap<uint64,int32> CellToFirstCorner;
+	TArray<int32> NextCornerInCell;
+	NextCornerInCell.AddUninitialized(NumWedges);
+
+	for (int32 WedgeIndex = 0; WedgeIndex < NumWedges; WedgeIndex++)
 	{
-		// only need to search forward, since we add pairs both ways
-		for (int32 j = i + 1; j < VertIndexAndZ.Num(); j++)
-		{
-			if (FMath::Abs(VertIndexAndZ[j].Z - VertIndexAndZ[i].Z) > THRESH_POINTS_ARE_SAME * 4.01f)
-				break; // can't be any more dups
+		const FVector Position = GetPositionForWedge(RawMesh, WedgeIndex);
+		const FVector GridPosition = (Position - GridOrigin) * InvCellSize;
+		const float GridThreshold = ComparisonThreshold * InvCellSize;
 
-			FVector PositionA = GetPositionForWedge(RawMesh, VertIndexAndZ[i].Index);
-			FVector PositionB = GetPositionForWedge(RawMesh, VertIndexAndZ[j].Index);
+		// Range of cells that may contain corners within the threshold.
+		int32 MinCell[3];
+		int32 MaxCell[3];
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			MinCell[Axis] = FMath::Clamp(FMath::Floor(GridPosition[Axis] - GridThreshold), 0, MaxCellCoord);
+			MaxCell[Axis] = FMath::Clamp(FMath::Floor(GridPosition[Axis] + GridThreshold), 0, MaxCellCoord);
+		}
 
-			if (PointsEqual(PositionA, PositionB, ComparisonThreshold))					
+		// Only corners added before this one are in the grid, so every pair is found once and added both ways.
+		for (int32 CellZ = MinCell[2]; CellZ <= MaxCell[2]; CellZ++)
+		{
+			for (int32 CellY = MinCell[1]; CellY <= MaxCell[1]; CellY++)
 			{
-				OutOverlappingCorners.Add(VertIndexAndZ[i].Index,VertIndexAndZ[j].Index);
-				OutOverlappingCorners.Add(VertIndexAndZ[j].Index,VertIndexAndZ[i].Index);
+				for (int32 CellX = MinCell[0]; CellX <= MaxCell[0]; CellX++)
+				{
+					const uint64 CellKey = (uint64)CellX | ((uint64)CellY << 21) | ((uint64)CellZ << 42);
+					const int32* FirstCorner = CellToFirstCorner.Find(CellKey);
+					for (int32 OtherIndex = FirstCorner ? *FirstCorner : INDEX_NONE; OtherIndex != INDEX_NONE; OtherIndex = NextCornerInCell[OtherIndex])
+					{
+						if (PointsEqual(Position, GetPositionForWedge(RawMesh, OtherIndex), ComparisonThreshold))
+						{
+							OutOverlappingCorners.Add(OtherIndex,WedgeIndex);
+							OutOverlappingCorners.Add(WedgeIndex,OtherIndex);
+						}
+					}
+				}
 			}
 		}
+
+		// Add this corner to its own cell.
+		const int32 CellX = FMath::Clamp(FMath::Floor(GridPosition.X), 0, MaxCellCoord);
+		const int32 CellY = FMath::Clamp(FMath::Floor(GridPosition.Y), 0, MaxCellCoord);
+		const int32 CellZ = FMath::Clamp(FMath::Floor(GridPosition.Z), 0, MaxCellCoord);
+		const uint64 CellKey = (uint64)CellX | ((uint64)CellY << 21) | ((uint64)CellZ << 42);
+
+		int32* FirstCorner = CellToFirstCorner.Find(CellKey);
+		if (FirstCorner)
+		{
+			NextCornerInCell[WedgeIndex] = *FirstCorner;
+			*FirstCorner = WedgeIndex;
+		}
+		else
+		{
+			NextCornerInCell[WedgeIndex] = INDEX_NONE;
+			CellToFirstCorner.Add(CellKey, WedgeIndex);
+		}
 	}
 }
 
@@ -1127,55 +1216,49 @@ struct FFanFace
 	bool bBlendNormals;
 };
 
-static void ComputeTangents(
-	FRawMesh& RawMesh,
-	TMultiMap<int32,int32> const& OverlappingCorners,
-	uint32 TangentOptions
-	)
+/**
+ * Computes the vertex tangents of faces by blending the tangents of adjacent faces.
+ * Each face only writes the tangents of its own corners and gathers from adjacent faces in a
+ * sorted order, so faces can be processed in any order and on any thread with identical results.
+ */
+class FVertexTangentsProcessor
 {
-	bool bBlendOverlappingNormals = (TangentOptions & ETangentOptions::BlendOverlappingNormals) != 0;
-	bool bIgnoreDegenerateTriangles = (TangentOptions & ETangentOptions::IgnoreDegenerateTriangles) != 0;
-	float ComparisonThreshold = bIgnoreDegenerateTriangles ? THRESH_POINTS_ARE_SAME : 0.0f;
-
-	// Compute per-triangle tangents.
-	TArray<FVector> TriangleTangentX;
-	TArray<FVector> TriangleTangentY;
-	TArray<FVector> TriangleTangentZ;
-
-	ComputeTriangleTangents(
-		TriangleTangentX,
-		TriangleTangentY,
-		TriangleTangentZ,
-		RawMesh,
-		bIgnoreDegenerateTriangles ? SMALL_NUMBER : 0.0f
-		);
-
-	// Declare these out here to avoid reallocations.
-	TArray<FFanFace> RelevantFacesForCorner[3];
-	TArray<int32> AdjacentFaces;
-	TArray<int32> DupVerts;
-
-	int32 NumWedges = RawMesh.WedgeIndices.Num();
-	int32 NumFaces = NumWedges / 3;
-
-	// Allocate storage for tangents if none were provided.
-	if (RawMesh.WedgeTangentX.Num() != NumWedges)
-	{
-		RawMesh.WedgeTangentX.Empty(NumWedges);
-		RawMesh.WedgeTangentX.AddZeroed(NumWedges);
-	}
-	if (RawMesh.WedgeTangentY.Num() != NumWedges)
+public:
+	FVertexTangentsProcessor(
+		FRawMesh& InRawMesh,
+		TMultiMap<int32,int32> const& InOverlappingCorners,
+		TArray<FVector> const& InTriangleTangentX,
+		TArray<FVector> const& InTriangleTangentY,
+		TArray<FVector> const& InTriangleTangentZ,
+		float InComparisonThreshold,
+		bool bInBlendOverlappingNormals
+		)
+		: RawMesh(InRawMesh)
+		, OverlappingCorners(InOverlappingCorners)
+		, TriangleTangentX(InTriangleTangentX)
+		, TriangleTangentY(InTriangleTangentY)
+		, TriangleTangentZ(InTriangleTangentZ)
+		, ComparisonThreshold(InComparisonThreshold)
+		, bBlendOverlappingNormals(bInBlendOverlappingNormals)
 	{
-		RawMesh.WedgeTangentY.Empty(NumWedges);
-		RawMesh.WedgeTangentY.AddZeroed(NumWedges);
 	}
-	if (RawMesh.WedgeTangentZ.Num() != NumWedges)
+
+	/** Processes faces [FirstFace, LastFace), called by ParallelForRanges. */
+	void operator()(int32 FirstFace, int32 LastFace)
 	{
-		RawMesh.WedgeTangentZ.Empty(NumWedges);
-		RawMesh.WedgeTangentZ.AddZeroed(NumWedges);
+		// Declare these out here to avoid reallocations.
+		TArray<FFanFace> RelevantFacesForCorner[3];
+		TArray<int32> AdjacentFaces;
+		TArray<int32> DupVerts;
+
+		for (int32 FaceIndex = FirstFace; FaceIndex < LastFace; FaceIndex++)
+		{
+			ProcessFace(FaceIndex, RelevantFacesForCorner, AdjacentFaces, DupVerts);
+		}
 	}
 
-	for (int32 FaceIndex = 0; FaceIndex < NumFaces; FaceIndex++)
+private:
+	void ProcessFace(int32 FaceIndex, TArray<FFanFace> (&RelevantFacesForCorner)[3], TArray<int32>& AdjacentFaces, TArray<int32>& DupVerts)
 	{
 		int32 WedgeOffset = FaceIndex * 3;
 		FVector CornerPositions[3];
@@ -1197,7 +1280,7 @@ static void ComputeTangents(
 			|| PointsEqual(CornerPositions[0],CornerPositions[2], ComparisonThreshold)
 			|| PointsEqual(CornerPositions[1],CornerPositions[2], ComparisonThreshold))
 		{
-			continue;
+			return;
 		}
 
 		// No need to process triangles if tangents already exist.
@@ -1210,7 +1293,7 @@ static void ComputeTangents(
 		}
 		if (bCornerHasTangents[0] && bCornerHasTangents[1] && bCornerHasTangents[2])
 		{
-			continue;
+			return;
 		}
 
 		// Calculate smooth vertex normals.
@@ -1439,6 +1522,70 @@ static void ComputeTangents(
 		}
 	}
 
+	FRawMesh& RawMesh;
+	TMultiMap<int32,int32> const& OverlappingCorners;
+	TArray<FVector> const& TriangleTangentX;
+	TArray<FVector> const& TriangleTangentY;
+	TArray<FVector> const& TriangleTangentZ;
+	float ComparisonThreshold;
+	bool bBlendOverlappingNormals;
+};
+
+static void ComputeTangents(
+	FRawMesh& RawMesh,
+	TMultiMap<int32,int32> const& OverlappingCorners,
+	uint32 TangentOptions
+	)
+{
+	bool bBlendOverlappingNormals = (TangentOptions & ETangentOptions::BlendOverlappingNormals) != 0;
+	bool bIgnoreDegenerateTriangles = (TangentOptions & ETangentOptions::IgnoreDegenerateTriangles) != 0;
+	float ComparisonThreshold = bIgnoreDegenerateTriangles ? THRESH_POINTS_ARE_SAME : 0.0f;
+
+	// Compute per-triangle tangents.
+	TArray<FVector> TriangleTangentX;
+	TArray<FVector> TriangleTangentY;
+	TArray<FVector> TriangleTangentZ;
+
+	ComputeTriangleTangents(
+		TriangleTangentX,
+		TriangleTangentY,
+		TriangleTangentZ,
+		RawMesh,
+		bIgnoreDegenerateTriangles ? SMALL_NUMBER : 0.0f
+		);
+
+	int32 NumWedges = RawMesh.WedgeIndices.Num();
+	int32 NumFaces = NumWedges / 3;
+
+	// Allocate storage for tangents if none were provided.
+	if (RawMesh.WedgeTangentX.Num() != NumWedges)
+	{
+		RawMesh.WedgeTangentX.Empty(NumWedges);
+		RawMesh.WedgeTangentX.AddZeroed(NumWedges);
+	}
+	if (RawMesh.WedgeTangentY.Num() != NumWedges)
+	{
+		RawMesh.WedgeTangentY.Empty(NumWedges);
+		RawMesh.WedgeTangentY.AddZeroed(NumWedges);
+	}
+	if (RawMesh.WedgeTangentZ.Num() != NumWedges)
+	{
+		RawMesh.WedgeTangentZ.Empty(NumWedges);
+		RawMesh.WedgeTangentZ.AddZeroed(NumWedges);
+	}
+
+	// Faces only read the mesh and write their own corners, so they are processed in parallel.
+	FVertexTangentsProcessor Processor(
+		RawMesh,
+		OverlappingCorners,
+		TriangleTangentX,
+		TriangleTangentY,
+		TriangleTangentZ,
+		ComparisonThreshold,
+		bBlendOverlappingNormals
+		);
+	ParallelForRanges(NumFaces, Processor, MinFacesPerTask);
+
 	check(RawMesh.WedgeTangentX.Num() == NumWedges);
 	check(RawMesh.WedgeTangentY.Num() == NumWedges);
 	check(RawMesh.WedgeTangentZ.Num() == NumWedges);
@@ -1901,6 +2048,40 @@ bool FMeshUtilities::BuildStaticMesh(
 		return false;
 	}
 
+	// Reduce all LODs based on an unreduced LOD0 in one go, so the reduction can share work between them.
+	TIndirectArray<FRawMesh> ChainMeshes;
+	TArray<float> ChainMaxDeviations;
+	TArray<int32> LODToChainIndex;
+	LODToChainIndex.Init(INDEX_NONE, SourceModels.Num());
+	if (MeshReduction)
+	{
+		FMeshReductionSettings BaseSettings = LODGroup.GetSettings(SourceModels[0].ReductionSettings, 0);
+		if (BaseSettings.PercentTriangles >= 1.0f && BaseSettings.MaxDeviation <= 0.0f)
+		{
+			TArray<FRawMesh*> ChainMeshPtrs;
+			TArray<FMeshReductionSettings> ChainSettings;
+			for (int32 LODIndex = 1; LODIndex < SourceModels.Num(); ++LODIndex)
+			{
+				FMeshReductionSettings ReductionSettings = LODGroup.GetSettings(SourceModels[LODIndex].ReductionSettings, LODIndex);
+				if (ReductionSettings.BaseLODModel == 0 && (ReductionSettings.PercentTriangles < 1.0f || ReductionSettings.MaxDeviation > 0.0f))
+				{
+					LODToChainIndex[LODIndex] = ChainSettings.Add(ReductionSettings);
+					ChainMeshPtrs.Add(new(ChainMeshes) FRawMesh());
+				}
+			}
+
+			if (ChainSettings.Num() > 1)
+			{
+				MeshReduction->ReduceLODChain(ChainMeshPtrs, ChainMaxDeviations, LODMeshes[0], ChainSettings);
+			}
+			else
+			{
+				ChainMeshes.Empty();
+				LODToChainIndex.Init(INDEX_NONE, SourceModels.Num());
+			}
+		}
+	}
+
 	// Reduce each LOD mesh according to its reduction settings.
 	OutRenderData.bReducedBySimplygon = false;
 	int32 NumValidLODs = 0;
@@ -1917,11 +2098,20 @@ bool FMeshUtilities::BuildStaticMesh(
 
 		if (MeshReduction && (ReductionSettings.PercentTriangles < 1.0f || ReductionSettings.MaxDeviation > 0.0f))
 		{
-			FRawMesh InMesh = LODMeshes[ReductionSettings.BaseLODModel];
 			FRawMesh& DestMesh = LODMeshes[NumValidLODs];
 			TMultiMap<int32,int32>& DestOverlappingCorners = LODOverlappingCorners[NumValidLODs];
 
-			MeshReduction->Reduce(DestMesh, LODMaxDeviation[NumValidLODs], InMesh, ReductionSettings);
+			const int32 ChainIndex = LODToChainIndex[LODIndex];
+			if (ChainIndex != INDEX_NONE)
+			{
+				DestMesh = ChainMeshes[ChainIndex];
+				LODMaxDeviation[NumValidLODs] = ChainMaxDeviations[ChainIndex];
+			}
+			else
+			{
+				FRawMesh InMesh = LODMeshes[ReductionSettings.BaseLODModel];
+				MeshReduction->Reduce(DestMesh, LODMaxDeviation[NumValidLODs], InMesh, ReductionSettings);
+			}
 			if (DestMesh.WedgeIndices.Num() > 0 && !DestMesh.IsValid())
 			{
 				UE_LOG(LogMeshUtilities,Error,TEXT("Mesh reduction produced a corrupt mesh for LOD%d"),LODIndex);
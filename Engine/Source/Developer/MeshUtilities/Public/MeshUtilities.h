@@ -23,6 +23,19 @@ public:
 		const struct FRawMesh& InMesh,
 		const struct FMeshReductionSettings& ReductionSettings
 		) = 0;
+	/**
+	 * Reduces the raw mesh to several levels of detail at once. Implementations may share work between the levels.
+	 * @param OutReducedMeshes - Upon return contains the reduced meshes, one per entry in ReductionSettings.
+	 * @param OutMaxDeviations - Upon return contains the maximum deviation of each reduced mesh.
+	 * @param InMesh - The mesh to reduce.
+	 * @param ReductionSettings - Settings with which to reduce the mesh for each level of detail.
+	 */
+	virtual void ReduceLODChain(
+		const TArray<struct FRawMesh*>& OutReducedMeshes,
+		TArray<float>& OutMaxDeviations,
+		const struct FRawMesh& InMesh,
+		const TArray<struct FMeshReductionSettings>& ReductionSettings
+		) = 0;
 	/**
 	 * Reduces the provided skeletal mesh.
 	 * @returns true if reduction was successful.
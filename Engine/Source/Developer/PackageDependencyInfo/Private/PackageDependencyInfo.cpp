@@ -193,6 +193,104 @@ bool FPackageDependencyInfo::DeterminePackageDependentTimeStamp(const TCHAR* InP
 	return bSuccessful;
 }
 
+bool FPackageDependencyInfo::DeterminePackageDependentHash(const TCHAR* InPackageName, FSHAHash& OutHash)
+{
+	// Fills in the dependencies of the package and everything below it
+	FDateTime TempTimeStamp;
+	if (DeterminePackageDependentTimeStamp(InPackageName, TempTimeStamp) == false)
+	{
+		return false;
+	}
+
+	// Gather every package the given one depends on, directly or not. Circular references are fine here,
+	// each package is only visited once.
+	FPackageDependencyTrackingInfo* PkgInfo = PackageInformation.FindRef(InPackageName);
+	TSet<FPackageDependencyTrackingInfo*> Visited;
+	TArray<FPackageDependencyTrackingInfo*> ToVisit;
+	ToVisit.Add(PkgInfo);
+	Visited.Add(PkgInfo);
+	while (ToVisit.Num() > 0)
+	{
+		FPackageDependencyTrackingInfo* VisitInfo = ToVisit.Pop();
+		for (TMap<FString,FPackageDependencyTrackingInfo*>::TConstIterator DepIt(VisitInfo->DependentPackages); DepIt; ++DepIt)
+		{
+			FPackageDependencyTrackingInfo* DepPkgInfo = DepIt.Value();
+			if ((DepPkgInfo != NULL) && !Visited.Contains(DepPkgInfo))
+			{
+				Visited.Add(DepPkgInfo);
+				ToVisit.Add(DepPkgInfo);
+			}
+		}
+	}
+
+	// Hash in name order, so the result doesn't depend on the order the dependencies were found in
+	TArray<FPackageDependencyTrackingInfo*> AllDependencies = Visited.Array();
+	AllDependencies.Sort([](const FPackageDependencyTrackingInfo& A, const FPackageDependencyTrackingInfo& B) { return A.PackageName < B.PackageName; });
+
+	FSHA1 Hasher;
+	for (int32 DepIdx = 0; DepIdx < AllDependencies.Num(); DepIdx++)
+	{
+		FPackageDependencyTrackingInfo* DepPkgInfo = AllDependencies[DepIdx];
+		const FSHAHash& SourceHash = GetSourceHash(DepPkgInfo);
+
+		Hasher.UpdateWithString(*DepPkgInfo->PackageName, DepPkgInfo->PackageName.Len());
+		Hasher.Update(SourceHash.Hash, sizeof(SourceHash.Hash));
+	}
+	Hasher.Final();
+	Hasher.GetHash(OutHash.Hash);
+
+	return true;
+}
+
+const FSHAHash& FPackageDependencyInfo::GetSourceHash(FPackageDependencyTrackingInfo* InPkgInfo)
+{
+	if (InPkgInfo->bSourceHashValid == false)
+	{
+		if (InPkgInfo == ShaderSourcePkgInfo)
+		{
+			HashFiles(ShaderSourceFiles, InPkgInfo->SourceHash);
+		}
+		else if (InPkgInfo == ScriptSourcePkgInfo)
+		{
+			HashFiles(ScriptSourceFiles, InPkgInfo->SourceHash);
+		}
+		else
+		{
+			TArray<uint8> Contents;
+			if (FFileHelper::LoadFileToArray(Contents, *InPkgInfo->SourceFilename))
+			{
+				FSHA1::HashBuffer(Contents.GetData(), Contents.Num(), InPkgInfo->SourceHash.Hash);
+			}
+			else
+			{
+				UE_LOG(LogPackageDependencyInfo, Warning, TEXT("Failed to read %s to hash it"), *InPkgInfo->SourceFilename);
+			}
+		}
+		InPkgInfo->bSourceHashValid = true;
+	}
+
+	return InPkgInfo->SourceHash;
+}
+
+void FPackageDependencyInfo::HashFiles(TArray<FString> InFilenames, FSHAHash& OutHash)
+{
+	InFilenames.Sort();
+
+	FSHA1 Hasher;
+	TArray<uint8> Contents;
+	for (int32 FileIdx = 0; FileIdx < InFilenames.Num(); FileIdx++)
+	{
+		Contents.Reset();
+		if (FFileHelper::LoadFileToArray(Contents, *InFilenames[FileIdx]))
+		{
+			Hasher.UpdateWithString(*InFilenames[FileIdx], InFilenames[FileIdx].Len());
+			Hasher.Update(Contents.GetData(), Contents.Num());
+		}
+	}
+	Hasher.Final();
+	Hasher.GetHash(OutHash.Hash);
+}
+
 void FPackageDependencyInfo::DetermineDependentTimeStamps(const TArray<FString>& InPackageList)
 {
 	FDateTime TempTimeStamp;
@@ -239,6 +337,7 @@ void FPackageDependencyInfo::DetermineShaderSourceTimeStamp()
 		if (FPaths::GetExtension(ShaderFilename) == TEXT("usf"))
 		{
 			// It's a shader file
+			ShaderSourceFiles.Add(ShaderFilename);
 			FDateTime ShaderTimestamp = It.Value();
 			if (ShaderTimestamp > ShaderSourceTimeStamp)
 			{
@@ -305,6 +404,7 @@ void FPackageDependencyInfo::DetermineScriptSourceTimeStamp(bool bInGame, FDateT
 		if (FPaths::GetExtension(ScriptFilename) == TEXT("h"))
 		{
 			// It's a 'script' file
+			ScriptSourceFiles.Add(ScriptFilename);
 			FDateTime ScriptTimestamp = It.Value();
 			if (ScriptTimestamp > OutNewestTime)
 			{
@@ -343,9 +443,11 @@ void FPackageDependencyInfo::PrepContentPackageTimeStamps()
 			if ( FPackageName::IsPackageExtension(*FPaths::GetExtension(ContentFilename, true)) )
 			{
 				FDateTime ContentTimestamp = It.Value();
+				FString SourceFilename = ContentFilename;
 				ContentFilename = FPaths::GetBaseFilename(ContentFilename, false);
 				// Add it to the pkg info mapping
 				FPackageDependencyTrackingInfo* NewInfo = new FPackageDependencyTrackingInfo(ContentFilename, ContentTimestamp);
+				NewInfo->SourceFilename = SourceFilename;
 				PackageInformation.Add(ContentFilename, NewInfo);
 			}
 		}
@@ -632,6 +734,12 @@ bool FPackageDependencyInfoModule::DeterminePackageDependentTimeStamp(const TCHA
 	return PackageDependencyInfo->DeterminePackageDependentTimeStamp(InPackageName, OutNewestTime);
 }
 
+bool FPackageDependencyInfoModule::DeterminePackageDependentHash(const TCHAR* InPackageName, FSHAHash& OutHash)
+{
+	check(PackageDependencyInfo);
+	return PackageDependencyInfo->DeterminePackageDependentHash(InPackageName, OutHash);
+}
+
 void FPackageDependencyInfoModule::DetermineDependentTimeStamps(const TArray<FString>& InPackageList)
 {
 	check(PackageDependencyInfo);
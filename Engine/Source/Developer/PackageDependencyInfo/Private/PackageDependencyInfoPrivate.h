@@ -37,6 +37,16 @@ public:
 	 */
 	bool DeterminePackageDependentTimeStamp(const TCHAR* InPackageName, FDateTime& OutNewestTime);
 
+	/**
+	 *	Determine the hash of the given package's contents and the contents of all its (transitive) dependencies
+	 *
+	 *	@param	InPackageName		The package to process
+	 *	@param	OutHash				The dependent hash for the package.
+	 *
+	 *	@return	bool				true if successful, false if not
+	 */
+	bool DeterminePackageDependentHash(const TCHAR* InPackageName, FSHAHash& OutHash);
+
 	/**
 	 *	Determine dependent timestamps for the given list of files
 	 *
@@ -73,6 +83,21 @@ protected:
 	/** Prep the content package list - ie gather the list of all content files and their actual timestamps */
 	void PrepContentPackageTimeStamps();
 
+	/**
+	 *	Get the hash of the source data for the given package info, hashing the file(s) the first time it is asked for
+	 *
+	 *	@param	InPkgInfo		The package to get the source hash of; may be the shader or script source info
+	 */
+	const FSHAHash& GetSourceHash(FPackageDependencyTrackingInfo* InPkgInfo);
+
+	/**
+	 *	Hash the contents of a list of files, in a stable order
+	 *
+	 *	@param	InFilenames		The files to hash
+	 *	@param	OutHash			OUTPUT - the combined hash
+	 */
+	static void HashFiles(TArray<FString> InFilenames, FSHAHash& OutHash);
+
 	/**
 	 *	Recursively process the given package to determine the dependent timestamp - ie its newest dependency
 	 *
@@ -100,6 +125,8 @@ protected:
 	FString NewestShaderSource;
 	/** The pkg info for shader source */
 	FPackageDependencyTrackingInfo* ShaderSourcePkgInfo;
+	/** All the shader source files, hashed when the shader source is first needed */
+	TArray<FString> ShaderSourceFiles;
 
 	/** The newest time stamp of the engine 'script' source files. Used when a package contains a blueprint */
 	FDateTime EngineScriptSourceTimeStamp;
@@ -111,6 +138,8 @@ protected:
 	FDateTime ScriptSourceTimeStamp;
 	/** The pkg info for script source */
 	FPackageDependencyTrackingInfo* ScriptSourcePkgInfo;
+	/** All the engine and game 'script' source files, hashed when the script source is first needed */
+	TArray<FString> ScriptSourceFiles;
 
 	/** The package information, including dependencies for content files */
 	TMap<FString,class FPackageDependencyTrackingInfo*> PackageInformation;
@@ -11,6 +11,11 @@ class FPackageDependencyTrackingInfo
 public:
 	/** Full path name of the package */
 	FString PackageName;
+	/** Filename of the source package, including the extension */
+	FString SourceFilename;
+	/** Hash of the source package file, only valid if bSourceHashValid is set */
+	FSHAHash SourceHash;
+	bool bSourceHashValid;
 	/** The GUID of the source package */
 	FGuid PackageGuid;
 	/** Timestamp of the package (source not cooked) */
@@ -40,7 +45,8 @@ public:
 	bool bHasCircularReferences;
 
 	FPackageDependencyTrackingInfo()
-		: DependentTimeStamp(FDateTime::MinValue())
+		: bSourceHashValid(false)
+		, DependentTimeStamp(FDateTime::MinValue())
 		, bContainsMap(false)
 		, bContainsShaders(false)
 		, bContainsBlueprints(false)
@@ -51,6 +57,7 @@ public:
 
 	FPackageDependencyTrackingInfo(FString& InPackageName, FDateTime& InTimeStamp)
 		: PackageName(InPackageName)
+		, bSourceHashValid(false)
 		, TimeStamp(InTimeStamp)
 		, DependentTimeStamp(FDateTime::MinValue())
 		, bContainsMap(false)
@@ -64,6 +71,9 @@ public:
 	FPackageDependencyTrackingInfo& operator=(const FPackageDependencyTrackingInfo& InInfo)
 	{
 		PackageName = InInfo.PackageName;
+		SourceFilename = InInfo.SourceFilename;
+		SourceHash = InInfo.SourceHash;
+		bSourceHashValid = InInfo.bSourceHashValid;
 		PackageGuid = InInfo.PackageGuid;
 		TimeStamp = InInfo.TimeStamp;
 		DependentTimeStamp = InInfo.DependentTimeStamp;
@@ -136,6 +146,17 @@ public:
 	 */
 	virtual bool DeterminePackageDependentTimeStamp(const TCHAR* InPackageName, FDateTime& OutNewestTime);
 
+	/**
+	 *	Determine the hash of the given package's contents and the contents of everything it depends on.
+	 *	Unlike the dependent time stamp, this only changes when the data does.
+	 *
+	 *	@param	InPackageName		The package to process
+	 *	@param	OutHash				The dependent hash for the package.
+	 *
+	 *	@return	bool				true if successful, false if not
+	 */
+	virtual bool DeterminePackageDependentHash(const TCHAR* InPackageName, FSHAHash& OutHash);
+
 	/**
 	 *	Determine dependent timestamps for the given list of files
 	 *
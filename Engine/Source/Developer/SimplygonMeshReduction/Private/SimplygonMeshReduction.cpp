@@ -126,6 +126,24 @@ public:
 		OutMaxDeviation = ReductionProcessor->GetMaxDeviation();
 	}
 
+	virtual void ReduceLODChain(
+		const TArray<FRawMesh*>& OutReducedMeshes,
+		TArray<float>& OutMaxDeviations,
+		const FRawMesh& InMesh,
+		const TArray<FMeshReductionSettings>& InSettings
+		)
+	{
+		check(OutReducedMeshes.Num() == InSettings.Num());
+
+		// Simplygon reduces each level of detail independently.
+		OutMaxDeviations.Empty(InSettings.Num());
+		OutMaxDeviations.AddZeroed(InSettings.Num());
+		for (int32 LODIndex = 0; LODIndex < InSettings.Num(); ++LODIndex)
+		{
+			Reduce(*OutReducedMeshes[LODIndex], OutMaxDeviations[LODIndex], InMesh, InSettings[LODIndex]);
+		}
+	}
+
 	bool ReduceLODModel(
 		FStaticLODModel * SrcModel,
 		FStaticLODModel *& OutModel, 
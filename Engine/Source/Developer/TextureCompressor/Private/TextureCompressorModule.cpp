@@ -15,6 +15,47 @@ enum EMipGenAddressMode
 	MGTAM_BorderBlack,
 };
 
+/**
+ * Adapts a row processor to ParallelForRanges.
+ * The row processor must provide ProcessRow(int32 Row) and be safe to call for different rows concurrently.
+ */
+template <class TRowProcessor>
+struct TImageRowsRange
+{
+	TImageRowsRange(TRowProcessor& InProcessor)
+		: Processor(InProcessor)
+	{
+	}
+
+	void operator()(int32 FirstRow, int32 LastRow)
+	{
+		for (int32 Row = FirstRow; Row < LastRow; ++Row)
+		{
+			Processor.ProcessRow(Row);
+		}
+	}
+
+	/** The processor working on the rows. */
+	TRowProcessor& Processor;
+};
+
+/**
+ * Processes all rows of an image, splitting them between the calling thread and background tasks.
+ * @param Processor - The row processor.
+ * @param NumRows - The number of rows to process.
+ * @param SamplesPerRow - The approximate number of texel samples taken for each row, small workloads are processed on the calling thread.
+ */
+template <class TRowProcessor>
+static void ProcessImageRows(TRowProcessor& Processor, int32 NumRows, int32 SamplesPerRow)
+{
+	// below this amount of samples per task, the overhead of starting tasks dominates
+	const int64 MinSamplesPerTask = 64 * 1024;
+	const int32 MinRowsPerTask = (int32)FMath::Clamp<int64>(MinSamplesPerTask / FMath::Max(SamplesPerRow, 1), 1, FMath::Max(NumRows, 1));
+
+	TImageRowsRange<TRowProcessor> Rows(Processor);
+	ParallelForRanges(NumRows, Rows, MinRowsPerTask);
+}
+
 /**
  * 2D view into one slice of an image.
  */
@@ -82,6 +123,31 @@ FLinearColor LookupSourceMip(const FImageView2D& SourceImageData, int32 X, int32
 	return SourceImageData.Access(X,Y);
 }
 
+// same as LookupSourceMip, but loads the sample into a vector register
+template <EMipGenAddressMode AddressMode>
+FORCEINLINE VectorRegister LookupSourceMipVector(const FImageView2D& SourceImageData, int32 X, int32 Y)
+{
+	if(AddressMode == MGTAM_Wrap)
+	{
+		X = (int32)((uint32)X) & (SourceImageData.SizeX - 1);
+		Y = (int32)((uint32)Y) & (SourceImageData.SizeY - 1);
+	}
+	else if(AddressMode == MGTAM_Clamp)
+	{
+		X = FMath::Clamp(X, 0, SourceImageData.SizeX - 1);
+		Y = FMath::Clamp(Y, 0, SourceImageData.SizeY - 1);
+	}
+	else if(AddressMode == MGTAM_BorderBlack)
+	{
+		if((uint32)X >= (uint32)SourceImageData.SizeX
+			|| (uint32)Y >= (uint32)SourceImageData.SizeY)
+		{
+			return VectorZero();
+		}
+	}
+	return VectorLoad(&SourceImageData.Access(X,Y));
+}
+
 // Kernel class for image filtering operations like image downsampling
 // at max MaxKernelExtend x MaxKernelExtend
 class FImageKernel2D
@@ -156,6 +222,9 @@ public:
 		BuildFilterTable2DFrom1D(KernelWeights, Table1D, TableSize1D);
 	}
 
+	// at max we support MaxKernelExtend x MaxKernelExtend kernels
+	const static uint32 MaxKernelExtend = 12;
+
 	inline uint32 GetFilterTableSize() const
 	{
 		return FilterTableSize;
@@ -280,8 +349,6 @@ private:
 		}
 	}
 
-	// at max we support MaxKernelExtend x MaxKernelExtend kernels
-	const static uint32 MaxKernelExtend = 12;
 	// 0 if no kernel was setup yet
 	uint32 FilterTableSize;
 	// normalized, means the sum of it should be 1.0f
@@ -290,85 +357,98 @@ private:
 
 
 /**
-* Generates a mip-map for an 2D B8G8R8A8 image using a 4x4 filter with sharpening
-* @param SourceImageData - The source image's data.
-* @param DestImageData - The destination image's data.
-* @param ImageFormat - The format of both the source and destination images.
-* @param FilterTable2D - [FilterTableSize * FilterTableSize]
-* @param FilterTableSize - >= 2
-* @param ScaleFactor 1 / 2:for downsampling
-*/
+ * Generates rows of a mip-map for an 2D B8G8R8A8 image using a 4x4 filter with sharpening
+ */
 template <EMipGenAddressMode AddressMode>
-static void GenerateSharpenedMipB8G8R8A8Templ(
-	const FImageView2D& SourceImageData, 
-	FImageView2D& DestImageData, 
-	bool bDitherMipMapAlpha,
-	const FImageKernel2D& Kernel,
-	uint32 ScaleFactor,
-	bool bSharpenWithoutColorShift )
+class TSharpenedMipRowProcessor
 {
-	check( SourceImageData.SizeX == ScaleFactor * DestImageData.SizeX || DestImageData.SizeX == 1 );
-	check( SourceImageData.SizeY == ScaleFactor * DestImageData.SizeY || DestImageData.SizeY == 1 );
-	check( Kernel.GetFilterTableSize() >= 2 );
+public:
+	/**
+	* @param SourceImageData - The source image's data.
+	* @param DestImageData - The destination image's data.
+	* @param Kernel - The filter kernel, >= 2x2
+	* @param ScaleFactor 1 / 2:for downsampling
+	*/
+	TSharpenedMipRowProcessor(
+		const FImageView2D& InSourceImageData, 
+		FImageView2D& InDestImageData, 
+		bool bInDitherMipMapAlpha,
+		const FImageKernel2D& Kernel,
+		uint32 InScaleFactor,
+		bool bInSharpenWithoutColorShift )
+		: SourceImageData(InSourceImageData)
+		, DestImageData(InDestImageData)
+		, bDitherMipMapAlpha(bInDitherMipMapAlpha)
+		, ScaleFactor(InScaleFactor)
+		, bSharpenWithoutColorShift(bInSharpenWithoutColorShift)
+	{
+		KernelSize = Kernel.GetFilterTableSize();
+		KernelCenter = (int32)KernelSize / 2 - 1;
+
+		// replicate the weights once, so the inner loop only does vector math
+		for ( uint32 KernelY = 0; KernelY < KernelSize;  ++KernelY )
+		{
+			for ( uint32 KernelX = 0; KernelX < KernelSize;  ++KernelX )
+			{
+				float Weight = Kernel.GetAt( KernelX, KernelY );
+				Weights[KernelX + KernelY * KernelSize] = VectorLoadFloat1( &Weight );
+			}
+		}
+	}
 
-	const int32 KernelCenter = (int32)Kernel.GetFilterTableSize() / 2 - 1;
+	void ProcessRow(int32 DestY)
+	{
+		const int32 SourceY = DestY * ScaleFactor;
+		const VectorRegister Quarter = MakeVectorRegister( 0.25f, 0.25f, 0.25f, 0.25f );
 
-	// Set up a random number stream for dithering.
-	FRandomStream RandomStream(0);
+		// Set up a random number stream for dithering, seeded per row so that the result doesn't depend on the threading.
+		FRandomStream RandomStream(DestY);
 
-	for ( int32 DestY = 0;DestY < DestImageData.SizeY; DestY++ )
-	{
 		for ( int32 DestX = 0;DestX < DestImageData.SizeX; DestX++ )
 		{
 			const int32 SourceX = DestX * ScaleFactor;
-			const int32 SourceY = DestY * ScaleFactor;
 
-			FLinearColor FilteredColor(0, 0, 0, 0);
+			VectorRegister FilteredColor = VectorZero();
 
-			if ( bSharpenWithoutColorShift )
+			for ( uint32 KernelY = 0; KernelY < KernelSize;  ++KernelY )
 			{
-				float NewLuminance = 0;
+				const VectorRegister* RowWeights = &Weights[KernelY * KernelSize];
 
-				for ( uint32 KernelY = 0; KernelY < Kernel.GetFilterTableSize();  ++KernelY )
+				for ( uint32 KernelX = 0; KernelX < KernelSize;  ++KernelX )
 				{
-					for ( uint32 KernelX = 0; KernelX < Kernel.GetFilterTableSize();  ++KernelX )
-					{
-						float Weight = Kernel.GetAt( KernelX, KernelY );
-						FLinearColor Sample = LookupSourceMip<AddressMode>( SourceImageData, SourceX + KernelX - KernelCenter, SourceY + KernelY - KernelCenter );
-						float LuminanceSample = Sample.ComputeLuminance();
-
-						NewLuminance += Weight * LuminanceSample;
-					}
+					VectorRegister Sample = LookupSourceMipVector<AddressMode>( SourceImageData, SourceX + KernelX - KernelCenter, SourceY + KernelY - KernelCenter );
+					FilteredColor = VectorMultiplyAdd( RowWeights[KernelX], Sample, FilteredColor );
 				}
+			}
+
+			FLinearColor DestColor;
+
+			if ( bSharpenWithoutColorShift )
+			{
+				// the luminance is linear, so the luminance of the filtered color equals the filtered luminance
+				FLinearColor SharpenedColor;
+				VectorStore( FilteredColor, &SharpenedColor );
+				float NewLuminance = SharpenedColor.ComputeLuminance();
 
 				// simple 2x2 kernel to compute the color
-				FilteredColor =
-					( LookupSourceMip<AddressMode>( SourceImageData, SourceX + 0, SourceY + 0 )
-					+ LookupSourceMip<AddressMode>( SourceImageData, SourceX + 1, SourceY + 0 )
-					+ LookupSourceMip<AddressMode>( SourceImageData, SourceX + 0, SourceY + 1 )
-					+ LookupSourceMip<AddressMode>( SourceImageData, SourceX + 1, SourceY + 1 ) ) * 0.25f;
+				VectorRegister AverageColor = VectorAdd(
+					VectorAdd( LookupSourceMipVector<AddressMode>( SourceImageData, SourceX + 0, SourceY + 0 ), LookupSourceMipVector<AddressMode>( SourceImageData, SourceX + 1, SourceY + 0 ) ),
+					VectorAdd( LookupSourceMipVector<AddressMode>( SourceImageData, SourceX + 0, SourceY + 1 ), LookupSourceMipVector<AddressMode>( SourceImageData, SourceX + 1, SourceY + 1 ) ) );
+				VectorStore( VectorMultiply( AverageColor, Quarter ), &DestColor );
 
-				float OldLuminance = FilteredColor.ComputeLuminance();
+				float OldLuminance = DestColor.ComputeLuminance();
 
 				if ( OldLuminance > 0.001f )
 				{
 					float Factor = NewLuminance / OldLuminance;
-					FilteredColor.R *= Factor;
-					FilteredColor.G *= Factor;
-					FilteredColor.B *= Factor;
+					DestColor.R *= Factor;
+					DestColor.G *= Factor;
+					DestColor.B *= Factor;
 				}
 			}
 			else
 			{
-				for ( uint32 KernelY = 0; KernelY < Kernel.GetFilterTableSize();  ++KernelY )
-				{
-					for ( uint32 KernelX = 0; KernelX < Kernel.GetFilterTableSize();  ++KernelX )
-					{
-						float Weight = Kernel.GetAt( KernelX, KernelY );
-						FLinearColor Sample = LookupSourceMip<AddressMode>( SourceImageData, SourceX + KernelX - KernelCenter, SourceY + KernelY - KernelCenter );
-						FilteredColor += Weight	* Sample;
-					}
-				}
+				VectorStore( FilteredColor, &DestColor );
 			}
 
 			if ( bDitherMipMapAlpha )
@@ -378,18 +458,56 @@ static void GenerateSharpenedMipB8G8R8A8Templ(
 				const float MinRandomAlpha = 85.0f;
 				const float MaxRandomAlpha = 255.0f;
 
-				if ( FilteredColor.A > AlphaThreshold )
+				if ( DestColor.A > AlphaThreshold )
 				{
-					FilteredColor.A = FMath::Trunc( FMath::Lerp( MinRandomAlpha, MaxRandomAlpha, RandomStream.GetFraction() ) );
+					DestColor.A = FMath::Trunc( FMath::Lerp( MinRandomAlpha, MaxRandomAlpha, RandomStream.GetFraction() ) );
 				}
 			}
 
 			// Set the destination pixel.
-			//FLinearColor& DestColor = *(DestImageData.AsRGBA32F() + DestX + DestY * DestImageData.SizeX);
-			FLinearColor& DestColor = DestImageData.Access(DestX, DestY);
-			DestColor = FilteredColor;
+			DestImageData.Access(DestX, DestY) = DestColor;
 		}
 	}
+
+private:
+
+	const FImageView2D& SourceImageData;
+	FImageView2D& DestImageData;
+	bool bDitherMipMapAlpha;
+	uint32 ScaleFactor;
+	bool bSharpenWithoutColorShift;
+	uint32 KernelSize;
+	int32 KernelCenter;
+	/** kernel weights, replicated to all components */
+	VectorRegister Weights[FImageKernel2D::MaxKernelExtend * FImageKernel2D::MaxKernelExtend];
+};
+
+/**
+* Generates a mip-map for an 2D B8G8R8A8 image using a 4x4 filter with sharpening
+* @param SourceImageData - The source image's data.
+* @param DestImageData - The destination image's data.
+* @param ImageFormat - The format of both the source and destination images.
+* @param FilterTable2D - [FilterTableSize * FilterTableSize]
+* @param FilterTableSize - >= 2
+* @param ScaleFactor 1 / 2:for downsampling
+*/
+template <EMipGenAddressMode AddressMode>
+static void GenerateSharpenedMipB8G8R8A8Templ(
+	const FImageView2D& SourceImageData, 
+	FImageView2D& DestImageData, 
+	bool bDitherMipMapAlpha,
+	const FImageKernel2D& Kernel,
+	uint32 ScaleFactor,
+	bool bSharpenWithoutColorShift )
+{
+	check( SourceImageData.SizeX == ScaleFactor * DestImageData.SizeX || DestImageData.SizeX == 1 );
+	check( SourceImageData.SizeY == ScaleFactor * DestImageData.SizeY || DestImageData.SizeY == 1 );
+	check( Kernel.GetFilterTableSize() >= 2 );
+
+	TSharpenedMipRowProcessor<AddressMode> Processor(SourceImageData, DestImageData, bDitherMipMapAlpha, Kernel, ScaleFactor, bSharpenWithoutColorShift);
+
+	// each destination row only reads from the source, so rows can be filtered in parallel
+	ProcessImageRows(Processor, DestImageData.SizeY, DestImageData.SizeX * Kernel.GetFilterTableSize() * Kernel.GetFilterTableSize());
 }
 
 // to switch conveniently between different texture wrapping modes for the mip map generation
@@ -781,6 +899,41 @@ static int32 ComputeLongLatCubemapExtents(const FImage& SrcImage)
 	return FMath::Clamp(1 << FMath::FloorLog2(SrcImage.SizeX / 2), 32, 512);
 }
 
+/**
+ * Generates rows of a cubemap mip from a longitude-latitude 2D image, rows of all faces are numbered consecutively.
+ */
+class FLongLatCubeMipRowProcessor
+{
+public:
+	FLongLatCubeMipRowProcessor(FImage& InMip, const FImageViewLongLat& InLongLatView)
+		: Mip(InMip)
+		, LongLatView(InLongLatView)
+		, Extent(InMip.SizeX)
+		, InvExtent(1.0f / InMip.SizeX)
+	{
+	}
+
+	void ProcessRow(int32 Row)
+	{
+		const uint32 Face = Row / Extent;
+		const int32 y = Row % Extent;
+
+		FImageView2D MipView(Mip, Face);
+		for(int32 x = 0; x < Extent; ++x)
+		{
+			FVector DirectionWS = ComputeWSCubeDirectionAtTexelCenter(Face, x, y, InvExtent);
+			MipView.Access(x, y) = LongLatView.LookupLongLat(DirectionWS);
+		}
+	}
+
+private:
+
+	FImage& Mip;
+	const FImageViewLongLat& LongLatView;
+	int32 Extent;
+	float InvExtent;
+};
+
 /**
  * Generates the base cubemap mip from a longitude-latitude 2D image.
  * @param OutMip - The output mip.
@@ -794,21 +947,10 @@ static void GenerateBaseCubeMipFromLongitudeLatitude2D(FImage* OutMip, const FIm
 
 	// TODO_TEXTURE: Expose target size to user.
 	int32 Extent = ComputeLongLatCubemapExtents(LongLatImage);
-	float InvExtent = 1.0f / Extent;
 	OutMip->Init(Extent, Extent, 6, ERawImageFormat::RGBA32F, false);
 
-	for(uint32 Face = 0; Face < 6; ++Face)
-	{
-		FImageView2D MipView(*OutMip, Face);
-		for(int32 y = 0; y < Extent; ++y)
-		{
-			for(int32 x = 0; x < Extent; ++x)
-			{
-				FVector DirectionWS = ComputeWSCubeDirectionAtTexelCenter(Face, x, y, InvExtent);
-				MipView.Access(x, y) = LongLatView.LookupLongLat(DirectionWS);
-			}
-		}
-	}
+	FLongLatCubeMipRowProcessor Processor(*OutMip, LongLatView);
+	ProcessImageRows(Processor, 6 * Extent, Extent * 4);
 }
 
 class FTexelProcessor
@@ -816,11 +958,13 @@ class FTexelProcessor
 public:
 	// @param InConeAxisSS - normalized, in side space
 	// @param TexelAreaArray - precomputed area of each texel for correct weighting
-	FTexelProcessor(const FVector& InConeAxisSS, float ConeAngle, const FLinearColor* InSideData, const float* InTexelAreaArray, uint32 InFullExtent)
+	// @param TexelDirectionArray - precomputed normalized side space direction at the center of each texel
+	FTexelProcessor(const FVector& InConeAxisSS, float ConeAngle, const FLinearColor* InSideData, const float* InTexelAreaArray, const FVector* InTexelDirectionArray, uint32 InFullExtent)
 		: ConeAxisSS(InConeAxisSS)
 		, AccumulatedColor(0, 0, 0, 0)
 		, SideData(InSideData)
 		, TexelAreaArray(InTexelAreaArray)
+		, TexelDirectionArray(InTexelDirectionArray)
 		, FullExtent(InFullExtent)
 	{
 		ConeAngleSin = sinf(ConeAngle);
@@ -859,7 +1003,7 @@ public:
 	{
 		const FLinearColor* In = &SideData[x + y * FullExtent];
 		
-		FVector DirectionSS = ComputeSSCubeDirectionAtTexelCenter(x, y, InvFullExtent);
+		const FVector& DirectionSS = TexelDirectionArray[x + y * FullExtent];
 
 		float DotValue = ConeAxisSS | DirectionSS;
 
@@ -902,6 +1046,7 @@ public:
 	/** [x + y * FullExtent] */
 	const FLinearColor* SideData;
 	const float* TexelAreaArray;
+	const FVector* TexelDirectionArray;
 	uint32 FullExtent;
 };
 
@@ -927,7 +1072,7 @@ void TCubemapSideRasterizer(TVisitor &TexelProcessor, int32 x, uint32 y, uint32
 	}
 }
 
-static FLinearColor IntegrateAngularArea(FImage& Image, FVector FilterDirectionWS, float ConeAngle, const float* TexelAreaArray)
+static FLinearColor IntegrateAngularArea(FImage& Image, FVector FilterDirectionWS, float ConeAngle, const float* TexelAreaArray, const FVector* TexelDirectionArray)
 {
 	// Alpha channel is used to renormalize later
 	FLinearColor ret(0, 0, 0, 0);
@@ -937,7 +1082,7 @@ static FLinearColor IntegrateAngularArea(FImage& Image, FVector FilterDirectionW
 	{
 		FImageView2D ImageView(Image, Face);
 		FVector FilterDirectionSS = TransformWorldToSideSpace(Face, FilterDirectionWS);
-		FTexelProcessor Processor(FilterDirectionSS, ConeAngle, &ImageView.Access(0,0), TexelAreaArray, Extent);
+		FTexelProcessor Processor(FilterDirectionSS, ConeAngle, &ImageView.Access(0,0), TexelAreaArray, TexelDirectionArray, Extent);
 
 		// recursively split the (0,0)-(Extent-1,Extent-1), tests for intersection and processes only colors inside
 		TCubemapSideRasterizer(Processor, 0, 0, Extent);
@@ -987,6 +1132,47 @@ static float ComputeTexelArea(uint32 x, uint32 y, float InvSideExtentMul2)
 	return TriangleArea2_3D(CornerA, CornerB, CornerC) + TriangleArea2_3D(CornerC, CornerB, CornerD) * 0.5f;
 }
 
+/**
+ * Generates rows of an angular filtered mip, rows of all faces are numbered consecutively.
+ */
+class FAngularFilteredMipRowProcessor
+{
+public:
+	FAngularFilteredMipRowProcessor(FImage& InDestMip, FImage& InSrcMip, float InConeAngle, const float* InTexelAreaArray, const FVector* InTexelDirectionArray)
+		: DestMip(InDestMip)
+		, SrcMip(InSrcMip)
+		, ConeAngle(InConeAngle)
+		, TexelAreaArray(InTexelAreaArray)
+		, TexelDirectionArray(InTexelDirectionArray)
+		, Extent(InDestMip.SizeX)
+		, InvSideExtent(1.0f / InDestMip.SizeX)
+	{
+	}
+
+	void ProcessRow(int32 Row)
+	{
+		const uint32 Face = Row / Extent;
+		const int32 y = Row % Extent;
+
+		FImageView2D DestMipView(DestMip, Face);
+		for(int32 x = 0; x < Extent; ++x)
+		{
+			FVector DirectionWS = ComputeWSCubeDirectionAtTexelCenter(Face, x, y, InvSideExtent);
+			DestMipView.Access(x,y) = IntegrateAngularArea(SrcMip, DirectionWS, ConeAngle, TexelAreaArray, TexelDirectionArray);
+		}
+	}
+
+private:
+
+	FImage& DestMip;
+	FImage& SrcMip;
+	float ConeAngle;
+	const float* TexelAreaArray;
+	const FVector* TexelDirectionArray;
+	int32 Extent;
+	float InvSideExtent;
+};
+
 /**
  * Generate a mip using angular filtering.
  * @param DestMip - The filtered mip.
@@ -997,32 +1183,67 @@ static void GenerateAngularFilteredMip(FImage* DestMip, FImage& SrcMip, float Co
 {
 	int32 Extent = DestMip->SizeX;
 	float InvSideExtent = 1.0f / Extent;
+	float InvSrcExtent = 1.0f / SrcMip.SizeX;
 
 	TArray<float> TexelAreaArray;
 	TexelAreaArray.AddUninitialized(SrcMip.SizeX * SrcMip.SizeY);
 
-	// precompute the area size for one face (is the same for each face)
+	TArray<FVector> TexelDirectionArray;
+	TexelDirectionArray.AddUninitialized(SrcMip.SizeX * SrcMip.SizeY);
+
+	// precompute the area size and the texel directions for one face (is the same for each face)
 	for(int32 y = 0; y < SrcMip.SizeY; ++y)
 	{
 		for(int32 x = 0; x < SrcMip.SizeX; ++x)
 		{
 			TexelAreaArray[x + y * SrcMip.SizeX] = ComputeTexelArea(x, y, InvSideExtent * 2);
+			TexelDirectionArray[x + y * SrcMip.SizeX] = ComputeSSCubeDirectionAtTexelCenter(x, y, InvSrcExtent);
 		}
 	}
 
-	for(int32 Face = 0; Face < 6; ++Face)
+	// every destination texel integrates over the whole source mip, so this is by far the most expensive step
+	FAngularFilteredMipRowProcessor Processor(*DestMip, SrcMip, ConeAngle, TexelAreaArray.GetData(), TexelDirectionArray.GetData());
+	ProcessImageRows(Processor, 6 * Extent, Extent * 6 * SrcMip.SizeX * SrcMip.SizeY);
+}
+
+/**
+ * Generates rows of a simple averaged cubemap mip, rows of all faces are numbered consecutively.
+ */
+class FAveragedCubeMipRowProcessor
+{
+public:
+	FAveragedCubeMipRowProcessor(FImage& InBaseMip, FImage& InMip)
+		: BaseMip(InBaseMip)
+		, Mip(InMip)
+		, MipExtent(InMip.SizeX)
+	{
+	}
+
+	void ProcessRow(int32 Row)
 	{
-		FImageView2D DestMipView(*DestMip, Face);
-		for(int32 y = 0; y < Extent; ++y)
+		const int32 Face = Row / MipExtent;
+		const int32 y = Row % MipExtent;
+
+		FImageView2D BaseMipView(BaseMip, Face);
+		FImageView2D MipView(Mip, Face);
+
+		const VectorRegister Quarter = MakeVectorRegister( 0.25f, 0.25f, 0.25f, 0.25f );
+
+		for(int32 x = 0; x < MipExtent; ++x)
 		{
-			for(int32 x = 0; x < Extent; ++x)
-			{
-				FVector DirectionWS = ComputeWSCubeDirectionAtTexelCenter(Face, x, y, InvSideExtent);
-				DestMipView.Access(x,y) = IntegrateAngularArea(SrcMip, DirectionWS, ConeAngle, TexelAreaArray.GetData());
-			}
+			VectorRegister Sum = VectorAdd(
+				VectorAdd( VectorLoad( &BaseMipView.Access(x*2, y*2) ), VectorLoad( &BaseMipView.Access(x*2+1, y*2) ) ),
+				VectorAdd( VectorLoad( &BaseMipView.Access(x*2, y*2+1) ), VectorLoad( &BaseMipView.Access(x*2+1, y*2+1) ) ) );
+			VectorStore( VectorMultiply( Sum, Quarter ), &MipView.Access(x,y) );
 		}
 	}
-}
+
+private:
+
+	FImage& BaseMip;
+	FImage& Mip;
+	int32 MipExtent;
+};
 
 /**
  * Generates angularly filtered mips.
@@ -1044,25 +1265,8 @@ static void GenerateAngularFilteredMips(TArray<FImage>& InOutMipChain, int32 Num
 		int32 MipExtent = FMath::Max(BaseExtent >> 1, 1);
 		FImage* Mip = new(SrcMipChain) FImage(MipExtent, MipExtent, BaseMip.NumSlices, BaseMip.Format);
 
-		for(int32 Face = 0; Face < 6; ++Face)
-		{
-			FImageView2D BaseMipView(BaseMip, Face);
-			FImageView2D MipView(*Mip, Face);
-
-			for(int32 y = 0; y < MipExtent; ++y)
-			{
-				for(int32 x = 0; x < MipExtent; ++x)
-				{		
-					FLinearColor Sum = (
-						BaseMipView.Access(x*2, y*2) +
-						BaseMipView.Access(x*2+1, y*2) +
-						BaseMipView.Access(x*2, y*2+1) +
-						BaseMipView.Access(x*2+1, y*2+1)
-						) * 0.25f;
-					MipView.Access(x,y) = Sum;
-				}
-			}
-		}
+		FAveragedCubeMipRowProcessor Processor(SrcMipChain[MipIndex - 1], *Mip);
+		ProcessImageRows(Processor, 6 * MipExtent, MipExtent * 4);
 	}
 
 	int32 Extent = 1 << (NumMips - 1);
@@ -3051,7 +3051,29 @@ void FKismetCompilerContext::Compile()
 			GConfig->GetBool(TEXT("Kismet"), TEXT("CompileDisplaysBinaryBackend"), /*out*/ bDisplayBytecode, GEngineIni);
 		}
 
+		// Blueprints listed in the engine ini are converted to C++ when asked for on the command line (normally by the cook),
+		// even when regenerating on load, so the generated code can be compiled into the game module
+		bool bNativize = false;
+		if (bIsFullCompile && FParse::Param(FCommandLine::Get(), TEXT("NativizeBlueprints")))
+		{
+			TArray<FString> NativizedBlueprints;
+			GConfig->GetArray(TEXT("Kismet"), TEXT("NativizedBlueprints"), NativizedBlueprints, GEngineIni);
+			bNativize = NativizedBlueprints.Contains(Blueprint->GetPathName());
+		}
+
 		// Generate code thru the backend(s)
+		if (bNativize)
+		{
+			FKismetCppBackend Backend_CPP(Schema, *this);
+			Backend_CPP.GenerateCodeFromClass(NewClass, FunctionList, !bIsFullCompile);
+
+			const FString OutputDirectory = FPaths::GameIntermediateDir() / TEXT("NativizedBlueprints");
+			if (Backend_CPP.SaveGeneratedCode(OutputDirectory))
+			{
+				UE_LOG(LogK2Compiler, Log, TEXT("Nativized %s to %s"), *Blueprint->GetPathName(), *OutputDirectory);
+			}
+		}
+
 		if (bDisplayCpp && bIsFullCompile)
 		{
 			FKismetCppBackend Backend_CPP(Schema, *this);
@@ -52,6 +52,9 @@ protected:
 
 	FString CppClassName;
 
+	/** Name of the generated files, without extension */
+	FString FileName;
+
 	// Pointers to commonly used structures (found in constructor)
 	UScriptStruct* VectorStruct;
 	UScriptStruct* RotatorStruct;
@@ -62,7 +65,13 @@ public:
 	FStringOutputDevice Body;
 protected:
 	FString TermToText(FBPTerminal* Term, UProperty* SourceProperty = NULL);
-	FString LatentFunctionInfoTermToText(FBPTerminal* Term, FBlueprintCompiledStatement* TargetLabel);
+	FString LatentFunctionInfoTermToText(FBPTerminal* Term, UProperty* LatentInfoProperty, FBlueprintCompiledStatement* TargetLabel);
+
+	/** Returns true if the type comes from a native module, rather than being defined by a blueprint */
+	static bool IsNativeType(UField* Type);
+
+	/** Adds any blueprint defined enums and structs used by the property (and the structs it uses) to OutTypes, dependencies first */
+	void GatherUserDefinedTypes(UProperty* Property, TArray<UField*>& OutTypes);
 
 	int32 StatementToStateIndex(FKismetFunctionContext& FunctionContext, FBlueprintCompiledStatement* Statement)
 	{
@@ -90,8 +99,23 @@ public:
 
 	void EmitClassProperties(FStringOutputDevice& Target, UClass* SourceClass);
 
+	/** Emits declarations for the blueprint defined enums and structs used by the class */
+	void EmitUserDefinedTypes(UClass* SourceClass, TIndirectArray<FKismetFunctionContext>& Functions);
+	void EmitEnum(UEnum* Enum);
+	void EmitStruct(UScriptStruct* Struct);
+
+	/** Emits the constructor, which sets up the properties that differ from the parent class defaults */
+	void EmitConstructor(UClass* SourceClass);
+
 	void GenerateCodeFromClass(UClass* SourceClass, TIndirectArray<FKismetFunctionContext>& Functions, bool bGenerateStubsOnly=false);
 
+	/**
+	 * Writes the generated header and source file to a directory
+	 *
+	 * @return	true if both files were written
+	 */
+	bool SaveGeneratedCode(const FString& Directory);
+
 	void EmitCallStatment(FKismetFunctionContext& FunctionContext, FBlueprintCompiledStatement& Statement);
 	void EmitCallDelegateStatment(FKismetFunctionContext& FunctionContext, FBlueprintCompiledStatement& Statement);
 	void EmitAssignmentStatment(FKismetFunctionContext& FunctionContext, FBlueprintCompiledStatement& Statement);
@@ -56,7 +56,7 @@ FString FKismetCppBackend::TermToText(FBPTerminal* Term, UProperty* CoerceProper
 		else if (UNameProperty* NameProperty = Cast<UNameProperty>(CoerceProperty))
 		{
 			FName LiteralName(*(Term->Name));
-			return FString::Printf(TEXT("FName(TEXT(\"%s\")"), *(LiteralName.ToString()));
+			return FString::Printf(TEXT("FName(TEXT(\"%s\"))"), *(LiteralName.ToString()));
 		}
 		else if (UStructProperty* StructProperty = Cast<UStructProperty>(CoerceProperty))
 		{
@@ -94,7 +94,11 @@ FString FKismetCppBackend::TermToText(FBPTerminal* Term, UProperty* CoerceProper
 		}
 		else if (UClassProperty* ClassProperty = Cast<UClassProperty>(CoerceProperty))
 		{
-			return FString::Printf(TEXT("%s::StaticClass()"), *(Term->Name)); //@TODO: Need the correct class prefix
+			if (UClass* LiteralClass = Cast<UClass>(Term->ObjectLiteral))
+			{
+				return FString::Printf(TEXT("%s%s::StaticClass()"), LiteralClass->GetPrefixCPP(), *LiteralClass->GetName());
+			}
+			return FString(TEXT("NULL"));
 		}
 		else if (CoerceProperty->IsA(UDelegateProperty::StaticClass()))
 		{
@@ -118,7 +122,7 @@ FString FKismetCppBackend::TermToText(FBPTerminal* Term, UProperty* CoerceProper
 			{
 				if (UClass* LiteralClass = Cast<UClass>(Term->ObjectLiteral))
 				{
-					return FString::Printf(TEXT("%s::StaticClass()"), *LiteralClass->GetName()); //@TODO: Need the correct class prefix
+					return FString::Printf(TEXT("%s%s::StaticClass()"), LiteralClass->GetPrefixCPP(), *LiteralClass->GetName());
 				}
 				else
 				{
@@ -174,7 +178,7 @@ FString FKismetCppBackend::TermToText(FBPTerminal* Term, UProperty* CoerceProper
 	}
 }
 
-FString FKismetCppBackend::LatentFunctionInfoTermToText(FBPTerminal* Term, FBlueprintCompiledStatement* TargetLabel)
+FString FKismetCppBackend::LatentFunctionInfoTermToText(FBPTerminal* Term, UProperty* LatentInfoProperty, FBlueprintCompiledStatement* TargetLabel)
 {
 	check(LatentInfoStruct);
 
@@ -191,15 +195,18 @@ FString FKismetCppBackend::LatentFunctionInfoTermToText(FBPTerminal* Term, FBlue
 
 	check(!FixupTermName.IsEmpty());
 
-	FString StructValues = Term->Name;
+	// The term holds the struct as import text, read it back the same way the VM backend does
+	UStructProperty* StructProperty = CastChecked<UStructProperty>(LatentInfoProperty);
+	check(StructProperty->Struct == LatentInfoStruct);
+
+	FLatentActionInfo LatentInfo;
+	StructProperty->ImportText(*Term->Name, &LatentInfo, 0, NULL, GLog);
 
 	// Index 0 is always the ubergraph
 	const int32 TargetStateIndex = StateMapPerFunction[0].StatementToStateIndex(TargetLabel);
-	const int32 LinkageTermStartIdx = StructValues.Find(FixupTermName);
-	check(LinkageTermStartIdx != INDEX_NONE);
-	StructValues = StructValues.Replace(TEXT("-1"), *FString::FromInt(TargetStateIndex));
 
-	return FString(TEXT("F")) + LatentInfoStruct->GetName() + StructValues;
+	// The callback target is always the object running the latent action
+	return FString::Printf(TEXT("FLatentActionInfo(%d, %d, TEXT(\"%s\"), this)"), TargetStateIndex, LatentInfo.UUID, *LatentInfo.ExecutionFunction.ToString());
 }
 
 void FKismetCppBackend::EmitClassProperties(FStringOutputDevice& Target, UClass* SourceClass)
@@ -211,27 +218,200 @@ void FKismetCppBackend::EmitClassProperties(FStringOutputDevice& Target, UClass*
 	{
 		UProperty* Property = *It;
 
-		Emit(Header, TEXT("\n\tUPROPERTY()\n"));
-		Emit(Header, TEXT("\t"));
+		// Keep the property visible to any blueprints that derive from the generated class
+		const TCHAR* Specifier = Property->HasAnyPropertyFlags(CPF_BlueprintReadOnly) ? TEXT("BlueprintReadOnly") : TEXT("BlueprintReadWrite");
+
+		Emit(Target, *FString::Printf(TEXT("\n\tUPROPERTY(%s, Category=Default)\n"), Specifier));
+		Emit(Target, TEXT("\t"));
 		Property->ExportCppDeclaration(Target, EExportedDeclaration::Member);
+		Emit(Target, TEXT(";\n"));
+	}
+}
+
+bool FKismetCppBackend::IsNativeType(UField* Type)
+{
+	return (Type->GetOutermost()->PackageFlags & PKG_CompiledIn) != 0;
+}
+
+void FKismetCppBackend::GatherUserDefinedTypes(UProperty* Property, TArray<UField*>& OutTypes)
+{
+	if (UArrayProperty* ArrayProperty = Cast<UArrayProperty>(Property))
+	{
+		GatherUserDefinedTypes(ArrayProperty->Inner, OutTypes);
+	}
+	else if (UByteProperty* ByteProperty = Cast<UByteProperty>(Property))
+	{
+		if (ByteProperty->Enum && !IsNativeType(ByteProperty->Enum))
+		{
+			OutTypes.AddUnique(ByteProperty->Enum);
+		}
+	}
+	else if (UStructProperty* StructProperty = Cast<UStructProperty>(Property))
+	{
+		UScriptStruct* Struct = StructProperty->Struct;
+		if (!IsNativeType(Struct) && !OutTypes.Contains(Struct))
+		{
+			// Members have to be declared before the struct that contains them
+			for (TFieldIterator<UProperty> It(Struct); It; ++It)
+			{
+				GatherUserDefinedTypes(*It, OutTypes);
+			}
+			OutTypes.AddUnique(Struct);
+		}
+	}
+}
+
+void FKismetCppBackend::EmitUserDefinedTypes(UClass* SourceClass, TIndirectArray<FKismetFunctionContext>& Functions)
+{
+	TArray<UField*> Types;
+	for (TFieldIterator<UProperty> It(SourceClass, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+	{
+		GatherUserDefinedTypes(*It, Types);
+	}
+
+	for (int32 i = 0; i < Functions.Num(); ++i)
+	{
+		if (Functions[i].IsValid())
+		{
+			for (TFieldIterator<UProperty> It(Functions[i].Function); It; ++It)
+			{
+				GatherUserDefinedTypes(*It, Types);
+			}
+		}
+	}
+
+	for (int32 i = 0; i < Types.Num(); ++i)
+	{
+		if (UEnum* Enum = Cast<UEnum>(Types[i]))
+		{
+			EmitEnum(Enum);
+		}
+		else
+		{
+			EmitStruct(CastChecked<UScriptStruct>(Types[i]));
+		}
+	}
+}
+
+void FKismetCppBackend::EmitEnum(UEnum* Enum)
+{
+	Emit(Header, TEXT("UENUM(BlueprintType)\n"));
+	Emit(Header, *FString::Printf(TEXT("namespace %s\n{\n"), *Enum->GetName()));
+	Emit(Header, TEXT("\tenum Type\n\t{\n"));
+
+	// The last entry is the autogenerated _MAX, which UHT adds back
+	for (int32 i = 0; i < Enum->NumEnums() - 1; ++i)
+	{
+		const FString EntryName = Enum->GetEnumName(i);
+		const FText DisplayName = Enum->GetEnumText(i);
+		Emit(Header, *FString::Printf(TEXT("\t\t%s UMETA(DisplayName=\"%s\"),\n"), *EntryName, *DisplayName.ToString()));
+	}
+
+	Emit(Header, TEXT("\t};\n}\n\n"));
+}
+
+void FKismetCppBackend::EmitStruct(UScriptStruct* Struct)
+{
+	Emit(Header, TEXT("USTRUCT(BlueprintType)\n"));
+	Emit(Header, *FString::Printf(TEXT("struct F%s\n{\n"), *Struct->GetName()));
+	Emit(Header, TEXT("\tGENERATED_USTRUCT_BODY()\n"));
+
+	for (TFieldIterator<UProperty> It(Struct); It; ++It)
+	{
+		Emit(Header, TEXT("\n\tUPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Default)\n\t"));
+		It->ExportCppDeclaration(Header, EExportedDeclaration::Member);
 		Emit(Header, TEXT(";\n"));
 	}
+
+	Emit(Header, TEXT("};\n\n"));
+}
+
+void FKismetCppBackend::EmitConstructor(UClass* SourceClass)
+{
+	Emit(Body, *FString::Printf(TEXT("%s::%s(const class FPostConstructInitializeProperties& PCIP)\n"), *CppClassName, *CppClassName));
+	Emit(Body, TEXT("\t: Super(PCIP)\n"));
+	Emit(Body, TEXT("{\n"));
+
+	UObject* ClassDefaults = SourceClass->GetDefaultObject(false);
+	UObject* ParentDefaults = SourceClass->GetSuperClass()->GetDefaultObject(false);
+
+	if (ClassDefaults != NULL)
+	{
+		for (TFieldIterator<UProperty> It(SourceClass); It; ++It)
+		{
+			UProperty* Property = *It;
+
+			// Only types that TermToText can write as literals; components and other subobjects are created by the parent class
+			UStructProperty* StructProperty = Cast<UStructProperty>(Property);
+			const bool bIsSimpleType = Property->IsA<UFloatProperty>() || Property->IsA<UIntProperty>() || Property->IsA<UBoolProperty>() || Property->IsA<UStrProperty>() || Property->IsA<UNameProperty>()
+				|| (Property->IsA<UByteProperty>() && CastChecked<UByteProperty>(Property)->Enum == NULL)
+				|| (StructProperty && (StructProperty->Struct == VectorStruct || StructProperty->Struct == RotatorStruct || StructProperty->Struct == TransformStruct));
+			if (!bIsSimpleType || Property->ArrayDim != 1 || Property->HasAnyPropertyFlags(CPF_Transient))
+			{
+				continue;
+			}
+
+			// Inherited values only need setting when the blueprint overrides them
+			const bool bInherited = Property->GetOwnerClass() != SourceClass;
+			if (bInherited && (ParentDefaults == NULL || Property->Identical_InContainer(ClassDefaults, ParentDefaults)))
+			{
+				continue;
+			}
+
+			FBPTerminal Literal;
+			Literal.bIsLiteral = true;
+			Property->ExportText_InContainer(0, Literal.Name, ClassDefaults, NULL, NULL, PPF_None);
+
+			// Native members may be private, and generated properties don't record their C++ access (UHT marks them all RF_Public),
+			// so inherited native members are always set through reflection rather than by name
+			if (bInherited && Property->GetOwnerClass()->HasAnyClassFlags(CLASS_Native))
+			{
+				Emit(Body, TEXT("\t{\n"));
+				Emit(Body, *FString::Printf(TEXT("\t\tUProperty* Property = FindFieldChecked<UProperty>(StaticClass(), TEXT(\"%s\"));\n"), *Property->GetName()));
+				Emit(Body, *FString::Printf(TEXT("\t\tProperty->ImportText(TEXT(\"%s\"), Property->ContainerPtrToValuePtr<uint8>(this), PPF_None, this);\n"), *Literal.Name.ReplaceCharWithEscapedChar()));
+				Emit(Body, TEXT("\t}\n"));
+				continue;
+			}
+
+			Emit(Body, *FString::Printf(TEXT("\t%s = %s;\n"), *Property->GetNameCPP(), *TermToText(&Literal, Property)));
+		}
+	}
+
+	Emit(Body, TEXT("}\n\n"));
 }
 
 void FKismetCppBackend::GenerateCodeFromClass(UClass* SourceClass, TIndirectArray<FKismetFunctionContext>& Functions, bool bGenerateStubsOnly)
 {
 	CppClassName = FString(SourceClass->GetPrefixCPP()) + SourceClass->GetName();
+	FileName = SourceClass->GetName();
 
 	UClass* SuperClass = SourceClass->GetSuperClass();
+
+	// Preamble
+	Emit(Header, TEXT("#pragma once\n\n"));
+	Emit(Header, TEXT("#include \"Engine.h\"\n"));
+	Emit(Header, *FString::Printf(TEXT("#include \"%s.generated.h\"\n\n"), *FileName));
+
+	Emit(Body, *FString::Printf(TEXT("#include \"%s.h\"\n\n"), *FileName));
+
+	EmitUserDefinedTypes(SourceClass, Functions);
+
+	Emit(Header, TEXT("UCLASS()\n"));
 	Emit(Header,
 		*FString::Printf(TEXT("class %s : public %s%s\n"), *CppClassName, SuperClass->GetPrefixCPP(), *SuperClass->GetName()));
 	Emit(Header,
 		TEXT("{\n")
+		TEXT("\tGENERATED_UCLASS_BODY()\n")
+		TEXT("\n")
 		TEXT("public:\n"));
-	Emit(Header, *FString::Printf(TEXT("\tGENERATED_UCLASS_BODY();\n")));
 
 	EmitClassProperties(Header, SourceClass);
 
+	if (!bGenerateStubsOnly)
+	{
+		EmitConstructor(SourceClass);
+	}
+
 	// Create the state map
 	for (int32 i = 0; i < Functions.Num(); ++i)
 	{
@@ -256,6 +436,24 @@ void FKismetCppBackend::GenerateCodeFromClass(UClass* SourceClass, TIndirectArra
 	Emit(Header, TEXT("};\n\n"));
 }
 
+bool FKismetCppBackend::SaveGeneratedCode(const FString& Directory)
+{
+	check(!FileName.IsEmpty());
+
+	const FString HeaderPath = Directory / (FileName + TEXT(".h"));
+	const FString BodyPath = Directory / (FileName + TEXT(".cpp"));
+
+	const bool bSavedHeader = FFileHelper::SaveStringToFile(Header, *HeaderPath);
+	const bool bSavedBody = FFileHelper::SaveStringToFile(Body, *BodyPath);
+	if (!bSavedHeader || !bSavedBody)
+	{
+		UE_LOG(LogK2Compiler, Warning, TEXT("Failed to save the generated code for %s to %s"), *CppClassName, *Directory);
+		return false;
+	}
+
+	return true;
+}
+
 void FKismetCppBackend::EmitCallDelegateStatment(FKismetFunctionContext& FunctionContext, FBlueprintCompiledStatement& Statement)
 {
 	Emit(Body, *FString::Printf(TEXT("\t\t\t%s.Broadcast("), *TermToText(Statement.FunctionContext)));
@@ -290,7 +488,7 @@ void FKismetCppBackend::EmitCallDelegateStatment(FKismetFunctionContext& Functio
 				if( StructProp && StructProp->Struct == LatentInfoStruct )
 				{
 					// Latent function info case
-					VarName = LatentFunctionInfoTermToText(Term, Statement.TargetLabel);
+					VarName = LatentFunctionInfoTermToText(Term, FuncParamProperty, Statement.TargetLabel);
 				}
 				else
 				{
@@ -336,7 +534,8 @@ void FKismetCppBackend::EmitCallStatment(FKismetFunctionContext& FunctionContext
 	{
 		if (Statement.FunctionToCall->HasAnyFunctionFlags(FUNC_Static))
 		{
-			Emit(Body, *FString::Printf(TEXT("U%s::"), *Statement.FunctionToCall->GetOuter()->GetName())); //@TODO: Assuming U prefix but could be A
+			UClass* OwnerClass = Statement.FunctionToCall->GetOwnerClass();
+			Emit(Body, *FString::Printf(TEXT("%s%s::"), OwnerClass->GetPrefixCPP(), *OwnerClass->GetName()));
 		}
 		else
 		{
@@ -349,8 +548,8 @@ void FKismetCppBackend::EmitCallStatment(FKismetFunctionContext& FunctionContext
 	Statement.FunctionToCall->GetName(FunctionNameToCall);
 	if( Statement.bIsParentContext )
 	{
-		const FString ContextString = Statement.FunctionToCall->GetOuter()->GetName();
-		FunctionNameToCall = ContextString + TEXT("::") + FunctionNameToCall;
+		UClass* OwnerClass = Statement.FunctionToCall->GetOwnerClass();
+		FunctionNameToCall = FString(OwnerClass->GetPrefixCPP()) + OwnerClass->GetName() + TEXT("::") + FunctionNameToCall;
 	}
 	Emit(Body, *FString::Printf(TEXT("%s"), *FunctionNameToCall));
 
@@ -389,7 +588,7 @@ void FKismetCppBackend::EmitCallStatment(FKismetFunctionContext& FunctionContext
 					if( StructProp && StructProp->Struct == LatentInfoStruct )
 					{
 						// Latent function info case
-						VarName = LatentFunctionInfoTermToText(Term, Statement.TargetLabel);
+						VarName = LatentFunctionInfoTermToText(Term, FuncParamProperty, Statement.TargetLabel);
 					}
 					else
 					{
@@ -448,12 +647,18 @@ void FKismetCppBackend::EmitCastToInterfaceStatement(FKismetFunctionContext& Fun
 
 void FKismetCppBackend::EmitDynamicCastStatement(FKismetFunctionContext& FunctionContext, FBlueprintCompiledStatement& Statement)
 {
-	FString TargetClass = TermToText(Statement.RHS[0], (UProperty*)(GetDefault<UClassProperty>()));
 	FString ObjectValue = TermToText(Statement.RHS[1], (UProperty*)(GetDefault<UObjectProperty>()));
 	FString CastedValue = TermToText(Statement.LHS, (UProperty*)(GetDefault<UObjectProperty>()));
 
-	Emit(Body, *FString::Printf(TEXT("\t\t\t %s = Cast<%s>(%s);\n"),
-		*CastedValue, *TargetClass, *ObjectValue));
+	// Cast<> needs the class type rather than the class object
+	UClass* TargetClass = Cast<UClass>(Statement.RHS[0]->ObjectLiteral);
+	if (TargetClass == NULL)
+	{
+		TargetClass = UObject::StaticClass();
+	}
+
+	Emit(Body, *FString::Printf(TEXT("\t\t\t%s = Cast<%s%s>(%s);\n"),
+		*CastedValue, TargetClass->GetPrefixCPP(), *TargetClass->GetName(), *ObjectValue));
 }
 
 void FKismetCppBackend::EmitObjectToBoolStatement(FKismetFunctionContext& FunctionContext, FBlueprintCompiledStatement& Statement)
@@ -469,7 +674,7 @@ void FKismetCppBackend::EmitAddMulticastDelegateStatement(FKismetFunctionContext
 	const FString Delegate = TermToText(Statement.LHS);
 	const FString DelegateToAdd = TermToText(Statement.RHS[0]);
 
-	Emit(Body, *FString::Printf(TEXT("\t\t\t%s->Add(%s);\n"), *Delegate, *DelegateToAdd));
+	Emit(Body, *FString::Printf(TEXT("\t\t\t%s.AddUnique(%s);\n"), *Delegate, *DelegateToAdd));
 }
 
 void FKismetCppBackend::EmitRemoveMulticastDelegateStatement(FKismetFunctionContext& FunctionContext, FBlueprintCompiledStatement& Statement)
@@ -477,21 +682,22 @@ void FKismetCppBackend::EmitRemoveMulticastDelegateStatement(FKismetFunctionCont
 	const FString Delegate = TermToText(Statement.LHS);
 	const FString DelegateToAdd = TermToText(Statement.RHS[0]);
 
-	Emit(Body, *FString::Printf(TEXT("\t\t\t%s->Remove(%s);\n"), *Delegate, *DelegateToAdd));
+	Emit(Body, *FString::Printf(TEXT("\t\t\t%s.Remove(%s);\n"), *Delegate, *DelegateToAdd));
 }
 
 void FKismetCppBackend::EmitBindDelegateStatement(FKismetFunctionContext& FunctionContext, FBlueprintCompiledStatement& Statement)
 {
 	check(2 == Statement.RHS.Num());
 	const FString Delegate = TermToText(Statement.LHS);
-	const FString NameTerm = TermToText(Statement.RHS[0]);
+	const FString NameTerm = TermToText(Statement.RHS[0], (UProperty*)(GetDefault<UNameProperty>()));
 	const FString ObjectTerm = TermToText(Statement.RHS[1]);
 
 	Emit(Body, 
 		*FString::Printf(
-			TEXT("\t\t\tif(FScriptDelegate* __Delegate = %s)\n\t\t\t{\n\t\t\t\t__Delegate->SetFunctionName(%s);\n\t\t\t\t__Delegate->SetObject(%s);\n\t\t\t|\n"),
-			*Delegate, 
+			TEXT("\t\t\t%s.SetFunctionName(%s);\n\t\t\t%s.SetObject(%s);\n"),
+			*Delegate,
 			*NameTerm, 
+			*Delegate, 
 			*ObjectTerm
 		)
 	);
@@ -501,7 +707,7 @@ void FKismetCppBackend::EmitClearMulticastDelegateStatement(FKismetFunctionConte
 {
 	const FString Delegate = TermToText(Statement.LHS);
 
-	Emit(Body, *FString::Printf(TEXT("\t\t\t%s->Clear();\n"), *Delegate));
+	Emit(Body, *FString::Printf(TEXT("\t\t\t%s.Clear();\n"), *Delegate));
 }
 
 void FKismetCppBackend::EmitCreateArrayStatement(FKismetFunctionContext& FunctionContext, FBlueprintCompiledStatement& Statement)
@@ -512,14 +718,14 @@ void FKismetCppBackend::EmitCreateArrayStatement(FKismetFunctionContext& Functio
 	UArrayProperty* ArrayProperty = CastChecked<UArrayProperty>(ArrayTerm->AssociatedVarProperty);
 	UProperty* InnerProperty = ArrayProperty->Inner;
 
+	Emit(Body, *FString::Printf(TEXT("\t\t\t%s.Reset(%d);\n"), *Array, Statement.RHS.Num()));
 	for(int32 i = 0; i < Statement.RHS.Num(); ++i)
 	{
 		FBPTerminal* CurrentTerminal = Statement.RHS[i];
 		Emit(Body, 
 			*FString::Printf(
-				TEXT("\t\t\t%s[%d] = %s;"),
+				TEXT("\t\t\t%s.Add(%s);\n"),
 				*Array,
-				i,
 				*TermToText(CurrentTerminal, (CurrentTerminal->bIsLiteral ? InnerProperty : NULL))));
 	}
 }
@@ -597,7 +803,15 @@ void FKismetCppBackend::DeclareLocalVariables(FKismetFunctionContext& FunctionCo
 void FKismetCppBackend::DeclareStateSwitch(FKismetFunctionContext& FunctionContext)
 {
 	Emit(Body, TEXT("\tTArray< int32, TInlineAllocator<8> > StateStack;\n"));
-	Emit(Body, TEXT("\tint32 CurrentState = 0;\n"));
+	if (FunctionContext.IsEventGraph())
+	{
+		// The ubergraph is entered at the state each event (or latent action) asks for
+		Emit(Body, *FString::Printf(TEXT("\tint32 CurrentState = %s;\n"), *Schema->PN_EntryPoint));
+	}
+	else
+	{
+		Emit(Body, TEXT("\tint32 CurrentState = 0;\n"));
+	}
 	Emit(Body, TEXT("\tdo\n"));
 	Emit(Body, TEXT("\t{\n"));
 	Emit(Body, TEXT("\t\tswitch( CurrentState )\n"));
@@ -621,7 +835,6 @@ void FKismetCppBackend::ConstructFunction(FKismetFunctionContext& FunctionContex
 {
 	FString FunctionName;
 	UFunction* Function = FunctionContext.Function;
-	UClass* Class = FunctionContext.NewClass;
 
 	Function->GetName(FunctionName);
 
@@ -674,11 +887,29 @@ void FKismetCppBackend::ConstructFunction(FKismetFunctionContext& FunctionContex
 
 	//@TODO: Make the header+body export more uniform
 	{
-		FString Start = FString::Printf(TEXT("%s %s%s%s("), *ReturnType, TEXT("%s"), TEXT("%s"), *FunctionName);
+		// Overrides of native events go through the _Implementation function rather than being new UFUNCTIONs
+		UFunction* SuperFunction = Function->GetSuperFunction();
+		const bool bOverridesNativeEvent = SuperFunction && SuperFunction->HasAllFunctionFlags(FUNC_Event | FUNC_Native);
+		if (SuperFunction && SuperFunction->HasAnyFunctionFlags(FUNC_Event) && !bOverridesNativeEvent)
+		{
+			MessageLog.Warning(*FString::Printf(TEXT("Function %s from graph @@ implements a BlueprintImplementableEvent, which native code can not override"), *FunctionName), FunctionContext.SourceGraph);
+		}
+
+		FString DeclaredName = FunctionName;
+		if (bOverridesNativeEvent)
+		{
+			DeclaredName += TEXT("_Implementation");
+			Emit(Header, TEXT("\tvirtual "));
+		}
+		else
+		{
+			Emit(Header, TEXT("\tUFUNCTION(BlueprintCallable, Category=Default)\n\t"));
+		}
+
+		FString Start = FString::Printf(TEXT("%s %s%s%s("), *ReturnType, TEXT("%s"), TEXT("%s"), *DeclaredName);
 
-		Emit(Header, TEXT("\t"));
 		Emit(Header, *FString::Printf(*Start, TEXT(""), TEXT("")));
-		Emit(Body, *FString::Printf(*Start, *Class->GetName(), TEXT("::")));
+		Emit(Body, *FString::Printf(*Start, *CppClassName, TEXT("::")));
 
 		for (int32 i = 0; i < ArgumentList.Num(); ++i)
 		{
@@ -700,7 +931,7 @@ void FKismetCppBackend::ConstructFunction(FKismetFunctionContext& FunctionContex
 			ArgProperty->ExportCppDeclaration(Body,   EExportedDeclaration::Parameter);
 		}
 
-		Emit(Header, TEXT(");\n"));
+		Emit(Header, bOverridesNativeEvent ? TEXT(") OVERRIDE;\n") : TEXT(");\n"));
 		Emit(Body, TEXT(")\n"));
 	}
 
@@ -405,4 +405,7 @@ void FNiagaraEditorModule::CompileScript(UNiagaraScript* ScriptToCompile)
 	// And copy the constant table and attributes.
 	ScriptToCompile->ConstantTable = Context.Constants;
 	ScriptToCompile->Attributes = Context.Attributes;
+
+	// Running simulations pick up the new native code on their next tick.
+	ScriptToCompile->BuildNativeProgram();
 }
@@ -30,6 +30,12 @@ class UCookCommandlet
 	bool bUnversioned;
 	/** Generate manifests for building streaming install packages */
 	bool bGenerateStreamingInstallManifests;
+	/** Number of worker processes to shard the cook across, 0 or 1 to cook in this process */
+	int32 NumCookWorkers;
+	/** If true, this process is a worker cooking the packages listed in CookWorkerListFilename for a coordinating process */
+	bool bCookWorker;
+	/** File listing the packages this worker should cook */
+	FString CookWorkerListFilename;
 	/** All commandline tokens */
 	TArray<FString> Tokens;
 	/** All commandline switches */
@@ -57,14 +63,27 @@ class UCookCommandlet
 	FString GetOutputDirectory( const FString& PlatformName ) const;
 
 	/**
-	 *	Get the given packages 'cooked' timestamp (i.e. account for dependencies)
+	 *	Get the hash that the given package's cooked data for a platform is keyed on: the package source,
+	 *	everything it depends on, and the settings of the platform being cooked for
 	 *
 	 *	@param	InFilename			The filename of the package
-	 *	@param	OutDateTime			The timestamp the cooked file should have
+	 *	@param	Platform			The platform being cooked for
+	 *	@param	OutHash				The hash the cooked package should have been cooked with
 	 *
-	 *	@return	bool				true if the package timestamp was found, false if not
+	 *	@return	bool				true if the hash could be determined, false if not
 	 */
-	bool GetPackageTimestamp( const FString& InFilename, FDateTime& OutDateTime );
+	bool GetPackageCookHash( const FString& InFilename, ITargetPlatform* Platform, FString& OutHash );
+
+	/**
+	 *	Check if the cooked version of a package was cooked from the current source data
+	 *
+	 *	@param	InFilename			The filename of the source package
+	 *	@param	CookedFilename		The filename of the cooked package for the platform
+	 *	@param	Platform			The platform being cooked for
+	 *
+	 *	@return	bool				true if the cooked package exists and is up to date
+	 */
+	bool IsCookedPackageUpToDate( const FString& InFilename, const FString& CookedFilename, ITargetPlatform* Platform );
 
 	/**
 	 *	Cook (save) the given package
@@ -110,6 +129,12 @@ private:
 	/** Leak test: last gc items */
 	TSet<FWeakObjectPtr> LastGCItems;
 
+	/** Per platform name, the cook hash of every cooked package, keyed by the cooked filename relative to the platform's sandbox */
+	TMap<FString, TMap<FString, FString> > CookedPackageHashes;
+
+	/** Per platform name, the hash of the settings that affect all cooked data for the platform */
+	TMap<FString, FSHAHash> PlatformSettingsHashes;
+
 	void MaybeMarkPackageAsAlreadyLoaded(UPackage *Package);
 
 	/** Gets the output directory respecting any command line overrides */
@@ -118,6 +143,21 @@ private:
 	/** Cleans sandbox folders for all target platforms */
 	void CleanSandbox(const TArray<ITargetPlatform*>& Platforms);
 
+	/** Gets the hash of everything outside of the packages that affects the cooked data for a platform */
+	const FSHAHash& GetPlatformSettingsHash(ITargetPlatform* Platform);
+
+	/** Gets the key of a cooked file in the cooked package hashes of a platform */
+	FString GetCookedPackageHashKey(const FString& CookedFilename, const FString& PlatformName) const;
+
+	/** Gets the file the cooked package hashes of a platform are saved to, in the platform's sandbox */
+	FString GetCookedPackageHashesFilename(const FString& PlatformName) const;
+
+	/** Loads the hashes of the packages cooked by an earlier run */
+	void LoadCookedPackageHashes(const TArray<ITargetPlatform*>& Platforms);
+
+	/** Saves the hashes of all the cooked packages, so later iterative cooks can tell what is up to date */
+	void SaveCookedPackageHashes(const TArray<ITargetPlatform*>& Platforms);
+
 	/** Generates asset registry */
 	void GenerateAssetRegistry(const TArray<ITargetPlatform*>& Platforms);
 
@@ -133,5 +173,17 @@ private:
 	/** Cooks all files */
 	bool Cook(const TArray<ITargetPlatform*>& Platforms, TArray<FString>& FilesInPath);
 
+	/** Cooks all files by splitting them between NumCookWorkers worker processes, then merges what they cooked */
+	bool CookWithWorkers(const TArray<ITargetPlatform*>& Platforms, TArray<FString>& FilesInPath);
+
+	/**
+	 * Moves the output of a worker into the sandbox of this process, along with the cook hashes of the moved packages.
+	 * Files already in the sandbox are left alone, since every package that needed cooking was deleted from it when cleaning the sandbox.
+	 *
+	 * @param Platforms			The platforms being cooked for
+	 * @param WorkerOutput		The output directory of the worker, with the [Platform] token
+	 */
+	void MergeCookWorkerOutput(const TArray<ITargetPlatform*>& Platforms, const FString& WorkerOutput);
+
 
 };
\ No newline at end of file
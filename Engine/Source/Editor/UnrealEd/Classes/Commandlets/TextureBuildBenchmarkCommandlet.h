@@ -0,0 +1,18 @@
+// Copyright 1998-2014 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+#include "TextureBuildBenchmarkCommandlet.generated.h"
+
+/**
+ * Measures how long the texture compressor takes to build the mip chain of a synthetic texture.
+ *
+ * Usage: TextureBuildBenchmark [-Size=2048] [-Iterations=4] [-Sharpen=0] [-Cube] [-Format=BGRA8]
+ */
+UCLASS()
+class UTextureBuildBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_UCLASS_BODY()
+	// Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) OVERRIDE;
+	// End UCommandlet Interface
+};
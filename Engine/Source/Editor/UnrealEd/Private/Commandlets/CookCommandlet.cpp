@@ -391,14 +391,23 @@ FString UCookCommandlet::GetOutputDirectory( const FString& PlatformName ) const
 }
 
 
-bool UCookCommandlet::GetPackageTimestamp( const FString& InFilename, FDateTime& OutDateTime )
+bool UCookCommandlet::GetPackageCookHash( const FString& InFilename, ITargetPlatform* Platform, FString& OutHash )
 {
 	FPackageDependencyInfoModule& PDInfoModule = FModuleManager::LoadModuleChecked<FPackageDependencyInfoModule>("PackageDependencyInfo");
-	FDateTime DependentTime;
+	FSHAHash DependentHash;
 
-	if (PDInfoModule.DeterminePackageDependentTimeStamp(*InFilename, DependentTime) == true)
+	if (PDInfoModule.DeterminePackageDependentHash(*FPaths::GetBaseFilename(InFilename, false), DependentHash) == true)
 	{
-		OutDateTime = DependentTime;
+		const FSHAHash& SettingsHash = GetPlatformSettingsHash(Platform);
+
+		FSHA1 Hasher;
+		Hasher.Update(DependentHash.Hash, sizeof(DependentHash.Hash));
+		Hasher.Update(SettingsHash.Hash, sizeof(SettingsHash.Hash));
+		Hasher.Final();
+
+		FSHAHash CookHash;
+		Hasher.GetHash(CookHash.Hash);
+		OutHash = CookHash.ToString();
 
 		return true;
 	}
@@ -406,49 +415,54 @@ bool UCookCommandlet::GetPackageTimestamp( const FString& InFilename, FDateTime&
 	return false;
 }
 
-bool UCookCommandlet::ShouldCook(const FString& InFileName)
+bool UCookCommandlet::IsCookedPackageUpToDate( const FString& InFilename, const FString& CookedFilename, ITargetPlatform* Platform )
 {
-	bool bDoCook = false;
+	const TMap<FString, FString>* PlatformHashes = CookedPackageHashes.Find(Platform->PlatformName());
+	const FString* CookedHash = PlatformHashes ? PlatformHashes->Find(GetCookedPackageHashKey(CookedFilename, Platform->PlatformName())) : NULL;
 
-	FString PkgFile;
-	FString PkgFilename;
-	FDateTime DependentTimeStamp = FDateTime::MinValue();
+	// If we don't know what the package was cooked from, or it has been deleted since, re-cook it
+	if (CookedHash == NULL || IFileManager::Get().FileSize(*CookedFilename) < 0)
+	{
+		return false;
+	}
 
-	if (bIterativeCooking && FPackageName::DoesPackageExist(InFileName, NULL, &PkgFile))
+	FString CurrentHash;
+	if (GetPackageCookHash(InFilename, Platform, CurrentHash) == false)
 	{
-		PkgFilename = PkgFile;
+		UE_LOG(LogCookCommandlet, Display, TEXT("Failed to find dependency hash for: %s"), *InFilename);
+		return false;
+	}
 
-		if (GetPackageTimestamp(FPaths::GetBaseFilename(PkgFilename, false), DependentTimeStamp) == false)
-		{
-			UE_LOG(LogCookCommandlet, Display, TEXT("Failed to find depedency timestamp for: %s"), *PkgFilename);
-		}
+	return *CookedHash == CurrentHash;
+}
+
+bool UCookCommandlet::ShouldCook(const FString& InFileName)
+{
+	// If we are not iterative cooking, then cook the package
+	FString PkgFilename;
+	if (bIterativeCooking == false || !FPackageName::DoesPackageExist(InFileName, NULL, &PkgFilename))
+	{
+		return true;
 	}
 
 	// Use SandboxFile to do path conversion to properly handle sandbox paths (outside of standard paths in particular).
-	PkgFilename = SandboxFile->ConvertToAbsolutePathForExternalAppForWrite(*PkgFilename);
+	FString SandboxFilename = SandboxFile->ConvertToAbsolutePathForExternalAppForWrite(*PkgFilename);
 
 	ITargetPlatformManagerModule& TPM = GetTargetPlatformManagerRef();
 	static const TArray<ITargetPlatform*>& Platforms =  TPM.GetActiveTargetPlatforms();
 
-	for (int32 Index = 0; Index < Platforms.Num() && !bDoCook; Index++)
+	for (int32 Index = 0; Index < Platforms.Num(); Index++)
 	{
 		ITargetPlatform* Target = Platforms[Index];
-		FString PlatFilename = PkgFilename.Replace(TEXT("[Platform]"), *Target->PlatformName());
-
-		// If we are not iterative cooking, then cook the package
-		bool bCookPackage = (bIterativeCooking == false);
+		FString PlatFilename = SandboxFilename.Replace(TEXT("[Platform]"), *Target->PlatformName());
 
-		if (bCookPackage == false)
+		if (!IsCookedPackageUpToDate(PkgFilename, PlatFilename, Target))
 		{
-			// If the cooked package doesn't exist, or if the cooked is older than the dependent, re-cook it
-			FDateTime CookedTimeStamp = IFileManager::Get().GetTimeStamp(*PlatFilename);
-			int32 CookedTimespanSeconds = (CookedTimeStamp - DependentTimeStamp).GetTotalSeconds();
-			bCookPackage = (CookedTimeStamp == FDateTime::MinValue()) || (CookedTimespanSeconds < 0);
+			return true;
 		}
-		bDoCook |= bCookPackage;
 	}
 
-	return bDoCook;
+	return false;
 }
 
 bool UCookCommandlet::SaveCookedPackage( UPackage* Package, uint32 SaveFlags, bool& bOutWasUpToDate )
@@ -459,23 +473,10 @@ bool UCookCommandlet::SaveCookedPackage( UPackage* Package, uint32 SaveFlags, bo
 
 	if (Filename.Len())
 	{
+		// The source package file, which the cook hash is determined from
 		FString PkgFilename;
-		FDateTime DependentTimeStamp = FDateTime::MinValue();
-
-		// We always want to use the dependent time stamp when saving a cooked package...
-		// Iterative or not!
-		FString PkgFile;
 		FString Name = Package->GetPathName();
-
-		if (bIterativeCooking && FPackageName::DoesPackageExist(Name, NULL, &PkgFile))
-		{
-			PkgFilename = PkgFile;
-
-			if (GetPackageTimestamp(FPaths::GetBaseFilename(PkgFilename, false), DependentTimeStamp) == false)
-			{
-				UE_LOG(LogCookCommandlet, Display, TEXT("Failed to find depedency timestamp for: %s"), *PkgFilename);
-			}
-		}
+		const bool bHasSourceFile = FPackageName::DoesPackageExist(Name, NULL, &PkgFilename);
 
 		// Use SandboxFile to do path conversion to properly handle sandbox paths (outside of standard paths in particular).
 		Filename = SandboxFile->ConvertToAbsolutePathForExternalAppForWrite(*Filename);
@@ -503,10 +504,8 @@ bool UCookCommandlet::SaveCookedPackage( UPackage* Package, uint32 SaveFlags, bo
 
 			if (bCookPackage == false)
 			{
-				// If the cooked package doesn't exist, or if the cooked is older than the dependent, re-cook it
-				FDateTime CookedTimeStamp = IFileManager::Get().GetTimeStamp(*PlatFilename);
-				int32 CookedTimespanSeconds = (CookedTimeStamp - DependentTimeStamp).GetTotalSeconds();
-				bCookPackage = (CookedTimeStamp == FDateTime::MinValue()) || (CookedTimespanSeconds < 0);
+				// If the cooked package doesn't exist, or was cooked from different data, re-cook it
+				bCookPackage = !bHasSourceFile || !IsCookedPackageUpToDate(PkgFilename, PlatFilename, Target);
 			}
 
 			// don't save Editor resources from the Engine if the target doesn't have editoronly data
@@ -554,8 +553,16 @@ bool UCookCommandlet::SaveCookedPackage( UPackage* Package, uint32 SaveFlags, bo
 					World->PersistentLevel->OwningWorld = World;
 				}
 
-				bSavedCorrectly &= GEditor->SavePackage(Package, World, Flags, *PlatFilename, GError, NULL, bSwap, false, SaveFlags, Target, FDateTime::MinValue());
+				const bool bSaved = GEditor->SavePackage(Package, World, Flags, *PlatFilename, GError, NULL, bSwap, false, SaveFlags, Target, FDateTime::MinValue());
+				bSavedCorrectly &= bSaved;
 				bOutWasUpToDate = false;
+
+				// Remember what the package was cooked from, so the next iterative cook can skip it if nothing changed
+				FString CookHash;
+				if (bSaved && bHasSourceFile && !bCookOnTheFly && GetPackageCookHash(PkgFilename, Target, CookHash))
+				{
+					CookedPackageHashes.FindOrAdd(Target->PlatformName()).Add(GetCookedPackageHashKey(PlatFilename, Target->PlatformName()), CookHash);
+				}
 			}
 			else
 			{
@@ -593,12 +600,28 @@ int32 UCookCommandlet::Main(const FString& CmdLineParams)
 	bCookOnTheFly = Switches.Contains(TEXT("COOKONTHEFLY"));   // Prototype cook-on-the-fly server
 	bCookAll = Switches.Contains(TEXT("COOKALL"));   // Cook everything
 	bLeakTest = Switches.Contains(TEXT("LEAKTEST"));   // Test for UObject leaks
-	bUnversioned = Switches.Contains(TEXT("UNVERSIONED"));   // Save all cooked packages without versions. These are then assumed to be current version on load. This is dangerous but results in smaller patch sizes.
+	bUnversioned = Switches.Contains(TEXT("UNVERSIONED"));   // Save all cooked packages without versions or property tags. These are then assumed to be current version on load. This is dangerous but results in smaller patch sizes.
 	bGenerateStreamingInstallManifests = Switches.Contains(TEXT("MANIFESTS"));   // Generate manifests for building streaming install packages
 	bCompressed = Switches.Contains(TEXT("COMPRESSED"));
 	bIterativeCooking = Switches.Contains(TEXT("ITERATE"));
 	bSkipEditorContent = Switches.Contains(TEXT("SKIPEDITORCONTENT")); // This won't save out any packages in Engine/COntent/Editor*
 
+	// Multi-process cooking: the coordinator passes each worker the list of packages it should cook
+	NumCookWorkers = 0;
+	FParse::Value(*Params, TEXT("CookWorkers="), NumCookWorkers);
+	bCookWorker = FParse::Value(*Params, TEXT("CookWorkerList="), CookWorkerListFilename);
+	if (bCookWorker)
+	{
+		// The coordinator already decided what is out of date, and the worker output is merged into its sandbox
+		NumCookWorkers = 0;
+		bIterativeCooking = false;
+	}
+	else if (NumCookWorkers > 1 && (bCookOnTheFly || bGenerateStreamingInstallManifests))
+	{
+		UE_LOG(LogCookCommandlet, Warning, TEXT("Cook workers can't be used with -COOKONTHEFLY or -MANIFESTS, cooking in a single process."));
+		NumCookWorkers = 0;
+	}
+
 	if (bLeakTest)
 	{
 		for (FObjectIterator It; It; ++It)
@@ -659,9 +682,16 @@ int32 UCookCommandlet::Main(const FString& CmdLineParams)
 			return -1;
 		}
 	}
-	else
+	else if (NumCookWorkers > 1)
 	{
-		Cook(Platforms, FilesInPath);
+		if (!CookWithWorkers(Platforms, FilesInPath))
+		{
+			return -1;
+		}
+	}
+	else if (!Cook(Platforms, FilesInPath))
+	{
+		return -1;
 	}
 
 	return 0;
@@ -707,11 +737,7 @@ void UCookCommandlet::CleanSandbox(const TArray<ITargetPlatform*>& Platforms)
 		}
 		else
 		{
-			FPackageDependencyInfoModule& PDInfoModule = FModuleManager::LoadModuleChecked<FPackageDependencyInfoModule>("PackageDependencyInfo");
-			
-			// list of directories to skip
-			TArray<FString> DirectoriesToSkip;
-			TArray<FString> DirectoriesToNotRecurse;
+			LoadCookedPackageHashes(Platforms);
 
 			// See what files are out of date in the sandbox folder
 			for (int32 Index = 0; Index < Platforms.Num(); Index++)
@@ -719,34 +745,31 @@ void UCookCommandlet::CleanSandbox(const TArray<ITargetPlatform*>& Platforms)
 				ITargetPlatform* Target = Platforms[Index];
 				FString SandboxDirectory = GetOutputDirectory(Target->PlatformName());
 
-				// use the timestamp grabbing visitor
-				IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-				FLocalTimestampDirectoryVisitor Visitor(PlatformFile, DirectoriesToSkip, DirectoriesToNotRecurse, false);
-			
-				PlatformFile.IterateDirectory(*SandboxDirectory, Visitor);
+				TArray<FString> CookedFiles;
+				IFileManager::Get().FindFilesRecursive(CookedFiles, *SandboxDirectory, TEXT("*"), true, false);
 
-				for (TMap<FString, FDateTime>::TIterator TimestampIt(Visitor.FileTimes); TimestampIt; ++TimestampIt)
+				for (int32 FileIndex = 0; FileIndex < CookedFiles.Num(); FileIndex++)
 				{
-					FString CookedFilename = TimestampIt.Key();
-					FDateTime CookedTimestamp = TimestampIt.Value();
+					const FString& CookedFilename = CookedFiles[FileIndex];
+					if (!FPackageName::IsPackageExtension(*FPaths::GetExtension(CookedFilename, true)))
+					{
+						continue;
+					}
+
 					FString StandardCookedFilename = CookedFilename.Replace(*SandboxDirectory, *(FPaths::GetRelativePathToRoot()));
-					FDateTime DependentTimestamp;
 
-					if (PDInfoModule.DeterminePackageDependentTimeStamp(*(FPaths::GetBaseFilename(StandardCookedFilename, false)), DependentTimestamp) == true)
+					// Packages cooked from different data, or that we don't know the origin of, are deleted so they are cooked again
+					if (!IsCookedPackageUpToDate(StandardCookedFilename, CookedFilename, Target))
 					{
-						double Diff = (CookedTimestamp - DependentTimestamp).GetTotalSeconds();
+						UE_LOG(LogCookCommandlet, Display, TEXT("Deleting out of date cooked file: %s"), *CookedFilename);
 
-						if (Diff < 0.0)
-						{
-							UE_LOG(LogCookCommandlet, Display, TEXT("Deleting out of date cooked file: %s"), *CookedFilename);
-
-							IFileManager::Get().Delete(*CookedFilename);
-						}
+						IFileManager::Get().Delete(*CookedFilename);
+						CookedPackageHashes.FindOrAdd(Target->PlatformName()).Remove(GetCookedPackageHashKey(CookedFilename, Target->PlatformName()));
 					}
 				}
 			}
 
-			// Collect garbage to ensure we don't have any packages hanging around from dependent time stamp determination
+			// Collect garbage to ensure we don't have any packages hanging around from dependent hash determination
 			CollectGarbage(RF_Native);
 		}
 	}
@@ -754,6 +777,96 @@ void UCookCommandlet::CleanSandbox(const TArray<ITargetPlatform*>& Platforms)
 	UE_LOG(LogCookCommandlet, Display, TEXT("Sandbox cleanup took %5.3f seconds"), SandboxCleanTime);
 }
 
+const FSHAHash& UCookCommandlet::GetPlatformSettingsHash(ITargetPlatform* Platform)
+{
+	const FString PlatformName = Platform->PlatformName();
+
+	FSHAHash* ExistingHash = PlatformSettingsHashes.Find(PlatformName);
+	if (ExistingHash)
+	{
+		return *ExistingHash;
+	}
+
+	FSHA1 Hasher;
+
+	// Anything that changes how every package is saved
+	FString Settings = FString::Printf(TEXT("%s %s %d %d %d %d"), *PlatformName, *GEngineVersion.ToString(), GPackageFileUE4Version, GPackageFileLicenseeUE4Version, bUnversioned ? 1 : 0, bCompressed ? 1 : 0);
+	Hasher.UpdateWithString(*Settings, Settings.Len());
+
+	// Along with the platform's view of the engine and game settings
+	const TCHAR* IniNames[] = { TEXT("Engine"), TEXT("Game") };
+	for (int32 IniIndex = 0; IniIndex < ARRAY_COUNT(IniNames); IniIndex++)
+	{
+		FConfigFile PlatformIni;
+		FConfigCacheIni::LoadLocalIniFile(PlatformIni, IniNames[IniIndex], true, *Platform->IniPlatformName());
+
+		for (FConfigFile::TConstIterator SectionIt(PlatformIni); SectionIt; ++SectionIt)
+		{
+			Hasher.UpdateWithString(*SectionIt.Key(), SectionIt.Key().Len());
+			for (FConfigSection::TConstIterator ValueIt(SectionIt.Value()); ValueIt; ++ValueIt)
+			{
+				const FString Key = ValueIt.Key().ToString();
+				Hasher.UpdateWithString(*Key, Key.Len());
+				Hasher.UpdateWithString(*ValueIt.Value(), ValueIt.Value().Len());
+			}
+		}
+	}
+
+	Hasher.Final();
+
+	FSHAHash& SettingsHash = PlatformSettingsHashes.Add(PlatformName, FSHAHash());
+	Hasher.GetHash(SettingsHash.Hash);
+
+	return SettingsHash;
+}
+
+FString UCookCommandlet::GetCookedPackageHashKey(const FString& CookedFilename, const FString& PlatformName) const
+{
+	FString Key = FPaths::ConvertRelativePathToFull(CookedFilename);
+	FPaths::MakePathRelativeTo(Key, *(FPaths::ConvertRelativePathToFull(GetOutputDirectory(PlatformName)) / TEXT("")));
+
+	return Key;
+}
+
+FString UCookCommandlet::GetCookedPackageHashesFilename(const FString& PlatformName) const
+{
+	return FPaths::ConvertRelativePathToFull(GetOutputDirectory(PlatformName)) / TEXT("CookedPackageHashes.bin");
+}
+
+void UCookCommandlet::LoadCookedPackageHashes(const TArray<ITargetPlatform*>& Platforms)
+{
+	for (int32 Index = 0; Index < Platforms.Num(); Index++)
+	{
+		const FString PlatformName = Platforms[Index]->PlatformName();
+		TMap<FString, FString>& PlatformHashes = CookedPackageHashes.FindOrAdd(PlatformName);
+
+		TAutoPtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*GetCookedPackageHashesFilename(PlatformName)));
+		if (Reader.IsValid())
+		{
+			*Reader << PlatformHashes;
+		}
+	}
+}
+
+void UCookCommandlet::SaveCookedPackageHashes(const TArray<ITargetPlatform*>& Platforms)
+{
+	for (int32 Index = 0; Index < Platforms.Num(); Index++)
+	{
+		const FString PlatformName = Platforms[Index]->PlatformName();
+		TMap<FString, FString>& PlatformHashes = CookedPackageHashes.FindOrAdd(PlatformName);
+
+		TAutoPtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*GetCookedPackageHashesFilename(PlatformName)));
+		if (Writer.IsValid())
+		{
+			*Writer << PlatformHashes;
+		}
+		else
+		{
+			UE_LOG(LogCookCommandlet, Warning, TEXT("Unable to save the cooked package hashes for %s, the next iterative cook will cook everything again"), *PlatformName);
+		}
+	}
+}
+
 void UCookCommandlet::GenerateAssetRegistry(const TArray<ITargetPlatform*>& Platforms)
 {
 	// load the interface
@@ -1039,16 +1152,34 @@ bool UCookCommandlet::Cook(const TArray<ITargetPlatform*>& Platforms, TArray<FSt
 	bool bDoSubset = SubsetMod > 0 && SubsetTarget < SubsetMod;
 
 	FCoreDelegates::PackageCreatedForLoad.AddUObject(this, &UCookCommandlet::MaybeMarkPackageAsAlreadyLoaded);
-	
-	SaveGlobalShaderMapFiles(Platforms);
 
-	CollectFilesToCook(FilesInPath);
-	if (FilesInPath.Num() == 0)
+	if (bCookWorker)
 	{
-		UE_LOG(LogCookCommandlet, Warning, TEXT("No files found."));
+		// The coordinator saves the global shaders and works out which packages need cooking
+		FilesInPath.Empty();
+		FString FileList;
+		if (FFileHelper::LoadFileToString(FileList, *CookWorkerListFilename))
+		{
+			FileList.ParseIntoArray(&FilesInPath, LINE_TERMINATOR, true);
+		}
+		else
+		{
+			UE_LOG(LogCookCommandlet, Error, TEXT("Unable to read the cook worker list %s"), *CookWorkerListFilename);
+			return false;
+		}
 	}
+	else
+	{
+		SaveGlobalShaderMapFiles(Platforms);
 
-	GenerateLongPackageNames(FilesInPath);
+		CollectFilesToCook(FilesInPath);
+		if (FilesInPath.Num() == 0)
+		{
+			UE_LOG(LogCookCommandlet, Warning, TEXT("No files found."));
+		}
+
+		GenerateLongPackageNames(FilesInPath);
+	}
 	
 	const int32 GCInterval = bLeakTest ? 1: 500;
 	int32 NumProcessedSinceLastGC = GCInterval;
@@ -1227,9 +1358,198 @@ bool UCookCommandlet::Cook(const TArray<ITargetPlatform*>& Platforms, TArray<FSt
 		ManifestGenerator.SaveAssetRegistry(SandboxRegistryFilename);
 	}
 
+	SaveCookedPackageHashes(Platforms);
+
 	return true;
 }
 
+bool UCookCommandlet::CookWithWorkers(const TArray<ITargetPlatform*>& Platforms, TArray<FString>& FilesInPath)
+{
+	SaveGlobalShaderMapFiles(Platforms);
+
+	CollectFilesToCook(FilesInPath);
+	if (FilesInPath.Num() == 0)
+	{
+		UE_LOG(LogCookCommandlet, Warning, TEXT("No files found."));
+	}
+
+	GenerateLongPackageNames(FilesInPath);
+
+	// Only hand out the packages that are out of date, the workers cook everything they are given
+	TArray<FString> PackagesToCook;
+	for (int32 FileIndex = 0; FileIndex < FilesInPath.Num(); FileIndex++)
+	{
+		FString Filename;
+		if (FPackageName::DoesPackageExist(FilesInPath[FileIndex], NULL, &Filename) == false)
+		{
+			UE_LOG(LogCookCommandlet, Warning, TEXT("Unable to find package file for: %s"), *FilesInPath[FileIndex]);
+			continue;
+		}
+		Filename = FPaths::ConvertRelativePathToFull(Filename);
+
+		if (ShouldCook(Filename))
+		{
+			PackagesToCook.Add(FilesInPath[FileIndex]);
+		}
+		else
+		{
+			UE_LOG(LogCookCommandlet, Display, TEXT("Up To Date: %s"), *Filename);
+		}
+	}
+
+	// Dependency determination loaded linkers for everything, don't keep them around while the workers run
+	CollectGarbage(RF_Native);
+
+	const int32 NumWorkers = FMath::Min(NumCookWorkers, PackagesToCook.Num());
+	UE_LOG(LogCookCommandlet, Display, TEXT("Cooking %d packages with %d workers"), PackagesToCook.Num(), NumWorkers);
+
+	const FString WorkerRoot = FPaths::ConvertRelativePathToFull(FPaths::GameIntermediateDir() / TEXT("CookWorkers"));
+	IFileManager::Get().DeleteDirectory(*WorkerRoot, false, true);
+
+	// Pass on our own command line, minus the options that are specific to the coordinator
+	FString WorkerCommandLine;
+	{
+		const TCHAR* CommandLine = FCommandLine::Get();
+		FString Token;
+		while (FParse::Token(CommandLine, Token, false))
+		{
+			if (Token.StartsWith(TEXT("-Output="), ESearchCase::IgnoreCase) ||
+				Token.StartsWith(TEXT("-CookWorkers="), ESearchCase::IgnoreCase) ||
+				Token.Equals(TEXT("-ITERATE"), ESearchCase::IgnoreCase))
+			{
+				continue;
+			}
+			WorkerCommandLine += Token.Contains(TEXT(" ")) ? FString::Printf(TEXT(" \"%s\""), *Token) : (TEXT(" ") + Token);
+		}
+	}
+
+	const FString ExecutablePath = FString(FPlatformProcess::BaseDir()) / FPlatformProcess::ExecutableName(false);
+
+	TArray<FString> WorkerOutputs;
+	TArray<FProcHandle> WorkerProcesses;
+	for (int32 WorkerIndex = 0; WorkerIndex < NumWorkers; WorkerIndex++)
+	{
+		// Round robin, so the expensive packages (maps are usually listed together) are spread between the workers
+		FString WorkerList;
+		for (int32 PackageIndex = WorkerIndex; PackageIndex < PackagesToCook.Num(); PackageIndex += NumWorkers)
+		{
+			WorkerList += PackagesToCook[PackageIndex] + LINE_TERMINATOR;
+		}
+
+		const FString WorkerDirectory = WorkerRoot / FString::Printf(TEXT("Worker%d"), WorkerIndex);
+		const FString WorkerListFilename = WorkerDirectory / TEXT("PackagesToCook.txt");
+		const FString WorkerOutput = WorkerDirectory / TEXT("[Platform]");
+		FFileHelper::SaveStringToFile(WorkerList, *WorkerListFilename);
+
+		const FString WorkerParams = WorkerCommandLine + FString::Printf(TEXT(" -CookWorkerList=\"%s\" -Output=\"%s\""), *WorkerListFilename, *WorkerOutput);
+		UE_LOG(LogCookCommandlet, Display, TEXT("Starting cook worker %d: %s%s"), WorkerIndex, *ExecutablePath, *WorkerParams);
+
+		FProcHandle WorkerProcess = FPlatformProcess::CreateProc(*ExecutablePath, *WorkerParams, false, true, true, NULL, 0, NULL, NULL);
+		if (!WorkerProcess.IsValid())
+		{
+			UE_LOG(LogCookCommandlet, Error, TEXT("Failed to start cook worker %d"), WorkerIndex);
+			continue;
+		}
+
+		WorkerOutputs.Add(WorkerOutput);
+		WorkerProcesses.Add(WorkerProcess);
+	}
+
+	bool bAllWorkersSucceeded = (WorkerProcesses.Num() == NumWorkers);
+	for (int32 WorkerIndex = 0; WorkerIndex < WorkerProcesses.Num(); WorkerIndex++)
+	{
+		while (FPlatformProcess::IsProcRunning(WorkerProcesses[WorkerIndex]))
+		{
+			FPlatformProcess::Sleep(0.1f);
+		}
+
+		int32 ReturnCode = -1;
+		if (!FPlatformProcess::GetProcReturnCode(WorkerProcesses[WorkerIndex], &ReturnCode) || ReturnCode != 0)
+		{
+			UE_LOG(LogCookCommandlet, Error, TEXT("Cook worker %d failed with return code %d, see its log for details"), WorkerIndex, ReturnCode);
+			bAllWorkersSucceeded = false;
+		}
+
+		// Whatever a failed worker did manage to cook is still valid
+		MergeCookWorkerOutput(Platforms, WorkerOutputs[WorkerIndex]);
+	}
+
+	IFileManager::Get().DeleteDirectory(*WorkerRoot, false, true);
+
+	{
+		// The asset registry covers all the packages, regardless of which worker cooked them
+		FChunkManifestGenerator ManifestGenerator(Platforms);
+		ManifestGenerator.Initialize(false);
+
+		FString RegistryFilename = FPaths::GameDir() / TEXT("AssetRegistry.bin");
+		FString SandboxRegistryFilename = SandboxFile->ConvertToAbsolutePathForExternalAppForWrite(*RegistryFilename);
+		ManifestGenerator.SaveAssetRegistry(SandboxRegistryFilename);
+	}
+
+	SaveCookedPackageHashes(Platforms);
+
+	return bAllWorkersSucceeded;
+}
+
+void UCookCommandlet::MergeCookWorkerOutput(const TArray<ITargetPlatform*>& Platforms, const FString& WorkerOutput)
+{
+	for (int32 Index = 0; Index < Platforms.Num(); Index++)
+	{
+		const FString PlatformName = Platforms[Index]->PlatformName();
+		const FString WorkerDirectory = WorkerOutput.Replace(TEXT("[Platform]"), *PlatformName);
+		const FString SandboxDirectory = FPaths::ConvertRelativePathToFull(GetOutputDirectory(PlatformName));
+		const FString WorkerHashesFilename = WorkerDirectory / FPaths::GetCleanFilename(GetCookedPackageHashesFilename(PlatformName));
+
+		TMap<FString, FString> WorkerHashes;
+		TAutoPtr<FArchive> HashesReader(IFileManager::Get().CreateFileReader(*WorkerHashesFilename));
+		if (HashesReader.IsValid())
+		{
+			*HashesReader << WorkerHashes;
+		}
+
+		TMap<FString, FString>& PlatformHashes = CookedPackageHashes.FindOrAdd(PlatformName);
+
+		TArray<FString> WorkerFiles;
+		IFileManager::Get().FindFilesRecursive(WorkerFiles, *WorkerDirectory, TEXT("*"), true, false);
+
+		for (int32 FileIndex = 0; FileIndex < WorkerFiles.Num(); FileIndex++)
+		{
+			FString RelativeFilename = WorkerFiles[FileIndex];
+			if (!FPaths::MakePathRelativeTo(RelativeFilename, *(WorkerDirectory / TEXT(""))))
+			{
+				continue;
+			}
+
+			// The coordinator writes the registry and the hashes for the whole cook
+			const FString CleanFilename = FPaths::GetCleanFilename(RelativeFilename);
+			if (CleanFilename == TEXT("AssetRegistry.bin") || WorkerFiles[FileIndex] == WorkerHashesFilename)
+			{
+				continue;
+			}
+
+			// Several workers may have cooked the same dependency, they all produced the same data
+			const FString SandboxFilename = SandboxDirectory / RelativeFilename;
+			if (IFileManager::Get().FileSize(*SandboxFilename) >= 0)
+			{
+				continue;
+			}
+
+			if (IFileManager::Get().Move(*SandboxFilename, *WorkerFiles[FileIndex]))
+			{
+				const FString* CookHash = WorkerHashes.Find(RelativeFilename);
+				if (CookHash)
+				{
+					PlatformHashes.Add(RelativeFilename, *CookHash);
+				}
+			}
+			else
+			{
+				UE_LOG(LogCookCommandlet, Error, TEXT("Failed to move cooked file %s to %s"), *WorkerFiles[FileIndex], *SandboxFilename);
+			}
+		}
+	}
+}
+
 
 /* UCookCommandlet callbacks
  *****************************************************************************/
@@ -0,0 +1,98 @@
+// Copyright 1998-2014 Epic Games, Inc. All Rights Reserved.
+
+/**
+ * Commandlet to measure the performance of texture mip generation and cubemap filtering
+ */
+
+#include "UnrealEd.h"
+#include "ImageCore.h"
+#include "TextureCompressorModule.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogTextureBuildBenchmarkCommandlet, Log, All);
+
+UTextureBuildBenchmarkCommandlet::UTextureBuildBenchmarkCommandlet(const class FPostConstructInitializeProperties& PCIP)
+	: Super(PCIP)
+{
+	LogToConsole = true;
+}
+
+int32 UTextureBuildBenchmarkCommandlet::Main(const FString& Params)
+{
+	int32 Size = 2048;
+	int32 Iterations = 4;
+	float MipSharpening = 0.0f;
+	FString FormatName = TEXT("BGRA8");
+
+	FParse::Value(*Params, TEXT("Size="), Size);
+	FParse::Value(*Params, TEXT("Iterations="), Iterations);
+	FParse::Value(*Params, TEXT("Sharpen="), MipSharpening);
+	FParse::Value(*Params, TEXT("Format="), FormatName);
+	const bool bCubemap = FParse::Param(*Params, TEXT("Cube"));
+
+	Size = FMath::Min<uint32>(FMath::RoundUpToPowerOfTwo(FMath::Max(Size, 1)), 8192);
+	Iterations = FMath::Max(Iterations, 1);
+
+	ITextureCompressorModule& TextureCompressor = FModuleManager::LoadModuleChecked<ITextureCompressorModule>(TEXTURE_COMPRESSOR_MODULENAME);
+
+	// fill the source with noise on top of a gradient, so that neither filtering nor compression can take shortcuts
+	const int32 NumSlices = bCubemap ? 6 : 1;
+	TArray<FImage> SourceMips;
+	FImage* SourceImage = new(SourceMips) FImage(Size, Size, NumSlices, ERawImageFormat::BGRA8, true);
+	FColor* SourceColors = SourceImage->AsBGRA8();
+	FRandomStream RandomStream(0x7E47);
+
+	for (int32 Slice = 0; Slice < NumSlices; ++Slice)
+	{
+		for (int32 Y = 0; Y < Size; ++Y)
+		{
+			for (int32 X = 0; X < Size; ++X)
+			{
+				const int32 Noise = RandomStream.RandHelper(64);
+				*SourceColors++ = FColor((X * 255) / Size, (Y * 255) / Size, (Slice * 40 + Noise) & 0xFF, 255 - Noise);
+			}
+		}
+	}
+
+	FTextureBuildSettings BuildSettings;
+	BuildSettings.TextureFormatName = FName(*FormatName);
+	BuildSettings.bSRGB = true;
+	BuildSettings.bCubemap = bCubemap;
+	BuildSettings.MipGenSettings = (MipSharpening != 0.0f) ? TMGS_Sharpen5 : TMGS_SimpleAverage;
+	BuildSettings.MipSharpening = MipSharpening;
+	BuildSettings.SharpenMipKernelSize = (MipSharpening != 0.0f) ? 8 : 2;
+	BuildSettings.DiffuseConvolveMipLevel = bCubemap ? 2 : 0;
+
+	UE_LOG(LogTextureBuildBenchmarkCommandlet, Display, TEXT("Building %dx%dx%d %s texture (%s, sharpening %.1f), %d iterations"),
+		Size, Size, NumSlices, *FormatName, bCubemap ? TEXT("cubemap") : TEXT("2D"), MipSharpening, Iterations);
+
+	double TotalTime = 0.0;
+	double BestTime = 0.0;
+
+	for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+	{
+		TArray<FCompressedImage2D> CompressedMips;
+		TArray<FImage> EmptyNormalMips;
+
+		const double StartTime = FPlatformTime::Seconds();
+		const bool bSuccess = TextureCompressor.BuildTexture(SourceMips, EmptyNormalMips, BuildSettings, CompressedMips);
+		const double ElapsedTime = FPlatformTime::Seconds() - StartTime;
+
+		if (!bSuccess)
+		{
+			UE_LOG(LogTextureBuildBenchmarkCommandlet, Error, TEXT("Failed to build the texture, is the %s texture format available?"), *FormatName);
+			return 1;
+		}
+
+		UE_LOG(LogTextureBuildBenchmarkCommandlet, Display, TEXT("  Iteration %d: %.2f ms, %d mips"), Iteration, ElapsedTime * 1000.0, CompressedMips.Num());
+
+		TotalTime += ElapsedTime;
+		BestTime = (Iteration == 0) ? ElapsedTime : FMath::Min(BestTime, ElapsedTime);
+	}
+
+	const double MegaTexels = (double)Size * Size * NumSlices / (1024.0 * 1024.0);
+	const double AverageTime = TotalTime / Iterations;
+
+	UE_LOG(LogTextureBuildBenchmarkCommandlet, Display, TEXT("Average %.2f ms, best %.2f ms, %.2f MTexels/s"), AverageTime * 1000.0, BestTime * 1000.0, MegaTexels / AverageTime);
+
+	return 0;
+}
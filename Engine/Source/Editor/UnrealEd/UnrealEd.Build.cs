@@ -41,6 +41,7 @@ public class UnrealEd : ModuleRules
 				"NiagaraEditor",
 				"PlacementMode",
 				"SoundClassEditor",
+				"TextureCompressor",
 				"ViewportSnapping",
 				"VSAccessor",
 			}
@@ -74,6 +75,7 @@ public class UnrealEd : ModuleRules
 				"EditorSettingsViewer",
 				"EditorStyle",
 				"EngineSettings",
+				"ImageCore",
 				"InputCore",
 				"InputBindingEditor",
 				"LauncherAutomatedService",
@@ -112,6 +114,7 @@ public class UnrealEd : ModuleRules
 				"FontEditor",
 				"StaticMeshEditor",
 				"TextureEditor",
+				"TextureCompressor",
 				"Cascade",
 				"Matinee",
 				"AssetRegistry",
@@ -257,7 +257,7 @@ namespace UnrealBuildTool.Linux
          */
         public override void SetUpEnvironment(UEBuildTarget InBuildTarget)
         {
-            InBuildTarget.GlobalCompileEnvironment.Config.Definitions.Add("WITH_OGGVORBIS=0");
+            InBuildTarget.GlobalCompileEnvironment.Config.Definitions.Add("WITH_OGGVORBIS=1");
 
             InBuildTarget.GlobalCompileEnvironment.Config.Definitions.Add("UNICODE");
             InBuildTarget.GlobalCompileEnvironment.Config.Definitions.Add("_UNICODE");
@@ -27,6 +27,9 @@ bool GReportDetailedStats = false;
 /** Whether Lightmass is running in debug mode (-debug), using a hardcoded job and not requesting tasks from Swarm. */
 bool GDebugMode = false;
 
+/** Whether Lightmass should only benchmark ray tracing against the scene (-raybench), instead of lighting it. */
+bool GRayTracingBenchmark = false;
+
 /** How many tasks to prefetch per worker thread. */
 float GNumTasksPerThreadPrefetch = 1.0f;
 
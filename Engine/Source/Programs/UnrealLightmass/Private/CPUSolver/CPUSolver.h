@@ -109,6 +109,9 @@ extern bool GReportDetailedStats;
 /** Whether Lightmass is running in debug mode (-debug), using a hardcoded job and not requesting tasks from Swarm. */
 extern bool GDebugMode;
 
+/** Whether Lightmass should only benchmark ray tracing against the scene (-raybench), instead of lighting it. */
+extern bool GRayTracingBenchmark;
+
 } //namespace Lightmass
 
 #endif
@@ -115,10 +115,11 @@ int LightmassMain(int argc, ANSICHAR* argv[])
 	{
 		if ((FCStringAnsi::Stricmp(argv[ArgIndex], " -help") == 0) || (FCStringAnsi::Stricmp(argv[ArgIndex], " -?") == 0))
 		{
-			UE_LOG(LogLightmass, Display, TEXT("Usage:\n  UnrealLightmass\n\t[SceneGuid]\n\t[-debug]\n\t[-unittest]\n\t[-dumptex]\n\t[-numthreads N]\n\t[-compare Dir1 Dir2 [-error N]]"));
+			UE_LOG(LogLightmass, Display, TEXT("Usage:\n  UnrealLightmass\n\t[SceneGuid]\n\t[-debug]\n\t[-raybench]\n\t[-unittest]\n\t[-dumptex]\n\t[-numthreads N]\n\t[-compare Dir1 Dir2 [-error N]]"));
 			UE_LOG(LogLightmass, Display, TEXT(""));
 			UE_LOG(LogLightmass, Display, TEXT("  SceneGuid : Guid of a scene file. 0x0000012300004567000089AB0000CDEF is the default"));
 			UE_LOG(LogLightmass, Display, TEXT("  -debug : Processes all mappings in the scene, instead of getting tasks from Swarm Coordinator"));
+			UE_LOG(LogLightmass, Display, TEXT("  -raybench : Measures ray tracing performance against the scene instead of lighting it, use together with -debug"));
 			UE_LOG(LogLightmass, Display, TEXT("  -unittest : Runs a series of validations, then quits"));
 			UE_LOG(LogLightmass, Display, TEXT("  -dumptex : Outputs .bmp files to the current directory of 2D lightmap/shadowmap results"));
 			UE_LOG(LogLightmass, Display, TEXT("  -compare : Compares the binary dumps created by UnrealEd to compare Unreal vs LM lighting runs"));
@@ -137,6 +138,10 @@ int LightmassMain(int argc, ANSICHAR* argv[])
 		{
 			GDebugMode = true;
 		}
+		else if (FCStringAnsi::Stricmp(argv[ArgIndex], " -raybench") == 0)
+		{
+			GRayTracingBenchmark = true;
+		}
 		else if (FCStringAnsi::Stricmp(argv[ArgIndex], " -stats") == 0)
 		{
 			GReportDetailedStats = true;
@@ -6,6 +6,7 @@
 
 #include "stdafx.h"
 #include "LightingSystem.h"
+#include "MonteCarlo.h"
 
 namespace Lightmass
 {
@@ -154,12 +155,12 @@ void FStaticLightingAggregateMesh::ReserveMemory( int32 NumMeshes, int32 NumVert
 
 void FStaticLightingAggregateMesh::PrepareForRaytracing()
 {
-	// Build the kDOP for simple meshes.
-	kDopTree.Build(kDOPTriangles);
+	// Build the BVH for simple meshes.
+	BVH.Build(kDOPTriangles);
 
 	// Log information about the aggregate mesh.
-	UE_LOG(LogLightmass, Log, TEXT("Static lighting kDOP: %u nodes, %u leaves, %u triangles, %u vertices"), GKDOPNodes, GKDOPNumLeaves, GKDOPTriangles, Vertices.Num());
-	UE_LOG(LogLightmass, Log, TEXT("Static lighting kDOP: %.3f%% wasted space in leaves"), ((GKDOPTriangles - kDOPTriangles.Num()) / (float)GKDOPTriangles) * 100.0f);
+	UE_LOG(LogLightmass, Log, TEXT("Static lighting BVH: %u nodes, %u leaves, %u triangles, %u vertices"), GKDOPNodes, GKDOPNumLeaves, GKDOPTriangles, Vertices.Num());
+	UE_LOG(LogLightmass, Log, TEXT("Static lighting BVH: %.3f%% wasted space in leaves"), GKDOPTriangles > 0 ? ((GKDOPTriangles - kDOPTriangles.Num()) / (float)GKDOPTriangles) * 100.0f : 0.0f);
 
 	kDOPTriangles.Empty();
 	TrianglePayloads.Shrink();
@@ -167,8 +168,8 @@ void FStaticLightingAggregateMesh::PrepareForRaytracing()
 
 void FStaticLightingAggregateMesh::DumpStats() const
 {
-	const uint64 kDOPTreeBytes = kDopTree.Nodes.GetAllocatedSize() 
-		+ kDopTree.SOATriangles.GetAllocatedSize()
+	const uint64 BVHBytes = BVH.Nodes.GetAllocatedSize() 
+		+ BVH.SOATriangles.GetAllocatedSize()
 		+ kDOPTriangles.GetAllocatedSize()
 		+ TrianglePayloads.GetAllocatedSize()
 		+ MeshInfos.GetAllocatedSize()
@@ -176,15 +177,15 @@ void FStaticLightingAggregateMesh::DumpStats() const
 		+ UVs.GetAllocatedSize()
 		+ LightmapUVs.GetAllocatedSize();
 
-	UE_LOG(LogLightmass, Log, TEXT("kDopTree.Nodes        : %7.1fMb"), kDopTree.Nodes.GetAllocatedSize() / 1048576.0f);
-	UE_LOG(LogLightmass, Log, TEXT("kDopTree.SOATriangles : %7.1fMb"), kDopTree.SOATriangles.GetAllocatedSize() / 1048576.0f);
+	UE_LOG(LogLightmass, Log, TEXT("BVH.Nodes             : %7.1fMb"), BVH.Nodes.GetAllocatedSize() / 1048576.0f);
+	UE_LOG(LogLightmass, Log, TEXT("BVH.SOATriangles      : %7.1fMb"), BVH.SOATriangles.GetAllocatedSize() / 1048576.0f);
 	UE_LOG(LogLightmass, Log, TEXT("kDOPTriangles         : %7.1fMb"), kDOPTriangles.GetAllocatedSize() / 1048576.0f);
 	UE_LOG(LogLightmass, Log, TEXT("TrianglePayloads      : %7.1fMb"), TrianglePayloads.GetAllocatedSize() / 1048576.0f);
 	UE_LOG(LogLightmass, Log, TEXT("MeshInfos             : %7.1fMb"), MeshInfos.GetAllocatedSize() / 1048576.0f);
 	UE_LOG(LogLightmass, Log, TEXT("Vertices              : %7.1fMb"), Vertices.GetAllocatedSize() / 1048576.0f);
 	UE_LOG(LogLightmass, Log, TEXT("UVs                   : %7.1fMb"), UVs.GetAllocatedSize() / 1048576.0f);
 	UE_LOG(LogLightmass, Log, TEXT("LightmapUVs           : %7.1fMb"), LightmapUVs.GetAllocatedSize() / 1048576.0f);
-	UE_LOG(LogLightmass, Log, TEXT("Static lighting kDOP: %u nodes, %u leaves, %u triangles, %u vertices, %.1f Mb"), GKDOPNodes, GKDOPNumLeaves, GKDOPTriangles, Vertices.Num(), kDOPTreeBytes / 1048576.0f);
+	UE_LOG(LogLightmass, Log, TEXT("Static lighting BVH: %u nodes, %u leaves, %u triangles, %u vertices, %.1f Mb"), GKDOPNodes, GKDOPNumLeaves, GKDOPTriangles, Vertices.Num(), BVHBytes / 1048576.0f);
 }
 
 FBox FStaticLightingAggregateMesh::GetBounds() const
@@ -204,74 +205,91 @@ float FStaticLightingAggregateMesh::GetSurfaceAreaWithinImportanceVolume() const
 	return SceneSurfaceAreaWithinImportanceVolume;
 }
 
-class FStaticLightingAggregateMeshDataProvider
+void FStaticLightingAggregateMesh::SetupLineCheck(
+	const FLightRay& ClippedLightRay,
+	const FLightRay& LightRay,
+	bool bFindClosestIntersection,
+	bool bDirectShadowingRay,
+	FBVHLineCheck& Check) const
 {
-public:
-
-	/** Initialization constructor. */
-	FStaticLightingAggregateMeshDataProvider(const FStaticLightingAggregateMesh* InMesh,const FLightRay& InLightRay):
-		Mesh(InMesh),
-		LightRay(InLightRay)
-	{}
-
-	// kDOP data provider interface.
-
-	FORCEINLINE const FVector4& GetVertex(uint32 Index) const
-	{
-		return Mesh->Vertices[Index];
-	}
-
-	FORCEINLINE FVector2D GetUV(uint32 Index) const
-	{
-		return Mesh->UVs[Index];
-	}
-
-	FORCEINLINE FVector2D GetLightmapUV(uint32 Index) const
-	{
-		return Mesh->LightmapUVs[Index];
-	}
-/*
-	FORCEINLINE UMaterialInterface* GetMaterial(uint32 MaterialIndex) const
-	{
-		return NULL;
-	}
-*/
-	FORCEINLINE int32 GetItemIndex(uint32 MaterialIndex) const
-	{
-		return MaterialIndex;
-	}
-
-	FORCEINLINE const TkDOPTree<const FStaticLightingAggregateMeshDataProvider,uint32>& GetkDOPTree(void) const
-	{
-		return Mesh->kDopTree;
-	}
+	Check.Init(
+		ClippedLightRay.Start,
+		ClippedLightRay.Start + ClippedLightRay.Direction * ClippedLightRay.Length,
+		bFindClosestIntersection,
+		(LightRay.TraceFlags & LIGHTRAY_STATIC_AND_OPAQUEONLY) != 0,
+		!bDirectShadowingRay,
+		(LightRay.TraceFlags & LIGHTRAY_FLIP_SIDEDNESS) != 0,
+		LightRay.Mapping ? LightRay.Mapping->Mesh->MeshIndex : INDEX_NONE,
+		LightRay.Mapping ? LightRay.Mapping->Mesh->GetLODIndex() : INDEX_NONE);
+}
 
-	FORCEINLINE const FMatrix& GetLocalToWorld(void) const
+FLightRayIntersection FStaticLightingAggregateMesh::GetIntersection(const FLightRay& ClippedLightRay, const FBVHLineCheck& Check, bool bFindClosestIntersection) const
+{
+	// Setup a vertex to represent the intersection.
+	FStaticLightingVertex IntersectionVertex;
+	IntersectionVertex.WorldPosition = ClippedLightRay.Start + ClippedLightRay.Direction * ClippedLightRay.Length * Check.Result.Time;
+	IntersectionVertex.WorldTangentZ = Check.HitNormal;
+	const FTriangleSOAPayload& Payload = TrianglePayloads[ Check.Result.Item ];
+	const FVector4& v1 = Vertices[Payload.VertexIndex[0]];
+	const FVector4& v2 = Vertices[Payload.VertexIndex[1]];
+	const FVector4& v3 = Vertices[Payload.VertexIndex[2]];
+	const FVector4 HitPosition = Check.Start + Check.Dir * Check.Result.Time;
+	FVector4 BaryCentricWeights;
+	//@todo - why is such a huge tolerance needed?  Reuse the barycentric coords calculated by the ray-triangle intersection instead of deriving them from the hit position.
+	//@todo - why does this sometimes fail if there was an intersection?
+	if (bFindClosestIntersection && GetBarycentricWeights(v1, v2, v3, HitPosition, KINDA_SMALL_NUMBER * 100.0f, BaryCentricWeights))
 	{
-		return FMatrix::Identity;
+		const FVector2D& UV1 = UVs[Payload.VertexIndex[0]];
+		const FVector2D& UV2 = UVs[Payload.VertexIndex[1]];
+		const FVector2D& UV3 = UVs[Payload.VertexIndex[2]];
+		// Interpolate the material texture coordinates to the intersection point
+		//@todo - only lookup and interpolate UV's if needed
+		IntersectionVertex.TextureCoordinates[0] = UV1 * BaryCentricWeights.X + UV2 * BaryCentricWeights.Y + UV3 * BaryCentricWeights.Z;
+		const FVector2D& LightmapUV1 = LightmapUVs[Payload.VertexIndex[0]];
+		const FVector2D& LightmapUV2 = LightmapUVs[Payload.VertexIndex[1]];
+		const FVector2D& LightmapUV3 = LightmapUVs[Payload.VertexIndex[2]];
+		// Interpolate the lightmap texture coordinates to the intersection point
+		IntersectionVertex.TextureCoordinates[1] = LightmapUV1 * BaryCentricWeights.X + LightmapUV2 * BaryCentricWeights.Y + LightmapUV3 * BaryCentricWeights.Z;
 	}
-
-	FORCEINLINE const FMatrix& GetWorldToLocal(void) const
+	else
 	{
-		return FMatrix::Identity;
+		IntersectionVertex.TextureCoordinates[0] = FVector2D(0,0);
+		IntersectionVertex.TextureCoordinates[1] = FVector2D(0,0);
 	}
-
-	FORCEINLINE FMatrix GetLocalToWorldTransposeAdjoint(void) const
+	// Return the index of the vertex closest to the hit point
+	int32 AbsoluteVertexIndex = Payload.VertexIndex[0];
+	if (BaryCentricWeights.Y > BaryCentricWeights.X)
 	{
-		return FMatrix::Identity;
+		if (BaryCentricWeights.Z > BaryCentricWeights.Y)
+		{
+			AbsoluteVertexIndex = Payload.VertexIndex[2];
+		}
+		else
+		{
+			AbsoluteVertexIndex = Payload.VertexIndex[1];
+		}
 	}
-
-	FORCEINLINE float GetDeterminant(void) const
+	else if (BaryCentricWeights.Z > BaryCentricWeights.X)
 	{
-		return 1.0f;
+		AbsoluteVertexIndex = Payload.VertexIndex[2];
 	}
+	// Convert the index into the BVH's vertices into an index into the hit mesh's vertices
+	const int32 RelativeVertexIndex = AbsoluteVertexIndex - Payload.MeshInfo->BaseIndex;
+	checkSlow(RelativeVertexIndex >= 0 && RelativeVertexIndex < Payload.MeshInfo->Mesh->NumVertices);
+	return FLightRayIntersection(true, IntersectionVertex, Payload.MeshInfo->Mesh, Payload.Mapping, RelativeVertexIndex, Payload.ElementIndex);
+}
 
-private:
-
-	const FStaticLightingAggregateMesh* Mesh;
-	const FLightRay& LightRay;
-};
-
+bool FStaticLightingAggregateMesh::ShouldContinueTracing(const FLightRay& LightRay, const FLightRayIntersection& Intersection, bool bDirectShadowingRay)
+{
+	// Continue tracing as long as we are intersecting meshes that might need to restart the ray
+	return Intersection.bIntersects 
+		&& (Intersection.Mesh->IsTranslucent(Intersection.ElementIndex) ||
+			Intersection.Mesh->IsMasked(Intersection.ElementIndex) ||
+			Intersection.Mesh == LightRay.Mesh && ((Intersection.Mesh->LightingFlags & GI_INSTANCE_SELFSHADOWDISABLE) || (LightRay.TraceFlags & LIGHTRAY_SELFSHADOWDISABLE)) ||
+			// Continue tracing if we are only allowed to self shadow and intersected a different mesh
+			Intersection.Mesh != LightRay.Mesh && (Intersection.Mesh->LightingFlags & GI_INSTANCE_SELFSHADOWONLY) ||
+			bDirectShadowingRay && Intersection.Mesh->IsIndirectlyShadowedOnly(Intersection.ElementIndex));
+}
 
 /**
  * Checks a light ray for intersection with the shadow mesh.
@@ -343,89 +361,25 @@ bool FStaticLightingAggregateMesh::IntersectLightRay(
 			ClosestIntersection.bIntersects = false;
 		}
 
-		// Check the kDOP containing low polygon meshes first.
-		FHitResult Result;
-		FStaticLightingAggregateMeshDataProvider kDOPDataProvider(this, ClippedLightRay);
-		TkDOPLineCollisionCheck<const FStaticLightingAggregateMeshDataProvider,uint32> kDOPCheck(
-			ClippedLightRay.Start,
-			ClippedLightRay.Start + ClippedLightRay.Direction * ClippedLightRay.Length,
-			bFindClosestIntersection,
-			(LightRay.TraceFlags & LIGHTRAY_STATIC_AND_OPAQUEONLY) != 0,
-			!bDirectShadowingRay,
-			(LightRay.TraceFlags & LIGHTRAY_FLIP_SIDEDNESS) != 0,
-			kDOPDataProvider,
-			LightRay.Mapping ? LightRay.Mapping->Mesh->MeshIndex : INDEX_NONE,
-			LightRay.Mapping ? LightRay.Mapping->Mesh->GetLODIndex() : INDEX_NONE,
-			&Result);
+		FBVHLineCheck Check;
+		SetupLineCheck(ClippedLightRay, LightRay, bFindClosestIntersection, bDirectShadowingRay, Check);
 
 		bool bHit = false; 
-		if (!bFindClosestIntersection && CoherentRayCache.kDOPNodeIndex != 0xFFFFFFFF)
+		if (!bFindClosestIntersection && CoherentRayCache.LastHitNodeIndex != BVH_INVALID_NODE)
 		{
-			TTraversalHistory<uint32> History;
 			// Trace against the last hit node if we're doing a boolean visibility check before traversing the whole tree
 			// Provides a small speedup with coherent boolean visibility rays (1.1x faster for precomputed visibility)
-			bHit = kDopTree.Nodes[CoherentRayCache.kDOPNodeIndex].LineCheck(kDOPCheck, History.AddNode(CoherentRayCache.kDOPNodeIndex));
+			bHit = BVH.LineCheck(Check, CoherentRayCache.LastHitNodeIndex);
 		}
 
 		if (!bHit)
 		{
-			bHit = kDopTree.LineCheck(kDOPCheck);
+			bHit = BVH.LineCheck(Check);
 		}
 
 		if (bHit)
 		{
-			// Setup a vertex to represent the intersection.
-			FStaticLightingVertex IntersectionVertex;
-			IntersectionVertex.WorldPosition = ClippedLightRay.Start + ClippedLightRay.Direction * ClippedLightRay.Length * Result.Time;
-			IntersectionVertex.WorldTangentZ = kDOPCheck.LocalHitNormal;
-			const FTriangleSOAPayload& Payload = TrianglePayloads[ Result.Item ];
-			const FVector4& v1 = kDOPDataProvider.GetVertex(Payload.VertexIndex[0]);
-			const FVector4& v2 = kDOPDataProvider.GetVertex(Payload.VertexIndex[1]);
-			const FVector4& v3 = kDOPDataProvider.GetVertex(Payload.VertexIndex[2]);
-			const FVector4 LocalHitPosition = kDOPCheck.LocalStart + kDOPCheck.LocalDir * Result.Time;
-			FVector4 BaryCentricWeights;
-			//@todo - why is such a huge tolerance needed?  Reuse the barycentric coords calculated by the ray-triangle intersection instead of deriving them from the hit position.
-			//@todo - why does this sometimes fail if there was an intersection?
-			if (bFindClosestIntersection && GetBarycentricWeights(v1, v2, v3, LocalHitPosition, KINDA_SMALL_NUMBER * 100.0f, BaryCentricWeights))
-			{
-				const FVector2D& UV1 = kDOPDataProvider.GetUV(Payload.VertexIndex[0]);
-				const FVector2D& UV2 = kDOPDataProvider.GetUV(Payload.VertexIndex[1]);
-				const FVector2D& UV3 = kDOPDataProvider.GetUV(Payload.VertexIndex[2]);
-				// Interpolate the material texture coordinates to the intersection point
-				//@todo - only lookup and interpolate UV's if needed
-				IntersectionVertex.TextureCoordinates[0] = UV1 * BaryCentricWeights.X + UV2 * BaryCentricWeights.Y + UV3 * BaryCentricWeights.Z;
-				const FVector2D& LightmapUV1 = kDOPDataProvider.GetLightmapUV(Payload.VertexIndex[0]);
-				const FVector2D& LightmapUV2 = kDOPDataProvider.GetLightmapUV(Payload.VertexIndex[1]);
-				const FVector2D& LightmapUV3 = kDOPDataProvider.GetLightmapUV(Payload.VertexIndex[2]);
-				// Interpolate the lightmap texture coordinates to the intersection point
-				IntersectionVertex.TextureCoordinates[1] = LightmapUV1 * BaryCentricWeights.X + LightmapUV2 * BaryCentricWeights.Y + LightmapUV3 * BaryCentricWeights.Z;
-			}
-			else
-			{
-				IntersectionVertex.TextureCoordinates[0] = FVector2D(0,0);
-				IntersectionVertex.TextureCoordinates[1] = FVector2D(0,0);
-			}
-			// Return the index of the vertex closest to the hit point
-			int32 AbsoluteVertexIndex = Payload.VertexIndex[0];
-			if (BaryCentricWeights.Y > BaryCentricWeights.X)
-			{
-				if (BaryCentricWeights.Z > BaryCentricWeights.Y)
-				{
-					AbsoluteVertexIndex = Payload.VertexIndex[2];
-				}
-				else
-				{
-					AbsoluteVertexIndex = Payload.VertexIndex[1];
-				}
-			}
-			else if (BaryCentricWeights.Z > BaryCentricWeights.X)
-			{
-				AbsoluteVertexIndex = Payload.VertexIndex[2];
-			}
-			// Convert the index into the kDOP tree's vertices into an index into the hit mesh's vertices
-			const int32 RelativeVertexIndex = AbsoluteVertexIndex - Payload.MeshInfo->BaseIndex;
-			checkSlow(RelativeVertexIndex >= 0 && RelativeVertexIndex < Payload.MeshInfo->Mesh->NumVertices);
-			ClosestIntersection = FLightRayIntersection(true, IntersectionVertex, Payload.MeshInfo->Mesh, Payload.Mapping, RelativeVertexIndex, Payload.ElementIndex);
+			ClosestIntersection = GetIntersection(ClippedLightRay, Check, bFindClosestIntersection);
 			if (bFindClosestIntersection)
 			{
 				ClippedLightRay.ClipAgainstIntersectionFromStart(ClosestIntersection.IntersectionVertex.WorldPosition);
@@ -433,21 +387,13 @@ bool FStaticLightingAggregateMesh::IntersectLightRay(
 			else
 			{
 				// Store off the hit node so future boolean visibility rays can test against that first
-				CoherentRayCache.kDOPNodeIndex = kDOPCheck.HitNodeIndex;
+				CoherentRayCache.LastHitNodeIndex = Check.HitNodeIndex;
 				//@todo - handle masked materials correctly with !bFindClosestIntersection
 				return true;
 			}
 		}
 	} 
-	// Continue tracing as long as we are intersecting meshes that might need to restart the ray
-	while (ClosestIntersection.bIntersects 
-		&& (ClosestIntersection.Mesh->IsTranslucent(ClosestIntersection.ElementIndex) ||
-			ClosestIntersection.Mesh->IsMasked(ClosestIntersection.ElementIndex) ||
-			ClosestIntersection.Mesh == LightRay.Mesh && ((ClosestIntersection.Mesh->LightingFlags & GI_INSTANCE_SELFSHADOWDISABLE) || (LightRay.TraceFlags & LIGHTRAY_SELFSHADOWDISABLE)) ||
-			// Continue tracing if we are only allowed to self shadow and intersected a different mesh
-			ClosestIntersection.Mesh != LightRay.Mesh && (ClosestIntersection.Mesh->LightingFlags & GI_INSTANCE_SELFSHADOWONLY) ||
-			bDirectShadowingRay && ClosestIntersection.Mesh->IsIndirectlyShadowedOnly(ClosestIntersection.ElementIndex))
-		&& NumIterativeIntersections < MaxNumIterativeIntersections);
+	while (ShouldContinueTracing(LightRay, ClosestIntersection, bDirectShadowingRay) && NumIterativeIntersections < MaxNumIterativeIntersections);
 
 	if (NumIterativeIntersections >= MaxNumIterativeIntersections)
 	{
@@ -461,5 +407,169 @@ bool FStaticLightingAggregateMesh::IntersectLightRay(
 	return ClosestIntersection.bIntersects;
 }
 
+void FStaticLightingAggregateMesh::IntersectLightRays(
+	const FLightRay* LightRays,
+	int32 NumRays,
+	bool bFindClosestIntersection,
+	bool bCalculateTransmission,
+	bool bDirectShadowingRay,
+	FCoherentRayCache& CoherentRayCache,
+	FLightRayIntersection* Intersections) const
+{
+	checkSlow(!bCalculateTransmission || bFindClosestIntersection);
+
+	for (int32 PacketStart = 0; PacketStart < NumRays; PacketStart += BVH_MAX_PACKET_SIZE)
+	{
+		const int32 PacketSize = FMath::Min(NumRays - PacketStart, BVH_MAX_PACKET_SIZE);
+		uint32 RestartMask = 0;
+		{
+			LIGHTINGSTAT(FScopedRDTSCTimer RayTraceTimer(bFindClosestIntersection ? CoherentRayCache.FirstHitRayTraceTime : CoherentRayCache.BooleanRayTraceTime);)
+			(bFindClosestIntersection ? CoherentRayCache.NumFirstHitRaysTraced : CoherentRayCache.NumBooleanRaysTraced) += PacketSize;
+
+			FBVHLineCheck Checks[BVH_MAX_PACKET_SIZE];
+			for (int32 RayIndex = 0; RayIndex < PacketSize; RayIndex++)
+			{
+				const FLightRay& LightRay = LightRays[PacketStart + RayIndex];
+				SetupLineCheck(LightRay, LightRay, bFindClosestIntersection, bDirectShadowingRay, Checks[RayIndex]);
+			}
+
+			const uint32 HitMask = BVH.LineCheckPacket(Checks, PacketSize);
+
+			for (int32 RayIndex = 0; RayIndex < PacketSize; RayIndex++)
+			{
+				const FLightRay& LightRay = LightRays[PacketStart + RayIndex];
+				FLightRayIntersection& Intersection = Intersections[PacketStart + RayIndex];
+				if (HitMask & (1u << RayIndex))
+				{
+					Intersection = GetIntersection(LightRay, Checks[RayIndex], bFindClosestIntersection);
+					if (bFindClosestIntersection)
+					{
+						if (ShouldContinueTracing(LightRay, Intersection, bDirectShadowingRay))
+						{
+							RestartMask |= 1u << RayIndex;
+						}
+					}
+					else
+					{
+						CoherentRayCache.LastHitNodeIndex = Checks[RayIndex].HitNodeIndex;
+					}
+				}
+				else
+				{
+					Intersection.bIntersects = false;
+				}
+				Intersection.Transmission = FLinearColor::White;
+			}
+		}
+
+		// Rays that hit something they may have to continue past, like a masked or translucent surface, are rare enough to be traced again one at a time
+		while (RestartMask != 0)
+		{
+			const uint32 RayIndex = appCountTrailingZeros(RestartMask);
+			RestartMask &= RestartMask - 1;
+			IntersectLightRay(LightRays[PacketStart + RayIndex], bFindClosestIntersection, bCalculateTransmission, bDirectShadowingRay, CoherentRayCache, Intersections[PacketStart + RayIndex]);
+		}
+	}
+}
+
+void FStaticLightingAggregateMesh::RunRayTracingBenchmark() const
+{
+	if (TrianglePayloads.Num() == 0)
+	{
+		UE_LOG(LogLightmass, Log, TEXT("Ray tracing benchmark: the scene has no shadow casting triangles"));
+		return;
+	}
+
+	// Shoot bundles of hemisphere rays from random points on the surfaces of the scene, like the final gather does
+	const int32 NumOrigins = 8192;
+	const int32 RaysPerOrigin = 64;
+	const int32 NumRays = NumOrigins * RaysPerOrigin;
+	const float RayLength = GetBounds().GetExtent().Size() * 2.0f;
+
+	TArray<FLightRay> LightRays;
+	LightRays.Empty(NumRays);
+	FLMRandomStream RandomStream(0);
+	for (int32 OriginIndex = 0; OriginIndex < NumOrigins; OriginIndex++)
+	{
+		const FTriangleSOAPayload& Payload = TrianglePayloads[FMath::Min(FMath::Trunc(RandomStream.GetFraction() * TrianglePayloads.Num()), TrianglePayloads.Num() - 1)];
+		const FVector4& V0 = Vertices[Payload.VertexIndex[0]];
+		const FVector4& V1 = Vertices[Payload.VertexIndex[1]];
+		const FVector4& V2 = Vertices[Payload.VertexIndex[2]];
+
+		float U = RandomStream.GetFraction();
+		float V = RandomStream.GetFraction();
+		if (U + V > 1.0f)
+		{
+			U = 1.0f - U;
+			V = 1.0f - V;
+		}
+		const FVector4 TriangleNormal = ((V2 - V0) ^ (V1 - V0)).SafeNormal();
+		const FVector4 Origin = V0 + (V1 - V0) * U + (V2 - V0) * V + TriangleNormal * Scene.SceneConstants.VisibilityRayOffsetDistance;
+
+		for (int32 RayIndex = 0; RayIndex < RaysPerOrigin; RayIndex++)
+		{
+			FVector4 Direction = GetUnitVector(RandomStream);
+			if (Dot3(Direction, TriangleNormal) < 0.0f)
+			{
+				Direction = -Direction;
+			}
+			LightRays.Add(FLightRay(Origin, Origin + Direction * RayLength, NULL, NULL));
+		}
+	}
+
+	UE_LOG(LogLightmass, Log, TEXT("Ray tracing benchmark: %u rays from %u surface points, %u BVH nodes, %u triangles"), NumRays, NumOrigins, BVH.Nodes.Num(), TrianglePayloads.Num());
+
+	TArray<FLightRayIntersection> SingleIntersections;
+	TArray<FLightRayIntersection> PacketIntersections;
+	SingleIntersections.AddUninitialized(NumRays);
+	PacketIntersections.AddUninitialized(NumRays);
+
+	for (int32 PassIndex = 0; PassIndex < 2; PassIndex++)
+	{
+		const bool bFindClosestIntersection = PassIndex == 0;
+		FCoherentRayCache CoherentRayCache;
+
+		const double SingleStartTime = FPlatformTime::Seconds();
+		for (int32 OriginIndex = 0; OriginIndex < NumOrigins; OriginIndex++)
+		{
+			CoherentRayCache.Clear();
+			for (int32 RayIndex = OriginIndex * RaysPerOrigin; RayIndex < (OriginIndex + 1) * RaysPerOrigin; RayIndex++)
+			{
+				IntersectLightRay(LightRays[RayIndex], bFindClosestIntersection, false, false, CoherentRayCache, SingleIntersections[RayIndex]);
+			}
+		}
+		const double SingleTime = FPlatformTime::Seconds() - SingleStartTime;
+
+		const double PacketStartTime = FPlatformTime::Seconds();
+		for (int32 OriginIndex = 0; OriginIndex < NumOrigins; OriginIndex++)
+		{
+			CoherentRayCache.Clear();
+			IntersectLightRays(&LightRays[OriginIndex * RaysPerOrigin], RaysPerOrigin, bFindClosestIntersection, false, false, CoherentRayCache, &PacketIntersections[OriginIndex * RaysPerOrigin]);
+		}
+		const double PacketTime = FPlatformTime::Seconds() - PacketStartTime;
+
+		// Both paths must agree on what was hit, and for closest hits also on where
+		int32 NumHits = 0;
+		int32 NumMismatches = 0;
+		for (int32 RayIndex = 0; RayIndex < NumRays; RayIndex++)
+		{
+			const FLightRayIntersection& Single = SingleIntersections[RayIndex];
+			const FLightRayIntersection& Packet = PacketIntersections[RayIndex];
+			NumHits += Single.bIntersects ? 1 : 0;
+			if (Single.bIntersects != Packet.bIntersects
+				|| bFindClosestIntersection && Single.bIntersects && (Single.IntersectionVertex.WorldPosition - Packet.IntersectionVertex.WorldPosition).Size3() > KINDA_SMALL_NUMBER * RayLength)
+			{
+				NumMismatches++;
+			}
+		}
+
+		UE_LOG(LogLightmass, Log, TEXT("Ray tracing benchmark, %s rays: %.1f%% hit, single %.2f Mrays/s, packets %.2f Mrays/s, %d mismatches"), 
+			bFindClosestIntersection ? TEXT("closest hit") : TEXT("boolean"),
+			100.0f * NumHits / NumRays,
+			NumRays / FMath::Max(SingleTime, (double)DELTA) / 1000000.0,
+			NumRays / FMath::Max(PacketTime, (double)DELTA) / 1000000.0,
+			NumMismatches);
+	}
+}
 
 } //namespace Lightmass
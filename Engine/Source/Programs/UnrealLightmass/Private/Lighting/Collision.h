@@ -70,8 +70,6 @@ public:
 	}
 };
 
-class FStaticLightingAggregateMeshDataProvider;  /* needs predeclaration... */
-
 /** Information about a single mesh that got aggregated. */
 struct FStaticLightingMeshInfo
 {
@@ -87,7 +85,7 @@ struct FStaticLightingMeshInfo
 	}
 };
 
-/** Each FTriangleSOA in the kDOP references 4 of these, one for each triangle it represents. */
+/** Each FTriangleSOA in the BVH references 4 of these, one for each triangle it represents. */
 struct FTriangleSOAPayload
 {
 	/** Constructor. */
@@ -171,34 +169,69 @@ public:
 		class FCoherentRayCache& CoherentRayCache,
 		FLightRayIntersection& Intersection) const;
 
+	/**
+	 * Checks a batch of light rays for intersection with the shadow mesh, with the same semantics as IntersectLightRay.
+	 * The rays are traced through the BVH as packets, which is faster than tracing them one by one when they are coherent,
+	 * such as the rays gathering incoming radiance over the hemisphere of one texel.
+	 * @param LightRays - The line segments to check for intersection.
+	 * @param NumRays - The number of line segments.
+	 * @param [out] Intersections - Receives the intersection of each light ray, NumRays entries.
+	 */
+	void IntersectLightRays(
+		const FLightRay* LightRays,
+		int32 NumRays,
+		bool bFindClosestIntersection,
+		bool bCalculateTransmission,
+		bool bDirectShadowingRay,
+		class FCoherentRayCache& CoherentRayCache,
+		FLightRayIntersection* Intersections) const;
+
+	/**
+	 * Traces random rays from the surfaces of the scene through the BVH, one at a time and as packets, and logs the throughput of both.
+	 * Used by the -raybench command line option, to measure ray tracing performance without lighting a whole scene.
+	 */
+	void RunRayTracingBenchmark() const;
+
 private:
 
-	const FScene& Scene;
+	/** Sets up a BVH line check for a light ray, which may have been clipped from the original ray. */
+	void SetupLineCheck(
+		const FLightRay& ClippedLightRay,
+		const FLightRay& LightRay,
+		bool bFindClosestIntersection,
+		bool bDirectShadowingRay,
+		FBVHLineCheck& Check) const;
+
+	/** Creates the intersection for a line check that hit something. */
+	FLightRayIntersection GetIntersection(const FLightRay& ClippedLightRay, const FBVHLineCheck& Check, bool bFindClosestIntersection) const;
 
-	friend class FStaticLightingAggregateMeshDataProvider;
+	/** Whether the ray has to be restarted past an intersection, because the surface that was hit doesn't block it. */
+	static bool ShouldContinueTracing(const FLightRay& LightRay, const FLightRayIntersection& Intersection, bool bDirectShadowingRay);
+
+	const FScene& Scene;
 
-	/** The world-space kDOP which is used by the simple meshes in the world. */
-	TkDOPTree<const FStaticLightingAggregateMeshDataProvider,uint32> kDopTree;
+	/** The world-space BVH which is used by the simple meshes in the world. */
+	FBVHTree BVH;
 
-	/** The triangles used to build the kDOP, valid until PrepareForRaytracing is called. */
+	/** The triangles used to build the BVH, valid until PrepareForRaytracing is called. */
 	TArray<FkDOPBuildCollisionTriangle<uint32> > kDOPTriangles;
  
-	/** TriangleSOA payload. Each TriangleSOA in the kDOP references 4 of these (one for each of the 4 triangles in a TriangleSOA). */
+	/** TriangleSOA payload. Each TriangleSOA in the BVH references 4 of these (one for each of the 4 triangles in a TriangleSOA). */
 	TArray<FTriangleSOAPayload> TrianglePayloads;
 
-	/** Information about the meshes used in the kDOP tree. */
+	/** Information about the meshes used in the BVH. */
 	TArray<const FStaticLightingMeshInfo*> MeshInfos;
 
 	/** 
-	 * The vertices used by the kDOP. 
+	 * The vertices used by the BVH. 
 	 * @todo - should all of these vertex attributes be stored in the same array? (ArrayOfStructures instead of SoA)
 	 */
 	TArray<FVector4> Vertices;
 
-	/** The texture coordinates used by the kDOP. */
+	/** The texture coordinates used by the BVH. */
 	TArray<FVector2D> UVs;
 
-	/** The lightmap coordinates used by the kDOP. */
+	/** The lightmap coordinates used by the BVH. */
 	TArray<FVector2D> LightmapUVs;
 
 	/** The bounding box of everything in the aggregate mesh. */
@@ -220,10 +253,10 @@ public:
 	float BooleanRayTraceTime;
 
 	/** 
-	 * Stores the index of the last hit kDOP node when doing a boolean visibility check. 
+	 * Stores the index of the last hit BVH node when doing a boolean visibility check. 
 	 * Used to optimize coherent boolean visibliity traces.
 	 */
-	uint32 kDOPNodeIndex;
+	uint32 LastHitNodeIndex;
 
 	/** Initialization constructor. */
 	FCoherentRayCache() :
@@ -231,12 +264,12 @@ public:
 		NumBooleanRaysTraced(0),
 		FirstHitRayTraceTime(0),
 		BooleanRayTraceTime(0),
-		kDOPNodeIndex(0xFFFFFFFF)
+		LastHitNodeIndex(BVH_INVALID_NODE)
 	{}
 
 	void Clear()
 	{
-		kDOPNodeIndex = 0xFFFFFFFF;
+		LastHitNodeIndex = BVH_INVALID_NODE;
 	}
 };
 
@@ -1268,8 +1268,14 @@ SampleType FStaticLightingSystem::IncomingRadianceUniform(
 	int32 NumBackfaceHits = 0;
 	float NumSamplesOccluded = 0;
 
-	// Estimate the indirect part of the light transport equation using uniform sampled monte carlo integration
-	//@todo - use cosine sampling if possible to match the indirect integrand, the irradiance caching algorithm assumes uniform sampling
+	// Generate all the hemisphere rays up front, so they can be traced together as coherent packets
+	TArray<FLightRay> PathRays;
+	TArray<FVector4> WorldPathDirections;
+	TArray<FVector4> TangentPathDirections;
+	PathRays.Empty(UniformHemisphereSamples.Num());
+	WorldPathDirections.Empty(UniformHemisphereSamples.Num());
+	TangentPathDirections.Empty(UniformHemisphereSamples.Num());
+
 	for (int32 SampleIndex = 0; SampleIndex < UniformHemisphereSamples.Num(); SampleIndex++)
 	{
 		//const FVector4& SampleDirection = UniformHemisphereSamples[SampleIndex];
@@ -1309,11 +1315,28 @@ SampleType FStaticLightingSystem::IncomingRadianceUniform(
 			NULL
 			);
 
-		MappingContext.Stats.NumFirstBounceRaysTraced++;
+		PathRays.Add(PathRay);
+		WorldPathDirections.Add(WorldPathDirection);
+		TangentPathDirections.Add(TangentPathDirection);
+	}
+
+	TArray<FLightRayIntersection> RayIntersections;
+	RayIntersections.AddUninitialized(PathRays.Num());
+	{
+		MappingContext.Stats.NumFirstBounceRaysTraced += PathRays.Num();
 		const float LastRayTraceTime = MappingContext.RayCache.FirstHitRayTraceTime;
-		FLightRayIntersection RayIntersection;
-		AggregateMesh.IntersectLightRay(PathRay, true, false, false, MappingContext.RayCache, RayIntersection);
+		AggregateMesh.IntersectLightRays(PathRays.GetTypedData(), PathRays.Num(), true, false, false, MappingContext.RayCache, RayIntersections.GetTypedData());
 		MappingContext.Stats.FirstBounceRayTraceTime += MappingContext.RayCache.FirstHitRayTraceTime - LastRayTraceTime;
+	}
+
+	// Estimate the indirect part of the light transport equation using uniform sampled monte carlo integration
+	//@todo - use cosine sampling if possible to match the indirect integrand, the irradiance caching algorithm assumes uniform sampling
+	for (int32 SampleIndex = 0; SampleIndex < UniformHemisphereSamples.Num(); SampleIndex++)
+	{
+		const FLightRay& PathRay = PathRays[SampleIndex];
+		const FVector4& WorldPathDirection = WorldPathDirections[SampleIndex];
+		const FVector4& TangentPathDirection = TangentPathDirections[SampleIndex];
+		const FLightRayIntersection& RayIntersection = RayIntersections[SampleIndex];
 
 		float PhotonImportanceSampledPDF = 0.0f;
 		{
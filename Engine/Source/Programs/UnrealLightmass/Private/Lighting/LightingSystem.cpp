@@ -503,6 +503,11 @@ FStaticLightingSystem::FStaticLightingSystem(const FLightingBuildOptions& InOpti
 	AggregateMesh.PrepareForRaytracing();
 	AggregateMesh.DumpStats();
 
+	if (GRayTracingBenchmark)
+	{
+		AggregateMesh.RunRayTracingBenchmark();
+		return;
+	}
 
 	Stats.SceneSetupTime = FPlatformTime::Seconds() - SceneSetupStart;
 	GStatistics.SceneSetupTime += Stats.SceneSetupTime;
@@ -16,6 +16,7 @@
 // these can be moved out and just included per .cpp file
 #include "LMOctree.h"			// TOctree functionality
 #include "LMkDOP.h"				// TkDOP functionality
+#include "LMBVH.h"				// FBVHTree functionality
 #include "LMCollision.h"		// Collision functionality
 
 
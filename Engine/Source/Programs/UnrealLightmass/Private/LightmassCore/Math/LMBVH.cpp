@@ -0,0 +1,532 @@
+// Copyright 1998-2014 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	LMBVH.cpp: 4-wide bounding volume hierarchy build and traversal.
+=============================================================================*/
+
+#include "stdafx.h"
+#include "LMCore.h"
+
+namespace Lightmass
+{
+
+/** Number of bins used to evaluate the surface area heuristic along each axis. */
+#define BVH_NUM_SAH_BINS		16
+/** Cost of traversing a node, relative to intersecting a FTriangleSOA. */
+#define BVH_TRAVERSAL_COST		1.0f
+
+/** A triangle being sorted into the tree. */
+struct FBVHBuildPrimitive
+{
+	FBox Bounds;
+	FVector Centroid;
+	/** Index into the build triangles. */
+	int32 TriangleIndex;
+
+	FBVHBuildPrimitive(const FkDOPBuildCollisionTriangle<uint32>& Triangle, int32 InTriangleIndex) :
+		Bounds(0),
+		Centroid(Triangle.GetCentroid()),
+		TriangleIndex(InTriangleIndex)
+	{
+		Bounds += Triangle.V0;
+		Bounds += Triangle.V1;
+		Bounds += Triangle.V2;
+	}
+};
+
+/** A range of build primitives which becomes one child of a node. */
+struct FBVHBuildRange
+{
+	int32 Start;
+	int32 Num;
+	FBox Bounds;
+	/** Whether the range was found to be cheaper as a leaf than split. */
+	bool bLeaf;
+};
+
+static FORCEINLINE float GetBoxSurfaceArea(const FBox& Box)
+{
+	const FVector Size = Box.Max - Box.Min;
+	return 2.0f * (Size.X * Size.Y + Size.Y * Size.Z + Size.Z * Size.X);
+}
+
+/** Number of FTriangleSOA's needed to hold the given number of triangles, which is what the leaf cost is measured in. */
+static FORCEINLINE int32 GetNumSOATriangles(int32 NumTriangles)
+{
+	return (NumTriangles + 3) / 4;
+}
+
+static FORCEINLINE int32 GetSAHBin(float Centroid, float AxisMin, float BinScale)
+{
+	return FMath::Clamp(FMath::Trunc((Centroid - AxisMin) * BinScale), 0, BVH_NUM_SAH_BINS - 1);
+}
+
+static FBox GetRangeBounds(const TArray<FBVHBuildPrimitive>& Primitives, int32 Start, int32 Num)
+{
+	FBox Bounds(0);
+	for (int32 PrimitiveIndex = Start; PrimitiveIndex < Start + Num; PrimitiveIndex++)
+	{
+		Bounds += Primitives[PrimitiveIndex].Bounds;
+	}
+	return Bounds;
+}
+
+/**
+ * Finds the cheapest binned SAH split of a range of primitives and partitions the range around it.
+ *
+ * @return Number of primitives that ended up on the left side of the split, 0 if the range should become a leaf
+ */
+static int32 SplitPrimitives(TArray<FBVHBuildPrimitive>& Primitives, int32 Start, int32 Num, const FBox& Bounds)
+{
+	if (Num <= GKDOPMaxTrisPerLeaf)
+	{
+		return 0;
+	}
+
+	FBox CentroidBounds(0);
+	for (int32 PrimitiveIndex = Start; PrimitiveIndex < Start + Num; PrimitiveIndex++)
+	{
+		CentroidBounds += Primitives[PrimitiveIndex].Centroid;
+	}
+
+	const float ParentArea = GetBoxSurfaceArea(Bounds);
+	const float OneOverParentArea = ParentArea > 0 ? 1.0f / ParentArea : 0;
+	float BestCost = MAX_FLT;
+	int32 BestAxis = INDEX_NONE;
+	int32 BestBin = INDEX_NONE;
+	float BestBinScale = 0;
+
+	for (int32 Axis = 0; Axis < 3; Axis++)
+	{
+		const float AxisMin = CentroidBounds.Min[Axis];
+		const float AxisExtent = CentroidBounds.Max[Axis] - AxisMin;
+		if (AxisExtent <= 0)
+		{
+			continue;
+		}
+
+		FBox BinBounds[BVH_NUM_SAH_BINS];
+		int32 BinCounts[BVH_NUM_SAH_BINS];
+		for (int32 BinIndex = 0; BinIndex < BVH_NUM_SAH_BINS; BinIndex++)
+		{
+			BinBounds[BinIndex] = FBox(0);
+			BinCounts[BinIndex] = 0;
+		}
+
+		const float BinScale = BVH_NUM_SAH_BINS / AxisExtent;
+		for (int32 PrimitiveIndex = Start; PrimitiveIndex < Start + Num; PrimitiveIndex++)
+		{
+			const FBVHBuildPrimitive& Primitive = Primitives[PrimitiveIndex];
+			const int32 BinIndex = GetSAHBin(Primitive.Centroid[Axis], AxisMin, BinScale);
+			BinBounds[BinIndex] += Primitive.Bounds;
+			BinCounts[BinIndex]++;
+		}
+
+		// Sweep from the right to get the area and count of everything to the right of each split plane
+		float RightAreas[BVH_NUM_SAH_BINS - 1];
+		int32 RightCounts[BVH_NUM_SAH_BINS - 1];
+		FBox RightBounds(0);
+		int32 RightCount = 0;
+		for (int32 BinIndex = BVH_NUM_SAH_BINS - 1; BinIndex > 0; BinIndex--)
+		{
+			RightBounds += BinBounds[BinIndex];
+			RightCount += BinCounts[BinIndex];
+			RightAreas[BinIndex - 1] = RightCount > 0 ? GetBoxSurfaceArea(RightBounds) : 0;
+			RightCounts[BinIndex - 1] = RightCount;
+		}
+
+		// Sweep from the left, evaluating the cost of splitting after each bin
+		FBox LeftBounds(0);
+		int32 LeftCount = 0;
+		for (int32 BinIndex = 0; BinIndex < BVH_NUM_SAH_BINS - 1; BinIndex++)
+		{
+			LeftBounds += BinBounds[BinIndex];
+			LeftCount += BinCounts[BinIndex];
+			if (LeftCount == 0 || RightCounts[BinIndex] == 0)
+			{
+				continue;
+			}
+
+			const float Cost = BVH_TRAVERSAL_COST
+				+ (GetBoxSurfaceArea(LeftBounds) * GetNumSOATriangles(LeftCount) + RightAreas[BinIndex] * GetNumSOATriangles(RightCounts[BinIndex])) * OneOverParentArea;
+
+			if (Cost < BestCost)
+			{
+				BestCost = Cost;
+				BestAxis = Axis;
+				BestBin = BinIndex;
+				BestBinScale = BinScale;
+			}
+		}
+	}
+
+	if (BestAxis == INDEX_NONE)
+	{
+		// All the centroids are in the same spot, split in the middle if the range is too big for a leaf
+		return Num > BVH_MAX_SAH_LEAF_SIZE ? Num / 2 : 0;
+	}
+
+	if (Num <= BVH_MAX_SAH_LEAF_SIZE && GetNumSOATriangles(Num) <= BestCost)
+	{
+		return 0;
+	}
+
+	// Partition the range around the split plane, using the same binning as the cost evaluation so both sides are non-empty
+	const float AxisMin = CentroidBounds.Min[BestAxis];
+	int32 Left = Start;
+	int32 Right = Start + Num - 1;
+	while (Left <= Right)
+	{
+		if (GetSAHBin(Primitives[Left].Centroid[BestAxis], AxisMin, BestBinScale) <= BestBin)
+		{
+			Left++;
+		}
+		else
+		{
+			Exchange(Primitives[Left], Primitives[Right]);
+			Right--;
+		}
+	}
+
+	checkSlow(Left > Start && Left < Start + Num);
+	return Left - Start;
+}
+
+void FBVHTree::Build(TArray<FkDOPBuildCollisionTriangle<uint32> >& BuildTriangles)
+{
+	float BVHBuildTime = 0;
+	{
+		FScopedRDTSCTimer BVHBuildTimer(BVHBuildTime);
+
+		// A 4-wide tree has roughly a node per 8 triangles and a FTriangleSOA per 3
+		Nodes.Empty(BuildTriangles.Num() / 4 + 1);
+		SOATriangles.Empty(BuildTriangles.Num() / 2 + 1);
+		NumLeaves = 0;
+
+		TArray<FBVHBuildPrimitive> Primitives;
+		Primitives.Empty(BuildTriangles.Num());
+		FBox Bounds(0);
+		for (int32 TriangleIndex = 0; TriangleIndex < BuildTriangles.Num(); TriangleIndex++)
+		{
+			const FBVHBuildPrimitive* Primitive = new(Primitives) FBVHBuildPrimitive(BuildTriangles[TriangleIndex], TriangleIndex);
+			Bounds += Primitive->Bounds;
+		}
+
+		if (Primitives.Num() > 0)
+		{
+			BuildNode(Primitives, 0, Primitives.Num(), Bounds, 0, BuildTriangles);
+		}
+
+		// Don't waste memory.
+		Nodes.Shrink();
+		SOATriangles.Shrink();
+
+		GKDOPNodes = Nodes.Num();
+		GKDOPNumLeaves = NumLeaves;
+		GKDOPTriangles = SOATriangles.Num() * 4;
+	}
+	UE_LOG(LogLightmass, Log, TEXT("Building BVH took %5.2f seconds."), BVHBuildTime);
+}
+
+uint32 FBVHTree::BuildNode(TArray<FBVHBuildPrimitive>& Primitives, int32 Start, int32 Num, const FBox& Bounds, int32 Depth, TArray<FkDOPBuildCollisionTriangle<uint32> >& BuildTriangles)
+{
+	const uint32 NodeIndex = Nodes.AddZeroed();
+
+	// Find the children of the node by repeatedly splitting the child with the largest surface area, until there are 4 of them
+	FBVHBuildRange Ranges[4];
+	int32 NumRanges = 1;
+	Ranges[0].Start = Start;
+	Ranges[0].Num = Num;
+	Ranges[0].Bounds = Bounds;
+	Ranges[0].bLeaf = Depth >= BVH_MAX_DEPTH;
+
+	while (NumRanges < 4)
+	{
+		int32 SplitRangeIndex = INDEX_NONE;
+		float LargestArea = -1.0f;
+		for (int32 RangeIndex = 0; RangeIndex < NumRanges; RangeIndex++)
+		{
+			const float Area = GetBoxSurfaceArea(Ranges[RangeIndex].Bounds);
+			if (!Ranges[RangeIndex].bLeaf && Area > LargestArea)
+			{
+				SplitRangeIndex = RangeIndex;
+				LargestArea = Area;
+			}
+		}
+
+		if (SplitRangeIndex == INDEX_NONE)
+		{
+			break;
+		}
+
+		FBVHBuildRange& SplitRange = Ranges[SplitRangeIndex];
+		const int32 NumLeft = SplitPrimitives(Primitives, SplitRange.Start, SplitRange.Num, SplitRange.Bounds);
+		if (NumLeft == 0)
+		{
+			SplitRange.bLeaf = true;
+			continue;
+		}
+
+		FBVHBuildRange& RightRange = Ranges[NumRanges++];
+		RightRange.Start = SplitRange.Start + NumLeft;
+		RightRange.Num = SplitRange.Num - NumLeft;
+		RightRange.Bounds = GetRangeBounds(Primitives, RightRange.Start, RightRange.Num);
+		RightRange.bLeaf = Depth >= BVH_MAX_DEPTH;
+
+		SplitRange.Num = NumLeft;
+		SplitRange.Bounds = GetRangeBounds(Primitives, SplitRange.Start, SplitRange.Num);
+	}
+
+	for (int32 ChildIndex = 0; ChildIndex < 4; ChildIndex++)
+	{
+		if (ChildIndex >= NumRanges)
+		{
+			FBVHNode& Node = Nodes[NodeIndex];
+			Node.Children[ChildIndex] = BVH_INVALID_NODE;
+			Node.NumChildTriangles[ChildIndex] = 0;
+			Node.ChildBounds.SetBox(ChildIndex, FBox(FVector(0,0,0), FVector(0,0,0)));
+			continue;
+		}
+
+		const FBVHBuildRange& Range = Ranges[ChildIndex];
+		if (Range.bLeaf || Range.Num <= GKDOPMaxTrisPerLeaf)
+		{
+			const uint32 FirstTriangle = BuildLeaf(Primitives, Range.Start, Range.Num, BuildTriangles);
+			FBVHNode& Node = Nodes[NodeIndex];
+			Node.Children[ChildIndex] = FirstTriangle;
+			Node.NumChildTriangles[ChildIndex] = GetNumSOATriangles(Range.Num);
+			NumLeaves++;
+		}
+		else
+		{
+			// Nodes may be reallocated by the recursion, so only reference the node once it returns
+			const uint32 ChildNodeIndex = BuildNode(Primitives, Range.Start, Range.Num, Range.Bounds, Depth + 1, BuildTriangles);
+			FBVHNode& Node = Nodes[NodeIndex];
+			Node.Children[ChildIndex] = ChildNodeIndex;
+			Node.NumChildTriangles[ChildIndex] = 0;
+		}
+		Nodes[NodeIndex].ChildBounds.SetBox(ChildIndex, Range.Bounds);
+	}
+
+	return NodeIndex;
+}
+
+uint32 FBVHTree::BuildLeaf(const TArray<FBVHBuildPrimitive>& Primitives, int32 Start, int32 Num, TArray<FkDOPBuildCollisionTriangle<uint32> >& BuildTriangles)
+{
+	// "NULL triangle", used when a leaf can't fill all 4 triangles in a FTriangleSOA.
+	// No line should ever hit these triangles, set the values so that it can never happen.
+	FkDOPBuildCollisionTriangle<uint32> EmptyTriangle(0,FVector4(0,0,0,0),FVector4(0,0,0,0),FVector4(0,0,0,0),INDEX_NONE,INDEX_NONE, false, true);
+
+	const uint32 FirstTriangle = SOATriangles.Num();
+	const int32 NumSOATriangles = GetNumSOATriangles(Num);
+	SOATriangles.AddZeroed(NumSOATriangles);
+
+	int32 PrimitiveIndex = Start;
+	for (int32 SOAIndex = 0; SOAIndex < NumSOATriangles; SOAIndex++)
+	{
+		FkDOPBuildCollisionTriangle<uint32>* Tris[4] = { &EmptyTriangle, &EmptyTriangle, &EmptyTriangle, &EmptyTriangle };
+		FTriangleSOA& SOA = SOATriangles[FirstTriangle + SOAIndex];
+		int32 SubIndex = 0;
+		for ( ; SubIndex < 4 && PrimitiveIndex < Start + Num; ++SubIndex, ++PrimitiveIndex)
+		{
+			Tris[SubIndex] = &BuildTriangles[Primitives[PrimitiveIndex].TriangleIndex];
+			SOA.Payload[SubIndex] = Tris[SubIndex]->MaterialIndex;
+		}
+		for ( ; SubIndex < 4; ++SubIndex)
+		{
+			SOA.Payload[SubIndex] = 0xffffffff;
+		}
+
+		appBuildTriangleSOA(SOA, Tris);
+	}
+
+	return FirstTriangle;
+}
+
+/** Inserts a child into a list of child indices kept sorted by entry time. */
+static FORCEINLINE void InsertSortedChild(int32* SortedChildren, int32& NumSortedChildren, int32 ChildIndex, const float* EntryTimes)
+{
+	int32 InsertIndex = NumSortedChildren++;
+	while (InsertIndex > 0 && EntryTimes[SortedChildren[InsertIndex - 1]] > EntryTimes[ChildIndex])
+	{
+		SortedChildren[InsertIndex] = SortedChildren[InsertIndex - 1];
+		InsertIndex--;
+	}
+	SortedChildren[InsertIndex] = ChildIndex;
+}
+
+bool FBVHTree::LineCheck(FBVHLineCheck& Check, uint32 StartNodeIndex) const
+{
+	if (Nodes.Num() == 0)
+	{
+		return false;
+	}
+
+	uint32 NodeStack[BVH_STACK_SIZE];
+	int32 StackSize = 0;
+	NodeStack[StackSize++] = StartNodeIndex;
+
+	bool bHit = false;
+	while (StackSize > 0)
+	{
+		const uint32 NodeIndex = NodeStack[--StackSize];
+		const FBVHNode& Node = Nodes[NodeIndex];
+
+		VectorRegister EntryTimesRegister;
+		const int32 ChildHitMask = LineCheckChildBounds(Node, Check, EntryTimesRegister);
+		if (ChildHitMask == 0)
+		{
+			continue;
+		}
+
+		MS_ALIGN(16) float EntryTimes[4] GCC_ALIGN(16);
+		VectorStoreAligned(EntryTimesRegister, EntryTimes);
+
+		int32 SortedChildren[4];
+		int32 NumSortedChildren = 0;
+		for (int32 ChildIndex = 0; ChildIndex < 4; ChildIndex++)
+		{
+			if ((ChildHitMask & (1 << ChildIndex)) && Node.Children[ChildIndex] != BVH_INVALID_NODE)
+			{
+				InsertSortedChild(SortedChildren, NumSortedChildren, ChildIndex, EntryTimes);
+			}
+		}
+
+		// Intersect the leaves right away, front to back so that closer hits cull the leaves behind them
+		for (int32 SortedIndex = 0; SortedIndex < NumSortedChildren; SortedIndex++)
+		{
+			const int32 ChildIndex = SortedChildren[SortedIndex];
+			if (Node.NumChildTriangles[ChildIndex] > 0
+				&& EntryTimes[ChildIndex] < Check.Result.Time
+				&& LineCheckLeaf(Check, Node.Children[ChildIndex], Node.NumChildTriangles[ChildIndex], NodeIndex))
+			{
+				bHit = true;
+				if (!Check.bFindClosestIntersection)
+				{
+					return true;
+				}
+			}
+		}
+
+		// Push the internal children back to front, so the closest one is traversed next
+		for (int32 SortedIndex = NumSortedChildren - 1; SortedIndex >= 0; SortedIndex--)
+		{
+			const int32 ChildIndex = SortedChildren[SortedIndex];
+			if (Node.NumChildTriangles[ChildIndex] == 0)
+			{
+				checkSlow(StackSize < BVH_STACK_SIZE);
+				NodeStack[StackSize++] = Node.Children[ChildIndex];
+			}
+		}
+	}
+	return bHit;
+}
+
+uint32 FBVHTree::LineCheckPacket(FBVHLineCheck* Checks, int32 NumChecks) const
+{
+	checkSlow(NumChecks <= BVH_MAX_PACKET_SIZE);
+	if (Nodes.Num() == 0 || NumChecks <= 0)
+	{
+		return 0;
+	}
+
+	// Every stack entry carries the mask of the rays that entered the node's bounds
+	uint32 NodeStack[BVH_STACK_SIZE];
+	uint32 RayMaskStack[BVH_STACK_SIZE];
+	int32 StackSize = 0;
+	NodeStack[StackSize] = 0;
+	RayMaskStack[StackSize] = NumChecks == 32 ? 0xFFFFFFFF : (1u << NumChecks) - 1;
+	StackSize++;
+
+	uint32 HitMask = 0;
+	// Boolean rays that have hit something and don't need to be traced any further
+	uint32 FinishedMask = 0;
+	while (StackSize > 0)
+	{
+		StackSize--;
+		const uint32 NodeIndex = NodeStack[StackSize];
+		uint32 ActiveMask = RayMaskStack[StackSize] & ~FinishedMask;
+		if (ActiveMask == 0)
+		{
+			continue;
+		}
+
+		const FBVHNode& Node = Nodes[NodeIndex];
+
+		// Test every active ray against the 4 children, and gather the rays that enter each child
+		uint32 ChildRayMasks[4] = { 0, 0, 0, 0 };
+		float ChildEntryTimes[4] = { MAX_FLT, MAX_FLT, MAX_FLT, MAX_FLT };
+		while (ActiveMask != 0)
+		{
+			const uint32 RayIndex = appCountTrailingZeros(ActiveMask);
+			ActiveMask &= ActiveMask - 1;
+
+			VectorRegister EntryTimesRegister;
+			const int32 ChildHitMask = LineCheckChildBounds(Node, Checks[RayIndex], EntryTimesRegister);
+			if (ChildHitMask != 0)
+			{
+				MS_ALIGN(16) float EntryTimes[4] GCC_ALIGN(16);
+				VectorStoreAligned(EntryTimesRegister, EntryTimes);
+				for (int32 ChildIndex = 0; ChildIndex < 4; ChildIndex++)
+				{
+					if (ChildHitMask & (1 << ChildIndex))
+					{
+						ChildRayMasks[ChildIndex] |= 1u << RayIndex;
+						ChildEntryTimes[ChildIndex] = FMath::Min(ChildEntryTimes[ChildIndex], EntryTimes[ChildIndex]);
+					}
+				}
+			}
+		}
+
+		// Order the children by the earliest time any ray enters them
+		int32 SortedChildren[4];
+		int32 NumSortedChildren = 0;
+		for (int32 ChildIndex = 0; ChildIndex < 4; ChildIndex++)
+		{
+			if (ChildRayMasks[ChildIndex] != 0 && Node.Children[ChildIndex] != BVH_INVALID_NODE)
+			{
+				InsertSortedChild(SortedChildren, NumSortedChildren, ChildIndex, ChildEntryTimes);
+			}
+		}
+
+		for (int32 SortedIndex = 0; SortedIndex < NumSortedChildren; SortedIndex++)
+		{
+			const int32 ChildIndex = SortedChildren[SortedIndex];
+			if (Node.NumChildTriangles[ChildIndex] > 0)
+			{
+				uint32 LeafRayMask = ChildRayMasks[ChildIndex] & ~FinishedMask;
+				while (LeafRayMask != 0)
+				{
+					const uint32 RayIndex = appCountTrailingZeros(LeafRayMask);
+					LeafRayMask &= LeafRayMask - 1;
+
+					FBVHLineCheck& Check = Checks[RayIndex];
+					if (LineCheckLeaf(Check, Node.Children[ChildIndex], Node.NumChildTriangles[ChildIndex], NodeIndex))
+					{
+						HitMask |= 1u << RayIndex;
+						if (!Check.bFindClosestIntersection)
+						{
+							FinishedMask |= 1u << RayIndex;
+						}
+					}
+				}
+			}
+		}
+
+		for (int32 SortedIndex = NumSortedChildren - 1; SortedIndex >= 0; SortedIndex--)
+		{
+			const int32 ChildIndex = SortedChildren[SortedIndex];
+			const uint32 ChildRayMask = ChildRayMasks[ChildIndex] & ~FinishedMask;
+			if (Node.NumChildTriangles[ChildIndex] == 0 && ChildRayMask != 0)
+			{
+				checkSlow(StackSize < BVH_STACK_SIZE);
+				NodeStack[StackSize] = Node.Children[ChildIndex];
+				RayMaskStack[StackSize] = ChildRayMask;
+				StackSize++;
+			}
+		}
+	}
+	return HitMask;
+}
+
+} // namespace
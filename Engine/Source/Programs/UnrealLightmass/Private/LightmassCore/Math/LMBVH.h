@@ -0,0 +1,251 @@
+// Copyright 1998-2014 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	LMBVH.h: 4-wide bounding volume hierarchy used for ray casting.
+=============================================================================*/
+
+#pragma once
+
+namespace Lightmass
+{
+
+/** Marks an unused child slot of a FBVHNode. */
+#define BVH_INVALID_NODE		0xFFFFFFFF
+/** Maximum depth of the tree, deeper ranges are turned into leaves. */
+#define BVH_MAX_DEPTH			48
+/** Size of the traversal stacks, every level of the tree can push at most 3 more nodes than it pops. */
+#define BVH_STACK_SIZE			((BVH_MAX_DEPTH + 1) * 3 + 1)
+/** Largest number of triangles the SAH is allowed to put into a leaf when that is cheaper than splitting. */
+#define BVH_MAX_SAH_LEAF_SIZE	16
+/** Largest number of rays that can be traced together by FBVHTree::LineCheckPacket. */
+#define BVH_MAX_PACKET_SIZE		32
+
+/**
+ * A node in the BVH. Stores the bounds of its 4 children in SOA form so that a ray can be tested against
+ * all of them at once.
+ */
+struct FBVHNode
+{
+	/** Bounding boxes of the 4 children. */
+	FMultiBox ChildBounds;
+
+	/** Index of the child node for internal children, index of the first FTriangleSOA for leaf children. BVH_INVALID_NODE for unused slots. */
+	uint32 Children[4];
+
+	/** Number of FTriangleSOA's in a leaf child, 0 for internal children and unused slots. */
+	uint32 NumChildTriangles[4];
+};
+
+/**
+ * The information used to trace a line segment through a FBVHTree, and the result of the trace.
+ * Positions are in world space, as the tree is only used for the aggregate mesh.
+ */
+struct FBVHLineCheck
+{
+	/** Start of the line, where each component is replicated into their own vector registers. */
+	FVector3SOA	StartSOA;
+	/** End of the line, where each component is replicated into their own vector registers. */
+	FVector3SOA	EndSOA;
+	/** Direction of the line (not normalized, just EndSOA-StartSOA), where each component is replicated into their own vector registers. */
+	FVector3SOA	DirSOA;
+	/** 1 / Direction of the line, where each component is replicated into their own vector registers. */
+	FVector3SOA	OneOverDirSOA;
+	/** Mesh index of the instigating mesh in every channel. */
+	VectorRegister MeshIndexRegister;
+	/** LOD index of the instigating mesh in every channel. */
+	VectorRegister LODIndexRegister;
+
+	FVector4 Start;
+	FVector4 End;
+	FVector4 Dir;
+
+	/** Normal of the triangle that was hit. */
+	FVector4 HitNormal;
+
+	/** Time and payload of the closest hit so far. */
+	FHitResult Result;
+
+	/** Index of the node whose leaf child contained the hit, BVH_INVALID_NODE if nothing was hit. */
+	uint32 HitNodeIndex;
+
+	/** Flags for optimizing a trace */
+	bool bFindClosestIntersection;
+	bool bStaticAndOpaqueOnly;
+	bool bTwoSidedCollision;
+	bool bFlipSidedness;
+
+	/**
+	 * Sets up the check for a new line. Not a constructor so that packets of checks can live in plain arrays.
+	 *
+	 * @param InStart - The starting point of the trace
+	 * @param InEnd - The ending point of the trace
+	 * @param bInFindClosestIntersection - Whether to stop at the first hit or not
+	 * @param MeshIndex - Index of the mesh that instigated the trace, INDEX_NONE if none
+	 * @param LODIndex - LOD index of the mesh that instigated the trace, INDEX_NONE if none
+	 */
+	void Init(
+		const FVector4& InStart,
+		const FVector4& InEnd,
+		bool bInFindClosestIntersection,
+		bool bInStaticAndOpaqueOnly,
+		bool bInTwoSidedCollision,
+		bool bInFlipSidedness,
+		int32 MeshIndex,
+		int32 LODIndex)
+	{
+		Start = InStart;
+		End = InEnd;
+		Dir = End - Start;
+		HitNormal = FVector4(0,0,0,0);
+		Result = FHitResult();
+		HitNodeIndex = BVH_INVALID_NODE;
+		bFindClosestIntersection = bInFindClosestIntersection;
+		bStaticAndOpaqueOnly = bInStaticAndOpaqueOnly;
+		bTwoSidedCollision = bInTwoSidedCollision;
+		bFlipSidedness = bInFlipSidedness;
+
+		const float OneOverDirX = Dir.X ? 1.f / Dir.X : MAX_FLT;
+		const float OneOverDirY = Dir.Y ? 1.f / Dir.Y : MAX_FLT;
+		const float OneOverDirZ = Dir.Z ? 1.f / Dir.Z : MAX_FLT;
+
+		StartSOA.X = VectorLoadFloat1( &Start.X );
+		StartSOA.Y = VectorLoadFloat1( &Start.Y );
+		StartSOA.Z = VectorLoadFloat1( &Start.Z );
+		EndSOA.X = VectorLoadFloat1( &End.X );
+		EndSOA.Y = VectorLoadFloat1( &End.Y );
+		EndSOA.Z = VectorLoadFloat1( &End.Z );
+		DirSOA.X = VectorLoadFloat1( &Dir.X );
+		DirSOA.Y = VectorLoadFloat1( &Dir.Y );
+		DirSOA.Z = VectorLoadFloat1( &Dir.Z );
+		OneOverDirSOA.X = VectorSetFloat1( OneOverDirX );
+		OneOverDirSOA.Y = VectorSetFloat1( OneOverDirY );
+		OneOverDirSOA.Z = VectorSetFloat1( OneOverDirZ );
+		MeshIndexRegister = VectorLoadFloat1(&MeshIndex);
+		LODIndexRegister = VectorLoadFloat1(&LODIndex);
+	}
+};
+
+/** A triangle being sorted into the tree during the build. */
+struct FBVHBuildPrimitive;
+
+/**
+ * A 4-wide bounding volume hierarchy over FTriangleSOA's, built with a binned surface area heuristic.
+ * Every node holds the bounds of up to 4 children, which are tested against a ray with a single SIMD slab test,
+ * and leaves are stored inline in their parent so that tracing never visits a node that only holds triangles.
+ */
+class FBVHTree
+{
+public:
+
+	/** The list of nodes contained within this tree. Node 0 is always the root node. */
+	kDOPArray<FBVHNode, FRangeChecklessHeapAllocator> Nodes;
+
+	/** The list of collision triangles in this tree, each leaf references a contiguous range. */
+	kDOPArray<FTriangleSOA, FRangeChecklessHeapAllocator> SOATriangles;
+
+	/** Number of leaves in the tree. */
+	int32 NumLeaves;
+
+	FBVHTree() :
+		NumLeaves(0)
+	{}
+
+	/**
+	 * Builds the tree over the passed in triangles. The payload of every triangle is set to its MaterialIndex.
+	 *
+	 * @param BuildTriangles - The list of triangles to use for the build process
+	 */
+	void Build(TArray<FkDOPBuildCollisionTriangle<uint32> >& BuildTriangles);
+
+	/**
+	 * Traces a line through the tree, starting at the given node.
+	 *
+	 * @param Check - The line to trace, receives the hit
+	 * @param StartNodeIndex - Node to start the traversal at, the root by default
+	 * @return true if anything was hit
+	 */
+	bool LineCheck(FBVHLineCheck& Check, uint32 StartNodeIndex = 0) const;
+
+	/**
+	 * Traces a packet of lines through the tree together, every node is fetched once for all the lines that reach it.
+	 * This pays off for coherent lines, such as the final gather rays from one texel.
+	 *
+	 * @param Checks - The lines to trace, each receives its own hit
+	 * @param NumChecks - Number of lines, at most BVH_MAX_PACKET_SIZE
+	 * @return Bitmask of the lines that hit anything
+	 */
+	uint32 LineCheckPacket(FBVHLineCheck* Checks, int32 NumChecks) const;
+
+private:
+
+	/**
+	 * Intersects a line with the 4 child bounds of a node.
+	 *
+	 * @param Node - The node whose children to test
+	 * @param Check - The line, only children entered before its current hit time pass
+	 * @param OutEntryTimes - Receives the time at which the line enters each child
+	 * @return Bitmask of the children that were hit
+	 */
+	FORCEINLINE int32 LineCheckChildBounds(const FBVHNode& Node, const FBVHLineCheck& Check, VectorRegister& OutEntryTimes) const
+	{
+		// Slab test, see http://www.flipcode.com/archives/SSE_RayBox_Intersection_Test.shtml
+		const VectorRegister CurrentHitTime	= VectorSetFloat1( Check.Result.Time );
+		const VectorRegister BoxMinSlabX	= VectorMultiply( VectorSubtract( VectorLoadAligned( &Node.ChildBounds.Min[0] ), Check.StartSOA.X ), Check.OneOverDirSOA.X );
+		const VectorRegister BoxMinSlabY	= VectorMultiply( VectorSubtract( VectorLoadAligned( &Node.ChildBounds.Min[1] ), Check.StartSOA.Y ), Check.OneOverDirSOA.Y );
+		const VectorRegister BoxMinSlabZ	= VectorMultiply( VectorSubtract( VectorLoadAligned( &Node.ChildBounds.Min[2] ), Check.StartSOA.Z ), Check.OneOverDirSOA.Z );
+		const VectorRegister BoxMaxSlabX	= VectorMultiply( VectorSubtract( VectorLoadAligned( &Node.ChildBounds.Max[0] ), Check.StartSOA.X ), Check.OneOverDirSOA.X );
+		const VectorRegister BoxMaxSlabY	= VectorMultiply( VectorSubtract( VectorLoadAligned( &Node.ChildBounds.Max[1] ), Check.StartSOA.Y ), Check.OneOverDirSOA.Y );
+		const VectorRegister BoxMaxSlabZ	= VectorMultiply( VectorSubtract( VectorLoadAligned( &Node.ChildBounds.Max[2] ), Check.StartSOA.Z ), Check.OneOverDirSOA.Z );
+
+		const VectorRegister MinTime		= VectorMax( VectorMax( VectorMin( BoxMinSlabX, BoxMaxSlabX ), VectorMin( BoxMinSlabY, BoxMaxSlabY ) ), VectorMin( BoxMinSlabZ, BoxMaxSlabZ ) );
+		const VectorRegister MaxTime		= VectorMin( VectorMin( VectorMax( BoxMinSlabX, BoxMaxSlabX ), VectorMax( BoxMinSlabY, BoxMaxSlabY ) ), VectorMax( BoxMinSlabZ, BoxMaxSlabZ ) );
+
+		const VectorRegister NodeHit		= VectorBitwiseAND( VectorCompareGE( MaxTime, VectorZero() ), VectorCompareGE( MaxTime, MinTime ) );
+		const VectorRegister CloserNodeHit	= VectorBitwiseAND( NodeHit, VectorCompareGT( CurrentHitTime, MinTime ) );
+		OutEntryTimes = MinTime;
+		return VectorMaskBits( CloserNodeHit );
+	}
+
+	/**
+	 * Intersects a line with the triangles of a leaf.
+	 *
+	 * @param Check - The line, receives the hit
+	 * @param FirstTriangle - Index of the first FTriangleSOA of the leaf
+	 * @param NumTriangles - Number of FTriangleSOA's in the leaf
+	 * @param ParentNodeIndex - Node that references the leaf, stored in the check on a hit
+	 * @return true if a triangle closer than the current hit was found
+	 */
+	FORCEINLINE bool LineCheckLeaf(FBVHLineCheck& Check, uint32 FirstTriangle, uint32 NumTriangles, uint32 ParentNodeIndex) const
+	{
+		bool bHit = false;
+		for (uint32 SOAIndex = FirstTriangle; SOAIndex < FirstTriangle + NumTriangles; SOAIndex++)
+		{
+			const FTriangleSOA& TriangleSOA = SOATriangles[SOAIndex];
+			const int32 SubIndex = appLineCheckTriangleSOA( Check.StartSOA, Check.EndSOA, Check.DirSOA, Check.MeshIndexRegister, Check.LODIndexRegister, TriangleSOA, Check.bStaticAndOpaqueOnly, Check.bTwoSidedCollision, Check.bFlipSidedness, Check.Result.Time );
+			if (SubIndex >= 0)
+			{
+				bHit = true;
+				Check.HitNormal.X = VectorGetComponent(TriangleSOA.Normals.X, SubIndex);
+				Check.HitNormal.Y = VectorGetComponent(TriangleSOA.Normals.Y, SubIndex);
+				Check.HitNormal.Z = VectorGetComponent(TriangleSOA.Normals.Z, SubIndex);
+				Check.Result.Item = TriangleSOA.Payload[SubIndex];
+				Check.HitNodeIndex = ParentNodeIndex;
+
+				// Early out if we don't care about the closest intersection.
+				if (!Check.bFindClosestIntersection)
+				{
+					break;
+				}
+			}
+		}
+		return bHit;
+	}
+
+	/** Recursively builds the node covering the given range of build primitives, returns its index. */
+	uint32 BuildNode(TArray<FBVHBuildPrimitive>& Primitives, int32 Start, int32 Num, const FBox& Bounds, int32 Depth, TArray<FkDOPBuildCollisionTriangle<uint32> >& BuildTriangles);
+
+	/** Packs the triangles of a leaf into FTriangleSOA's, returns the index of the first one. */
+	uint32 BuildLeaf(const TArray<FBVHBuildPrimitive>& Primitives, int32 Start, int32 Num, TArray<FkDOPBuildCollisionTriangle<uint32> >& BuildTriangles);
+};
+
+} // namespace
@@ -0,0 +1,19 @@
+// Copyright 1998-2014 Epic Games, Inc. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class AudioMixer : ModuleRules
+{
+	public AudioMixer(TargetInfo Target)
+	{
+		PrivateIncludePathModuleNames.Add("TargetPlatform");
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[] {
+				"Core",
+				"CoreUObject",
+				"Engine",
+			}
+			);
+	}
+}
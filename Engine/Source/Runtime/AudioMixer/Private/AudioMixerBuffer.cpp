@@ -0,0 +1,214 @@
+// Copyright 1998-2014 Epic Games, Inc. All Rights Reserved.
+
+#include "AudioMixerDevice.h"
+#include "AudioDecompress.h"
+
+/*------------------------------------------------------------------------------------
+	FMixerSoundBuffer.
+------------------------------------------------------------------------------------*/
+
+FMixerSoundBuffer::FMixerSoundBuffer( FMixerAudioDevice* InAudioDevice )
+	: AudioDevice( InAudioDevice )
+	, Format( MixerBufferFormat_Invalid )
+	, PCMData( NULL )
+	, NumFrames( 0 )
+	, BufferSize( 0 )
+	, SampleRate( 0 )
+	, DecompressionState( NULL )
+	, bOwnsPCMData( false )
+{
+}
+
+FMixerSoundBuffer::~FMixerSoundBuffer()
+{
+	if( bAllocationInPermanentPool )
+	{
+		UE_LOG( LogAudioMixer, Fatal, TEXT( "Can't free resource '%s' as it was allocated in permanent pool." ), *ResourceName );
+	}
+
+	if( DecompressionState )
+	{
+		delete DecompressionState;
+	}
+
+	if( PCMData && bOwnsPCMData )
+	{
+		FMemory::Free( PCMData );
+	}
+}
+
+FMixerSoundBuffer* FMixerSoundBuffer::CreateNativeBuffer( FMixerAudioDevice* AudioDevice, USoundWave* Wave )
+{
+#if WITH_OGGVORBIS
+	// Check to see if thread has finished decompressing on the other thread
+	if( Wave->VorbisDecompressor != NULL )
+	{
+		if( !Wave->VorbisDecompressor->IsDone() )
+		{
+			// Don't play this sound just yet
+			UE_LOG( LogAudioMixer, Log, TEXT( "Waiting for sound to decompress: %s" ), *Wave->GetName() );
+			return NULL;
+		}
+
+		// Remove the decompressor
+		delete Wave->VorbisDecompressor;
+		Wave->VorbisDecompressor = NULL;
+	}
+#endif	//WITH_OGGVORBIS
+
+	FMixerSoundBuffer* Buffer = new FMixerSoundBuffer( AudioDevice );
+	Buffer->Format = MixerBufferFormat_PCM;
+	Buffer->NumChannels = Wave->NumChannels;
+	Buffer->SampleRate = Wave->SampleRate;
+
+	// Take ownership the PCM data
+	Buffer->PCMData = ( int16* )Wave->RawPCMData;
+	Buffer->BufferSize = Wave->RawPCMDataSize;
+	Buffer->NumFrames = Wave->RawPCMDataSize / ( sizeof( int16 ) * Wave->NumChannels );
+	Buffer->bOwnsPCMData = true;
+
+	Wave->RawPCMData = NULL;
+
+	AudioDevice->TrackResource( Wave, Buffer );
+
+	Wave->RemoveAudioResource();
+
+	return Buffer;
+}
+
+FMixerSoundBuffer* FMixerSoundBuffer::CreatePreviewBuffer( FMixerAudioDevice* AudioDevice, USoundWave* Wave )
+{
+	FMixerSoundBuffer* Buffer = new FMixerSoundBuffer( AudioDevice );
+	Buffer->Format = MixerBufferFormat_PCM;
+	Buffer->NumChannels = Wave->NumChannels;
+	Buffer->SampleRate = Wave->SampleRate;
+
+	// Take ownership the PCM data
+	Buffer->PCMData = ( int16* )Wave->RawPCMData;
+	Buffer->BufferSize = Wave->RawPCMDataSize;
+	Buffer->NumFrames = Wave->RawPCMDataSize / ( sizeof( int16 ) * Wave->NumChannels );
+
+	Wave->RawPCMData = NULL;
+
+	// Copy over whether this data should be freed on delete
+	Buffer->bOwnsPCMData = Wave->bDynamicResource;
+
+	AudioDevice->TrackResource( Wave, Buffer );
+
+	return Buffer;
+}
+
+FMixerSoundBuffer* FMixerSoundBuffer::CreateStreamingBuffer( FMixerAudioDevice* AudioDevice, USoundWave* Wave )
+{
+	// Always create a new buffer for real time decompressed sounds
+	FMixerSoundBuffer* Buffer = new FMixerSoundBuffer( AudioDevice );
+
+	FSoundQualityInfo QualityInfo = { 0 };
+
+	Buffer->DecompressionState = new FVorbisAudioInfo();
+
+	Wave->InitAudioResource( AudioDevice->GetRuntimeFormat() );
+
+	if( Buffer->DecompressionState->ReadCompressedInfo( Wave->ResourceData, Wave->ResourceSize, &QualityInfo ) )
+	{
+		// Refresh the wave data
+		Wave->SampleRate = QualityInfo.SampleRate;
+		Wave->NumChannels = QualityInfo.NumChannels;
+		Wave->RawPCMDataSize = QualityInfo.SampleDataSize;
+		Wave->Duration = QualityInfo.Duration;
+
+		Buffer->Format = MixerBufferFormat_Streaming;
+		Buffer->NumChannels = Wave->NumChannels;
+		Buffer->SampleRate = Wave->SampleRate;
+		Buffer->BufferSize = Wave->ResourceSize;
+#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+		Buffer->ResourceName = Wave->GetPathName();
+#endif
+	}
+	else
+	{
+		Wave->DecompressionType = DTYPE_Invalid;
+		Wave->NumChannels = 0;
+
+		Wave->RemoveAudioResource();
+	}
+
+	return Buffer;
+}
+
+FMixerSoundBuffer* FMixerSoundBuffer::Init( FMixerAudioDevice* AudioDevice, USoundWave* Wave )
+{
+	SCOPE_CYCLE_COUNTER( STAT_AudioResourceCreationTime );
+
+	// Can't create a buffer without any source data
+	if( Wave == NULL || Wave->NumChannels == 0 )
+	{
+		return NULL;
+	}
+
+	FMixerSoundBuffer* Buffer = NULL;
+
+	switch( Wave->DecompressionType )
+	{
+	case DTYPE_Setup:
+		// Has circumvented precache mechanism - precache now
+		AudioDevice->Precache( Wave, true, false );
+
+		// if it didn't change, we will recurse forever
+		check( Wave->DecompressionType != DTYPE_Setup );
+
+		// Recall this function with new decompression type
+		return Init( AudioDevice, Wave );
+
+	case DTYPE_Preview:
+		// Find the existing buffer if any
+		if( Wave->ResourceID )
+		{
+			Buffer = ( FMixerSoundBuffer* )AudioDevice->WaveBufferMap.FindRef( Wave->ResourceID );
+		}
+
+		// Override with any new PCM data even if some already exists.
+		if( Wave->RawPCMData )
+		{
+			if( Buffer )
+			{
+				AudioDevice->FreeBufferResource( Buffer );
+			}
+			Buffer = CreatePreviewBuffer( AudioDevice, Wave );
+		}
+		break;
+
+	case DTYPE_RealTime:
+		// Always create a new buffer for streaming ogg vorbis data
+		Buffer = CreateStreamingBuffer( AudioDevice, Wave );
+		break;
+
+	case DTYPE_Native:
+		if( Wave->ResourceID )
+		{
+			Buffer = ( FMixerSoundBuffer* )AudioDevice->WaveBufferMap.FindRef( Wave->ResourceID );
+		}
+
+		if( Buffer == NULL )
+		{
+			Buffer = CreateNativeBuffer( AudioDevice, Wave );
+		}
+		break;
+
+	case DTYPE_Procedural:
+	case DTYPE_Invalid:
+	default:
+		UE_LOG( LogAudioMixer, Warning, TEXT( "Init Buffer on unsupported sound type name = %s type = %d" ), *Wave->GetName(), int32( Wave->DecompressionType ) );
+		break;
+	}
+
+	return Buffer;
+}
+
+bool FMixerSoundBuffer::ReadCompressedData( int16* Destination, bool bLooping )
+{
+	SCOPE_CYCLE_COUNTER( STAT_AudioMixerDecodeTime );
+
+	check( DecompressionState );
+	return DecompressionState->ReadCompressedData( ( uint8* )Destination, bLooping, GetStreamingChunkFrames() * NumChannels * sizeof( int16 ) );
+}
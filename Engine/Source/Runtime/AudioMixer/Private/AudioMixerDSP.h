@@ -0,0 +1,108 @@
+// Copyright 1998-2014 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	AudioMixerDSP.h: Vectorized kernels used by the software mixer.
+=============================================================================*/
+
+#pragma once
+
+namespace AudioMixerDSP
+{
+	/**
+	 * Linearly resamples a planar channel.
+	 *
+	 * Output frame N is interpolated at position StartFraction + N * Ratio of Source, so Source must hold at least
+	 * Floor(StartFraction + (NumOutputFrames - 1) * Ratio) + 2 frames. The interpolation is done four frames at a
+	 * time; only fetching the two neighbouring source frames of each lane is scalar.
+	 */
+	FORCEINLINE void ResampleLinear( const float* RESTRICT Source, float* RESTRICT Dest, int32 NumOutputFrames, float StartFraction, float Ratio )
+	{
+		if( Ratio == 1.0f && StartFraction == 0.0f )
+		{
+			FMemory::Memcpy( Dest, Source, NumOutputFrames * sizeof( float ) );
+			return;
+		}
+
+		int32 FrameIndex = 0;
+		for( ; FrameIndex + 3 < NumOutputFrames; FrameIndex += 4 )
+		{
+			float Lower[4];
+			float Upper[4];
+			float Alpha[4];
+			for( int32 Lane = 0; Lane < 4; Lane++ )
+			{
+				const float Position = StartFraction + ( FrameIndex + Lane ) * Ratio;
+				const int32 SourceIndex = FMath::Trunc( Position );
+				Lower[Lane] = Source[SourceIndex];
+				Upper[Lane] = Source[SourceIndex + 1];
+				Alpha[Lane] = Position - SourceIndex;
+			}
+
+			const VectorRegister LowerVec = VectorLoad( Lower );
+			const VectorRegister UpperVec = VectorLoad( Upper );
+			const VectorRegister AlphaVec = VectorLoad( Alpha );
+			VectorStore( VectorMultiplyAdd( VectorSubtract( UpperVec, LowerVec ), AlphaVec, LowerVec ), Dest + FrameIndex );
+		}
+
+		for( ; FrameIndex < NumOutputFrames; FrameIndex++ )
+		{
+			const float Position = StartFraction + FrameIndex * Ratio;
+			const int32 SourceIndex = FMath::Trunc( Position );
+			const float Alpha = Position - SourceIndex;
+			Dest[FrameIndex] = Source[SourceIndex] + ( Source[SourceIndex + 1] - Source[SourceIndex] ) * Alpha;
+		}
+	}
+
+	/**
+	 * Adds Source into Dest, scaled by a gain that ramps linearly from StartGain to EndGain over the buffer.
+	 */
+	FORCEINLINE void MixInWithGainRamp( const float* RESTRICT Source, float* RESTRICT Dest, int32 NumFrames, float StartGain, float EndGain )
+	{
+		if( StartGain == 0.0f && EndGain == 0.0f )
+		{
+			return;
+		}
+
+		const float GainDelta = ( EndGain - StartGain ) / NumFrames;
+		const float GainStep = GainDelta * 4.0f;
+
+		VectorRegister Gain = MakeVectorRegister( StartGain, StartGain + GainDelta, StartGain + GainDelta * 2.0f, StartGain + GainDelta * 3.0f );
+		const VectorRegister Step = VectorLoadFloat1( &GainStep );
+
+		int32 FrameIndex = 0;
+		for( ; FrameIndex + 3 < NumFrames; FrameIndex += 4 )
+		{
+			VectorStore( VectorMultiplyAdd( VectorLoad( Source + FrameIndex ), Gain, VectorLoad( Dest + FrameIndex ) ), Dest + FrameIndex );
+			Gain = VectorAdd( Gain, Step );
+		}
+
+		for( ; FrameIndex < NumFrames; FrameIndex++ )
+		{
+			Dest[FrameIndex] += Source[FrameIndex] * ( StartGain + GainDelta * FrameIndex );
+		}
+	}
+
+	/**
+	 * Scales Buffer by Gain and clamps the result to -1..1.
+	 */
+	FORCEINLINE void ApplyGainAndClamp( float* Buffer, int32 NumFrames, float Gain )
+	{
+		const float MinValue = -1.0f;
+		const float MaxValue = 1.0f;
+		const VectorRegister GainVec = VectorLoadFloat1( &Gain );
+		const VectorRegister MinVec = VectorLoadFloat1( &MinValue );
+		const VectorRegister MaxVec = VectorLoadFloat1( &MaxValue );
+
+		int32 FrameIndex = 0;
+		for( ; FrameIndex + 3 < NumFrames; FrameIndex += 4 )
+		{
+			const VectorRegister Scaled = VectorMultiply( VectorLoad( Buffer + FrameIndex ), GainVec );
+			VectorStore( VectorMax( VectorMin( Scaled, MaxVec ), MinVec ), Buffer + FrameIndex );
+		}
+
+		for( ; FrameIndex < NumFrames; FrameIndex++ )
+		{
+			Buffer[FrameIndex] = FMath::Clamp( Buffer[FrameIndex] * Gain, MinValue, MaxValue );
+		}
+	}
+}
@@ -0,0 +1,658 @@
+// Copyright 1998-2014 Epic Games, Inc. All Rights Reserved.
+
+/*------------------------------------------------------------------------------------
+	Audio includes.
+------------------------------------------------------------------------------------*/
+
+#include "AudioMixerDevice.h"
+#include "AudioMixerDSP.h"
+#include "AudioDecompress.h"
+
+DEFINE_LOG_CATEGORY(LogAudioMixer);
+
+DEFINE_STAT(STAT_AudioMixerRenderTime);
+DEFINE_STAT(STAT_AudioMixerDecodeTime);
+DEFINE_STAT(STAT_AudioMixerActiveVoices);
+
+/** Scale from 16 bit samples to the -1..1 range */
+#define AUDIOMIXER_PCM16_SCALE		( 1.0f / 32768.0f )
+
+/** Reverb submix tuning. Delay lengths are in samples at 44.1kHz and scaled to the mixer's sample rate. */
+static const int32 ReverbCombLengths[4] = { 1116, 1188, 1277, 1356 };
+static const int32 ReverbAllPassLengths[2] = { 556, 441 };
+static const int32 ReverbStereoSpread = 23;
+static const float ReverbCombFeedback = 0.84f;
+static const float ReverbCombDamping = 0.2f;
+static const float ReverbAllPassFeedback = 0.5f;
+static const float ReverbInputGain = 0.05f;
+
+/*------------------------------------------------------------------------------------
+	Output sink registration.
+------------------------------------------------------------------------------------*/
+
+static TMap<FName, FCreateAudioMixerSink>& GetAudioMixerSinkFactories()
+{
+	static TMap<FName, FCreateAudioMixerSink> SinkFactories;
+	return SinkFactories;
+}
+
+void FMixerAudioDevice::RegisterSink( FName SinkName, const FCreateAudioMixerSink& Factory )
+{
+	GetAudioMixerSinkFactories().Add( SinkName, Factory );
+}
+
+void FMixerAudioDevice::UnregisterSink( FName SinkName )
+{
+	GetAudioMixerSinkFactories().Remove( SinkName );
+}
+
+static IAudioMixerSink* CreateNullSink()
+{
+	return new FAudioMixerNullSink();
+}
+
+static IAudioMixerSink* CreateWavSink()
+{
+	FString Filename = FPaths::GameSavedDir() / TEXT( "AudioMixer.wav" );
+	GConfig->GetString( TEXT( "AudioMixer" ), TEXT( "WavFilename" ), Filename, GEngineIni );
+	FParse::Value( FCommandLine::Get(), TEXT( "AudioMixerWavFile=" ), Filename );
+
+	return new FAudioMixerWavSink( Filename );
+}
+
+/*------------------------------------------------------------------------------------
+	Module.
+------------------------------------------------------------------------------------*/
+
+class FMixerAudioDeviceModule : public IAudioDeviceModule
+{
+public:
+
+	virtual void StartupModule() OVERRIDE
+	{
+		FMixerAudioDevice::RegisterSink( TEXT( "Null" ), FCreateAudioMixerSink::CreateStatic( &CreateNullSink ) );
+		FMixerAudioDevice::RegisterSink( TEXT( "Wav" ), FCreateAudioMixerSink::CreateStatic( &CreateWavSink ) );
+	}
+
+	virtual void ShutdownModule() OVERRIDE
+	{
+		FMixerAudioDevice::UnregisterSink( TEXT( "Null" ) );
+		FMixerAudioDevice::UnregisterSink( TEXT( "Wav" ) );
+	}
+
+	/** Creates a new instance of the audio device implemented by the module. */
+	virtual FAudioDevice* CreateAudioDevice() OVERRIDE
+	{
+		return new FMixerAudioDevice;
+	}
+};
+
+IMPLEMENT_MODULE(FMixerAudioDeviceModule, AudioMixer);
+
+/*------------------------------------------------------------------------------------
+	FMixerVoice.
+------------------------------------------------------------------------------------*/
+
+FMixerVoice::FMixerVoice()
+{
+	Reset();
+}
+
+void FMixerVoice::Reset()
+{
+	Buffer = NULL;
+	Frames = NULL;
+	NumFrames = 0;
+	NumChannels = 0;
+	ReadIndex = 0;
+	Fraction = 0.0f;
+	FMemory::Memzero( History, sizeof( History ) );
+	FMemory::Memzero( LowPassState, sizeof( LowPassState ) );
+	FMemory::Memzero( PrevGains, sizeof( PrevGains ) );
+	PrevReverbSend = 0.0f;
+	StreamChunk.Reset();
+	Params = FMixerVoiceParams();
+	bLooping = false;
+	bPlaying = false;
+	bHasRendered = false;
+	bDecoderFinished = false;
+	bSourceExhausted = false;
+	LoopCount.Reset();
+	Finished.Reset();
+}
+
+/*------------------------------------------------------------------------------------
+	FMixerRenderThread.
+------------------------------------------------------------------------------------*/
+
+/**
+ * Mixes blocks and hands them to the sink until asked to stop.
+ */
+class FMixerRenderThread : public FRunnable
+{
+public:
+	FMixerRenderThread( FMixerAudioDevice* InDevice )
+		: Device( InDevice )
+	{
+	}
+
+	virtual uint32 Run() OVERRIDE
+	{
+		const double BlockDuration = ( double )Device->NumFramesPerBuffer / Device->SampleRate;
+		double NextBlockTime = FPlatformTime::Seconds();
+
+		while( StopTaskCounter.GetValue() == 0 )
+		{
+			Device->RenderBlock();
+			Device->Sink->Submit( Device->InterleavedOutput.GetData(), Device->NumFramesPerBuffer );
+
+			if( !Device->Sink->IsRealtime() )
+			{
+				// Nothing is pulling on us, so keep to the real time rate ourselves
+				NextBlockTime += BlockDuration;
+
+				const double Now = FPlatformTime::Seconds();
+				if( NextBlockTime > Now )
+				{
+					FPlatformProcess::Sleep( ( float )( NextBlockTime - Now ) );
+				}
+				else if( Now - NextBlockTime > BlockDuration * 4.0 )
+				{
+					// Fell well behind (hitch, debugger), don't try to catch up
+					NextBlockTime = Now;
+				}
+			}
+		}
+
+		return 0;
+	}
+
+	virtual void Stop() OVERRIDE
+	{
+		StopTaskCounter.Increment();
+	}
+
+private:
+	FMixerAudioDevice* Device;
+	FThreadSafeCounter StopTaskCounter;
+};
+
+/*------------------------------------------------------------------------------------
+	FMixerAudioDevice.
+------------------------------------------------------------------------------------*/
+
+FMixerAudioDevice::FMixerAudioDevice()
+	: bPendingParamsDirty( false )
+	, SampleRate( 48000 )
+	, NumFramesPerBuffer( 512 )
+	, MasterGain( 1.0f )
+	, Sink( NULL )
+	, RenderRunnable( NULL )
+	, RenderThread( NULL )
+{
+}
+
+FMixerAudioDevice::~FMixerAudioDevice()
+{
+	check( RenderThread == NULL );
+}
+
+IAudioMixerSink* FMixerAudioDevice::CreateSink()
+{
+	FString SinkName = TEXT( "Null" );
+	GConfig->GetString( TEXT( "AudioMixer" ), TEXT( "OutputSink" ), SinkName, GEngineIni );
+	FParse::Value( FCommandLine::Get(), TEXT( "AudioMixerSink=" ), SinkName );
+
+	IAudioMixerSink* NewSink = NULL;
+	const FCreateAudioMixerSink* Factory = GetAudioMixerSinkFactories().Find( FName( *SinkName ) );
+	if( Factory && Factory->IsBound() )
+	{
+		NewSink = Factory->Execute();
+	}
+
+	if( NewSink == NULL )
+	{
+		UE_LOG( LogAudioMixer, Warning, TEXT( "Unknown output sink '%s', falling back to Null" ), *SinkName );
+		NewSink = new FAudioMixerNullSink();
+	}
+
+	return NewSink;
+}
+
+bool FMixerAudioDevice::InitializeHardware()
+{
+	GConfig->GetInt( TEXT( "AudioMixer" ), TEXT( "SampleRate" ), SampleRate, GEngineIni );
+	GConfig->GetInt( TEXT( "AudioMixer" ), TEXT( "BufferFrames" ), NumFramesPerBuffer, GEngineIni );
+	GConfig->GetFloat( TEXT( "AudioMixer" ), TEXT( "MasterGain" ), MasterGain, GEngineIni );
+
+	SampleRate = FMath::Clamp( SampleRate, 8000, 192000 );
+	// Keep blocks a multiple of the vector width
+	NumFramesPerBuffer = FMath::Clamp( Align( NumFramesPerBuffer, 4 ), 64, 8192 );
+
+	// Default to sensible channel count.
+	if( MaxChannels < 1 )
+	{
+		MaxChannels = 32;
+	}
+
+	Sink = CreateSink();
+	if( !Sink->Open( AUDIOMIXER_NUM_OUTPUT_CHANNELS, SampleRate, NumFramesPerBuffer ) )
+	{
+		UE_LOG( LogAudioMixer, Warning, TEXT( "Couldn't open the %s output sink, falling back to Null" ), Sink->GetName() );
+		delete Sink;
+		Sink = new FAudioMixerNullSink();
+		Sink->Open( AUDIOMIXER_NUM_OUTPUT_CHANNELS, SampleRate, NumFramesPerBuffer );
+	}
+
+	// One voice per source; sources are created right after this by InitSoundSources()
+	for( int32 VoiceIndex = 0; VoiceIndex < MaxChannels; VoiceIndex++ )
+	{
+		new( Voices ) FMixerVoice();
+	}
+	GameThreadParams.AddZeroed( MaxChannels );
+	PendingParams.AddZeroed( MaxChannels );
+	for( int32 VoiceIndex = 0; VoiceIndex < MaxChannels; VoiceIndex++ )
+	{
+		GameThreadParams[VoiceIndex] = FMixerVoiceParams();
+		PendingParams[VoiceIndex] = FMixerVoiceParams();
+	}
+
+	for( int32 Channel = 0; Channel < AUDIOMIXER_NUM_OUTPUT_CHANNELS; Channel++ )
+	{
+		DryBus[Channel].AddZeroed( NumFramesPerBuffer );
+		ReverbBus[Channel].AddZeroed( NumFramesPerBuffer );
+	}
+	for( int32 Channel = 0; Channel < AUDIOMIXER_MAX_SOURCE_CHANNELS; Channel++ )
+	{
+		ResampledScratch[Channel].AddZeroed( NumFramesPerBuffer );
+	}
+	InterleavedOutput.AddZeroed( NumFramesPerBuffer * AUDIOMIXER_NUM_OUTPUT_CHANNELS );
+
+	InitReverbSubmix();
+
+	RenderRunnable = new FMixerRenderThread( this );
+	RenderThread = FRunnableThread::Create( RenderRunnable, TEXT( "AudioMixerRenderThread" ), false, false, 0, TPri_AboveNormal );
+	if( RenderThread == NULL )
+	{
+		UE_LOG( LogAudioMixer, Warning, TEXT( "Couldn't create the audio render thread" ) );
+		delete RenderRunnable;
+		RenderRunnable = NULL;
+
+		Sink->Close();
+		delete Sink;
+		Sink = NULL;
+		return false;
+	}
+
+	UE_LOG( LogAudioMixer, Log, TEXT( "Software mixer running at %d Hz, %d frames per block, %d voices, output to %s" ), SampleRate, NumFramesPerBuffer, MaxChannels, Sink->GetName() );
+
+	// Initialized.
+	NextResourceID = 1;
+
+	return true;
+}
+
+void FMixerAudioDevice::TeardownHardware()
+{
+	if( RenderThread )
+	{
+		RenderThread->Kill( true );
+		delete RenderThread;
+		RenderThread = NULL;
+
+		delete RenderRunnable;
+		RenderRunnable = NULL;
+	}
+
+	if( Sink )
+	{
+		Sink->Close();
+		delete Sink;
+		Sink = NULL;
+	}
+}
+
+void FMixerAudioDevice::UpdateHardware()
+{
+	{
+		FScopeLock Lock( &ParamsLock );
+		FMemory::Memcpy( PendingParams.GetData(), GameThreadParams.GetData(), GameThreadParams.Num() * sizeof( FMixerVoiceParams ) );
+		bPendingParamsDirty = true;
+	}
+
+	INC_DWORD_STAT_BY( STAT_AudioMixerActiveVoices, NumActiveVoices.GetValue() );
+}
+
+FSoundSource* FMixerAudioDevice::CreateSoundSource()
+{
+	check( Sources.Num() < Voices.Num() );
+	return new FMixerSoundSource( this, Sources.Num() );
+}
+
+/*------------------------------------------------------------------------------------
+	Rendering.
+------------------------------------------------------------------------------------*/
+
+void FMixerAudioDevice::RenderBlock()
+{
+	SCOPE_CYCLE_COUNTER( STAT_AudioMixerRenderTime );
+
+	FScopeLock Lock( &RenderLock );
+
+	// Pick up the latest parameters from the game thread
+	{
+		FScopeLock ParamsScopeLock( &ParamsLock );
+		if( bPendingParamsDirty )
+		{
+			for( int32 VoiceIndex = 0; VoiceIndex < Voices.Num(); VoiceIndex++ )
+			{
+				Voices[VoiceIndex].Params = PendingParams[VoiceIndex];
+			}
+			bPendingParamsDirty = false;
+		}
+	}
+
+	for( int32 Channel = 0; Channel < AUDIOMIXER_NUM_OUTPUT_CHANNELS; Channel++ )
+	{
+		FMemory::Memzero( DryBus[Channel].GetData(), NumFramesPerBuffer * sizeof( float ) );
+		FMemory::Memzero( ReverbBus[Channel].GetData(), NumFramesPerBuffer * sizeof( float ) );
+	}
+
+	int32 NumRendered = 0;
+	for( int32 VoiceIndex = 0; VoiceIndex < Voices.Num(); VoiceIndex++ )
+	{
+		FMixerVoice& Voice = Voices[VoiceIndex];
+		if( Voice.Buffer && Voice.bPlaying && !Voice.Params.bPaused )
+		{
+			RenderVoice( Voice );
+			NumRendered++;
+		}
+	}
+	NumActiveVoices.Set( NumRendered );
+
+	ProcessReverbSubmix();
+
+	// Master submix
+	for( int32 Channel = 0; Channel < AUDIOMIXER_NUM_OUTPUT_CHANNELS; Channel++ )
+	{
+		AudioMixerDSP::ApplyGainAndClamp( DryBus[Channel].GetData(), NumFramesPerBuffer, MasterGain );
+	}
+
+	float* Output = InterleavedOutput.GetData();
+	for( int32 FrameIndex = 0; FrameIndex < NumFramesPerBuffer; FrameIndex++ )
+	{
+		for( int32 Channel = 0; Channel < AUDIOMIXER_NUM_OUTPUT_CHANNELS; Channel++ )
+		{
+			*Output++ = DryBus[Channel][FrameIndex];
+		}
+	}
+}
+
+bool FMixerAudioDevice::RefillVoice( FMixerVoice& Voice )
+{
+	if( Voice.Buffer->Format == MixerBufferFormat_Streaming )
+	{
+		if( Voice.bDecoderFinished )
+		{
+			return false;
+		}
+
+		const bool bReachedEnd = Voice.Buffer->ReadCompressedData( Voice.StreamChunk.GetData(), Voice.bLooping );
+		Voice.Frames = Voice.StreamChunk.GetData();
+		Voice.NumFrames = FMixerSoundBuffer::GetStreamingChunkFrames();
+		Voice.ReadIndex = 0;
+
+		if( bReachedEnd )
+		{
+			if( Voice.bLooping )
+			{
+				// The decoder already wrapped around within this chunk
+				Voice.LoopCount.Increment();
+			}
+			else
+			{
+				// The rest of this chunk is padded with silence
+				Voice.bDecoderFinished = true;
+			}
+		}
+		return true;
+	}
+
+	if( Voice.bLooping && Voice.NumFrames > 0 )
+	{
+		Voice.ReadIndex = 0;
+		Voice.LoopCount.Increment();
+		return true;
+	}
+
+	return false;
+}
+
+int32 FMixerAudioDevice::ReadVoiceFrames( FMixerVoice& Voice, float* const* Destination, int32 DestOffset, int32 NumFramesToRead )
+{
+	int32 NumRead = 0;
+	while( NumRead < NumFramesToRead )
+	{
+		if( Voice.ReadIndex >= Voice.NumFrames && !RefillVoice( Voice ) )
+		{
+			Voice.bSourceExhausted = true;
+			break;
+		}
+
+		const int32 NumAvailable = FMath::Min( NumFramesToRead - NumRead, Voice.NumFrames - Voice.ReadIndex );
+		const int16* Source = Voice.Frames + Voice.ReadIndex * Voice.NumChannels;
+
+		if( Voice.NumChannels == 1 )
+		{
+			float* Dest = Destination[0] + DestOffset + NumRead;
+			for( int32 FrameIndex = 0; FrameIndex < NumAvailable; FrameIndex++ )
+			{
+				Dest[FrameIndex] = Source[FrameIndex] * AUDIOMIXER_PCM16_SCALE;
+			}
+		}
+		else
+		{
+			// Deinterleave as we go, everything downstream works on planar data
+			float* DestLeft = Destination[0] + DestOffset + NumRead;
+			float* DestRight = Destination[1] + DestOffset + NumRead;
+			for( int32 FrameIndex = 0; FrameIndex < NumAvailable; FrameIndex++ )
+			{
+				DestLeft[FrameIndex] = Source[FrameIndex * 2] * AUDIOMIXER_PCM16_SCALE;
+				DestRight[FrameIndex] = Source[FrameIndex * 2 + 1] * AUDIOMIXER_PCM16_SCALE;
+			}
+		}
+
+		Voice.ReadIndex += NumAvailable;
+		NumRead += NumAvailable;
+	}
+
+	// Pad with silence past the end of the sound
+	if( NumRead < NumFramesToRead )
+	{
+		for( int32 Channel = 0; Channel < Voice.NumChannels; Channel++ )
+		{
+			FMemory::Memzero( Destination[Channel] + DestOffset + NumRead, ( NumFramesToRead - NumRead ) * sizeof( float ) );
+		}
+	}
+
+	return NumRead;
+}
+
+void FMixerAudioDevice::RenderVoice( FMixerVoice& Voice )
+{
+	const int32 NumChannels = Voice.NumChannels;
+	const float Ratio = Voice.Params.PitchRatio;
+
+	// Source frames needed on top of the two history frames to produce a block and know the history for the next one
+	const int32 NumNewFrames = FMath::Trunc( Voice.Fraction + NumFramesPerBuffer * Ratio );
+	const int32 NumSourceFrames = NumNewFrames + 2;
+
+	float* SourceFrames[AUDIOMIXER_MAX_SOURCE_CHANNELS];
+	float* Resampled[AUDIOMIXER_MAX_SOURCE_CHANNELS];
+	for( int32 Channel = 0; Channel < NumChannels; Channel++ )
+	{
+		if( SourceScratch[Channel].Num() < NumSourceFrames )
+		{
+			SourceScratch[Channel].AddUninitialized( NumSourceFrames - SourceScratch[Channel].Num() );
+		}
+		SourceFrames[Channel] = SourceScratch[Channel].GetData();
+		Resampled[Channel] = ResampledScratch[Channel].GetData();
+	}
+
+	if( !Voice.bHasRendered )
+	{
+		// Prime the history with the first two frames of the sound
+		ReadVoiceFrames( Voice, SourceFrames, 0, 2 );
+		for( int32 Channel = 0; Channel < NumChannels; Channel++ )
+		{
+			Voice.History[Channel][0] = SourceFrames[Channel][0];
+			Voice.History[Channel][1] = SourceFrames[Channel][1];
+		}
+		Voice.Fraction = 0.0f;
+	}
+
+	for( int32 Channel = 0; Channel < NumChannels; Channel++ )
+	{
+		SourceFrames[Channel][0] = Voice.History[Channel][0];
+		SourceFrames[Channel][1] = Voice.History[Channel][1];
+	}
+	ReadVoiceFrames( Voice, SourceFrames, 2, NumNewFrames );
+
+	for( int32 Channel = 0; Channel < NumChannels; Channel++ )
+	{
+		AudioMixerDSP::ResampleLinear( SourceFrames[Channel], Resampled[Channel], NumFramesPerBuffer, Voice.Fraction, Ratio );
+
+		Voice.History[Channel][0] = SourceFrames[Channel][NumNewFrames];
+		Voice.History[Channel][1] = SourceFrames[Channel][NumNewFrames + 1];
+	}
+	Voice.Fraction = Voice.Fraction + NumFramesPerBuffer * Ratio - NumNewFrames;
+
+	// Low pass filter
+	const float LowPassCoefficient = Voice.Params.LowPassCoefficient;
+	for( int32 Channel = 0; Channel < NumChannels; Channel++ )
+	{
+		float* Samples = Resampled[Channel];
+		if( LowPassCoefficient < 1.0f )
+		{
+			float State = Voice.LowPassState[Channel];
+			for( int32 FrameIndex = 0; FrameIndex < NumFramesPerBuffer; FrameIndex++ )
+			{
+				State += LowPassCoefficient * ( Samples[FrameIndex] - State );
+				Samples[FrameIndex] = State;
+			}
+			Voice.LowPassState[Channel] = State;
+		}
+		else
+		{
+			Voice.LowPassState[Channel] = Samples[NumFramesPerBuffer - 1];
+		}
+	}
+
+	// Pan into the dry bus and send to the reverb bus, ramping from last block's gains
+	if( !Voice.bHasRendered )
+	{
+		FMemory::Memcpy( Voice.PrevGains, Voice.Params.Gains, sizeof( Voice.PrevGains ) );
+		Voice.PrevReverbSend = Voice.Params.ReverbSend;
+	}
+
+	for( int32 SourceChannel = 0; SourceChannel < NumChannels; SourceChannel++ )
+	{
+		for( int32 OutputChannel = 0; OutputChannel < AUDIOMIXER_NUM_OUTPUT_CHANNELS; OutputChannel++ )
+		{
+			AudioMixerDSP::MixInWithGainRamp( Resampled[SourceChannel], DryBus[OutputChannel].GetData(), NumFramesPerBuffer,
+				Voice.PrevGains[SourceChannel][OutputChannel], Voice.Params.Gains[SourceChannel][OutputChannel] );
+
+			// Mono sources feed both sides of the reverb, stereo ones keep their side
+			if( NumChannels == 1 || SourceChannel == OutputChannel )
+			{
+				AudioMixerDSP::MixInWithGainRamp( Resampled[SourceChannel], ReverbBus[OutputChannel].GetData(), NumFramesPerBuffer,
+					Voice.PrevReverbSend, Voice.Params.ReverbSend );
+			}
+		}
+	}
+
+	FMemory::Memcpy( Voice.PrevGains, Voice.Params.Gains, sizeof( Voice.PrevGains ) );
+	Voice.PrevReverbSend = Voice.Params.ReverbSend;
+	Voice.bHasRendered = true;
+
+	// Everything up to the end of the data has been played
+	if( Voice.bSourceExhausted )
+	{
+		Voice.bPlaying = false;
+		Voice.Finished.Set( 1 );
+	}
+}
+
+void FMixerAudioDevice::InitReverbSubmix()
+{
+	const float RateScale = SampleRate / 44100.0f;
+	for( int32 Channel = 0; Channel < AUDIOMIXER_NUM_OUTPUT_CHANNELS; Channel++ )
+	{
+		const int32 Spread = Channel * ReverbStereoSpread;
+		for( int32 CombIndex = 0; CombIndex < 4; CombIndex++ )
+		{
+			const int32 Length = FMath::Max( FMath::Trunc( ( ReverbCombLengths[CombIndex] + Spread ) * RateScale ), 1 );
+			ReverbCombBuffers[Channel][CombIndex].Empty( Length );
+			ReverbCombBuffers[Channel][CombIndex].AddZeroed( Length );
+			ReverbCombIndex[Channel][CombIndex] = 0;
+			ReverbCombFilterState[Channel][CombIndex] = 0.0f;
+		}
+		for( int32 AllPassIndex = 0; AllPassIndex < 2; AllPassIndex++ )
+		{
+			const int32 Length = FMath::Max( FMath::Trunc( ( ReverbAllPassLengths[AllPassIndex] + Spread ) * RateScale ), 1 );
+			ReverbAllPassBuffers[Channel][AllPassIndex].Empty( Length );
+			ReverbAllPassBuffers[Channel][AllPassIndex].AddZeroed( Length );
+			ReverbAllPassIndex[Channel][AllPassIndex] = 0;
+		}
+	}
+}
+
+void FMixerAudioDevice::ProcessReverbSubmix()
+{
+	// Schroeder style reverb: parallel damped combs followed by serial all passes, run on every block so tails decay
+	// naturally after the last voice stops sending
+	for( int32 Channel = 0; Channel < AUDIOMIXER_NUM_OUTPUT_CHANNELS; Channel++ )
+	{
+		const float* Input = ReverbBus[Channel].GetData();
+		float* Output = DryBus[Channel].GetData();
+
+		for( int32 FrameIndex = 0; FrameIndex < NumFramesPerBuffer; FrameIndex++ )
+		{
+			const float In = Input[FrameIndex] * ReverbInputGain;
+			float Accumulated = 0.0f;
+
+			for( int32 CombIndex = 0; CombIndex < 4; CombIndex++ )
+			{
+				TArray<float>& Delay = ReverbCombBuffers[Channel][CombIndex];
+				int32& Index = ReverbCombIndex[Channel][CombIndex];
+				float& FilterState = ReverbCombFilterState[Channel][CombIndex];
+
+				const float Delayed = Delay[Index];
+				FilterState = Delayed * ( 1.0f - ReverbCombDamping ) + FilterState * ReverbCombDamping;
+				Delay[Index] = In + FilterState * ReverbCombFeedback;
+				if( ++Index >= Delay.Num() )
+				{
+					Index = 0;
+				}
+
+				Accumulated += Delayed;
+			}
+
+			for( int32 AllPassIndex = 0; AllPassIndex < 2; AllPassIndex++ )
+			{
+				TArray<float>& Delay = ReverbAllPassBuffers[Channel][AllPassIndex];
+				int32& Index = ReverbAllPassIndex[Channel][AllPassIndex];
+
+				const float Delayed = Delay[Index];
+				Delay[Index] = Accumulated + Delayed * ReverbAllPassFeedback;
+				Accumulated = Delayed - Accumulated;
+				if( ++Index >= Delay.Num() )
+				{
+					Index = 0;
+				}
+			}
+
+			Output[FrameIndex] += Accumulated;
+		}
+	}
+}
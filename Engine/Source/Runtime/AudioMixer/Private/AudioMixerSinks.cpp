@@ -0,0 +1,106 @@
+// Copyright 1998-2014 Epic Games, Inc. All Rights Reserved.
+
+/*------------------------------------------------------------------------------------
+	FAudioMixerWavSink.
+------------------------------------------------------------------------------------*/
+
+#include "AudioMixerDevice.h"
+
+FAudioMixerWavSink::FAudioMixerWavSink( const FString& InFilename )
+	: Filename( InFilename )
+	, Writer( NULL )
+	, NumChannels( 0 )
+	, SampleRate( 0 )
+	, DataSize( 0 )
+{
+}
+
+FAudioMixerWavSink::~FAudioMixerWavSink()
+{
+	Close();
+}
+
+bool FAudioMixerWavSink::Open( int32 InNumChannels, int32 InSampleRate, int32 NumFramesPerBuffer )
+{
+	check( Writer == NULL );
+
+	Writer = IFileManager::Get().CreateFileWriter( *Filename, FILEWRITE_EvenIfReadOnly );
+	if( Writer == NULL )
+	{
+		UE_LOG( LogAudioMixer, Warning, TEXT( "Couldn't open %s for writing" ), *Filename );
+		return false;
+	}
+
+	NumChannels = InNumChannels;
+	SampleRate = InSampleRate;
+	DataSize = 0;
+	ConvertedSamples.Empty( NumFramesPerBuffer * NumChannels );
+
+	// Write a placeholder header, the sizes are patched in when the sink is closed
+	WriteHeader();
+
+	UE_LOG( LogAudioMixer, Log, TEXT( "Recording mixer output to %s" ), *Filename );
+	return true;
+}
+
+void FAudioMixerWavSink::Close()
+{
+	if( Writer )
+	{
+		Writer->Seek( 0 );
+		WriteHeader();
+
+		delete Writer;
+		Writer = NULL;
+	}
+}
+
+void FAudioMixerWavSink::Submit( const float* Samples, int32 NumFrames )
+{
+	if( Writer == NULL )
+	{
+		return;
+	}
+
+	const int32 NumSamples = NumFrames * NumChannels;
+	ConvertedSamples.Reset();
+	ConvertedSamples.AddUninitialized( NumSamples );
+
+	for( int32 SampleIndex = 0; SampleIndex < NumSamples; SampleIndex++ )
+	{
+		ConvertedSamples[SampleIndex] = ( int16 )FMath::Clamp<int32>( FMath::Trunc( Samples[SampleIndex] * 32767.0f ), -32768, 32767 );
+	}
+
+	const uint32 NumBytes = NumSamples * sizeof( int16 );
+	Writer->Serialize( ConvertedSamples.GetData(), NumBytes );
+	DataSize += NumBytes;
+}
+
+void FAudioMixerWavSink::WriteHeader()
+{
+	uint16 FormatTag = 1;	// PCM
+	uint16 Channels = NumChannels;
+	uint32 SamplesPerSec = SampleRate;
+	uint16 BitsPerSample = 16;
+	uint16 BlockAlign = Channels * BitsPerSample / 8;
+	uint32 AvgBytesPerSec = SamplesPerSec * BlockAlign;
+	uint32 FormatSize = 16;
+	uint32 RiffSize = 4 + ( 8 + FormatSize ) + ( 8 + DataSize );
+
+	FArchive& Ar = *Writer;
+	Ar.Serialize( ( void* )"RIFF", 4 );
+	Ar << RiffSize;
+	Ar.Serialize( ( void* )"WAVE", 4 );
+
+	Ar.Serialize( ( void* )"fmt ", 4 );
+	Ar << FormatSize;
+	Ar << FormatTag;
+	Ar << Channels;
+	Ar << SamplesPerSec;
+	Ar << AvgBytesPerSec;
+	Ar << BlockAlign;
+	Ar << BitsPerSample;
+
+	Ar.Serialize( ( void* )"data", 4 );
+	Ar << DataSize;
+}
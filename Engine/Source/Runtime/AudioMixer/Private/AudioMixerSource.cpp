@@ -0,0 +1,274 @@
+// Copyright 1998-2014 Epic Games, Inc. All Rights Reserved.
+
+/*------------------------------------------------------------------------------------
+	FMixerSoundSource.
+------------------------------------------------------------------------------------*/
+
+#include "AudioMixerDevice.h"
+#include "AudioDecompress.h"
+
+/** Level of the reverb send relative to the dry signal */
+#define AUDIOMIXER_REVERB_SEND_LEVEL	0.3f
+
+FMixerSoundSource::FMixerSoundSource( FMixerAudioDevice* InAudioDevice, int32 InVoiceIndex )
+	: FSoundSource( InAudioDevice )
+	, MixerDevice( InAudioDevice )
+	, MixerBuffer( NULL )
+	, VoiceIndex( InVoiceIndex )
+	, LastLoopCount( 0 )
+{
+}
+
+FMixerSoundSource::~FMixerSoundSource()
+{
+	{
+		FScopeLock Lock( &MixerDevice->RenderLock );
+		MixerDevice->Voices[VoiceIndex].Reset();
+	}
+
+	ReleaseResources();
+}
+
+void FMixerSoundSource::ReleaseResources()
+{
+	// Streaming buffers aren't tracked by the device, so they belong to the source that created them
+	if( MixerBuffer && MixerBuffer->ResourceID == 0 )
+	{
+		delete MixerBuffer;
+	}
+	MixerBuffer = NULL;
+	Buffer = NULL;
+}
+
+bool FMixerSoundSource::Init( FWaveInstance* InWaveInstance )
+{
+	MixerBuffer = FMixerSoundBuffer::Init( MixerDevice, InWaveInstance->WaveData );
+	if( MixerBuffer == NULL )
+	{
+		return false;
+	}
+
+	if( MixerBuffer->Format == MixerBufferFormat_Invalid || MixerBuffer->NumChannels < 1 || MixerBuffer->NumChannels > AUDIOMIXER_MAX_SOURCE_CHANNELS )
+	{
+		UE_LOG( LogAudioMixer, Warning, TEXT( "Can't play %s with %d channels" ), *InWaveInstance->WaveData->GetName(), MixerBuffer->NumChannels );
+		ReleaseResources();
+		return false;
+	}
+
+	SCOPE_CYCLE_COUNTER( STAT_AudioSourceInitTime );
+
+	WaveInstance = InWaveInstance;
+	Buffer = MixerBuffer;
+	LastLoopCount = 0;
+
+	SetReverbApplied( true );
+
+	// Work out where to start playing from. Streaming buffers are only touched by the render thread once the voice
+	// points at them, so seeking here is safe.
+	int32 StartFrame = 0;
+	if( WaveInstance->StartTime > 0.0f )
+	{
+		if( MixerBuffer->Format == MixerBufferFormat_Streaming )
+		{
+			MixerBuffer->DecompressionState->SeekToTime( WaveInstance->StartTime );
+		}
+		else
+		{
+			StartFrame = FMath::Clamp( FMath::Trunc( WaveInstance->StartTime * MixerBuffer->SampleRate ), 0, MixerBuffer->NumFrames );
+		}
+	}
+
+	{
+		FScopeLock Lock( &MixerDevice->RenderLock );
+
+		FMixerVoice& Voice = MixerDevice->Voices[VoiceIndex];
+		Voice.Reset();
+		Voice.Buffer = MixerBuffer;
+		Voice.NumChannels = MixerBuffer->NumChannels;
+		Voice.bLooping = WaveInstance->LoopingMode != LOOP_Never;
+
+		if( MixerBuffer->Format == MixerBufferFormat_Streaming )
+		{
+			// The first chunk is decoded by the render thread when the voice starts reading
+			Voice.StreamChunk.AddUninitialized( FMixerSoundBuffer::GetStreamingChunkFrames() * MixerBuffer->NumChannels );
+		}
+		else
+		{
+			Voice.Frames = MixerBuffer->PCMData;
+			Voice.NumFrames = MixerBuffer->NumFrames;
+			Voice.ReadIndex = StartFrame;
+		}
+	}
+
+	Update();
+
+	return true;
+}
+
+void FMixerSoundSource::ComputeGains( FMixerVoiceParams& OutParams )
+{
+	const float Volume = FMath::Clamp<float>( WaveInstance->GetActualVolume(), 0.0f, MAX_VOLUME );
+
+	float DryVolume = Volume;
+	float ReverbVolume = bReverbApplied ? Volume * AUDIOMIXER_REVERB_SEND_LEVEL : 0.0f;
+
+	// Apply any debug settings
+	switch( AudioDevice->GetMixDebugState() )
+	{
+	case DEBUGSTATE_IsolateReverb:
+		DryVolume = 0.0f;
+		break;
+
+	case DEBUGSTATE_IsolateDryAudio:
+		ReverbVolume = 0.0f;
+		break;
+
+	default:
+		break;
+	};
+
+	if( MixerBuffer->NumChannels == 1 )
+	{
+		// Equal power pan based on how far to the side of the listener the sound is
+		float Pan = 0.0f;
+		if( WaveInstance->bUseSpatialization && AudioDevice->Listeners.Num() > 0 )
+		{
+			const FVector Direction = AudioDevice->Listeners[0].Transform.InverseTransformPosition( WaveInstance->Location ).SafeNormal();
+			Pan = FMath::Clamp( Direction.Y, -1.0f, 1.0f );
+		}
+
+		const float PanAngle = ( Pan + 1.0f ) * 0.25f * PI;
+		OutParams.Gains[0][0] = FMath::Cos( PanAngle ) * DryVolume;
+		OutParams.Gains[0][1] = FMath::Sin( PanAngle ) * DryVolume;
+	}
+	else
+	{
+		// Stereo sounds aren't spatialized, each channel goes straight to its speaker
+		OutParams.Gains[0][0] = DryVolume;
+		OutParams.Gains[1][1] = DryVolume;
+	}
+
+	OutParams.ReverbSend = ReverbVolume;
+}
+
+void FMixerSoundSource::Update()
+{
+	SCOPE_CYCLE_COUNTER( STAT_AudioUpdateSources );
+
+	if( !WaveInstance || Paused )
+	{
+		return;
+	}
+
+	FMixerVoiceParams Params;
+
+	const float Pitch = FMath::Clamp<float>( WaveInstance->Pitch, MIN_PITCH, MAX_PITCH );
+	Params.PitchRatio = Pitch * MixerBuffer->SampleRate / MixerDevice->GetSampleRate();
+
+	// Set whether to bleed to the rear speakers
+	SetStereoBleed();
+
+	// Set the amount to bleed to the LFE speaker
+	SetLFEBleed();
+
+	// Set the HighFrequencyGain value (aka low pass filter setting)
+	SetHighFrequencyGain();
+
+	if( HighFrequencyGain < 1.0f - KINDA_SMALL_NUMBER )
+	{
+		const float Cutoff = FMath::Lerp( MIN_FILTER_FREQUENCY, MAX_FILTER_FREQUENCY, HighFrequencyGain );
+		Params.LowPassCoefficient = 1.0f - FMath::Exp( -2.0f * PI * Cutoff / MixerDevice->GetSampleRate() );
+	}
+
+	ComputeGains( Params );
+
+	// Published to the render thread by UpdateHardware(), together with every other source
+	MixerDevice->GameThreadParams[VoiceIndex] = Params;
+}
+
+void FMixerSoundSource::Play()
+{
+	if( WaveInstance )
+	{
+		FMixerVoiceParams& Params = MixerDevice->GameThreadParams[VoiceIndex];
+		Params.bPaused = false;
+
+		// Hand the parameters over directly rather than waiting for UpdateHardware(), so the first block doesn't
+		// render with whatever the voice played last
+		{
+			FScopeLock Lock( &MixerDevice->ParamsLock );
+			MixerDevice->PendingParams[VoiceIndex] = Params;
+		}
+
+		{
+			FScopeLock Lock( &MixerDevice->RenderLock );
+			FMixerVoice& Voice = MixerDevice->Voices[VoiceIndex];
+			Voice.Params = Params;
+			Voice.bPlaying = true;
+		}
+
+		Paused = false;
+		Playing = true;
+	}
+}
+
+void FMixerSoundSource::Stop()
+{
+	if( WaveInstance )
+	{
+		// Once this returns the render thread no longer references the buffer, so it is safe to free
+		{
+			FScopeLock Lock( &MixerDevice->RenderLock );
+			MixerDevice->Voices[VoiceIndex].Reset();
+		}
+
+		ReleaseResources();
+
+		Paused = false;
+		Playing = false;
+	}
+
+	FSoundSource::Stop();
+}
+
+void FMixerSoundSource::Pause()
+{
+	if( WaveInstance )
+	{
+		Paused = true;
+
+		MixerDevice->GameThreadParams[VoiceIndex].bPaused = true;
+	}
+}
+
+bool FMixerSoundSource::IsFinished()
+{
+	if( WaveInstance )
+	{
+		FMixerVoice& Voice = MixerDevice->Voices[VoiceIndex];
+
+		// The render thread ran out of data for a non looping sound
+		if( Voice.Finished.GetValue() != 0 )
+		{
+			// Notify the wave instance that it has finished playing
+			WaveInstance->NotifyFinished();
+			return true;
+		}
+
+		const int32 LoopCount = Voice.LoopCount.GetValue();
+		if( LoopCount != LastLoopCount )
+		{
+			LastLoopCount = LoopCount;
+
+			if( WaveInstance->LoopingMode == LOOP_WithNotification )
+			{
+				// Notify the wave instance that it has finished playing.
+				WaveInstance->NotifyFinished();
+			}
+		}
+
+		return false;
+	}
+
+	return true;
+}
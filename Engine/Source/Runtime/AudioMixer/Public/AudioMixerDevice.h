@@ -0,0 +1,358 @@
+// Copyright 1998-2014 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	AudioMixerDevice.h: Platform independent software mixing audio device.
+=============================================================================*/
+
+#pragma once
+
+/*------------------------------------------------------------------------------------
+	Dependencies, helpers & forward declarations.
+------------------------------------------------------------------------------------*/
+
+class FMixerAudioDevice;
+
+#include "Engine.h"
+#include "SoundDefinitions.h"
+#include "AudioEffect.h"
+#include "AudioMixerSink.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogAudioMixer, Log, All);
+
+DECLARE_CYCLE_STAT_EXTERN( TEXT( "Mixer Render Time" ), STAT_AudioMixerRenderTime, STATGROUP_Audio, );
+DECLARE_CYCLE_STAT_EXTERN( TEXT( "Mixer Decode Time" ), STAT_AudioMixerDecodeTime, STATGROUP_Audio, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN( TEXT( "Mixer Active Voices" ), STAT_AudioMixerActiveVoices, STATGROUP_Audio, );
+
+/** Number of output channels the mixer renders to. Multichannel sources are folded down to this. */
+#define AUDIOMIXER_NUM_OUTPUT_CHANNELS	2
+
+/** Maximum number of channels a source can have */
+#define AUDIOMIXER_MAX_SOURCE_CHANNELS	2
+
+enum EMixerBufferFormat
+{
+	MixerBufferFormat_Invalid,
+	/** Fully decompressed 16 bit PCM, shared between sources */
+	MixerBufferFormat_PCM,
+	/** Ogg vorbis data decompressed on the render thread as it plays, one buffer per source */
+	MixerBufferFormat_Streaming,
+};
+
+/**
+ * Software mixer implementation of FSoundBuffer, containing the wave data and format information.
+ */
+class FMixerSoundBuffer : public FSoundBuffer
+{
+public:
+	/**
+	 * Constructor
+	 *
+	 * @param AudioDevice	audio device this sound buffer is going to be attached to.
+	 */
+	FMixerSoundBuffer( FMixerAudioDevice* AudioDevice );
+
+	/**
+	 * Destructor
+	 *
+	 * Frees wave data and detaches itself from audio device.
+	 */
+	virtual ~FMixerSoundBuffer();
+
+	/**
+	 * Static function used to create a buffer.
+	 *
+	 * @param AudioDevice	audio device to attach created buffer to
+	 * @param Wave			USoundWave to use as template and wave source
+	 * @return FMixerSoundBuffer pointer if buffer creation succeeded, NULL otherwise
+	 */
+	static FMixerSoundBuffer* Init( FMixerAudioDevice* AudioDevice, USoundWave* Wave );
+
+	/**
+	 * Decompresses the next chunk of a streaming buffer. Called on the audio render thread.
+	 *
+	 * @param Destination	Memory to decompress to, GetStreamingChunkFrames() * NumChannels samples
+	 * @param bLooping		Whether to loop the sound seamlessly, or pad with zeroes
+	 * @return				Whether the end of the data was reached
+	 */
+	bool ReadCompressedData( int16* Destination, bool bLooping );
+
+	/** Number of frames decompressed by each call to ReadCompressedData() */
+	static int32 GetStreamingChunkFrames()
+	{
+		return MONO_PCM_BUFFER_SAMPLES;
+	}
+
+	// FSoundBuffer interface
+	virtual int32 GetSize() OVERRIDE
+	{
+		return BufferSize;
+	}
+
+	/** Audio device this buffer is attached to */
+	FMixerAudioDevice*		AudioDevice;
+	/** How the sample data is stored */
+	EMixerBufferFormat		Format;
+	/** Interleaved sample data for MixerBufferFormat_PCM buffers */
+	int16*					PCMData;
+	/** Number of frames in PCMData */
+	int32					NumFrames;
+	/** Size of the PCM or compressed data in bytes */
+	int32					BufferSize;
+	/** Sample rate of the data */
+	int32					SampleRate;
+	/** Wrapper to handle the decompression of vorbis data for streaming buffers */
+	class FVorbisAudioInfo*	DecompressionState;
+	/** Whether PCMData should be freed with the buffer; preview data may still be owned by the editor */
+	bool					bOwnsPCMData;
+
+private:
+	static FMixerSoundBuffer* CreateNativeBuffer( FMixerAudioDevice* AudioDevice, USoundWave* Wave );
+	static FMixerSoundBuffer* CreatePreviewBuffer( FMixerAudioDevice* AudioDevice, USoundWave* Wave );
+	static FMixerSoundBuffer* CreateStreamingBuffer( FMixerAudioDevice* AudioDevice, USoundWave* Wave );
+};
+
+/**
+ * Parameters of a voice, computed on the game thread by FMixerSoundSource::Update() and picked up by the render thread
+ * at the start of each block.
+ */
+struct FMixerVoiceParams
+{
+	/** Gain applied to each output channel for each source channel */
+	float Gains[AUDIOMIXER_MAX_SOURCE_CHANNELS][AUDIOMIXER_NUM_OUTPUT_CHANNELS];
+	/** Send level to the reverb submix */
+	float ReverbSend;
+	/** Source frames to advance per output frame */
+	float PitchRatio;
+	/** One pole low pass coefficient, 1 meaning no filtering */
+	float LowPassCoefficient;
+	/** Whether the voice is paused */
+	bool bPaused;
+
+	FMixerVoiceParams()
+	{
+		FMemory::Memzero( this, sizeof( FMixerVoiceParams ) );
+		PitchRatio = 1.0f;
+		LowPassCoefficient = 1.0f;
+	}
+};
+
+/**
+ * Render thread side of a source. One per FMixerSoundSource, owned by the device and only touched by the game thread
+ * while holding the device's render lock.
+ */
+struct FMixerVoice
+{
+	/** Buffer being played, NULL when the voice is idle */
+	FMixerSoundBuffer* Buffer;
+	/** Interleaved frames currently being read from; either the whole buffer or the current streaming chunk */
+	const int16* Frames;
+	int32 NumFrames;
+	int32 NumChannels;
+	/** Read cursor into Frames */
+	int32 ReadIndex;
+	/** Fractional position between the two frames in History */
+	float Fraction;
+	/** The two source frames the output is currently being interpolated between */
+	float History[AUDIOMIXER_MAX_SOURCE_CHANNELS][2];
+	/** Low pass filter state per channel */
+	float LowPassState[AUDIOMIXER_MAX_SOURCE_CHANNELS];
+	/** Gains used at the end of the previous block, ramped from to avoid zipper noise */
+	float PrevGains[AUDIOMIXER_MAX_SOURCE_CHANNELS][AUDIOMIXER_NUM_OUTPUT_CHANNELS];
+	float PrevReverbSend;
+	/** Decompressed chunk for streaming buffers */
+	TArray<int16> StreamChunk;
+	/** Parameters in effect for the block being rendered */
+	FMixerVoiceParams Params;
+	/** Whether the buffer should loop */
+	bool bLooping;
+	/** Whether the voice has been started */
+	bool bPlaying;
+	/** Whether the gains have been ramped from at least once */
+	bool bHasRendered;
+	/** Streaming only: set once the decoder has handed out the last chunk of a non looping sound */
+	bool bDecoderFinished;
+	/** Set once a non looping sound has run out of data; the voice stops at the end of the block */
+	bool bSourceExhausted;
+
+	/** Incremented by the render thread every time the buffer wraps around */
+	FThreadSafeCounter LoopCount;
+	/** Set by the render thread when a non looping sound has played all its data */
+	FThreadSafeCounter Finished;
+
+	FMixerVoice();
+
+	/** Detaches the voice from its buffer. Caller must hold the render lock. */
+	void Reset();
+};
+
+/**
+ * Software mixer implementation of FSoundSource, the interface used to play, stop and update sources
+ */
+class FMixerSoundSource : public FSoundSource
+{
+public:
+	/**
+	 * Constructor
+	 *
+	 * @param	InAudioDevice	audio device this source is attached to
+	 * @param	InVoiceIndex	index of the render thread voice backing this source
+	 */
+	FMixerSoundSource( FMixerAudioDevice* InAudioDevice, int32 InVoiceIndex );
+
+	/**
+	 * Destructor
+	 */
+	virtual ~FMixerSoundSource();
+
+	// FSoundSource interface
+	virtual bool Init( FWaveInstance* WaveInstance ) OVERRIDE;
+	virtual void Update() OVERRIDE;
+	virtual void Play() OVERRIDE;
+	virtual void Stop() OVERRIDE;
+	virtual void Pause() OVERRIDE;
+	virtual bool IsFinished() OVERRIDE;
+
+	virtual bool UsesCPUDecompression() OVERRIDE
+	{
+		return MixerBuffer && MixerBuffer->Format == MixerBufferFormat_Streaming;
+	}
+
+protected:
+	/** Computes the per channel gains for the current wave instance */
+	void ComputeGains( FMixerVoiceParams& OutParams );
+
+	/** Frees the buffer if this source owns it */
+	void ReleaseResources();
+
+	/** Device this source belongs to */
+	FMixerAudioDevice*		MixerDevice;
+	/** Buffer being played */
+	FMixerSoundBuffer*		MixerBuffer;
+	/** Voice used to render this source */
+	int32					VoiceIndex;
+	/** Loop count last seen by IsFinished() */
+	int32					LastLoopCount;
+};
+
+/**
+ * Software mixer implementation of an Unreal audio device. Voices are resampled, filtered, panned and mixed on a
+ * dedicated render thread and the result is handed to a pluggable IAudioMixerSink.
+ */
+class FMixerAudioDevice : public FAudioDevice
+{
+public:
+	FMixerAudioDevice();
+	virtual ~FMixerAudioDevice();
+
+	virtual FName GetRuntimeFormat() OVERRIDE
+	{
+		static FName NAME_OGG(TEXT("OGG"));
+		return NAME_OGG;
+	}
+
+	/** Starts up the render thread and the output sink */
+	virtual bool InitializeHardware() OVERRIDE;
+
+	/** Stops the render thread and closes the output sink */
+	virtual void TeardownHardware() OVERRIDE;
+
+	/** Publishes the parameters of all sources updated this frame to the render thread in one go */
+	virtual void UpdateHardware() OVERRIDE;
+
+	/**
+	 * Registers a factory for an output sink, so it can be selected with the OutputSink setting in the [AudioMixer]
+	 * section of the engine ini, or with -AudioMixerSink= on the command line.
+	 *
+	 * @param SinkName	Name the sink is selected by
+	 * @param Factory	Delegate creating a new instance of the sink
+	 */
+	static void RegisterSink( FName SinkName, const FCreateAudioMixerSink& Factory );
+
+	/** Removes a factory registered with RegisterSink() */
+	static void UnregisterSink( FName SinkName );
+
+	/** @return the sample rate voices are mixed at */
+	int32 GetSampleRate() const
+	{
+		return SampleRate;
+	}
+
+protected:
+	friend class FMixerSoundSource;
+	friend class FMixerRenderThread;
+
+	virtual FSoundSource* CreateSoundSource() OVERRIDE;
+
+	/** Creates the sink selected on the command line or in the ini */
+	IAudioMixerSink* CreateSink();
+
+	/** Renders one block of NumFramesPerBuffer frames into InterleavedOutput. Called on the render thread. */
+	void RenderBlock();
+
+	/** Renders one voice into the dry and reverb buses */
+	void RenderVoice( FMixerVoice& Voice );
+
+	/**
+	 * Reads and converts the next NumFrames source frames of a voice into the planar scratch buffers, returning the
+	 * number of frames that were actually available.
+	 */
+	int32 ReadVoiceFrames( FMixerVoice& Voice, float* const* Destination, int32 DestOffset, int32 NumFramesToRead );
+
+	/**
+	 * Moves a voice on to the next chunk of data when it reached the end of the current one. Loops PCM data and
+	 * decodes streaming data as needed.
+	 *
+	 * @return false if a non looping sound has no data left
+	 */
+	bool RefillVoice( FMixerVoice& Voice );
+
+	/** Initializes the reverb submix delay lines for the current sample rate */
+	void InitReverbSubmix();
+
+	/** Runs the reverb submix and adds its output to the dry bus. Called on the render thread. */
+	void ProcessReverbSubmix();
+
+	/** Voices, indexed by FMixerSoundSource::VoiceIndex */
+	TIndirectArray<FMixerVoice>		Voices;
+	/** Parameters computed by the sources this frame, only touched by the game thread */
+	TArray<FMixerVoiceParams>		GameThreadParams;
+	/** Parameters published by UpdateHardware(), copied into the voices at the start of the next block */
+	TArray<FMixerVoiceParams>		PendingParams;
+	bool							bPendingParamsDirty;
+	/** Guards PendingParams */
+	FCriticalSection				ParamsLock;
+	/** Held by the render thread while a block is being mixed, and by the game thread when it starts or stops voices */
+	FCriticalSection				RenderLock;
+
+	/** Output format */
+	int32							SampleRate;
+	int32							NumFramesPerBuffer;
+
+	/** Planar mix buses, NumFramesPerBuffer floats per channel */
+	TArray<float>					DryBus[AUDIOMIXER_NUM_OUTPUT_CHANNELS];
+	TArray<float>					ReverbBus[AUDIOMIXER_NUM_OUTPUT_CHANNELS];
+	/** Per voice scratch: converted source frames and resampled output */
+	TArray<float>					SourceScratch[AUDIOMIXER_MAX_SOURCE_CHANNELS];
+	TArray<float>					ResampledScratch[AUDIOMIXER_MAX_SOURCE_CHANNELS];
+	/** Final interleaved output handed to the sink */
+	TArray<float>					InterleavedOutput;
+
+	/** Reverb submix state */
+	TArray<float>					ReverbCombBuffers[AUDIOMIXER_NUM_OUTPUT_CHANNELS][4];
+	int32							ReverbCombIndex[AUDIOMIXER_NUM_OUTPUT_CHANNELS][4];
+	float							ReverbCombFilterState[AUDIOMIXER_NUM_OUTPUT_CHANNELS][4];
+	TArray<float>					ReverbAllPassBuffers[AUDIOMIXER_NUM_OUTPUT_CHANNELS][2];
+	int32							ReverbAllPassIndex[AUDIOMIXER_NUM_OUTPUT_CHANNELS][2];
+
+	/** Gain applied to the final mix before clamping */
+	float							MasterGain;
+
+	/** Number of voices rendered in the last block, for stats */
+	FThreadSafeCounter				NumActiveVoices;
+
+	/** Output sink, only touched by the render thread while it is running */
+	IAudioMixerSink*				Sink;
+	/** Render thread */
+	class FMixerRenderThread*		RenderRunnable;
+	FRunnableThread*				RenderThread;
+};
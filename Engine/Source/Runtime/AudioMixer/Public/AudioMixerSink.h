@@ -0,0 +1,131 @@
+// Copyright 1998-2014 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	AudioMixerSink.h: Output sinks for the software audio mixer.
+=============================================================================*/
+
+#pragma once
+
+/**
+ * Final destination of the software mixer's output.
+ *
+ * A sink is opened once by the mixer device and then fed one buffer of interleaved float samples at a time from the
+ * audio render thread. Platform modules can provide hardware sinks by registering a factory with
+ * FMixerAudioDevice::RegisterSink(); the null and WAV file sinks are always available.
+ */
+class IAudioMixerSink
+{
+public:
+	virtual ~IAudioMixerSink()
+	{
+	}
+
+	/**
+	 * Prepares the sink for output.
+	 *
+	 * @param NumChannels		Number of interleaved channels in each submitted buffer
+	 * @param SampleRate		Sample rate of the mixed output
+	 * @param NumFramesPerBuffer	Number of frames the mixer will submit at a time
+	 * @return true if the sink is ready to receive buffers
+	 */
+	virtual bool Open( int32 NumChannels, int32 SampleRate, int32 NumFramesPerBuffer ) = 0;
+
+	/** Releases anything the sink acquired in Open(). No buffers are submitted after this is called. */
+	virtual void Close() = 0;
+
+	/**
+	 * Consumes one buffer of mixed output. Called on the audio render thread.
+	 *
+	 * @param Samples		Interleaved samples in the -1..1 range, NumFrames * NumChannels of them
+	 * @param NumFrames		Number of frames in Samples
+	 */
+	virtual void Submit( const float* Samples, int32 NumFrames ) = 0;
+
+	/**
+	 * Whether Submit() blocks until the output device needs more data. Sinks that don't (null, file) are paced by the
+	 * render thread so that the mixer still runs at the real time rate.
+	 */
+	virtual bool IsRealtime() const = 0;
+
+	/** Human readable name, for logging. */
+	virtual const TCHAR* GetName() const = 0;
+};
+
+/** Creates a new sink instance. Ownership passes to the caller. */
+DECLARE_DELEGATE_RetVal( IAudioMixerSink*, FCreateAudioMixerSink );
+
+/**
+ * Sink that discards everything it is given. Useful for servers and for measuring mixing cost on its own.
+ */
+class FAudioMixerNullSink : public IAudioMixerSink
+{
+public:
+	virtual bool Open( int32 NumChannels, int32 SampleRate, int32 NumFramesPerBuffer ) OVERRIDE
+	{
+		return true;
+	}
+
+	virtual void Close() OVERRIDE
+	{
+	}
+
+	virtual void Submit( const float* Samples, int32 NumFrames ) OVERRIDE
+	{
+	}
+
+	virtual bool IsRealtime() const OVERRIDE
+	{
+		return false;
+	}
+
+	virtual const TCHAR* GetName() const OVERRIDE
+	{
+		return TEXT("Null");
+	}
+};
+
+/**
+ * Sink that records the mixed output to a 16 bit PCM WAV file.
+ */
+class FAudioMixerWavSink : public IAudioMixerSink
+{
+public:
+	/**
+	 * Constructor
+	 *
+	 * @param InFilename	File to write to. Overwritten when the sink is opened.
+	 */
+	FAudioMixerWavSink( const FString& InFilename );
+
+	virtual ~FAudioMixerWavSink();
+
+	virtual bool Open( int32 NumChannels, int32 SampleRate, int32 NumFramesPerBuffer ) OVERRIDE;
+	virtual void Close() OVERRIDE;
+	virtual void Submit( const float* Samples, int32 NumFrames ) OVERRIDE;
+
+	virtual bool IsRealtime() const OVERRIDE
+	{
+		return false;
+	}
+
+	virtual const TCHAR* GetName() const OVERRIDE
+	{
+		return TEXT("Wav");
+	}
+
+private:
+	/** Writes the RIFF header, patching in the sizes of the data written so far */
+	void WriteHeader();
+
+	/** Output file name */
+	FString Filename;
+	/** Open file, NULL when the sink is closed */
+	FArchive* Writer;
+	/** Format of the output */
+	int32 NumChannels;
+	int32 SampleRate;
+	/** Number of bytes of sample data written so far */
+	uint32 DataSize;
+	/** Conversion buffer for the 16 bit samples */
+	TArray<int16> ConvertedSamples;
+};
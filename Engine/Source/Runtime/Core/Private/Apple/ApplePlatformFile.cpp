@@ -5,6 +5,7 @@
 =============================================================================*/
 
 #include "CorePrivate.h"
+#include <sys/mman.h>
 
 // make an FTimeSpan object that represents the "epoch" for time_t (from a stat struct)
 const FDateTime MacEpoch(1970, 1, 1);
@@ -280,6 +281,99 @@ __thread FFileHandleApple* FFileHandleApple::ActiveHandles[ FFileHandleApple::AC
 __thread double FFileHandleApple::AccessTimes[ FFileHandleApple::ACTIVE_HANDLE_COUNT ];
 #endif
 
+/** 
+ * Apple memory mapped region implementation
+**/
+class CORE_API FMappedFileRegionApple : public IMappedFileRegion
+{
+	/** Start of the mapping, which is aligned down to a page boundary */
+	void* MappingBase;
+	/** Size of the whole mapping */
+	size_t MappingSize;
+	/** Start of the requested region within the mapping */
+	const uint8* MappedPtr;
+	/** Size of the requested region */
+	int64 MappedSize;
+
+public:
+	FMappedFileRegionApple(void* InMappingBase, size_t InMappingSize, const uint8* InMappedPtr, int64 InMappedSize)
+		: MappingBase(InMappingBase)
+		, MappingSize(InMappingSize)
+		, MappedPtr(InMappedPtr)
+		, MappedSize(InMappedSize)
+	{
+	}
+
+	virtual ~FMappedFileRegionApple()
+	{
+		munmap(MappingBase, MappingSize);
+	}
+
+	virtual const uint8* GetMappedPtr() OVERRIDE
+	{
+		return MappedPtr;
+	}
+
+	virtual int64 GetMappedSize() OVERRIDE
+	{
+		return MappedSize;
+	}
+};
+
+/** 
+ * Apple memory mapped file handle implementation. These hold on to their descriptor and are not
+ * subject to the per thread limit on open read handles above.
+**/
+class CORE_API FMappedFileHandleApple : public IMappedFileHandle
+{
+	int32 FileHandle;
+	int64 FileSize;
+
+public:
+	FMappedFileHandleApple(int32 InFileHandle, int64 InFileSize)
+		: FileHandle(InFileHandle)
+		, FileSize(InFileSize)
+	{
+	}
+
+	virtual ~FMappedFileHandleApple()
+	{
+		close(FileHandle);
+		FileHandle = -1;
+	}
+
+	virtual int64 GetFileSize() OVERRIDE
+	{
+		return FileSize;
+	}
+
+	virtual IMappedFileRegion* MapRegion(int64 Offset, int64 BytesToMap) OVERRIDE
+	{
+		check(Offset >= 0);
+		if (BytesToMap < 0 || BytesToMap > FileSize - Offset)
+		{
+			BytesToMap = FileSize - Offset;
+		}
+		if (BytesToMap <= 0)
+		{
+			return NULL;
+		}
+
+		// mmap wants a page aligned offset, map from the start of the page and point into it
+		const int64 PageSize = getpagesize();
+		const int64 AlignedOffset = Offset - (Offset % PageSize);
+		const size_t MappingSize = (size_t)(BytesToMap + (Offset - AlignedOffset));
+
+		void* MappingBase = mmap(NULL, MappingSize, PROT_READ, MAP_PRIVATE, FileHandle, AlignedOffset);
+		if (MappingBase == MAP_FAILED)
+		{
+			return NULL;
+		}
+
+		return new FMappedFileRegionApple(MappingBase, MappingSize, (const uint8*)MappingBase + (Offset - AlignedOffset), BytesToMap);
+	}
+};
+
 /**
  * Mac File I/O implementation
 **/
@@ -419,6 +513,20 @@ IFileHandle* FApplePlatformFile::OpenRead(const TCHAR* Filename)
 	}
 	return NULL;
 }
+IMappedFileHandle* FApplePlatformFile::OpenMapped(const TCHAR* Filename)
+{
+	int32 Handle = open(TCHAR_TO_UTF8(*NormalizeFilename(Filename)), O_RDONLY);
+	if (Handle != -1)
+	{
+		struct stat FileInfo;
+		if (fstat(Handle, &FileInfo) != -1 && S_ISREG(FileInfo.st_mode))
+		{
+			return new FMappedFileHandleApple(Handle, FileInfo.st_size);
+		}
+		close(Handle);
+	}
+	return NULL;
+}
 IFileHandle* FApplePlatformFile::OpenWrite(const TCHAR* Filename, bool bAppend, bool bAllowRead)
 {
 	int Flags = O_CREAT;
@@ -0,0 +1,225 @@
+// Copyright 1998-2014 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	FlatMapTest.cpp: Unit test and benchmark for TFlatMap.
+=============================================================================*/
+
+#include "CorePrivate.h"
+#include "AutomationTest.h"
+#include "FlatMap.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlatMapTest, "Core.Misc.FlatMap", EAutomationTestFlags::ATF_SmokeTest)
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFlatMapBenchmark, "Core.Misc.FlatMap Benchmark", EAutomationTestFlags::ATF_Editor | EAutomationTestFlags::ATF_Commandlet)
+
+namespace
+{
+	/** Key funcs with a poor hash, to test long probe sequences. */
+	struct FCollidingKeyFuncs : TDefaultMapKeyFuncs<int32, FString, false>
+	{
+		static FORCEINLINE uint32 GetKeyHash(KeyInitType Key)
+		{
+			return Key & 3;
+		}
+	};
+
+	/** Applies the same random operations to a TMap and a TFlatMap and checks that their contents match. */
+	template <typename FlatMapType>
+	bool TestAgainstMap(FAutomationTestBase& Test, const TCHAR* What, int32 NumOperations, int32 KeyRange)
+	{
+		FRandomStream Random(12345);
+		TMap<int32, FString> Map;
+		FlatMapType FlatMap;
+
+		for (int32 Operation = 0; Operation < NumOperations; ++Operation)
+		{
+			const int32 Key = Random.RandRange(0, KeyRange - 1);
+			if (Random.FRand() < 0.6f)
+			{
+				const FString Value = FString::Printf(TEXT("Value%d"), Operation);
+				Map.Add(Key, Value);
+				FlatMap.Add(Key, Value);
+			}
+			else if (Map.Remove(Key) != FlatMap.Remove(Key))
+			{
+				Test.AddError(FString::Printf(TEXT("%s: Remove returned a different count for key %d"), What, Key));
+				return false;
+			}
+
+			if (Map.Num() != FlatMap.Num())
+			{
+				Test.AddError(FString::Printf(TEXT("%s: Num is %d, expected %d"), What, FlatMap.Num(), Map.Num()));
+				return false;
+			}
+		}
+
+		for (int32 Key = 0; Key < KeyRange; ++Key)
+		{
+			const FString* Value = Map.Find(Key);
+			const FString* FlatValue = FlatMap.Find(Key);
+			if ((Value == NULL) != (FlatValue == NULL) || (Value && *Value != *FlatValue))
+			{
+				Test.AddError(FString::Printf(TEXT("%s: Mismatch for key %d"), What, Key));
+				return false;
+			}
+		}
+
+		int32 NumIterated = 0;
+		for (typename FlatMapType::TConstIterator It(FlatMap); It; ++It)
+		{
+			const FString* Value = Map.Find(It.Key());
+			if (Value == NULL || *Value != It.Value())
+			{
+				Test.AddError(FString::Printf(TEXT("%s: Iteration returned an unexpected pair for key %d"), What, It.Key()));
+				return false;
+			}
+			++NumIterated;
+		}
+
+		if (NumIterated != Map.Num())
+		{
+			Test.AddError(FString::Printf(TEXT("%s: Iterated over %d pairs, expected %d"), What, NumIterated, Map.Num()));
+			return false;
+		}
+
+		return true;
+	}
+
+	/** Times adding, finding and removing the given keys in a map type. */
+	template <typename MapType, typename KeyType>
+	void BenchmarkMap(FAutomationTestBase& Test, const TCHAR* MapName, const TCHAR* KeyName, const TArray<KeyType>& Keys, const TArray<KeyType>& MissingKeys)
+	{
+		const int32 NumFindPasses = 10;
+		MapType Map;
+		int32 NumFound = 0;
+
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < Keys.Num(); ++Index)
+		{
+			Map.Add(Keys[Index], Index);
+		}
+		const double AddTime = FPlatformTime::Seconds() - StartTime;
+
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Pass = 0; Pass < NumFindPasses; ++Pass)
+		{
+			for (int32 Index = 0; Index < Keys.Num(); ++Index)
+			{
+				NumFound += Map.Find(Keys[Index]) != NULL;
+			}
+		}
+		const double FindTime = FPlatformTime::Seconds() - StartTime;
+
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Pass = 0; Pass < NumFindPasses; ++Pass)
+		{
+			for (int32 Index = 0; Index < MissingKeys.Num(); ++Index)
+			{
+				NumFound += Map.Find(MissingKeys[Index]) != NULL;
+			}
+		}
+		const double MissTime = FPlatformTime::Seconds() - StartTime;
+
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < Keys.Num(); ++Index)
+		{
+			Map.Remove(Keys[Index]);
+		}
+		const double RemoveTime = FPlatformTime::Seconds() - StartTime;
+
+		if (NumFound != Keys.Num() * NumFindPasses)
+		{
+			Test.AddError(FString::Printf(TEXT("%s<%s>: Found %d keys, expected %d"), MapName, KeyName, NumFound, Keys.Num() * NumFindPasses));
+		}
+
+		Test.AddLogItem(FString::Printf(TEXT("%-8s %-8s Add %7.2fms  Find %7.2fms  Miss %7.2fms  Remove %7.2fms"),
+			MapName, KeyName, AddTime * 1000.0, FindTime * 1000.0, MissTime * 1000.0, RemoveTime * 1000.0));
+	}
+
+	template <typename KeyType>
+	void BenchmarkKeyType(FAutomationTestBase& Test, const TCHAR* KeyName, const TArray<KeyType>& Keys, const TArray<KeyType>& MissingKeys)
+	{
+		BenchmarkMap<TMap<KeyType, int32> >(Test, TEXT("TMap"), KeyName, Keys, MissingKeys);
+		BenchmarkMap<TFlatMap<KeyType, int32> >(Test, TEXT("TFlatMap"), KeyName, Keys, MissingKeys);
+	}
+}
+
+bool FFlatMapTest::RunTest( const FString& Parameters )
+{
+	bool bSuccess = true;
+	bSuccess &= TestAgainstMap<TFlatMap<int32, FString> >(*this, TEXT("Default hash"), 20000, 2000);
+	bSuccess &= TestAgainstMap<TFlatMap<int32, FString, FCollidingKeyFuncs> >(*this, TEXT("Colliding hash"), 5000, 1500);
+
+	// Copies and moves must keep the contents.
+	TFlatMap<FString, int32> Source;
+	for (int32 Index = 0; Index < 100; ++Index)
+	{
+		Source.Add(FString::Printf(TEXT("Key%d"), Index), Index);
+	}
+	TFlatMap<FString, int32> Copy(Source);
+	TFlatMap<FString, int32> Moved(MoveTemp(Copy));
+	TestEqual(TEXT("A moved-from map must be empty"), Copy.Num(), 0);
+	TestEqual(TEXT("A moved-to map must have all pairs"), Moved.Num(), 100);
+	TestEqual(TEXT("A copied map must find its pairs"), Moved.FindRef(TEXT("Key42")), 42);
+	TestTrue(TEXT("A copied map must not find missing keys"), !Moved.Contains(TEXT("Key100")));
+
+	Moved.Reset();
+	TestEqual(TEXT("A reset map must be empty"), Moved.Num(), 0);
+	TestTrue(TEXT("A reset map must not find removed keys"), Moved.Find(TEXT("Key42")) == NULL);
+
+	return bSuccess;
+}
+
+bool FFlatMapBenchmark::RunTest( const FString& Parameters )
+{
+	const int32 NumKeys = 100000;
+
+	// Integer keys, in random order.
+	{
+		FRandomStream Random(54321);
+		TArray<int32> Keys;
+		TArray<int32> MissingKeys;
+		for (int32 Index = 0; Index < NumKeys; ++Index)
+		{
+			Keys.Add(Index * 2);
+			MissingKeys.Add(Index * 2 + 1);
+		}
+		for (int32 Index = Keys.Num() - 1; Index > 0; --Index)
+		{
+			Keys.Swap(Index, Random.RandRange(0, Index));
+		}
+		BenchmarkKeyType(*this, TEXT("int32"), Keys, MissingKeys);
+	}
+
+	// Pointer keys, as used by most object maps.
+	{
+		TArray<uint64> Objects;
+		Objects.AddZeroed(NumKeys * 2);
+		TArray<uint64*> Keys;
+		TArray<uint64*> MissingKeys;
+		for (int32 Index = 0; Index < NumKeys; ++Index)
+		{
+			Keys.Add(&Objects[Index * 2]);
+			MissingKeys.Add(&Objects[Index * 2 + 1]);
+		}
+		BenchmarkKeyType(*this, TEXT("pointer"), Keys, MissingKeys);
+	}
+
+	// Name and string keys.
+	{
+		TArray<FName> NameKeys;
+		TArray<FName> MissingNameKeys;
+		TArray<FString> StringKeys;
+		TArray<FString> MissingStringKeys;
+		for (int32 Index = 0; Index < NumKeys; ++Index)
+		{
+			StringKeys.Add(FString::Printf(TEXT("FlatMapKey%dA"), Index));
+			MissingStringKeys.Add(FString::Printf(TEXT("FlatMapKey%dB"), Index));
+			NameKeys.Add(FName(*StringKeys.Last()));
+			MissingNameKeys.Add(FName(*MissingStringKeys.Last()));
+		}
+		BenchmarkKeyType(*this, TEXT("FName"), NameKeys, MissingNameKeys);
+		BenchmarkKeyType(*this, TEXT("FString"), StringKeys, MissingStringKeys);
+	}
+
+	return true;
+}
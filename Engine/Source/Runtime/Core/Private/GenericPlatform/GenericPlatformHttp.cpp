@@ -31,6 +31,7 @@ public:
 	virtual bool ProcessRequest() OVERRIDE { return false; }
 	virtual FHttpRequestCompleteDelegate& OnProcessRequestComplete() OVERRIDE { static FHttpRequestCompleteDelegate RequestCompleteDelegate; return RequestCompleteDelegate; }
 	virtual FHttpRequestProgressDelegate& OnRequestProgress() OVERRIDE { static FHttpRequestProgressDelegate RequestProgressDelegate; return RequestProgressDelegate; }
+	virtual FHttpRequestChunkReceivedDelegate& OnRequestChunkReceived() OVERRIDE { static FHttpRequestChunkReceivedDelegate RequestChunkReceivedDelegate; return RequestChunkReceivedDelegate; }
 	virtual void CancelRequest() OVERRIDE {}
 	virtual EHttpRequestStatus::Type GetStatus() OVERRIDE { return EHttpRequestStatus::NotStarted; }
 	virtual void Tick(float DeltaSeconds) OVERRIDE {}
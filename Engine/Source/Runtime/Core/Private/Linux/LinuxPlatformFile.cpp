@@ -1,6 +1,7 @@
 // Copyright 1998-2014 Epic Games, Inc. All Rights Reserved.
 
 #include "CorePrivate.h"
+#include <sys/mman.h>
 
 DEFINE_LOG_CATEGORY_STATIC(LogLinuxPlatformFile, Log, All);
 
@@ -89,6 +90,99 @@ public:
 	}
 };
 
+/** 
+ * Linux memory mapped region implementation
+**/
+class CORE_API FMappedFileRegionLinux : public IMappedFileRegion
+{
+	/** Start of the mapping, which is aligned down to a page boundary */
+	void* MappingBase;
+	/** Size of the whole mapping */
+	size_t MappingSize;
+	/** Start of the requested region within the mapping */
+	const uint8* MappedPtr;
+	/** Size of the requested region */
+	int64 MappedSize;
+
+public:
+	FMappedFileRegionLinux(void* InMappingBase, size_t InMappingSize, const uint8* InMappedPtr, int64 InMappedSize)
+		: MappingBase(InMappingBase)
+		, MappingSize(InMappingSize)
+		, MappedPtr(InMappedPtr)
+		, MappedSize(InMappedSize)
+	{
+	}
+
+	virtual ~FMappedFileRegionLinux()
+	{
+		munmap(MappingBase, MappingSize);
+	}
+
+	virtual const uint8* GetMappedPtr() OVERRIDE
+	{
+		return MappedPtr;
+	}
+
+	virtual int64 GetMappedSize() OVERRIDE
+	{
+		return MappedSize;
+	}
+};
+
+/** 
+ * Linux memory mapped file handle implementation
+**/
+class CORE_API FMappedFileHandleLinux : public IMappedFileHandle
+{
+	int32 FileHandle;
+	int64 FileSize;
+
+public:
+	FMappedFileHandleLinux(int32 InFileHandle, int64 InFileSize)
+		: FileHandle(InFileHandle)
+		, FileSize(InFileSize)
+	{
+	}
+
+	virtual ~FMappedFileHandleLinux()
+	{
+		close(FileHandle);
+		FileHandle = -1;
+	}
+
+	virtual int64 GetFileSize() OVERRIDE
+	{
+		return FileSize;
+	}
+
+	virtual IMappedFileRegion* MapRegion(int64 Offset, int64 BytesToMap) OVERRIDE
+	{
+		check(Offset >= 0);
+		if (BytesToMap < 0 || BytesToMap > FileSize - Offset)
+		{
+			BytesToMap = FileSize - Offset;
+		}
+		if (BytesToMap <= 0)
+		{
+			return NULL;
+		}
+
+		// mmap wants a page aligned offset, map from the start of the page and point into it
+		const int64 PageSize = sysconf(_SC_PAGESIZE);
+		const int64 AlignedOffset = Offset - (Offset % PageSize);
+		const size_t MappingSize = (size_t)(BytesToMap + (Offset - AlignedOffset));
+
+		void* MappingBase = mmap(NULL, MappingSize, PROT_READ, MAP_PRIVATE, FileHandle, AlignedOffset);
+		if (MappingBase == MAP_FAILED)
+		{
+			UE_LOG(LogLinuxPlatformFile, Warning, TEXT( "mmap(%lld, %lld) failed: errno=%d (%s)" ), AlignedOffset, (int64)MappingSize, errno, ANSI_TO_TCHAR(strerror(errno)));
+			return NULL;
+		}
+
+		return new FMappedFileRegionLinux(MappingBase, MappingSize, (const uint8*)MappingBase + (Offset - AlignedOffset), BytesToMap);
+	}
+};
+
 /**
  * Linux File I/O implementation
 **/
@@ -237,6 +331,27 @@ IFileHandle* FLinuxPlatformFile::OpenRead(const TCHAR* Filename)
 	return NULL;
 }
 
+IMappedFileHandle* FLinuxPlatformFile::OpenMapped(const TCHAR* Filename)
+{
+	int32 Handle = open(TCHAR_TO_UTF8(*NormalizeFilename(Filename)), O_RDONLY);
+	if (Handle != -1)
+	{
+		struct stat FileInfo;
+		if (fstat(Handle, &FileInfo) != -1 && S_ISREG(FileInfo.st_mode))
+		{
+			return new FMappedFileHandleLinux(Handle, FileInfo.st_size);
+		}
+		close(Handle);
+		return NULL;
+	}
+	// log non-standard errors only
+	if (ENOENT != errno)
+	{
+		UE_LOG(LogLinuxPlatformFile, Warning, TEXT( "open('%s', ORDONLY) failed: errno=%d (%s)" ), *NormalizeFilename(Filename), errno, ANSI_TO_TCHAR(strerror(errno)));
+	}
+	return NULL;
+}
+
 IFileHandle* FLinuxPlatformFile::OpenWrite(const TCHAR* Filename, bool bAppend, bool bAllowRead)
 {
 	int Flags = O_CREAT;
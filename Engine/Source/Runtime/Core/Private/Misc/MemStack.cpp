@@ -13,6 +13,11 @@ template<> uint32 FThreadSingleton<FMemStack>::TlsSlot = 0;
 
 DECLARE_MEMORY_STAT(TEXT("MemStack Allocated (all threads)"), STAT_MemStackAllocated,STATGROUP_Memory);
 DECLARE_MEMORY_STAT(TEXT("MemStack Used (all threads)"), STAT_MemStackUsed,STATGROUP_Memory);
+DECLARE_MEMORY_STAT(TEXT("MemStack Peak (game thread)"), STAT_MemStackPeakGameThread,STATGROUP_Memory);
+DECLARE_MEMORY_STAT(TEXT("MemStack Peak (rendering thread)"), STAT_MemStackPeakRenderingThread,STATGROUP_Memory);
+
+/** Pattern written over memory that has been released by a mark. */
+#define MEMSTACK_POISON_PATTERN 0xcd
 
 /*-----------------------------------------------------------------------------
 	FMemStack implementation.
@@ -26,14 +31,16 @@ FMemStack::FMemStack( int32 InDefaultChunkSize /*= DEFAULT_CHUNK_SIZE*/ )
 ,	TopMark(NULL)
 ,	UnusedChunks(NULL)
 ,	NumMarks(0)
+,	UsedChunkBytes(0)
+,	PeakChunkBytes(0)
 {
 }
 
 FMemStack::~FMemStack()
 {
 	check(GIsCriticalError || !NumMarks);
+	check(GIsCriticalError || TopChunk==NULL);
 
-	Tick();
 	while( UnusedChunks )
 	{
 		FTaggedMemory* Old = UnusedChunks;
@@ -43,9 +50,20 @@ FMemStack::~FMemStack()
 	}
 }
 
-void FMemStack::Tick() const
+void FMemStack::Tick()
 {
-	check(TopChunk==NULL);
+	// Only the game and rendering threads tick their stacks.
+	if( IsInGameThread() )
+	{
+		SET_MEMORY_STAT( STAT_MemStackPeakGameThread, PeakChunkBytes );
+	}
+	else
+	{
+		SET_MEMORY_STAT( STAT_MemStackPeakRenderingThread, PeakChunkBytes );
+	}
+
+	// Start over from what is still held, e.g. by the marks of the caller.
+	PeakChunkBytes = UsedChunkBytes;
 }
 
 int32 FMemStack::GetByteCount() const
@@ -103,6 +121,9 @@ void FMemStack::AllocateNewChunk( int32 MinSize )
 		INC_MEMORY_STAT_BY( STAT_MemStackUsed, Chunk->DataSize );
 	}
 
+	UsedChunkBytes += Chunk->DataSize;
+	PeakChunkBytes = FMath::Max( PeakChunkBytes, UsedChunkBytes );
+
 	Chunk->Next = TopChunk;
 	TopChunk    = Chunk;
 	Top         = Chunk->Data;
@@ -117,6 +138,7 @@ void FMemStack::FreeChunks( FTaggedMemory* NewTopChunk )
 		TopChunk                   = TopChunk->Next;
 		RemoveChunk->Next          = UnusedChunks;
 		UnusedChunks               = RemoveChunk;
+		UsedChunkBytes            -= RemoveChunk->DataSize;
 
 		DEC_MEMORY_STAT_BY( STAT_MemStackUsed, RemoveChunk->DataSize );
 	}
@@ -129,6 +151,24 @@ void FMemStack::FreeChunks( FTaggedMemory* NewTopChunk )
 	}
 }
 
+void FMemStack::PoisonAbove( FTaggedMemory* NewTopChunk, uint8* NewTop )
+{
+	for( FTaggedMemory* Chunk=TopChunk; Chunk; Chunk=Chunk->Next )
+	{
+		uint8* ChunkEnd = Chunk->Data + Chunk->DataSize;
+		if( Chunk!=NewTopChunk )
+		{
+			// The whole chunk is about to be freed.
+			FMemory::Memset( Chunk->Data, MEMSTACK_POISON_PATTERN, ChunkEnd - Chunk->Data );
+		}
+		else
+		{
+			FMemory::Memset( NewTop, MEMSTACK_POISON_PATTERN, ChunkEnd - NewTop );
+			break;
+		}
+	}
+}
+
 bool FMemStack::ContainsPointer( const void* Pointer ) const
 {
 	const uint8* Ptr = (const uint8*)Pointer;
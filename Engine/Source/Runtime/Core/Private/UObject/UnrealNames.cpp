@@ -15,6 +15,42 @@ DEFINE_LOG_CATEGORY_STATIC(LogUnrealNames, Log, All);
 
 FNameEntry* AllocateNameEntry( const void* Name, NAME_INDEX Index, FNameEntry* HashNext, bool bIsPureAnsi );
 
+/** Upper cases a character of a pure ANSI name. Those only contain characters up to 0x7f, so this doesn't need to go through the CRT. */
+static FORCEINLINE uint32 FoldNameChar( ANSICHAR Char )
+{
+	const uint32 Code = (uint8)Char;
+	return Code - ((Code - 'a' < 26u) << 5);
+}
+
+/** Upper cases a character of a wide name. */
+static FORCEINLINE uint32 FoldNameChar( WIDECHAR Char )
+{
+	return Char < 0x80 ? FoldNameChar( (ANSICHAR)Char ) : (uint32)TChar<WIDECHAR>::ToUpper( Char );
+}
+
+/**
+ * Case insensitive hash of a name string. FNV-1a over the upper cased characters, followed by
+ * a final mix so that the low bits used to pick the hash bucket and shard depend on every character.
+ *
+ * @param	Name	Name string to hash
+ * @return			Hash of the name
+ */
+template <typename CharType>
+static uint32 GetNameStringHash( const CharType* Name )
+{
+	uint32 Hash = 2166136261u;
+	while( *Name )
+	{
+		Hash = (Hash ^ FoldNameChar( *Name++ )) * 16777619u;
+	}
+	Hash ^= Hash >> 16;
+	Hash *= 0x85ebca6b;
+	Hash ^= Hash >> 13;
+	Hash *= 0xc2b2ae35;
+	Hash ^= Hash >> 16;
+	return Hash;
+}
+
 /**
 * Helper function that can be used inside the debuggers watch window. E.g. "DebugFName(Class->Name.Index)". 
 *
@@ -103,11 +139,11 @@ uint32 FNameEntry::GetNameHash() const
 {
 	if( IsWide() )
 	{
-		return FCrc::Strihash_DEPRECATED(WideName);
+		return GetNameStringHash(WideName);
 	}
 	else
 	{
-		return FCrc::Strihash_DEPRECATED(AnsiName);
+		return GetNameStringHash(AnsiName);
 	}
 }
 
@@ -223,17 +259,69 @@ FNameEntry*** FName::GetNameTableForDebuggerVisualizers_MT()
 }
 
 
-FCriticalSection* FName::GetCriticalSection()
+/**
+ * Insertion lock for a subset of the name hash buckets. Lookups walk the hash chains without locking,
+ * so only threads adding names to buckets of the same shard wait for each other.
+ */
+struct FNameHashShard
+{
+	/** Serializes adding names to the buckets of this shard. */
+	FCriticalSection	Lock;
+	/** Number of threads adding or waiting to add a name to this shard. */
+	volatile int32		NumInserting;
+	/** Number of adds that had to wait for another thread adding to this shard. Only changed while holding the lock. */
+	int32				NumContendedInserts;
+	/** Number of adds that found the name already added by another thread once they had the lock. Only changed while holding the lock. */
+	int32				NumLostInsertRaces;
+
+	FNameHashShard()
+		: NumInserting(0)
+		, NumContendedInserts(0)
+		, NumLostInsertRaces(0)
+	{
+	}
+};
+
+/** Singleton to retrieve the name hash shards. Allocated on first use, see GetNames for why. */
+static FNameHashShard* GetNameHashShards()
 {
-	static FCriticalSection*	CriticalSection = NULL;
-	if( CriticalSection == NULL )
+	checkAtCompileTime((FNameDefs::NameHashShardCount & (FNameDefs::NameHashShardCount - 1)) == 0, NameHashShardCountMustBeAPowerOfTwo);
+	checkAtCompileTime(FNameDefs::NameHashShardCount <= FNameDefs::NameHashBucketCount, NameHashShardCountMustNotExceedBucketCount);
+
+	static FNameHashShard* Shards = NULL;
+	if( Shards == NULL )
 	{
 		check(IsInGameThread());
-		CriticalSection = new FCriticalSection();
+		Shards = new FNameHashShard[FNameDefs::NameHashShardCount];
 	}
-	return CriticalSection;
+	return Shards;
 }
 
+/** Acquires the lock of a name hash shard for the lifetime of the scope, counting acquisitions that had to wait. */
+class FNameHashShardScopeLock
+{
+public:
+	FNameHashShardScopeLock( FNameHashShard& InShard )
+		: Shard(InShard)
+	{
+		const bool bContended = FPlatformAtomics::InterlockedIncrement(&Shard.NumInserting) > 1;
+		Shard.Lock.Lock();
+		if( bContended )
+		{
+			Shard.NumContendedInserts++;
+		}
+	}
+
+	~FNameHashShardScopeLock()
+	{
+		Shard.Lock.Unlock();
+		FPlatformAtomics::InterlockedDecrement(&Shard.NumInserting);
+	}
+
+private:
+	FNameHashShard& Shard;
+};
+
 
 // Static variables.
 FNameEntry*						FName::NameHash[ FNameDefs::NameHashBucketCount ];
@@ -432,11 +520,11 @@ void FName::Init(const WIDECHAR* InName, int32 InNumber, EFindName FindType, boo
 	if( bIsPureAnsi )
 	{
 		FCStringAnsi::Strncpy( AnsiName, StringCast<ANSICHAR>(InName).Get(), ARRAY_COUNT(AnsiName) );
-		iHash = FCrc::Strihash_DEPRECATED( AnsiName ) & (ARRAY_COUNT(NameHash)-1);
+		iHash = GetNameStringHash( AnsiName ) & (ARRAY_COUNT(NameHash)-1);
 	}
 	else
 	{
-		iHash = FCrc::Strihash_DEPRECATED( InName ) & (ARRAY_COUNT(NameHash)-1);
+		iHash = GetNameStringHash( InName ) & (ARRAY_COUNT(NameHash)-1);
 	}
 
 	if (OutIndex < 0)
@@ -490,8 +578,9 @@ void FName::Init(const WIDECHAR* InName, int32 InNumber, EFindName FindType, boo
 			return;
 		}
 	}
-	// acquire the lock
-	FScopeLock ScopeLock(GetCriticalSection());
+	// acquire the lock of the shard this bucket belongs to, only threads adding to the same shard contend for it
+	FNameHashShard& Shard = GetNameHashShards()[iHash & (FNameDefs::NameHashShardCount - 1)];
+	FNameHashShardScopeLock ScopeLock(Shard);
 	if (OutIndex < 0)
 	{
 		// Try to find the name in the hash. AGAIN...we might have been adding from a different thread and we just missed it
@@ -504,6 +593,7 @@ void FName::Init(const WIDECHAR* InName, int32 InNumber, EFindName FindType, boo
 				// Found it in the hash.
 				OutIndex = Hash->GetIndex();
 				check(FindType == FNAME_Add);  // if this was a replace, well it isn't safe for threading. Find should have already been handled
+				Shard.NumLostInsertRaces++;
 				Index = OutIndex;
 				Number = OutNumber;
 				return;
@@ -527,7 +617,7 @@ void FName::Init(const WIDECHAR* InName, int32 InNumber, EFindName FindType, boo
 	}
 	if (FPlatformAtomics::InterlockedCompareExchangePointer((void**)&NameHash[iHash], NewEntry, OldHash) != OldHash) // we use an atomic operation to check for unexpected concurrency, verify alignment, etc
 	{
-		check(0); // someone changed this while we were changing it
+		check(0); // someone changed this while we were changing it, buckets are only changed while holding their shard's lock
 	}
 	check(OutIndex >= 0);
 	Index = OutIndex;
@@ -660,6 +750,16 @@ void FName::DisplayHash( FOutputDevice& Ar )
 		}
 	}
 	Ar.Logf( TEXT("Hash: %i names, %i/%i hash bins, Mem in bytes %i"), NameCount, UsedBins, ARRAY_COUNT(NameHash), MemUsed);
+
+	int32 ContendedInserts=0, LostInsertRaces=0, MaxShardContendedInserts=0;
+	FNameHashShard* Shards = GetNameHashShards();
+	for( uint32 ShardIndex=0; ShardIndex<FNameDefs::NameHashShardCount; ShardIndex++ )
+	{
+		ContendedInserts += Shards[ShardIndex].NumContendedInserts;
+		LostInsertRaces += Shards[ShardIndex].NumLostInsertRaces;
+		MaxShardContendedInserts = FMath::Max( MaxShardContendedInserts, Shards[ShardIndex].NumContendedInserts );
+	}
+	Ar.Logf( TEXT("Shards: %i, %i contended adds (at most %i in one shard), %i adds lost to another thread"), FNameDefs::NameHashShardCount, ContendedInserts, MaxShardContendedInserts, LostInsertRaces);
 }
 
 bool FName::SplitNameWithCheck(const WIDECHAR* OldName, WIDECHAR* NewName, int32 NewNameLen, int32& NewNumber)
@@ -810,6 +910,7 @@ FArchive& operator<<( FArchive& Ar, FNameEntry& E )
  * never go away. It simply uses 64K chunks and allocates new ones as space runs out. This reduces
  * allocation overhead significantly (only minor waste on 64k boundaries) and also greatly helps
  * with fragmentation as 50-100k allocations turn into tens of allocations.
+ * Thread safe without locking, as names are added from all name hash shards concurrently.
  */
 class FNameEntryPoolAllocator
 {
@@ -818,9 +919,7 @@ public:
 	FNameEntryPoolAllocator()
 	{
 		TotalAllocatedPages	= 0;
-		CurrentPoolStart	= NULL;
-		CurrentPoolEnd		= NULL;
-		check(ThreadGuard.GetValue() == 0);
+		CurrentPool			= NULL;
 	}
 
 	/**
@@ -831,23 +930,27 @@ public:
 	 */
 	FNameEntry* Allocate( int32 Size )
 	{
-		check(ThreadGuard.Increment() == 1);
 		// Some platforms need all of the name entries to be aligned to 4 bytes, so by
 		// aligning the size here the next allocation will be aligned to 4
 		Size = Align( Size, ALIGNOF(FNameEntry) );
+		check( Size <= PoolSize() - PoolHeaderSize() );
 
-		// Allocate a new pool if current one is exhausted. We don't worry about a little bit
-		// of waste at the end given the relative size of pool to average and max allocation.
-		if( CurrentPoolEnd - CurrentPoolStart < Size )
+		while( true )
 		{
-			AllocateNewPool();
+			// Claim space in the current pool. Threads that overrun the end only waste the pool's tail,
+			// we don't worry about a little bit of waste given the relative size of pool to average and max allocation.
+			FPool* Pool = CurrentPool;
+			if( Pool )
+			{
+				const int32 Offset = FPlatformAtomics::InterlockedAdd( &Pool->Used, Size );
+				if( Offset + Size <= PoolSize() )
+				{
+					return (FNameEntry*) ((uint8*)Pool + Offset);
+				}
+			}
+			// Allocate a new pool if current one is exhausted.
+			AllocateNewPool( Pool );
 		}
-		check( CurrentPoolEnd - CurrentPoolStart >= Size );
-		// Return current pool start as allocation and increment by size.
-		FNameEntry* NameEntry = (FNameEntry*) CurrentPoolStart;
-		CurrentPoolStart += Size;
-		check(ThreadGuard.Decrement() == 0);
-		return NameEntry;
 	}
 
 	/**
@@ -872,22 +975,42 @@ public:
 	}
 
 private:
-	/** Allocates a new pool. */
-	void AllocateNewPool()
+	/** Header at the start of each pool. */
+	struct FPool
 	{
-		TotalAllocatedPages++;
-		CurrentPoolStart = (uint8*) FMemory::Malloc(PoolSize());
-		CurrentPoolEnd = CurrentPoolStart + PoolSize();
+		/** Number of bytes claimed in the pool, including the header. May exceed the pool size. */
+		volatile int32 Used;
+	};
+
+	/** Returns the size of the pool header, padded so that name entries stay aligned. */
+	FORCEINLINE int32 PoolHeaderSize()
+	{
+		return Align( sizeof(FPool), ALIGNOF(FNameEntry) );
+	}
+
+	/**
+	 * Allocates a new pool, unless another thread has already replaced the exhausted one.
+	 *
+	 * @param   ExhaustedPool  The pool that ran out of space, NULL if none was allocated yet.
+	 */
+	void AllocateNewPool( FPool* ExhaustedPool )
+	{
+		FPool* NewPool = (FPool*) FMemory::Malloc(PoolSize());
+		NewPool->Used = PoolHeaderSize();
+		if( FPlatformAtomics::InterlockedCompareExchangePointer( (void**)&CurrentPool, NewPool, ExhaustedPool ) == ExhaustedPool )
+		{
+			FPlatformAtomics::InterlockedIncrement( &TotalAllocatedPages );
+		}
+		else
+		{
+			FMemory::Free( NewPool );
+		}
 	}
 
-	/** Beginning of pool. Allocated by AllocateNewPool, incremented by Allocate.	*/
-	uint8* CurrentPoolStart;
-	/** End of current pool. Set by AllocateNewPool and checked by Allocate.		*/
-	uint8* CurrentPoolEnd;
+	/** Pool allocations are currently made from. Replaced by AllocateNewPool when exhausted. */
+	FPool* volatile CurrentPool;
 	/** Total number of pages that have been allocated.								*/
-	int32 TotalAllocatedPages;
-	/** Threadsafe counter to test for unwanted concurrency							*/
-	FThreadSafeCounter ThreadGuard;
+	volatile int32 TotalAllocatedPages;
 };
 
 /** Global allocator for name entries. */
@@ -898,7 +1021,7 @@ FNameEntry* AllocateNameEntry( const void* Name, NAME_INDEX Index, FNameEntry* H
 	const SIZE_T NameLen  = bIsPureAnsi ? FCStringAnsi::Strlen((ANSICHAR*)Name) : FCString::Strlen((TCHAR*)Name);
 	int32 NameEntrySize	  = FNameEntry::GetSize( NameLen, bIsPureAnsi );
 	FNameEntry* NameEntry = GNameEntryPoolAllocator.Allocate( NameEntrySize );
-	FName::NameEntryMemorySize += NameEntrySize;
+	FPlatformAtomics::InterlockedAdd( &FName::NameEntryMemorySize, NameEntrySize );
 	NameEntry->Index      = (Index << NAME_INDEX_SHIFT) | (bIsPureAnsi ? 0 : 1);
 	NameEntry->HashNext   = HashNext;
 	// Can't rely on the template override for static arrays since the safe crt version of strcpy will fill in
@@ -906,12 +1029,12 @@ FNameEntry* AllocateNameEntry( const void* Name, NAME_INDEX Index, FNameEntry* H
 	if( bIsPureAnsi )
 	{
 		FCStringAnsi::Strcpy( const_cast<ANSICHAR*>(NameEntry->GetAnsiName()), NameLen + 1, (ANSICHAR*) Name );
-		FName::NumAnsiNames++;
+		FPlatformAtomics::InterlockedIncrement( &FName::NumAnsiNames );
 	}
 	else
 	{
 		FCStringWide::Strcpy( const_cast<WIDECHAR*>(NameEntry->GetWideName()), NameLen + 1, (WIDECHAR*) Name );
-		FName::NumWideNames++;
+		FPlatformAtomics::InterlockedIncrement( &FName::NumWideNames );
 	}
 	return NameEntry;
 }
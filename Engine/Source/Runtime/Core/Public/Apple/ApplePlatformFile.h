@@ -31,6 +31,7 @@ public:
 
 	virtual IFileHandle* OpenRead(const TCHAR* Filename) OVERRIDE;
 	virtual IFileHandle* OpenWrite(const TCHAR* Filename, bool bAppend = false, bool bAllowRead = false) OVERRIDE;
+	virtual IMappedFileHandle* OpenMapped(const TCHAR* Filename) OVERRIDE;
 	virtual bool DirectoryExists(const TCHAR* Directory) OVERRIDE;
 	virtual bool CreateDirectory(const TCHAR* Directory) OVERRIDE;
 	virtual bool DeleteDirectory(const TCHAR* Directory) OVERRIDE;
@@ -631,3 +631,81 @@ public:
 };
 
 
+/**
+ * Asynchronous processing of one range of a ParallelForRanges call
+ */
+template<typename BodyType>
+class TParallelForRangeWorker : public FNonAbandonableTask
+{
+public:
+	TParallelForRangeWorker( BodyType* InBody, int32 InFirst, int32 InLast )
+		: Body( *InBody )
+		, First( InFirst )
+		, Last( InLast )
+	{
+	}
+
+	/** Processes the range */
+	void DoWork()
+	{
+		Body( First, Last );
+	}
+
+	/** Give the name for external event viewers
+	* @return	the name to display in external event viewers
+	*/
+	static const TCHAR *Name()
+	{
+		return TEXT("FParallelForRangeTask");
+	}
+
+private:
+	/** The body processing the range */
+	BodyType& Body;
+	/** First item to process */
+	int32 First;
+	/** One past the last item to process */
+	int32 Last;
+};
+
+/**
+ * Processes the items [0, Num) in contiguous ranges, splitting them between the calling thread and background tasks.
+ * Returns once all items have been processed. Each item is processed exactly once, so results don't depend on the split
+ * as long as the body only writes data belonging to the items it was given.
+ *
+ * @param Num				number of items to process
+ * @param Body				called as Body(int32 First, int32 Last) for disjoint ranges, possibly at the same time on different threads
+ * @param MinItemsPerTask	ranges are not made smaller than this, small workloads are processed on the calling thread
+ */
+template<typename BodyType>
+void ParallelForRanges( int32 Num, BodyType& Body, int32 MinItemsPerTask = 1 )
+{
+	const int32 NumTasks = FMath::Clamp( Num / FMath::Max( MinItemsPerTask, 1 ), 1, FMath::Max( FMath::Min( FPlatformMisc::NumberOfCores(), Num ), 1 ) );
+	if( NumTasks == 1 )
+	{
+		if( Num > 0 )
+		{
+			Body( 0, Num );
+		}
+		return;
+	}
+
+	typedef FAsyncTask<TParallelForRangeWorker<BodyType> > FParallelForRangeTask;
+	TIndirectArray<FParallelForRangeTask> AsyncTasks;
+	const int32 ItemsPerTask = ( Num + NumTasks - 1 ) / NumTasks;
+
+	// the first range is processed on this thread while the others run in the background
+	for( int32 First = ItemsPerTask; First < Num; First += ItemsPerTask )
+	{
+		FParallelForRangeTask* AsyncTask = new(AsyncTasks) FParallelForRangeTask( &Body, First, FMath::Min( First + ItemsPerTask, Num ) );
+		AsyncTask->StartBackgroundTask();
+	}
+
+	Body( 0, ItemsPerTask );
+
+	for( int32 TaskIndex = 0; TaskIndex < AsyncTasks.Num(); TaskIndex++ )
+	{
+		AsyncTasks[TaskIndex].EnsureCompletion();
+	}
+}
+
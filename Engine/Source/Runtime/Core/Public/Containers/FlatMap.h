@@ -0,0 +1,306 @@
+// Copyright 1998-2014 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	FlatMap.h: Open addressing map definitions.
+=============================================================================*/
+
+#pragma once
+
+#include "FlatSet.h"
+
+/**
+ * A map from keys to values, implemented using a TFlatSet of key-value pairs with a custom KeyFuncs.
+ * Has the same interface as TMap for the common operations, see TFlatSet for the differences in behavior.
+ * Meant for maps with frequent lookups on hot paths; TMap remains the general purpose map.
+ */
+template<typename KeyType, typename ValueType, typename KeyFuncs = TDefaultMapKeyFuncs<KeyType,ValueType,false> >
+class TFlatMap
+{
+public:
+	typedef typename TTypeTraits<KeyType>::ConstPointerType KeyConstPointerType;
+	typedef typename TTypeTraits<KeyType>::ConstInitType    KeyInitType;
+	typedef typename TTypeTraits<ValueType>::ConstInitType  ValueInitType;
+
+protected:
+	typedef TPair<KeyType, ValueType> PairType;
+	typedef TFlatSet<PairType, KeyFuncs> PairSetType;
+
+public:
+#if PLATFORM_COMPILER_HAS_DEFAULTED_FUNCTIONS
+
+	TFlatMap() = default;
+	TFlatMap(TFlatMap&&) = default;
+	TFlatMap(const TFlatMap&) = default;
+	TFlatMap& operator=(TFlatMap&&) = default;
+	TFlatMap& operator=(const TFlatMap&) = default;
+
+#else
+
+	FORCEINLINE TFlatMap() {}
+	FORCEINLINE TFlatMap(      TFlatMap&& Other) : Pairs(MoveTemp(Other.Pairs)) {}
+	FORCEINLINE TFlatMap(const TFlatMap&  Other) : Pairs(         Other.Pairs ) {}
+	FORCEINLINE TFlatMap& operator=(      TFlatMap&& Other) { Pairs = MoveTemp(Other.Pairs); return *this; }
+	FORCEINLINE TFlatMap& operator=(const TFlatMap&  Other) { Pairs =          Other.Pairs ; return *this; }
+
+#endif
+
+public:
+	/**
+	 * Removes all elements from the map, potentially leaving space allocated for an expected number of elements about to be added.
+	 * @param ExpectedNumElements - The number of elements about to be added to the map.
+	 */
+	FORCEINLINE void Empty(int32 ExpectedNumElements = 0)
+	{
+		Pairs.Empty(ExpectedNumElements);
+	}
+
+	/** Efficiently empties out the map but preserves all allocations and capacities */
+	FORCEINLINE void Reset()
+	{
+		Pairs.Reset();
+	}
+
+	/** Preallocates enough memory to contain Number elements without rehashing. */
+	FORCEINLINE void Reserve(int32 Number)
+	{
+		Pairs.Reserve(Number);
+	}
+
+	/** @return The number of elements in the map. */
+	FORCEINLINE int32 Num() const
+	{
+		return Pairs.Num();
+	}
+
+	/** @return The amount of memory allocated by this container, in bytes. */
+	FORCEINLINE uint32 GetAllocatedSize() const
+	{
+		return Pairs.GetAllocatedSize();
+	}
+
+	/**
+	 * Sets the value associated with a key, replacing an existing value.
+	 *
+	 * @param InKey - The key to associate the value with.
+	 * @param InValue - The value to associate with the key.
+	 * @return A reference to the value as stored in the map.  The reference is only valid until the next change to the map.
+	 */
+	FORCEINLINE ValueType& Add(const KeyType&  InKey, const ValueType&  InValue) { return Emplace(         InKey ,          InValue ); }
+	FORCEINLINE ValueType& Add(const KeyType&  InKey,       ValueType&& InValue) { return Emplace(         InKey , MoveTemp(InValue)); }
+	FORCEINLINE ValueType& Add(      KeyType&& InKey, const ValueType&  InValue) { return Emplace(MoveTemp(InKey),          InValue ); }
+	FORCEINLINE ValueType& Add(      KeyType&& InKey,       ValueType&& InValue) { return Emplace(MoveTemp(InKey), MoveTemp(InValue)); }
+
+	/**
+	 * Sets a default value associated with a key, replacing an existing value.
+	 *
+	 * @param InKey - The key to associate the value with.
+	 * @return A reference to the value as stored in the map.  The reference is only valid until the next change to the map.
+	 */
+	FORCEINLINE ValueType& Add(const KeyType&  InKey) { return Emplace(         InKey ); }
+	FORCEINLINE ValueType& Add(      KeyType&& InKey) { return Emplace(MoveTemp(InKey)); }
+
+	/** Sets the value associated with a key, see Add. */
+	template <typename InitKeyType, typename InitValueType>
+	FORCEINLINE ValueType& Emplace(InitKeyType&& InKey, InitValueType&& InValue)
+	{
+		return Pairs.Emplace(TPairInitializer<InitKeyType&&, InitValueType&&>(Forward<InitKeyType>(InKey), Forward<InitValueType>(InValue)))->Value;
+	}
+
+	/** Sets a default value associated with a key, see Add. */
+	template <typename InitKeyType>
+	FORCEINLINE ValueType& Emplace(InitKeyType&& InKey)
+	{
+		return Pairs.Emplace(TKeyInitializer<InitKeyType&&>(Forward<InitKeyType>(InKey)))->Value;
+	}
+
+	/**
+	 * Removes the value association for a key.
+	 * @param InKey - The key to remove the associated value for.
+	 * @return The number of values that were associated with the key.
+	 */
+	FORCEINLINE int32 Remove(KeyConstPointerType InKey)
+	{
+		return Pairs.Remove(InKey);
+	}
+
+	/**
+	 * Returns the value associated with a specified key.
+	 * @param	Key - The key to search for.
+	 * @return	A pointer to the value associated with the specified key, or NULL if the key isn't contained in this map.  The pointer
+	 *			is only valid until the next change to the map.
+	 */
+	FORCEINLINE ValueType* Find(KeyConstPointerType Key)
+	{
+		if (PairType* Pair = Pairs.Find(Key))
+		{
+			return &Pair->Value;
+		}
+
+		return NULL;
+	}
+	FORCEINLINE const ValueType* Find(KeyConstPointerType Key) const
+	{
+		return const_cast<TFlatMap*>(this)->Find(Key);
+	}
+
+	/**
+	 * Returns the value associated with a specified key, or if none exists, adds a value using the default constructor.
+	 * @param	Key - The key to search for.
+	 * @return	A reference to the value associated with the specified key.
+	 */
+	FORCEINLINE ValueType& FindOrAdd(const KeyType& Key)
+	{
+		if (PairType* Pair = Pairs.Find(Key))
+		{
+			return Pair->Value;
+		}
+
+		return Add(Key);
+	}
+
+	/**
+	 * Returns a reference to the value associated with a specified key.
+	 * @param	Key - The key to search for.
+	 * @return	The value associated with the specified key, or triggers an assertion if the key does not exist.
+	 */
+	FORCEINLINE ValueType& FindChecked(KeyConstPointerType Key)
+	{
+		PairType* Pair = Pairs.Find(Key);
+		check(Pair != NULL);
+		return Pair->Value;
+	}
+	FORCEINLINE const ValueType& FindChecked(KeyConstPointerType Key) const
+	{
+		return const_cast<TFlatMap*>(this)->FindChecked(Key);
+	}
+
+	/**
+	 * Returns the value associated with a specified key.
+	 * @param	Key - The key to search for.
+	 * @return	The value associated with the specified key, or the default value for the ValueType if the key isn't contained in this map.
+	 */
+	FORCEINLINE ValueType FindRef(KeyConstPointerType Key) const
+	{
+		if (const PairType* Pair = Pairs.Find(Key))
+		{
+			return Pair->Value;
+		}
+
+		return ValueType();
+	}
+
+	/**
+	 * Checks if map contains the specified key.
+	 * @param Key - The key to check for.
+	 * @return true if the map contains the key.
+	 */
+	FORCEINLINE bool Contains(KeyConstPointerType Key) const
+	{
+		return Pairs.Contains(Key);
+	}
+
+protected:
+	/** The base of TFlatMap iterators. */
+	template<bool bConst>
+	class TBaseIterator
+	{
+	public:
+		typedef typename TChooseClass<bConst,typename PairSetType::TConstIterator,typename PairSetType::TIterator>::Result PairItType;
+	private:
+		typedef typename TChooseClass<bConst,const KeyType,KeyType>::Result ItKeyType;
+		typedef typename TChooseClass<bConst,const ValueType,ValueType>::Result ItValueType;
+		typedef typename TChooseClass<bConst,const PairType,PairType>::Result ItPairType;
+
+	protected:
+		FORCEINLINE TBaseIterator(const PairItType& InElementIt)
+			: PairIt(InElementIt)
+		{
+		}
+
+	public:
+		FORCEINLINE TBaseIterator& operator++()
+		{
+			++PairIt;
+			return *this;
+		}
+
+		/** conversion to "bool" returning true if the iterator is valid. */
+		FORCEINLINE_EXPLICIT_OPERATOR_BOOL() const
+		{
+			return !!PairIt;
+		}
+		/** inverse of the "bool" operator */
+		FORCEINLINE bool operator !() const
+		{
+			return !(bool)*this;
+		}
+
+		FORCEINLINE friend bool operator==(const TBaseIterator& Lhs, const TBaseIterator& Rhs) { return Lhs.PairIt == Rhs.PairIt; }
+		FORCEINLINE friend bool operator!=(const TBaseIterator& Lhs, const TBaseIterator& Rhs) { return Lhs.PairIt != Rhs.PairIt; }
+
+		// The key is not modifiable, as that would break the hash.
+		FORCEINLINE const KeyType& Key()   const { return PairIt->Key; }
+		FORCEINLINE ItValueType&   Value() const { return PairIt->Value; }
+
+		FORCEINLINE ItPairType& operator* () const { return  *PairIt; }
+		FORCEINLINE ItPairType* operator->() const { return &*PairIt; }
+
+	protected:
+		PairItType PairIt;
+	};
+
+	/** A set of the key-value pairs in the map. */
+	PairSetType Pairs;
+
+public:
+	/** Map iterator. */
+	class TIterator : public TBaseIterator<false>
+	{
+	public:
+		FORCEINLINE explicit TIterator(TFlatMap& InMap)
+			: TBaseIterator<false>(InMap.Pairs.CreateIterator())
+		{
+		}
+
+		FORCEINLINE TIterator(const typename TBaseIterator<false>::PairItType& InPairIt)
+			: TBaseIterator<false>(InPairIt)
+		{
+		}
+	};
+
+	/** Const map iterator. */
+	class TConstIterator : public TBaseIterator<true>
+	{
+	public:
+		FORCEINLINE explicit TConstIterator(const TFlatMap& InMap)
+			: TBaseIterator<true>(InMap.Pairs.CreateConstIterator())
+		{
+		}
+
+		FORCEINLINE TConstIterator(const typename TBaseIterator<true>::PairItType& InPairIt)
+			: TBaseIterator<true>(InPairIt)
+		{
+		}
+	};
+
+	/** Creates an iterator over all the pairs in this map */
+	FORCEINLINE TIterator CreateIterator()
+	{
+		return TIterator(*this);
+	}
+
+	/** Creates a const iterator over all the pairs in this map */
+	FORCEINLINE TConstIterator CreateConstIterator() const
+	{
+		return TConstIterator(*this);
+	}
+
+	/**
+	 * DO NOT USE DIRECTLY
+	 * STL-like iterators to enable range-based for loop support.
+	 */
+	FORCEINLINE friend TIterator      begin(      TFlatMap& Map) { return TIterator     (begin(Map.Pairs)); }
+	FORCEINLINE friend TConstIterator begin(const TFlatMap& Map) { return TConstIterator(begin(Map.Pairs)); }
+	FORCEINLINE friend TIterator      end  (      TFlatMap& Map) { return TIterator     (end  (Map.Pairs)); }
+	FORCEINLINE friend TConstIterator end  (const TFlatMap& Map) { return TConstIterator(end  (Map.Pairs)); }
+};
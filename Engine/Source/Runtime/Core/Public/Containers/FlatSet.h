@@ -0,0 +1,536 @@
+// Copyright 1998-2014 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	FlatSet.h: Open addressing set definitions.
+=============================================================================*/
+
+#pragma once
+
+/**
+ * A set that stores its elements directly in an open addressing hash table, using Robin Hood hashing.
+ *
+ * TSet keeps a separate array of hash buckets which chain through the elements of a sparse array, so a lookup
+ * has to touch at least two unrelated cache lines. Here, a lookup probes consecutive slots which hold a metadata
+ * byte, the element's full hash and the element itself.
+ *
+ * The metadata byte of a slot is zero for an empty slot, otherwise it is one more than the distance of the
+ * element from the slot its hash maps to (saturated, the exact distance can always be recovered from the hash).
+ * Insertion takes slots from elements that are closer to their ideal slot than the element being inserted, so
+ * a lookup can stop as soon as it finds an element closer to its ideal slot than the key would be. Removal
+ * shifts the following elements back, so there are no tombstones.
+ *
+ * Differences to TSet:
+ * - KeyFuncs must not allow duplicate keys.
+ * - Adding or removing an element may move other elements, so pointers to elements are only valid until the next change.
+ * - Elements are relocated with a memory copy, as in TArray.
+ * - Elements can't be removed while iterating, and the iteration order is not the order of addition.
+ */
+template<typename InElementType, typename KeyFuncs = DefaultKeyFuncs<InElementType> >
+class TFlatSet
+{
+public:
+	typedef InElementType ElementType;
+	typedef typename KeyFuncs::KeyInitType KeyInitType;
+
+	/** Default constructor. */
+	FORCEINLINE TFlatSet()
+		: Elements(NULL)
+		, Hashes(NULL)
+		, Metadata(NULL)
+		, Capacity(0)
+		, HashShift(0)
+		, NumElements(0)
+	{
+		checkAtCompileTime(!KeyFuncs::bAllowDuplicateKeys, TFlatSet_does_not_support_duplicate_keys);
+	}
+
+	/** Copy constructor. */
+	TFlatSet(const TFlatSet& Other)
+		: Elements(NULL)
+		, Hashes(NULL)
+		, Metadata(NULL)
+		, Capacity(0)
+		, HashShift(0)
+		, NumElements(0)
+	{
+		*this = Other;
+	}
+
+	/** Move constructor. */
+	TFlatSet(TFlatSet&& Other)
+		: Elements(NULL)
+		, Hashes(NULL)
+		, Metadata(NULL)
+		, Capacity(0)
+		, HashShift(0)
+		, NumElements(0)
+	{
+		*this = MoveTemp(Other);
+	}
+
+	/** Destructor. */
+	~TFlatSet()
+	{
+		Empty();
+	}
+
+	/** Assignment operator. */
+	TFlatSet& operator=(const TFlatSet& Other)
+	{
+		if (this != &Other)
+		{
+			Empty(Other.Num());
+			for (TConstIterator It(Other); It; ++It)
+			{
+				Add(*It);
+			}
+		}
+		return *this;
+	}
+
+	/** Move assignment operator. */
+	TFlatSet& operator=(TFlatSet&& Other)
+	{
+		if (this != &Other)
+		{
+			Empty();
+
+			Elements    = Other.Elements;
+			Hashes      = Other.Hashes;
+			Metadata    = Other.Metadata;
+			Capacity    = Other.Capacity;
+			HashShift   = Other.HashShift;
+			NumElements = Other.NumElements;
+
+			Other.Elements    = NULL;
+			Other.Hashes      = NULL;
+			Other.Metadata    = NULL;
+			Other.Capacity    = 0;
+			Other.HashShift   = 0;
+			Other.NumElements = 0;
+		}
+		return *this;
+	}
+
+	/**
+	 * Removes all elements from the set, potentially leaving space allocated for an expected number of elements about to be added.
+	 * @param ExpectedNumElements - The number of elements about to be added to the set.
+	 */
+	void Empty(int32 ExpectedNumElements = 0)
+	{
+		DestructElements();
+
+		const uint32 NewCapacity = ExpectedNumElements > 0 ? GetCapacityFor(ExpectedNumElements) : 0;
+		if (NewCapacity != Capacity)
+		{
+			FMemory::Free(Elements);
+			Allocate(NewCapacity);
+		}
+		else if (Capacity)
+		{
+			FMemory::Memzero(Metadata, Capacity);
+		}
+	}
+
+	/** Efficiently empties out the set but preserves all allocations and capacities. */
+	void Reset()
+	{
+		DestructElements();
+		if (Capacity)
+		{
+			FMemory::Memzero(Metadata, Capacity);
+		}
+	}
+
+	/** Preallocates enough memory to contain Number elements without rehashing. */
+	void Reserve(int32 Number)
+	{
+		if ((uint32)Number > GetMaxLoad(Capacity))
+		{
+			Rehash(GetCapacityFor(Number));
+		}
+	}
+
+	/** @return The number of elements in the set. */
+	FORCEINLINE int32 Num() const
+	{
+		return NumElements;
+	}
+
+	/** @return The amount of memory allocated by this container, in bytes. */
+	FORCEINLINE uint32 GetAllocatedSize() const
+	{
+		return Capacity * (sizeof(ElementType) + sizeof(uint32) + sizeof(uint8));
+	}
+
+	/**
+	 * Adds an element to the set, replacing an existing element with the same key.
+	 * @return A pointer to the element stored in the set, valid until the next change to the set.
+	 */
+	FORCEINLINE ElementType* Add(const ElementType&  InElement) { return Emplace(         InElement ); }
+	FORCEINLINE ElementType* Add(      ElementType&& InElement) { return Emplace(MoveTemp(InElement)); }
+
+	/**
+	 * Adds an element to the set, replacing an existing element with the same key.
+	 * @param Args - The argument(s) to be forwarded to the set element's constructor.
+	 * @return A pointer to the element stored in the set, valid until the next change to the set.
+	 */
+	template <typename ArgsType>
+	ElementType* Emplace(ArgsType&& Args)
+	{
+		TAlignedBytes<sizeof(ElementType),ALIGNOF(ElementType)> NewElementBytes;
+		ElementType& NewElement = *new(&NewElementBytes) ElementType(Forward<ArgsType>(Args));
+		const uint32 Hash = KeyFuncs::GetKeyHash(KeyFuncs::GetSetKey(NewElement));
+
+		const int32 ExistingIndex = FindIndex(KeyFuncs::GetSetKey(NewElement), Hash);
+		if (ExistingIndex != INDEX_NONE)
+		{
+			MoveByRelocate(Elements[ExistingIndex], NewElement);
+			return &Elements[ExistingIndex];
+		}
+
+		if ((uint32)NumElements + 1 > GetMaxLoad(Capacity))
+		{
+			Rehash(Capacity ? Capacity * 2 : (uint32)MinCapacity);
+		}
+		NumElements++;
+		return &Elements[InsertRelocated(NewElement, Hash)];
+	}
+
+	/**
+	 * Removes the element with the given key.
+	 * @return The number of elements removed.
+	 */
+	int32 Remove(KeyInitType Key)
+	{
+		const int32 Index = FindIndex(Key, KeyFuncs::GetKeyHash(Key));
+		if (Index == INDEX_NONE)
+		{
+			return 0;
+		}
+
+		RemoveAtIndex(Index);
+		return 1;
+	}
+
+	/**
+	 * Finds an element with the given key.
+	 * @return A pointer to the element, or NULL if the set doesn't contain the key. Valid until the next change to the set.
+	 */
+	FORCEINLINE ElementType* Find(KeyInitType Key)
+	{
+		const int32 Index = FindIndex(Key, KeyFuncs::GetKeyHash(Key));
+		return Index != INDEX_NONE ? &Elements[Index] : NULL;
+	}
+	FORCEINLINE const ElementType* Find(KeyInitType Key) const
+	{
+		return const_cast<TFlatSet*>(this)->Find(Key);
+	}
+
+	/** @return true if the set contains an element with the given key. */
+	FORCEINLINE bool Contains(KeyInitType Key) const
+	{
+		return FindIndex(Key, KeyFuncs::GetKeyHash(Key)) != INDEX_NONE;
+	}
+
+private:
+	/** The base type of set iterators. */
+	template<bool bConst>
+	class TBaseIterator
+	{
+	private:
+		typedef typename TChooseClass<bConst,const TFlatSet,TFlatSet>::Result SetType;
+		typedef typename TChooseClass<bConst,const ElementType,ElementType>::Result ItElementType;
+
+	public:
+		FORCEINLINE TBaseIterator(SetType& InSet, uint32 StartIndex)
+			: Set(InSet)
+			, Index(StartIndex)
+		{
+			SkipEmptySlots();
+		}
+
+		/** Advances the iterator to the next element. */
+		FORCEINLINE TBaseIterator& operator++()
+		{
+			++Index;
+			SkipEmptySlots();
+			return *this;
+		}
+
+		/** conversion to "bool" returning true if the iterator is valid. */
+		FORCEINLINE_EXPLICIT_OPERATOR_BOOL() const
+		{
+			return Index < Set.Capacity;
+		}
+		/** inverse of the "bool" operator */
+		FORCEINLINE bool operator !() const
+		{
+			return !(bool)*this;
+		}
+
+		// Accessors.
+		FORCEINLINE ItElementType* operator->() const
+		{
+			return &Set.Elements[Index];
+		}
+		FORCEINLINE ItElementType& operator*() const
+		{
+			return Set.Elements[Index];
+		}
+
+		FORCEINLINE friend bool operator==(const TBaseIterator& Lhs, const TBaseIterator& Rhs) { return &Lhs.Set == &Rhs.Set && Lhs.Index == Rhs.Index; }
+		FORCEINLINE friend bool operator!=(const TBaseIterator& Lhs, const TBaseIterator& Rhs) { return &Lhs.Set != &Rhs.Set || Lhs.Index != Rhs.Index; }
+
+	private:
+		FORCEINLINE void SkipEmptySlots()
+		{
+			while (Index < Set.Capacity && !Set.Metadata[Index])
+			{
+				++Index;
+			}
+		}
+
+		SetType& Set;
+		uint32 Index;
+	};
+
+public:
+	/** Used to iterate over the elements of a const TFlatSet. */
+	class TConstIterator : public TBaseIterator<true>
+	{
+	public:
+		FORCEINLINE explicit TConstIterator(const TFlatSet& InSet, uint32 StartIndex = 0)
+			: TBaseIterator<true>(InSet, StartIndex)
+		{
+		}
+	};
+
+	/** Used to iterate over the elements of a TFlatSet. */
+	class TIterator : public TBaseIterator<false>
+	{
+	public:
+		FORCEINLINE explicit TIterator(TFlatSet& InSet, uint32 StartIndex = 0)
+			: TBaseIterator<false>(InSet, StartIndex)
+		{
+		}
+	};
+
+	/** Creates an iterator for the contents of this set */
+	FORCEINLINE TIterator CreateIterator()
+	{
+		return TIterator(*this);
+	}
+
+	/** Creates a const iterator for the contents of this set */
+	FORCEINLINE TConstIterator CreateConstIterator() const
+	{
+		return TConstIterator(*this);
+	}
+
+	/**
+	 * DO NOT USE DIRECTLY
+	 * STL-like iterators to enable range-based for loop support.
+	 */
+	FORCEINLINE friend TIterator      begin(      TFlatSet& Set) { return TIterator     (Set); }
+	FORCEINLINE friend TConstIterator begin(const TFlatSet& Set) { return TConstIterator(Set); }
+	FORCEINLINE friend TIterator      end  (      TFlatSet& Set) { return TIterator     (Set, Set.Capacity); }
+	FORCEINLINE friend TConstIterator end  (const TFlatSet& Set) { return TConstIterator(Set, Set.Capacity); }
+
+private:
+	enum
+	{
+		/** Smallest number of slots allocated. */
+		MinCapacity = 8,
+
+		/** Metadata value of slots whose elements are at least this distance (minus one) from their ideal slot. */
+		MaxStoredDistance = 255
+	};
+
+	/** The elements, NULL if nothing is allocated. The hashes and metadata are stored in the same allocation. */
+	ElementType* Elements;
+
+	/** The hash of the element in each slot. */
+	uint32* Hashes;
+
+	/** The metadata byte of each slot, see the class description. */
+	uint8* Metadata;
+
+	/** The number of slots, zero or a power of two. */
+	uint32 Capacity;
+
+	/** The shift which maps a scrambled hash to a slot index. */
+	uint32 HashShift;
+
+	/** The number of elements in the set. */
+	int32 NumElements;
+
+	/** @return The number of elements that fit into the given number of slots. */
+	static FORCEINLINE uint32 GetMaxLoad(uint32 InCapacity)
+	{
+		return InCapacity - InCapacity / 8;
+	}
+
+	/** @return The number of slots needed to hold the given number of elements. */
+	static uint32 GetCapacityFor(int32 InNumElements)
+	{
+		return FMath::Max<uint32>(MinCapacity, FMath::RoundUpToPowerOfTwo((uint32)InNumElements + (uint32)InNumElements / 7 + 1));
+	}
+
+	/** @return The slot the given hash maps to. */
+	FORCEINLINE uint32 GetIdealIndex(uint32 Hash) const
+	{
+		// Fibonacci hashing, as many hash functions leave the low bits poorly distributed.
+		return (Hash * 0x9E3779B9u) >> HashShift;
+	}
+
+	/** @return The distance of the element in a non-empty slot from its ideal slot. */
+	FORCEINLINE uint32 GetDistance(uint32 Index) const
+	{
+		const uint8 Meta = Metadata[Index];
+		return Meta < MaxStoredDistance ? Meta - 1u : ((Index - GetIdealIndex(Hashes[Index])) & (Capacity - 1));
+	}
+
+	/** @return The metadata byte for an element at the given distance from its ideal slot. */
+	static FORCEINLINE uint8 EncodeDistance(uint32 Distance)
+	{
+		return (uint8)FMath::Min<uint32>(Distance + 1, MaxStoredDistance);
+	}
+
+	/** @return The slot index of the element with the given key, or INDEX_NONE. */
+	int32 FindIndex(KeyInitType Key, uint32 Hash) const
+	{
+		if (NumElements == 0)
+		{
+			return INDEX_NONE;
+		}
+
+		for (uint32 Index = GetIdealIndex(Hash), Distance = 0; ; Index = (Index + 1) & (Capacity - 1), ++Distance)
+		{
+			const uint8 Meta = Metadata[Index];
+			if (Meta == 0 || GetDistance(Index) < Distance)
+			{
+				// The key would have taken this slot if it were in the set.
+				return INDEX_NONE;
+			}
+
+			if (Hashes[Index] == Hash && KeyFuncs::Matches(KeyFuncs::GetSetKey(Elements[Index]), Key))
+			{
+				return Index;
+			}
+		}
+	}
+
+	/**
+	 * Relocates an element into the table, which must have a free slot.
+	 * @return The slot index the element ended up in.
+	 */
+	uint32 InsertRelocated(ElementType& InElement, uint32 Hash)
+	{
+		TAlignedBytes<sizeof(ElementType),ALIGNOF(ElementType)> CarriedBytes;
+		ElementType* Carried = (ElementType*)&CarriedBytes;
+		RelocateItems(Carried, &InElement, 1);
+
+		uint32 Result = Capacity;
+		for (uint32 Index = GetIdealIndex(Hash), Distance = 0; ; Index = (Index + 1) & (Capacity - 1), ++Distance)
+		{
+			if (Metadata[Index] == 0)
+			{
+				RelocateItems(&Elements[Index], Carried, 1);
+				Hashes[Index] = Hash;
+				Metadata[Index] = EncodeDistance(Distance);
+				return Result < Capacity ? Result : Index;
+			}
+
+			const uint32 SlotDistance = GetDistance(Index);
+			if (SlotDistance < Distance)
+			{
+				// Take the slot from the element closer to its ideal slot, and carry that one on.
+				FMemory::Memswap(&Elements[Index], Carried, sizeof(ElementType));
+				Exchange(Hashes[Index], Hash);
+				Metadata[Index] = EncodeDistance(Distance);
+				Distance = SlotDistance;
+
+				if (Result == Capacity)
+				{
+					Result = Index;
+				}
+			}
+		}
+	}
+
+	/** Removes the element in the given slot. */
+	void RemoveAtIndex(uint32 Index)
+	{
+		Elements[Index].~ElementType();
+		NumElements--;
+
+		// Shift the following elements back until one is in its ideal slot, so that lookups don't stop at the hole.
+		for (uint32 NextIndex = (Index + 1) & (Capacity - 1); Metadata[NextIndex] > 1; NextIndex = (NextIndex + 1) & (Capacity - 1))
+		{
+			RelocateItems(&Elements[Index], &Elements[NextIndex], 1);
+			Hashes[Index] = Hashes[NextIndex];
+			Metadata[Index] = EncodeDistance(GetDistance(NextIndex) - 1);
+			Index = NextIndex;
+		}
+		Metadata[Index] = 0;
+	}
+
+	/** Destructs all elements, leaving the metadata untouched. */
+	void DestructElements()
+	{
+		if (NumElements)
+		{
+			for (uint32 Index = 0; Index < Capacity; ++Index)
+			{
+				if (Metadata[Index])
+				{
+					Elements[Index].~ElementType();
+				}
+			}
+			NumElements = 0;
+		}
+	}
+
+	/** Allocates empty slots, without freeing the previous allocation. */
+	void Allocate(uint32 NewCapacity)
+	{
+		Capacity = NewCapacity;
+		if (Capacity)
+		{
+			uint8* Data = (uint8*)FMemory::Malloc(GetAllocatedSize(), ALIGNOF(ElementType));
+			Elements  = (ElementType*)Data;
+			Hashes    = (uint32*)(Data + Capacity * sizeof(ElementType));
+			Metadata  = (uint8*)(Hashes + Capacity);
+			HashShift = 32 - FMath::CeilLogTwo(Capacity);
+			FMemory::Memzero(Metadata, Capacity);
+		}
+		else
+		{
+			Elements  = NULL;
+			Hashes    = NULL;
+			Metadata  = NULL;
+			HashShift = 0;
+		}
+	}
+
+	/** Moves all elements into a table with the given number of slots. */
+	void Rehash(uint32 NewCapacity)
+	{
+		ElementType* OldElements = Elements;
+		uint32* OldHashes = Hashes;
+		uint8* OldMetadata = Metadata;
+		const uint32 OldCapacity = Capacity;
+
+		Allocate(NewCapacity);
+		for (uint32 Index = 0; Index < OldCapacity; ++Index)
+		{
+			if (OldMetadata[Index])
+			{
+				InsertRelocated(OldElements[Index], OldHashes[Index]);
+			}
+		}
+
+		FMemory::Free(OldElements);
+	}
+};
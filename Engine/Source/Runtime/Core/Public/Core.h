@@ -438,6 +438,7 @@ extern CORE_API double GBlueprintCompileTime;
 #include "Set.h"						// Set definitions.
 #include "Map.h"						// Dynamic map definitions.
 #include "MapBuilder.h"					// Builder template for maps.
+#include "FlatMap.h"					// Open addressing set and map definitions.
 #include "List.h"						// Dynamic list definitions.
 #include "ResourceArray.h"				// Resource array definitions.
 #include "RefCounting.h"				// Reference counting definitions.
@@ -58,6 +58,51 @@ public:
 };
 
 
+/** 
+ * Read only view of a region of a memory mapped file.
+ * The data stays valid until the region is deleted, which is also the only way to unmap it.
+ * A region holds its own mapping, so it may outlive the handle it was mapped from.
+**/
+class CORE_API IMappedFileRegion
+{
+public:
+	/** Destructor, unmaps the region **/
+	virtual ~IMappedFileRegion()
+	{
+	}
+
+	/** Return a pointer to the first byte of the region. **/
+	virtual const uint8*	GetMappedPtr() = 0;
+	/** Return the size of the region in bytes. **/
+	virtual int64			GetMappedSize() = 0;
+};
+
+
+/** 
+ * Handle to a file opened for memory mapping. 
+ * Regions mapped from a handle stay valid after the handle is deleted.
+**/
+class CORE_API IMappedFileHandle
+{
+public:
+	/** Destructor, also the only way to close the file handle **/
+	virtual ~IMappedFileHandle()
+	{
+	}
+
+	/** Return the total size of the file **/
+	virtual int64				GetFileSize() = 0;
+
+	/** 
+	 * Map a region of the file into memory.
+	 * @param Offset		Offset in the file of the first byte to map. Does not need to be aligned to a page.
+	 * @param BytesToMap	Number of bytes to map, clamped to the end of the file. Negative maps up to the end of the file.
+	 * @return				The mapped region, or NULL if the region could not be mapped. Delete it to unmap it.
+	**/
+	virtual IMappedFileRegion*	MapRegion(int64 Offset = 0, int64 BytesToMap = -1) = 0;
+};
+
+
 /**
 * File I/O Interface
 **/
@@ -208,6 +253,18 @@ public:
 	 */
 	virtual bool CopyDirectoryTree(const TCHAR* DestinationDirectory, const TCHAR* Source, bool bOverwriteAllExisting);
 
+	/**
+	 * Attempt to open a file for memory mapping. Mapped regions read the file data in place, without the allocation
+	 * and copy a read through OpenRead needs.
+	 * @param Filename		File to open.
+	 * @return				A handle to map regions from, or NULL if the file does not exist or this platform file
+	 *						(or the storage the file lives in) does not support mapping. Callers should fall back to OpenRead.
+	**/
+	virtual IMappedFileHandle* OpenMapped(const TCHAR* Filename)
+	{
+		return NULL;
+	}
+
 	/**
 	 * Converts passed in filename to use an absolute path (for reading).
 	 *
@@ -10,6 +10,11 @@
 	Globals.
 -----------------------------------------------------------------------------*/
 
+/** Whether memory released by FMemMark::Pop() is filled with a pattern to catch use after free. */
+#ifndef MEMSTACK_POISON_FREED_MEMORY
+	#define MEMSTACK_POISON_FREED_MEMORY (UE_BUILD_DEBUG)
+#endif
+
 // Enums for specifying memory allocation type.
 enum EMemZeroed {MEM_Zeroed=1};
 enum EMemOned   {MEM_Oned  =1};
@@ -18,6 +23,8 @@ enum EMemOned   {MEM_Oned  =1};
  * Simple linear-allocation memory stack.
  * Items are allocated via PushBytes() or the specialized operator new()s.
  * Items are freed en masse by using FMemMark to Pop() them.
+ * There is one stack per thread. The game thread keeps a mark for the duration of each frame,
+ * so scratch allocations that are not released by a nested mark are released at the end of the frame.
  **/
 class CORE_API FMemStack : public FThreadSingleton<FMemStack>
 {
@@ -60,8 +67,8 @@ public:
 		return Result;
 	}
 
-	/** Timer tick. Makes sure the memory stack is empty. */
-	void Tick() const;
+	/** Frame boundary, called by the game and rendering threads. Publishes and resets the high water mark. */
+	void Tick();
 
 	/** @return the number of bytes allocated for this FMemStack that are currently in use. */
 	int32 GetByteCount() const;
@@ -69,6 +76,12 @@ public:
 	/** @return the number of bytes allocated for this FMemStack that are currently unused and available. */
 	int32 GetUnusedByteCount() const;
 
+	/** @return the largest number of bytes held by chunks in use since the last Tick(). */
+	int32 GetPeakByteCount() const
+	{
+		return PeakChunkBytes;
+	}
+
 	// Returns true if the pointer was allocated using this allocator
 	bool ContainsPointer(const void* Pointer) const;
 
@@ -112,6 +125,12 @@ private:
 	/** The number of marks on this stack. */
 	int32 NumMarks;
 
+	/** The number of bytes held by the chunks in use. */
+	int32 UsedChunkBytes;
+
+	/** The high water mark of UsedChunkBytes since the last Tick(). */
+	int32 PeakChunkBytes;
+
 	/**
 	 * Allocate a new chunk of memory of at least MinSize size,
 	 * updates the memory stack's Chunks table and ActiveChunks counter.
@@ -120,6 +139,9 @@ private:
 
 	/** Frees the chunks above the specified chunk on the stack. */
 	void FreeChunks( FTaggedMemory* NewTopChunk );
+
+	/** Fills the memory above the specified position on the stack with a debug pattern. */
+	void PoisonAbove( FTaggedMemory* NewTopChunk, uint8* NewTop );
 };
 
 /*-----------------------------------------------------------------------------
@@ -290,6 +312,10 @@ public:
 			// Track the number of outstanding marks on the stack.
 			--Mem.NumMarks;
 
+#if MEMSTACK_POISON_FREED_MEMORY
+			Mem.PoisonAbove( SavedChunk, Top );
+#endif
+
 			// Unlock any new chunks that were allocated.
 			if( SavedChunk != Mem.TopChunk )
 			{
@@ -865,6 +865,26 @@ public:
 		ArIsFilterEditorOnly = InFilterEditorOnly;
 	}
 
+	/**
+	 * Indicates whether tagged properties are serialized without tags, relying on the property layout being the same when loading.
+	 *
+	 * @return true if the archive uses unversioned property serialization, false otherwise.
+	 */
+	virtual bool UseUnversionedPropertySerialization()
+	{
+		return ArUseUnversionedPropertySerialization;
+	}
+
+	/**
+	 * Sets whether tagged properties are serialized without tags. Only valid for cooked data loaded by the same build.
+	 *
+	 * @param bInUseUnversioned - Whether to use unversioned property serialization.
+	 */
+	virtual void SetUseUnversionedPropertySerialization(bool bInUseUnversioned)
+	{
+		ArUseUnversionedPropertySerialization = bInUseUnversioned;
+	}
+
 	/**
 	 * Indicates whether this archive is saving or loading game state
 	 *
@@ -1019,6 +1039,9 @@ public:
 	/** Whether editor only properties are being filtered from the archive (or has been filtered). */
 	bool ArIsFilterEditorOnly;
 
+	/** Whether tagged properties are serialized without tags (cooked packages only). */
+	bool ArUseUnversionedPropertySerialization;
+
 	/** Whether this archive is saving/loading game state */
 	bool ArIsSaveGame;
 
@@ -57,10 +57,14 @@ namespace FNameDefs
 #if !WITH_EDITORONLY_DATA
 	// Use a modest bucket count on consoles
 	static const uint32 NameHashBucketCount = 4096;
+	// Number of insertion locks the hash buckets are split between
+	static const uint32 NameHashShardCount = 16;
 #else
 	// On PC platform we use a large number of name hash buckets to accommodate the editor's
 	// use of FNames to store asset path and content tags
 	static const uint32 NameHashBucketCount = 65536;
+	// The editor creates names from many loading and DDC threads at once, so it uses more insertion locks
+	static const uint32 NameHashShardCount = 64;
 #endif
 }
 
@@ -256,36 +260,41 @@ class TStaticIndirectArrayThreadSafeRead
 	/** Static master table to chunks of pointers **/
 	ElementType** Chunks[ChunkTableSize];
 	/** Number of elements we currently have **/
-	int32 NumElements;
+	volatile int32 NumElements;
 	/** Number of chunks we currently have **/
-	int32 NumChunks;
+	volatile int32 NumChunks;
 
 	/**
 	 * Expands the array so that Element[Index] is allocated. New pointers are all zero.
+	 * Thread safe, several threads may expand the array at the same time.
 	 * @param Index The Index of an element we want to be sure is allocated
 	 **/
 	void ExpandChunksToIndex(int32 Index)
 	{
 		check(Index >= 0 && Index < MaxTotalElements);
 		int32 ChunkIndex = Index / ElementsPerChunk;
-		while (1)
+		for (int32 AddIndex = NumChunks; AddIndex <= ChunkIndex; AddIndex++)
 		{
-			if (ChunkIndex < NumChunks)
+			if (Chunks[AddIndex])
 			{
-				break;
+				continue;
 			}
-			// add a chunk, and make sure nobody else tries
-			ElementType*** Chunk = &Chunks[ChunkIndex];
+			// add a chunk, unless another thread beats us to it
+			ElementType*** Chunk = &Chunks[AddIndex];
 			ElementType** NewChunk = (ElementType**)FMemory::Malloc(sizeof(ElementType*) * ElementsPerChunk);
 			FMemory::Memzero(NewChunk, sizeof(ElementType*) * ElementsPerChunk);
 			if (FPlatformAtomics::InterlockedCompareExchangePointer((void**)Chunk, NewChunk, NULL))
 			{
-				// someone else beat us to the add, we don't support multiple concurrent adds
-				check(0)
+				FMemory::Free(NewChunk);
 			}
-			else
+		}
+		// raise the chunk count, chunks below it are all allocated now
+		while (1)
+		{
+			int32 OldNumChunks = NumChunks;
+			if (OldNumChunks > ChunkIndex || FPlatformAtomics::InterlockedCompareExchange(&NumChunks, ChunkIndex + 1, OldNumChunks) == OldNumChunks)
 			{
-				NumChunks++;
+				break;
 			}
 		}
 		check(ChunkIndex < NumChunks && Chunks[ChunkIndex]); // should have a valid pointer now
@@ -347,17 +356,20 @@ public:
 	 * Add more elements to the array
 	 * @param	NumToAdd	Number of elements to add
 	 * @return	the number of elements in the container before we did the add. In other words, the add index.
-	 * Not thread safe. This should only be called by one thread, but the other methods can be called while this is going on.
+	 * Thread safe. The chunks are allocated before the elements are claimed, so any index below Num() always has a chunk.
 	**/
 	int32 AddZeroed(int32 NumToAdd)
 	{
-		int32 Result = NumElements;
-		check(NumElements + NumToAdd <= MaxTotalElements);
-		ExpandChunksToIndex(NumElements + NumToAdd - 1);
-		check(Result == NumElements);
-		NumElements += NumToAdd;
-		FPlatformMisc::MemoryBarrier();
-		return Result;
+		while (1)
+		{
+			int32 Result = NumElements;
+			check(Result + NumToAdd <= MaxTotalElements);
+			ExpandChunksToIndex(Result + NumToAdd - 1);
+			if (FPlatformAtomics::InterlockedCompareExchange(&NumElements, Result + NumToAdd, Result) == Result)
+			{
+				return Result;
+			}
+		}
 	}
 	/** 
 	 * Return a naked pointer to the fundamental data structure for debug visualizers.
@@ -754,9 +766,6 @@ private:
 		Init(StringCast<WIDECHAR>(InName).Get(), InNumber, FindType, bSplitName, HardcodeIndex);
 	}
 
-	/** Singleton to retrieve the critical section. */
-	static FCriticalSection* GetCriticalSection();
-
 };
 
 template<> struct TIsZeroConstructType<class FName> { enum { Value = true }; };
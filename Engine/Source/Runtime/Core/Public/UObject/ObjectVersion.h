@@ -495,6 +495,8 @@ enum EUnrealEngineObjectUE4Version
 	VER_UE4_DISABLED_SCRIPT_LIMIT_BYTECODE,
 	// Made remote role private, exposed bReplicates
 	VER_UE4_PRIVATE_REMOTE_ROLE,
+	// Landscape heightfield collision stores simplified collision for distant components
+	VER_UE4_LANDSCAPE_SIMPLE_COLLISION,
 
 	// -----<new versions can be added before this line>-------------------------------------------------
 	// - this needs to be the last line (see note below)
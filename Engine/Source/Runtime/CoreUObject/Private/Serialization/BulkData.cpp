@@ -80,11 +80,7 @@ FUntypedBulkData::~FUntypedBulkData()
 {
 	check( LockStatus == LOCKSTATUS_Unlocked );
 	// Free memory.
-	if( bShouldFreeOnEmpty )
-	{
-		FMemory::Free( BulkData );
-	}
-	BulkData = NULL;
+	FreeBulkData();
 	
 #if WITH_EDITOR
 	// Detach from archive.
@@ -324,11 +320,7 @@ void FUntypedBulkData::GetCopy( void** Dest, bool bDiscardInternalCopy )
 			// single use bulk data.
 			if( bDiscardInternalCopy && (CanLoadFromDisk() || (BulkDataFlags & BULKDATA_SingleUse)) )
 			{
-				if( bShouldFreeOnEmpty )
-				{
-					FMemory::Free( BulkData );
-				}
-				BulkData = NULL;
+				FreeBulkData();
 			}
 		}
 		// Data isn't currently loaded so we need to load it from disk.
@@ -348,6 +340,8 @@ void FUntypedBulkData::GetCopy( void** Dest, bool bDiscardInternalCopy )
 			// also do this if the data is single use like e.g. when uploading texture data.
 			if( bDiscardInternalCopy && (CanLoadFromDisk()|| (BulkDataFlags & BULKDATA_SingleUse)) )
 			{
+				// The caller frees what we return, so a mapping can't be handed out as is.
+				CopyMappedBulkData();
 				*Dest = BulkData;
 				BulkData = NULL;
 			}
@@ -388,6 +382,9 @@ void* FUntypedBulkData::Lock( uint32 LockFlags )
 	{
 		LockStatus = LOCKSTATUS_ReadWriteLock;
 
+		// Mappings are read only.
+		CopyMappedBulkData();
+
 #if WITH_EDITOR
 		// We need to detach from the archive to not be able to clobber changes by serializing
 		// over them.
@@ -458,11 +455,7 @@ void FUntypedBulkData::Unlock() const
 	// Free pointer if we're guaranteed to only to access the data once.
 	if (BulkDataFlags & BULKDATA_SingleUse)
 	{
-		if (bShouldFreeOnEmpty)
-		{
-			FMemory::Free(mutable_this->BulkData);
-		}
-		mutable_this->BulkData = NULL;
+		mutable_this->FreeBulkData();
 	}
 }
 
@@ -484,11 +477,7 @@ void FUntypedBulkData::RemoveBulkData()
 	
 	// Resize to 0 elements.
 	ElementCount	= 0;
-	if( ShouldFreeOnEmpty() )
-	{
-		FMemory::Free( BulkData );
-	}
-	BulkData		= NULL;
+	FreeBulkData();
 }
 
 /**
@@ -496,8 +485,9 @@ void FUntypedBulkData::RemoveBulkData()
  */
 void FUntypedBulkData::ForceBulkDataResident()
 {
-	// Make sure bulk data is loaded.
+	// Make sure bulk data is loaded, without depending on the file staying around.
 	MakeSureBulkDataIsLoaded();
+	CopyMappedBulkData();
 
 #if WITH_EDITOR
 	// Detach from the archive 
@@ -586,6 +576,10 @@ void FUntypedBulkData::Serialize( FArchive& Ar, UObject* Owner, int32 Idx )
 
 				// Allocate bulk data.
 				check(bShouldFreeOnEmpty);
+				if( MappedRegion )
+				{
+					FreeBulkData();
+				}
 				BulkData = FMemory::Realloc( BulkData, GetBulkDataSize() );
 
 				// Deserialize bulk data.
@@ -685,6 +679,10 @@ void FUntypedBulkData::Serialize( FArchive& Ar, UObject* Owner, int32 Idx )
 			else
 			{
 				// memory for bulk data can come from preallocated GPU-accessible resource memory or default to system memory
+				if( MappedRegion )
+				{
+					FreeBulkData();
+				}
 				BulkData = GetBulkDataResourceMemory(Owner,Idx);
 				if( !BulkData )
 				{
@@ -851,6 +849,7 @@ void FUntypedBulkData::DetachFromArchive( FArchive* Ar, bool bEnsureBulkDataIsLo
 	if( bEnsureBulkDataIsLoaded )
 	{
 		MakeSureBulkDataIsLoaded();
+		CopyMappedBulkData();
 	}
 
 	// Detach from archive.
@@ -922,6 +921,7 @@ void FUntypedBulkData::InitializeMemberVariables()
 	BulkDataOffsetInFile		= INDEX_NONE;
 	BulkDataSizeOnDisk			= INDEX_NONE;
 	BulkData					= NULL;
+	MappedRegion				= NULL;
 	LockStatus					= LOCKSTATUS_Unlocked;
 	bShouldFreeOnEmpty			= true;
 	Linker						= NULL;
@@ -1042,8 +1042,8 @@ void FUntypedBulkData::SerializeBulkData( FArchive& Ar, void* Data )
  */
 void FUntypedBulkData::MakeSureBulkDataIsLoaded()
 {
-	// Nothing to do if data is already loaded.
-	if( !BulkData )
+	// Nothing to do if data is already loaded, or if it can be read in place from the file.
+	if( !BulkData && !(GetBulkDataSize() > 0 && MapBulkData()) )
 	{
 		// Allocate memory for bulk data.
 		BulkData = FMemory::Malloc( GetBulkDataSize() );
@@ -1106,18 +1106,124 @@ void FUntypedBulkData::LoadDataIntoMemory( void* Dest )
 	{
 		// load from the specied filename when the linker has been cleared
 		checkf( Filename != TEXT(""), TEXT( "Attempted to load bulk data without a proper filename." ) );
+
+		// Read the payload in place from a mapping of the file when the platform file supports it, this avoids
+		// opening a buffered reader and going through its intermediate buffer.
+		TAutoPtr<IMappedFileHandle> MappedFile( BulkDataSizeOnDisk > 0 ? FPlatformFileManager::Get().GetPlatformFile().OpenMapped( *Filename ) : NULL );
+		TAutoPtr<IMappedFileRegion> MappedRegion( MappedFile.IsValid() ? MappedFile->MapRegion( BulkDataOffsetInFile, BulkDataSizeOnDisk ) : NULL );
+		if( MappedRegion.IsValid() && MappedRegion->GetMappedSize() == BulkDataSizeOnDisk )
+		{
+			FBufferReader Ar( (void*)MappedRegion->GetMappedPtr(), MappedRegion->GetMappedSize(), false );
+			SerializeBulkData( Ar, Dest );
+		}
+		else
+		{
+			FArchive* Ar = IFileManager::Get().CreateFileReader(*Filename, FILEREAD_Silent);
+			checkf( Ar != NULL, TEXT( "Attempted to load bulk data from an invalid filename '%s'." ), *Filename );
 	
-		FArchive* Ar = IFileManager::Get().CreateFileReader(*Filename, FILEREAD_Silent);
-		checkf( Ar != NULL, TEXT( "Attempted to load bulk data from an invalid filename '%s'." ), *Filename );
-	
-		// Seek to the beginning of the bulk data in the file.
-		Ar->Seek( BulkDataOffsetInFile );
-		SerializeBulkData( *Ar, Dest );
-		delete Ar;
+			// Seek to the beginning of the bulk data in the file.
+			Ar->Seek( BulkDataOffsetInFile );
+			SerializeBulkData( *Ar, Dest );
+			delete Ar;
+		}
+	}
+#endif // WITH_EDITOR
+}
+
+/**
+ * Points the bulk data straight at a read only mapping of the payload in the package file, so loading
+ * needs neither an allocation nor a copy. Only possible for uncompressed payloads serialized in bulk.
+ *
+ * @return true if the bulk data now points into a mapping
+ */
+bool FUntypedBulkData::MapBulkData()
+{
+	check( !BulkData && !MappedRegion );
+
+	// Anything that has to be inflated or serialized an element at a time needs its own copy.
+	if( (BulkDataFlags & (BULKDATA_Unused|BULKDATA_SerializeCompressed|BULKDATA_ForceSingleElementSerialization)) || BulkDataSizeOnDisk != GetBulkDataSize() )
+	{
+		return false;
 	}
+
+	ULinkerLoad* LinkerLoad = NULL;
+#if WITH_EDITOR
+	// Editor builds only remember the archive they are attached to, the linker knows which file that is.
+	LinkerLoad = AttachedAr ? Linker : NULL;
+	const FString MappedFilename = LinkerLoad ? LinkerLoad->Filename : FString();
+#else
+	LinkerLoad = Linker.Get();
+	const FString MappedFilename = Filename;
 #endif // WITH_EDITOR
+	if( MappedFilename.IsEmpty() || (LinkerLoad && LinkerLoad->IsCompressed()) )
+	{
+		return false;
+	}
+
+	// Regions hold their own mapping, so the handle can go right away.
+	IMappedFileRegion* Region = NULL;
+	{
+		TAutoPtr<IMappedFileHandle> MappedFile( FPlatformFileManager::Get().GetPlatformFile().OpenMapped( *MappedFilename ) );
+		Region = MappedFile.IsValid() ? MappedFile->MapRegion( BulkDataOffsetInFile, BulkDataSizeOnDisk ) : NULL;
+	}
+	if( !Region )
+	{
+		return false;
+	}
+
+	// Derived classes decide on single element serialization from the version the payload was saved with.
+	FBufferReader RegionReader( (void*)Region->GetMappedPtr(), Region->GetMappedSize(), false );
+	if( LinkerLoad )
+	{
+		RegionReader.SetUE4Ver( LinkerLoad->UE4Ver() );
+		RegionReader.SetLicenseeUE4Ver( LinkerLoad->LicenseeUE4Ver() );
+	}
+
+	// Users of the data expect it as aligned as an allocation would be.
+	const uint8* MappedPtr = Region->GetMappedPtr();
+	if( Region->GetMappedSize() != BulkDataSizeOnDisk || Align( MappedPtr, 16 ) != MappedPtr || RequiresSingleElementSerialization( RegionReader ) )
+	{
+		delete Region;
+		return false;
+	}
+
+	MappedRegion	= Region;
+	BulkData		= (void*)MappedPtr;
+	return true;
 }
 
+/**
+ * Copies mapped bulk data into memory owned by the bulk data so it can be written to, reallocated or handed out.
+ */
+void FUntypedBulkData::CopyMappedBulkData()
+{
+	if( MappedRegion )
+	{
+		check( bShouldFreeOnEmpty );
+		void* OwnedData = FMemory::Malloc( GetBulkDataSize() );
+		FMemory::Memcpy( OwnedData, BulkData, GetBulkDataSize() );
+		delete MappedRegion;
+		MappedRegion	= NULL;
+		BulkData		= OwnedData;
+	}
+}
+
+/**
+ * Frees or unmaps the bulk data, depending on where it lives, and clears the pointer.
+ */
+void FUntypedBulkData::FreeBulkData()
+{
+	if( MappedRegion )
+	{
+		delete MappedRegion;
+		MappedRegion = NULL;
+	}
+	else if( bShouldFreeOnEmpty )
+	{
+		FMemory::Free( BulkData );
+	}
+	BulkData = NULL;
+}
 
 
 /*-----------------------------------------------------------------------------
@@ -350,6 +350,8 @@ UStruct::UStruct( EStaticConstructor, int32 InSize, EObjectFlags InFlags )
 ,	RefLink			( NULL )
 ,	DestructorLink	( NULL )
 , PostConstructLink( NULL )
+,	UnversionedSchemaHash( 0 )
+,	UnversionedSchemaNum( 0 )
 {
 }
 
@@ -363,6 +365,8 @@ UStruct::UStruct(const class FPostConstructInitializeProperties& PCIP, UStruct*
 ,	RefLink			( NULL )
 ,	DestructorLink	( NULL )
 , PostConstructLink( NULL )
+,	UnversionedSchemaHash( 0 )
+,	UnversionedSchemaNum( 0 )
 {
 }
 
@@ -390,6 +394,40 @@ void UStruct::StaticLink(bool bRelinkExistingProperties)
 	Link(ArDummy, bRelinkExistingProperties);
 }
 
+/**
+ * Whether the property is part of the layout used by unversioned property serialization. Unversioned packages are cooked
+ * with editor-only data filtered out and are never duplicated for PIE, so those properties can't be in the data.
+ */
+static FORCEINLINE bool IsInUnversionedSchema(UProperty* Property)
+{
+	return !Property->HasAnyPropertyFlags(CPF_Deprecated | CPF_NonPIETransient) && !Property->IsEditorOnlyProperty();
+}
+
+/** Adds anything about the property that changes how its value is serialized to the unversioned schema hash */
+static uint32 HashUnversionedSchemaProperty(UProperty* Property, uint32 Hash)
+{
+	Hash = FCrc::StrCrc32(*Property->GetName(), Hash);
+	Hash = FCrc::StrCrc32(*Property->GetID().ToString(), Hash);
+	Hash = FCrc::MemCrc32(&Property->ArrayDim, sizeof(Property->ArrayDim), Hash);
+
+	if (UArrayProperty* ArrayProperty = Cast<UArrayProperty>(Property))
+	{
+		Hash = HashUnversionedSchemaProperty(ArrayProperty->Inner, Hash);
+	}
+	else if (UStructProperty* StructProperty = Cast<UStructProperty>(Property))
+	{
+		Hash = FCrc::StrCrc32(*StructProperty->Struct->GetName(), Hash);
+	}
+	else if (UByteProperty* ByteProperty = Cast<UByteProperty>(Property))
+	{
+		// Enum values are written by name, plain bytes by value
+		const uint8 bHasEnum = ByteProperty->Enum != NULL;
+		Hash = FCrc::MemCrc32(&bHasEnum, sizeof(bHasEnum), Hash);
+	}
+
+	return Hash;
+}
+
 void UStruct::Link(FArchive& Ar, bool bRelinkExistingProperties)
 {
 	if (bRelinkExistingProperties)
@@ -538,10 +576,19 @@ void UStruct::Link(FArchive& Ar, bool bRelinkExistingProperties)
 	UProperty** RefLinkPtr = (UProperty**)&RefLink;
 	UProperty** PostConstructLinkPtr = &PostConstructLink;
 
+	UnversionedSchemaHash = 0;
+	UnversionedSchemaNum = 0;
+
 	for (TFieldIterator<UProperty> It(this); It; ++It)
 	{
 		UProperty* Property = *It;
 
+		if (IsInUnversionedSchema(Property))
+		{
+			UnversionedSchemaHash = HashUnversionedSchemaProperty(Property, UnversionedSchemaHash);
+			UnversionedSchemaNum += Property->ArrayDim;
+		}
+
 		if (Property->ContainsObjectReference() || Property->ContainsWeakObjectReference())
 		{
 			*RefLinkPtr = Property;
@@ -646,6 +693,12 @@ void UStruct::SerializeTaggedProperties(FArchive& Ar, uint8* Data, UStruct* Defa
 
 	check(Ar.IsLoading() || Ar.IsSaving());
 
+	if (Ar.UseUnversionedPropertySerialization())
+	{
+		SerializeUnversionedProperties(Ar, Data, DefaultsStruct, Defaults);
+		return;
+	}
+
 	UClass* DefaultsClass = Cast<UClass>(DefaultsStruct);
 	UScriptStruct* DefaultsScriptStruct = Cast<UScriptStruct>(DefaultsStruct);
 
@@ -1071,6 +1124,127 @@ void UStruct::SerializeTaggedProperties(FArchive& Ar, uint8* Data, UStruct* Defa
 		Ar << Temp;
 	}
 }
+
+void UStruct::SerializeUnversionedProperties(FArchive& Ar, uint8* Data, UStruct* DefaultsStruct, uint8* Defaults) const
+{
+	const int32 NumMaskWords = (UnversionedSchemaNum + 31) / 32;
+	TArray<uint32, TInlineAllocator<16> > Mask;
+	Mask.AddZeroed(NumMaskWords);
+
+	UProperty* OldSerializedProperty = GSerializedProperty;
+
+	if( Ar.IsLoading() )
+	{
+		uint32 SchemaHash = 0;
+		int32 BlockSize = 0;
+		Ar << SchemaHash;
+		Ar << BlockSize;
+
+		if( SchemaHash != UnversionedSchemaHash )
+		{
+			// Without tags there is no way to match up the values, so leave everything at its defaults
+			UE_LOG(LogClass, Warning, TEXT("Property layout of %s doesn't match the one it was cooked with, skipping its properties for package:  %s"), *GetName(), *Ar.GetArchiveName() );
+			Ar.Seek(Ar.Tell() + BlockSize);
+			return;
+		}
+
+		for( int32 WordIndex = 0; WordIndex < NumMaskWords; WordIndex++ )
+		{
+			Ar << Mask[WordIndex];
+		}
+
+		int32 ElementIndex = 0;
+		for( UProperty* Property = PropertyLink; Property; Property = Property->PropertyLinkNext )
+		{
+			if( !IsInUnversionedSchema(Property) )
+			{
+				continue;
+			}
+
+			for( int32 Idx = 0; Idx < Property->ArrayDim; Idx++, ElementIndex++ )
+			{
+				if( Mask[ElementIndex >> 5] & (1u << (ElementIndex & 31)) )
+				{
+					GSerializedProperty = Property;
+					Property->SerializeItem( Ar, Property->ContainerPtrToValuePtr<uint8>(Data, Idx), 0, NULL );
+				}
+			}
+		}
+	}
+	else
+	{
+		/** If true, it means that we want to serialize all properties of this struct if any properties differ from defaults */
+		UScriptStruct* DefaultsScriptStruct = Cast<UScriptStruct>(DefaultsStruct);
+		const bool bUseAtomicSerialization = DefaultsScriptStruct && DefaultsScriptStruct->ShouldSerializeAtomically(Ar);
+
+		// Work out which elements are written, using the same rules as tagged serialization. Atomic structs
+		// always write every member so they can't be partially overwritten by their defaults on load.
+		int32 ElementIndex = 0;
+		for( UProperty* Property = PropertyLink; Property; Property = Property->PropertyLinkNext )
+		{
+			if( !IsInUnversionedSchema(Property) )
+			{
+				continue;
+			}
+			if( !Property->ShouldSerializeValue(Ar) )
+			{
+				ElementIndex += Property->ArrayDim;
+				continue;
+			}
+
+			for( int32 Idx = 0; Idx < Property->ArrayDim; Idx++, ElementIndex++ )
+			{
+				uint8* DataPtr = Property->ContainerPtrToValuePtr<uint8>(Data, Idx);
+				uint8* DefaultValue = Property->ContainerPtrToValuePtrForDefaults<uint8>(DefaultsStruct, Defaults, Idx);
+				if( bUseAtomicSerialization || (!IsA(UClass::StaticClass()) && !Defaults) || !Ar.DoDelta() || 
+					!Property->Identical( DataPtr, DefaultValue, Ar.GetPortFlags()) || Ar.IsTransacting() )
+				{
+					Mask[ElementIndex >> 5] |= (1u << (ElementIndex & 31));
+				}
+			}
+		}
+
+		uint32 SchemaHash = UnversionedSchemaHash;
+		int32 BlockSize = 0;
+		Ar << SchemaHash;
+		const int64 BlockSizeOffset = Ar.Tell();
+		Ar << BlockSize;
+
+		for( int32 WordIndex = 0; WordIndex < NumMaskWords; WordIndex++ )
+		{
+			Ar << Mask[WordIndex];
+		}
+
+		ElementIndex = 0;
+		for( UProperty* Property = PropertyLink; Property; Property = Property->PropertyLinkNext )
+		{
+			if( !IsInUnversionedSchema(Property) )
+			{
+				continue;
+			}
+
+			for( int32 Idx = 0; Idx < Property->ArrayDim; Idx++, ElementIndex++ )
+			{
+				if( Mask[ElementIndex >> 5] & (1u << (ElementIndex & 31)) )
+				{
+					uint8* DefaultValue = bUseAtomicSerialization ? NULL : Property->ContainerPtrToValuePtrForDefaults<uint8>(DefaultsStruct, Defaults, Idx);
+					GSerializedProperty = Property;
+					Property->SerializeItem( Ar, Property->ContainerPtrToValuePtr<uint8>(Data, Idx), 0, DefaultValue );
+				}
+			}
+		}
+
+		// Go back and write the size of the block, so a mismatched layout can be skipped on load
+		const int64 EndOffset = Ar.Tell();
+		BlockSize = EndOffset - BlockSizeOffset - sizeof(int32);
+		Ar.Seek(BlockSizeOffset);
+		Ar << BlockSize;
+		Ar.Seek(EndOffset);
+	}
+
+	GSerializedProperty = OldSerializedProperty;
+}
+
 void UStruct::FinishDestroy()
 {
 	Script.Empty();
@@ -58,6 +58,7 @@ TMap<FName, FName> ULinkerLoad::GameNameRedirects;					// Game package name to n
 TMap<FName, FName> ULinkerLoad::StructNameRedirects;				// Old struct name to new struct name mapping
 TMap<FString, FString> ULinkerLoad::PluginNameRedirects;			// Old plugin name to new plugin name mapping
 TMap<FName, ULinkerLoad::FSubobjectRedirect> ULinkerLoad::SubobjectNameRedirects;	
+TMap<FName, FName> ULinkerLoad::NativizedClassRedirects;				// Generated class path to native class path
 
 /*----------------------------------------------------------------------------
 	Helpers
@@ -154,6 +155,27 @@ void ULinkerLoad::CreateActiveRedirectsMap(const FString& GEngineIniName)
 				PluginNameRedirects.Add(OldPluginName, NewPluginName);
 			}
 		}
+
+		// Cooked games have the code generated for nativized blueprints compiled into the game module, so references to
+		// their generated classes are redirected to the native classes instead of loading the bytecode ones
+		if( FPlatformProperties::RequiresCookedData() )
+		{
+			TArray<FString> NativizedBlueprints;
+			GConfig->GetArray( TEXT("Kismet"), TEXT("NativizedBlueprints"), NativizedBlueprints, GEngineIniName );
+			for( int32 BlueprintIndex = 0; BlueprintIndex < NativizedBlueprints.Num(); BlueprintIndex++ )
+			{
+				// "/Game/Blueprints/MyActor.MyActor" generates "/Game/Blueprints/MyActor.MyActor_C", which the game module declares as a native class
+				FString BlueprintPath = NativizedBlueprints[BlueprintIndex];
+				if( BlueprintPath.Find( TEXT(".") ) < 0 )
+				{
+					BlueprintPath = BlueprintPath + TEXT(".") + FPackageName::GetShortName( BlueprintPath );
+				}
+
+				const FString GeneratedClassPath = BlueprintPath + TEXT("_C");
+				const FString NativeClassPath = FString(TEXT("/Script/")) + FApp::GetGameName() + TEXT(".") + FPackageName::ObjectPathToObjectName( GeneratedClassPath );
+				NativizedClassRedirects.Add( *GeneratedClassPath, *NativeClassPath );
+			}
+		}
 	}
 	else
 	{
@@ -161,6 +183,19 @@ void ULinkerLoad::CreateActiveRedirectsMap(const FString& GEngineIniName)
 	}
 }
 
+FName* ULinkerLoad::FindNativizedClassRedirect(const FString& GeneratedClassPath)
+{
+	FName* NativeClassPath = NativizedClassRedirects.Find( *GeneratedClassPath );
+	if( NativeClassPath && FindObject<UClass>( NULL, *NativeClassPath->ToString() ) == NULL )
+	{
+		// keep loading the bytecode class, and only complain once
+		UE_LOG(LogLinker, Warning, TEXT("Nativized blueprint class %s has no native class %s, using the blueprint class"), *GeneratedClassPath, *NativeClassPath->ToString() );
+		NativizedClassRedirects.Remove( *GeneratedClassPath );
+		NativeClassPath = NULL;
+	}
+	return NativeClassPath;
+}
+
 /** Helper struct to keep track of the first time CreateImport() is called in the current callstack. */
 struct FScopedCreateImportCounter
 {
@@ -1129,8 +1164,11 @@ ULinkerLoad::ELinkerStatus ULinkerLoad::FixupImportMap()
 					}
 
 					static FName NAME_ScriptStruct(TEXT("ScriptStruct"));
+					static FName NAME_BlueprintGeneratedClass(TEXT("BlueprintGeneratedClass"));
 
-					bool bIsClass = Import.ClassName == NAME_Class;
+					// Generated classes of nativized blueprints are redirected to native classes like any other class
+					bool bIsBlueprintGeneratedClass = Import.ClassName == NAME_BlueprintGeneratedClass;
+					bool bIsClass = Import.ClassName == NAME_Class || bIsBlueprintGeneratedClass;
 					bool bIsStruct = Import.ClassName == NAME_ScriptStruct;
 					bool bIsEnum = Import.ClassName == NAME_Enum;
 					bool bIsClassOrStructOrEnum = bIsClass || bIsStruct || bIsEnum;
@@ -1138,6 +1176,19 @@ ULinkerLoad::ELinkerStatus ULinkerLoad::FixupImportMap()
 					FString RedirectName, ResultPackage, ResultClass;
 					FName* RedirectNameObj = ObjectNameRedirects.Find(Import.ObjectName);
 					FName* RedirectNameClass = ObjectNameRedirects.Find(Import.ClassName);
+
+					// Nativized blueprints are matched on their full path, as other packages may have generated classes of the same name
+					if ( NativizedClassRedirects.Num() > 0 )
+					{
+						if ( !RedirectNameObj && bIsBlueprintGeneratedClass )
+						{
+							RedirectNameObj = FindNativizedClassRedirect(GetImportPathName(i));
+						}
+						if ( !RedirectNameClass && !IsCoreUObjectPackage(Import.ClassPackage) && Import.ClassPackage != NAME_None )
+						{
+							RedirectNameClass = FindNativizedClassRedirect(Import.ClassPackage.ToString() + TEXT(".") + Import.ClassName.ToString());
+						}
+					}
 					int32 OldOuterIndex = 0;
 					if ( (RedirectNameObj && bIsClassOrStructOrEnum) || RedirectNameClass )
 					{
@@ -1249,6 +1300,13 @@ ULinkerLoad::ELinkerStatus ULinkerLoad::FixupImportMap()
 							Import.OldClassName = Import.ObjectName;
 #endif
 							Import.ObjectName = *ResultClass;							
+
+							// The native replacement is a plain UClass
+							if ( bIsBlueprintGeneratedClass )
+							{
+								Import.ClassName = NAME_Class;
+								Import.ClassPackage = GLongCoreUObjectPackageName;
+							}
 						}
 
 						// Default objects should be converted by name as well
@@ -118,6 +118,10 @@ FArchive& operator<<( FArchive& Ar, FPackageFileSummary& Sum )
 		{
 			Ar.SetFilterEditorOnly(true);
 		}
+		if( Sum.PackageFlags & PKG_UnversionedProperties )
+		{
+			Ar.SetUseUnversionedPropertySerialization(true);
+		}
 		Ar << Sum.NameCount     << Sum.NameOffset;
 		Ar << Sum.ExportCount   << Sum.ExportOffset;
 		Ar << Sum.ImportCount   << Sum.ImportOffset;
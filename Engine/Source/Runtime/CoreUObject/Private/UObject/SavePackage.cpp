@@ -2515,6 +2515,16 @@ bool UPackage::SavePackage( UPackage* InOuter, UObject* Base, EObjectFlags TopLe
 				Linker->SetFilterEditorOnly( FilterEditorOnly );
 				Linker->SetCookingTarget(TargetPlatform);
 
+				// Unversioned cooked packages are only loaded by the build they were cooked with, so the property layout
+				// is known on load and the property tags can be dropped as well
+				const bool bUnversionedProperties = bSaveUnversioned && FilterEditorOnly;
+				Linker->SetUseUnversionedPropertySerialization( bUnversionedProperties );
+				Linker->Summary.PackageFlags &= ~PKG_UnversionedProperties;
+				if ( bUnversionedProperties )
+				{
+					Linker->Summary.PackageFlags |= PKG_UnversionedProperties;
+				}
+
 				if ( EndSavingIfCancelled( Linker, TempFilename ) ) { return false; }
 				GWarn->UpdateProgress( ++CurSaveStep, TotalSaveSteps );
 			
@@ -3326,7 +3336,7 @@ bool UPackage::SavePackage( UPackage* InOuter, UObject* Base, EObjectFlags TopLe
 				Linker->LinkerRoot->ThisRequiresLocalizationGather(Linker->RequiresLocalizationGather());
 				
 				// Update package flags from package, in case serialization has modified package flags.
-				Linker->Summary.PackageFlags  = Linker->LinkerRoot->PackageFlags;
+				Linker->Summary.PackageFlags  = (Linker->LinkerRoot->PackageFlags & ~PKG_UnversionedProperties) | (bUnversionedProperties ? PKG_UnversionedProperties : 0);
 
 				Linker->Seek(0);
 				*Linker << Linker->Summary;
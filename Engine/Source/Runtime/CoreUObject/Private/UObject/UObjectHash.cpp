@@ -22,8 +22,45 @@ DEFINE_LOG_CATEGORY_STATIC(LogUObjectHash, Log, All);
 */
 #define OBJECT_HASH_BINS (1024*1024)
 
-static TMultiMap<int32,class UObjectBase*> ObjectHash;
-static TMultiMap<int32,class UObjectBase*> ObjectHashOuter;
+/**
+ * The number of stripes each hash table is split into. Every stripe has its own lock, so threads hashing or
+ * finding unrelated objects rarely wait on each other.
+ *
+ * NOTE: This must be power of 2 so that (size - 1) turns on all bits!
+ */
+#define OBJECT_HASH_STRIPES 64
+
+/**
+ * A hash table split into stripes that are locked independently. The stripe is picked from the hash of the
+ * key, so all the entries for one key live in the same stripe.
+ */
+template<typename MapType>
+class TObjectHashStripes
+{
+public:
+
+	struct FStripe
+	{
+		/** Guards Map. Lookups and modifications of the map must hold it for as long as they touch the map */
+		FCriticalSection Lock;
+
+		MapType Map;
+	};
+
+	FORCEINLINE FStripe& GetStripe(uint32 KeyHash)
+	{
+		return Stripes[KeyHash & (OBJECT_HASH_STRIPES - 1)];
+	}
+
+private:
+
+	FStripe Stripes[OBJECT_HASH_STRIPES];
+};
+
+typedef TMultiMap<int32,class UObjectBase*> FObjectHashMap;
+
+static TObjectHashStripes<FObjectHashMap> ObjectHash;
+static TObjectHashStripes<FObjectHashMap> ObjectHashOuter;
 
 /**
  * Calculates the object's hash just using the object's name index
@@ -64,7 +101,9 @@ UObject* StaticFindObjectFastExplicit( UClass* ObjectClass, FName ObjectName, co
 	checkSlow(FPackageName::IsShortPackageName(ObjectName)); //@Package name transition, we aren't checking the name here because we know this is only used for texture
 	// Find an object with the specified name and (optional) class, in any package; if bAnyPackage is false, only matches top-level packages
 	int32 Hash = GetObjectHash( ObjectName );
-	for(TMultiMap<int32,class UObjectBase*>::TConstKeyIterator HashIt(ObjectHash,Hash); HashIt; ++HashIt)
+	TObjectHashStripes<FObjectHashMap>::FStripe& Stripe = ObjectHash.GetStripe(Hash);
+	FScopeLock HashLock(&Stripe.Lock);
+	for(FObjectHashMap::TConstKeyIterator HashIt(Stripe.Map,Hash); HashIt; ++HashIt)
 	{
 		UObject *Object = (UObject *)HashIt.Value();
 		if
@@ -100,7 +139,9 @@ UObject* StaticFindObjectFastInternal( UClass* ObjectClass, UObject* ObjectPacka
 	if (ObjectPackage != NULL)
 	{
 		int32 Hash = GetObjectOuterHash( ObjectName, (PTRINT)ObjectPackage );
-		for(TMultiMap<int32,class UObjectBase*>::TConstKeyIterator HashIt(ObjectHashOuter,Hash); HashIt; ++HashIt)
+		TObjectHashStripes<FObjectHashMap>::FStripe& Stripe = ObjectHashOuter.GetStripe(Hash);
+		FScopeLock HashLock(&Stripe.Lock);
+		for(FObjectHashMap::TConstKeyIterator HashIt(Stripe.Map,Hash); HashIt; ++HashIt)
 		{
 			UObject *Object = (UObject *)HashIt.Value();
 			if
@@ -143,7 +184,9 @@ UObject* StaticFindObjectFastInternal( UClass* ObjectClass, UObject* ObjectPacka
 			ActualObjectName = FName(*ObjectNameString.Mid(DotIndex + 1));
 		}
 		const int32 Hash = GetObjectHash( ActualObjectName );
-		for(TMultiMap<int32,class UObjectBase*>::TConstKeyIterator HashIt(ObjectHash,Hash); HashIt; ++HashIt)
+		TObjectHashStripes<FObjectHashMap>::FStripe& Stripe = ObjectHash.GetStripe(Hash);
+		FScopeLock HashLock(&Stripe.Lock);
+		for(FObjectHashMap::TConstKeyIterator HashIt(Stripe.Map,Hash); HashIt; ++HashIt)
 		{
 			UObject *Object = (UObject *)HashIt.Value();
 			if
@@ -183,14 +226,23 @@ UObject* StaticFindObjectFastInternal( UClass* ObjectClass, UObject* ObjectPacka
 	return Result;
 }
 
+typedef TMap<const UObjectBase*, TSet<UObjectBase*> > FObjectOuterMap;
+typedef TMap<UClass*, TSet<UObjectBase*> > FClassToObjectListMap;
+
 /** Map of object to their outers, used to avoid an object iterator to find such things. **/
-static TMap<UObjectBase*, TSet<UObjectBase*> > ObjectOuterMap;
-static TMap<UClass*, TSet<UObjectBase*> > ClassToObjectListMap;
+static TObjectHashStripes<FObjectOuterMap> ObjectOuterMap;
+static TObjectHashStripes<FClassToObjectListMap> ClassToObjectListMap;
+
+/** Classes are only added and removed when classes are created or destroyed, so one lock is enough for the class tree */
 static TMap<UClass*, TSet<UClass*> > ClassToChildListMap;
+static FCriticalSection ClassToChildListLock;
 
 static void AddToOuterMap(UObjectBase* Object)
 {
-	TSet<UObjectBase*>& Inners = ObjectOuterMap.FindOrAdd(Object->GetOuter());
+	TObjectHashStripes<FObjectOuterMap>::FStripe& Stripe = ObjectOuterMap.GetStripe(PointerHash(Object->GetOuter()));
+	FScopeLock OuterMapLock(&Stripe.Lock);
+
+	TSet<UObjectBase*>& Inners = Stripe.Map.FindOrAdd(Object->GetOuter());
 	bool bIsAlreadyInSetPtr = false;
 	Inners.Add(Object, &bIsAlreadyInSetPtr);
 	check(!bIsAlreadyInSetPtr); // if it already exists, something is wrong with the external code
@@ -200,7 +252,10 @@ static void AddToClassMap(UObjectBase* Object)
 {
 	{
 		check(Object->GetClass());
-		TSet<UObjectBase*>& ObjectList = ClassToObjectListMap.FindOrAdd(Object->GetClass());
+		TObjectHashStripes<FClassToObjectListMap>::FStripe& Stripe = ClassToObjectListMap.GetStripe(PointerHash(Object->GetClass()));
+		FScopeLock ClassMapLock(&Stripe.Lock);
+
+		TSet<UObjectBase*>& ObjectList = Stripe.Map.FindOrAdd(Object->GetClass());
 		bool bIsAlreadyInSetPtr = false;
 		ObjectList.Add(Object, &bIsAlreadyInSetPtr);
 		check(!bIsAlreadyInSetPtr); // if it already exists, something is wrong with the external code
@@ -213,6 +268,8 @@ static void AddToClassMap(UObjectBase* Object)
 		UClass* SuperClass = Class->GetSuperClass();
 		if ( SuperClass )
 		{
+			FScopeLock ChildListLock(&ClassToChildListLock);
+
 			TSet<UClass*>& ChildList = ClassToChildListMap.FindOrAdd(SuperClass);
 			bool bIsAlreadyInSetPtr = false;
 			ChildList.Add(Class, &bIsAlreadyInSetPtr);
@@ -223,7 +280,10 @@ static void AddToClassMap(UObjectBase* Object)
 
 static void RemoveFromOuterMap(UObjectBase* Object)
 {
-	TSet<UObjectBase*>& Inners = ObjectOuterMap.FindOrAdd(Object->GetOuter());
+	TObjectHashStripes<FObjectOuterMap>::FStripe& Stripe = ObjectOuterMap.GetStripe(PointerHash(Object->GetOuter()));
+	FScopeLock OuterMapLock(&Stripe.Lock);
+
+	TSet<UObjectBase*>& Inners = Stripe.Map.FindOrAdd(Object->GetOuter());
 	int32 NumRemoved = Inners.Remove(Object);
     if (NumRemoved != 1)
 	{
@@ -232,7 +292,7 @@ static void RemoveFromOuterMap(UObjectBase* Object)
 	check(NumRemoved == 1); // must have existed, else something is wrong with the external code
 	if (!Inners.Num())
 	{
-		ObjectOuterMap.Remove(Object->GetOuter());
+		Stripe.Map.Remove(Object->GetOuter());
 	}
 }
 
@@ -241,7 +301,10 @@ static void RemoveFromClassMap(UObjectBase* Object)
 	UObjectBaseUtility* ObjectWithUtility = static_cast<UObjectBaseUtility*>(Object);
 
 	{
-		TSet<UObjectBase*>& ObjectList = ClassToObjectListMap.FindOrAdd(Object->GetClass());
+		TObjectHashStripes<FClassToObjectListMap>::FStripe& Stripe = ClassToObjectListMap.GetStripe(PointerHash(Object->GetClass()));
+		FScopeLock ClassMapLock(&Stripe.Lock);
+
+		TSet<UObjectBase*>& ObjectList = Stripe.Map.FindOrAdd(Object->GetClass());
 		int32 NumRemoved = ObjectList.Remove(Object);
 		if (NumRemoved != 1)
 		{
@@ -250,7 +313,7 @@ static void RemoveFromClassMap(UObjectBase* Object)
 		check(NumRemoved == 1); // must have existed, else something is wrong with the external code
 		if (!ObjectList.Num())
 		{
-			ClassToObjectListMap.Remove(Object->GetClass());
+			Stripe.Map.Remove(Object->GetClass());
 		}
 	}
 
@@ -261,6 +324,8 @@ static void RemoveFromClassMap(UObjectBase* Object)
 		if ( SuperClass )
 		{
 			// Remove the class from the SuperClass' child list
+			FScopeLock ChildListLock(&ClassToChildListLock);
+
 			TSet<UClass*>& ChildList = ClassToChildListMap.FindOrAdd(SuperClass);
 			int32 NumRemoved = ChildList.Remove(Class);
 			if (NumRemoved != 1)
@@ -276,16 +341,17 @@ static void RemoveFromClassMap(UObjectBase* Object)
 	}
 }
 
-void GetObjectsWithOuter(const class UObjectBase* Outer, TArray<UObject *>& Results, bool bIncludeNestedObjects, EObjectFlags ExclusionFlags)
+/**
+ * Adds the objects directly inside Outer to Results
+ *
+ * @return	true if Outer has any inners, including ones that were excluded
+ */
+static bool AddInnersToResults(const UObjectBase* Outer, TArray<UObject *>& Results, EObjectFlags ExclusionFlags)
 {
-	// We don't want to return any objects that are currently being background loaded unless we're using the object iterator during async loading.
-	ExclusionFlags |= RF_Unreachable;
-	if( !GIsAsyncLoading )
-	{
-		ExclusionFlags = EObjectFlags(ExclusionFlags | RF_AsyncLoading);
-	}
-	int32 StartNum = Results.Num();
-	TSet<UObjectBase*> const* Inners = ObjectOuterMap.Find(Outer);
+	TObjectHashStripes<FObjectOuterMap>::FStripe& Stripe = ObjectOuterMap.GetStripe(PointerHash(Outer));
+	FScopeLock OuterMapLock(&Stripe.Lock);
+
+	TSet<UObjectBase*> const* Inners = Stripe.Map.Find(Outer);
 	if (Inners)
 	{
 		for(TSet<UObjectBase*>::TConstIterator It(*Inners); It; ++It)
@@ -296,6 +362,21 @@ void GetObjectsWithOuter(const class UObjectBase* Outer, TArray<UObject *>& Resu
 				Results.Add(Object);
 			}
 		}
+	}
+	return Inners != NULL;
+}
+
+void GetObjectsWithOuter(const class UObjectBase* Outer, TArray<UObject *>& Results, bool bIncludeNestedObjects, EObjectFlags ExclusionFlags)
+{
+	// We don't want to return any objects that are currently being background loaded unless we're using the object iterator during async loading.
+	ExclusionFlags |= RF_Unreachable;
+	if( !GIsAsyncLoading )
+	{
+		ExclusionFlags = EObjectFlags(ExclusionFlags | RF_AsyncLoading);
+	}
+	int32 StartNum = Results.Num();
+	if (AddInnersToResults(Outer, Results, ExclusionFlags))
+	{
 		int32 MaxResults = GUObjectArray.GetObjectArrayNum();
 		while (StartNum != Results.Num() && bIncludeNestedObjects) 
 		{
@@ -304,18 +385,7 @@ void GetObjectsWithOuter(const class UObjectBase* Outer, TArray<UObject *>& Resu
 			StartNum = RangeEnd;
 			for (int32 Index = RangeStart; Index < RangeEnd; Index++)
 			{
-				TSet<UObjectBase*> const* InnerInners = ObjectOuterMap.Find(Results[Index]);
-				if (InnerInners)
-				{
-					for(TSet<UObjectBase*>::TConstIterator It(*InnerInners); It; ++It)
-					{
-						UObject *Object = static_cast<UObject *>(*It);
-						if (!Object->HasAnyFlags(ExclusionFlags))
-						{
-							Results.Add(Object);
-						}
-					}
-				}
+				AddInnersToResults(Results[Index], Results, ExclusionFlags);
 			}
 			check(Results.Num() <= MaxResults); // otherwise we have a cycle in the outer chain, which should not be possible
 		} 
@@ -338,7 +408,10 @@ UObjectBase* FindObjectWithOuter(class UObjectBase* Outer, class UClass* ClassTo
 	}
 
 	UObject *Result = NULL;
-	TSet<UObjectBase*> const* Inners = ObjectOuterMap.Find(Outer);
+	TObjectHashStripes<FObjectOuterMap>::FStripe& Stripe = ObjectOuterMap.GetStripe(PointerHash(Outer));
+	FScopeLock OuterMapLock(&Stripe.Lock);
+
+	TSet<UObjectBase*> const* Inners = Stripe.Map.Find(Outer);
 	if (Inners)
 	{
 
@@ -363,6 +436,8 @@ UObjectBase* FindObjectWithOuter(class UObjectBase* Outer, class UClass* ClassTo
 /** Helper function that returns all the children of the specified class recursively */
 static void RecursivelyPopulateDerivedClasses(UClass* ParentClass, TSet<UClass*>& OutAllDerivedClass)
 {
+	FScopeLock ChildListLock(&ClassToChildListLock);
+
 	TSet<UClass*>* ChildSet = ClassToChildListMap.Find(ParentClass);
 	if ( ChildSet )
 	{
@@ -398,7 +473,10 @@ void GetObjectsOfClass(UClass* ClassToLookFor, TArray<UObject *>& Results, bool
 	const int32 MaxResults = GUObjectArray.GetObjectArrayNum();
 	for ( auto ClassIt = ClassesToSearch.CreateConstIterator(); ClassIt; ++ClassIt )
 	{
-		TSet<UObjectBase*> const* List = ClassToObjectListMap.Find(*ClassIt);
+		TObjectHashStripes<FClassToObjectListMap>::FStripe& Stripe = ClassToObjectListMap.GetStripe(PointerHash(*ClassIt));
+		FScopeLock ClassMapLock(&Stripe.Lock);
+
+		TSet<UObjectBase*> const* List = Stripe.Map.Find(*ClassIt);
 
 		if ( List )
 		{
@@ -426,6 +504,8 @@ void GetDerivedClasses(UClass* ClassToLookFor, TArray<UClass *>& Results, bool b
 	}
 	else
 	{
+		FScopeLock ChildListLock(&ClassToChildListLock);
+
 		TSet<UClass*>* DerivedClasses = ClassToChildListMap.Find(ClassToLookFor);
 		if ( DerivedClasses )
 		{
@@ -448,12 +528,20 @@ void HashObject(UObjectBase* Object)
 	}
 
 	int32 Hash = GetObjectHash( Name );
-	checkSlow(!ObjectHash.FindPair(Hash,Object));  // if it already exists, something is wrong with the external code
-	ObjectHash.Add(Hash,Object);
+	{
+		TObjectHashStripes<FObjectHashMap>::FStripe& Stripe = ObjectHash.GetStripe(Hash);
+		FScopeLock HashLock(&Stripe.Lock);
+		checkSlow(!Stripe.Map.FindPair(Hash,Object));  // if it already exists, something is wrong with the external code
+		Stripe.Map.Add(Hash,Object);
+	}
 
 	Hash = GetObjectOuterHash(Name,(PTRINT)Object->GetOuter());
-	checkSlow(!ObjectHashOuter.FindPair(Hash,Object));  // if it already exists, something is wrong with the external code
-	ObjectHashOuter.Add(Hash,Object);
+	{
+		TObjectHashStripes<FObjectHashMap>::FStripe& Stripe = ObjectHashOuter.GetStripe(Hash);
+		FScopeLock HashLock(&Stripe.Lock);
+		checkSlow(!Stripe.Map.FindPair(Hash,Object));  // if it already exists, something is wrong with the external code
+		Stripe.Map.Add(Hash,Object);
+	}
 
 	AddToOuterMap(Object);
 	AddToClassMap(Object);
@@ -473,12 +561,20 @@ void UnhashObject(UObjectBase* Object)
 	}
 
 	int32 Hash = GetObjectHash( Name );
-	int32 NumRemoved = ObjectHash.RemoveSingle(Hash,Object);
-	check(NumRemoved == 1); // must have existed, else something is wrong with the external code
+	{
+		TObjectHashStripes<FObjectHashMap>::FStripe& Stripe = ObjectHash.GetStripe(Hash);
+		FScopeLock HashLock(&Stripe.Lock);
+		int32 NumRemoved = Stripe.Map.RemoveSingle(Hash,Object);
+		check(NumRemoved == 1); // must have existed, else something is wrong with the external code
+	}
 
 	Hash = GetObjectOuterHash(Name,(PTRINT)Object->GetOuter());
-	NumRemoved = ObjectHashOuter.RemoveSingle(Hash,Object);
-	check(NumRemoved == 1); // must have existed, else something is wrong with the external code
+	{
+		TObjectHashStripes<FObjectHashMap>::FStripe& Stripe = ObjectHashOuter.GetStripe(Hash);
+		FScopeLock HashLock(&Stripe.Lock);
+		int32 NumRemoved = Stripe.Map.RemoveSingle(Hash,Object);
+		check(NumRemoved == 1); // must have existed, else something is wrong with the external code
+	}
 
 	RemoveFromOuterMap(Object);
 	RemoveFromClassMap(Object);
@@ -362,6 +362,24 @@ private:
 	 */
 	void LoadDataIntoMemory( void* Dest );
 
+	/**
+	 * Points the bulk data straight at a read only mapping of the payload in the package file, so loading
+	 * needs neither an allocation nor a copy. Only possible for uncompressed payloads serialized in bulk.
+	 *
+	 * @return true if the bulk data now points into a mapping
+	 */
+	bool MapBulkData();
+
+	/**
+	 * Copies mapped bulk data into memory owned by the bulk data so it can be written to, reallocated or handed out.
+	 */
+	void CopyMappedBulkData();
+
+	/**
+	 * Frees or unmaps the bulk data, depending on where it lives, and clears the pointer.
+	 */
+	void FreeBulkData();
+
 	/*-----------------------------------------------------------------------------
 		Member variables.
 	-----------------------------------------------------------------------------*/
@@ -377,6 +395,8 @@ private:
 
 	/** Pointer to cached bulk data																						*/
 	void*				BulkData;
+	/** Mapping BulkData points into when the payload is read in place, NULL if BulkData is allocated memory			*/
+	IMappedFileRegion*	MappedRegion;
 	/** Current lock status																								*/
 	uint32				LockStatus;
 	
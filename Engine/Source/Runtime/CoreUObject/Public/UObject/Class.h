@@ -218,6 +218,11 @@ public:
 	/** In memory only: Linked list of properties requiring post constructor initialization.**/
 	UProperty* PostConstructLink;
 
+	/** In memory only: Hash of the property layout used by unversioned property serialization **/
+	uint32 UnversionedSchemaHash;
+	/** In memory only: Number of property elements (properties times their array dimension) in the unversioned layout **/
+	int32 UnversionedSchemaNum;
+
 	/** Array of object references embedded in script code. Mirrored for easy access by realtime garbage collection code */
 	TArray<UObject*> ScriptObjectReferences;
 
@@ -273,6 +278,15 @@ public:
 
 	void SerializeTaggedProperties( FArchive& Ar, uint8* Data, UStruct* DefaultsStruct, uint8* Defaults ) const;
 
+private:
+	/**
+	 * Serializes the properties without tags, as a schema hash, a bitmask of the property elements that were written and their values.
+	 * Used by cooked packages, where the property layout on load is known to match the one that was saved.
+	 */
+	void SerializeUnversionedProperties( FArchive& Ar, uint8* Data, UStruct* DefaultsStruct, uint8* Defaults ) const;
+
+public:
+
 	virtual EExprToken SerializeExpr(int32& iCode, FArchive& Ar);
 	virtual void TagSubobjects(EObjectFlags NewFlags) OVERRIDE;
 
@@ -1202,6 +1202,16 @@ public:
 		}
 	};
 	static TMap<FName, FSubobjectRedirect> SubobjectNameRedirects;	
+	/** Generated class path of a nativized blueprint to the path of the native class replacing it in cooked games */
+	static TMap<FName, FName> NativizedClassRedirects;
+
+	/**
+	 * Finds the native class that replaces a nativized blueprint's generated class.
+	 *
+	 * @param GeneratedClassPath	full path of the blueprint generated class, e.g. /Game/Blueprints/MyActor.MyActor_C
+	 * @return the path of the native class, or NULL if the class is not nativized or its native class was not compiled in
+	 */
+	static FName* FindNativizedClassRedirect(const FString& GeneratedClassPath);
 
 private:
 	// Variables used during async linker creation.
@@ -60,6 +60,19 @@ struct FVelocityAvoidanceCone
 	FPlane ConePlane[2];			//Left and right cone planes - these should point in toward each other. Technically, this is a convex hull, it's just unbounded.
 };
 
+/** Single entry of a batched avoidance request, see UAvoidanceManager::GetAvoidanceVelocitiesForBatch */
+struct FNavAvoidanceBatchQuery
+{
+	/** Current data of the querying agent */
+	FNavAvoidanceData AvoidanceData;
+
+	/** UID of the querying agent, it will not avoid itself. INDEX_NONE if the agent isn't registered. */
+	int32 IgnoreThisUID;
+
+	FNavAvoidanceBatchQuery() : IgnoreThisUID(INDEX_NONE) {}
+	FNavAvoidanceBatchQuery(const FNavAvoidanceData& InAvoidanceData, int32 InIgnoreThisUID) : AvoidanceData(InAvoidanceData), IgnoreThisUID(InIgnoreThisUID) {}
+};
+
 UCLASS(config=Engine, Blueprintable)
 class ENGINE_API UAvoidanceManager : public UObject, public FSelfRegisteringExec
 {
@@ -93,6 +106,14 @@ class ENGINE_API UAvoidanceManager : public UObject, public FSelfRegisteringExec
 	UPROPERTY(EditAnywhere, Category="Avoidance", config, meta=(ClampMin = "0.0"))
 	float TestHeightDifference;
 
+	/** Size of the spatial hash cells used to find nearby obstacles. If zero, TestRadius2D is used. */
+	UPROPERTY(EditAnywhere, Category="Avoidance", config, meta=(ClampMin = "0.0"))
+	float GridCellSize;
+
+	/** Number of agents processed by a single task graph task in GetAvoidanceVelocitiesForBatch. Smaller batches are processed on the calling thread. */
+	UPROPERTY(EditAnywhere, Category="Avoidance", config, meta=(ClampMin = "1"))
+	int32 AgentsPerBatchTask;
+
 	/** Get the number of avoidance objects currently in the manager. */
 	UFUNCTION(BlueprintCallable, Category="AI")
 	int32 GetObjectCount();
@@ -119,6 +140,17 @@ class ENGINE_API UAvoidanceManager : public UObject, public FSelfRegisteringExec
 	UFUNCTION(BlueprintCallable, Category="AI")
 	FVector GetAvoidanceVelocity(const FNavAvoidanceData& AvoidanceData, float DeltaTime);
 
+	/** 
+	 * Computes avoidance velocities for many agents at once, spreading the work across task graph worker threads.
+	 * Results match calling GetAvoidanceVelocityIgnoringUID for every query in turn, regardless of how the work was split.
+	 * Must be called from the game thread, and nothing may update the avoidance data until it returns.
+	 *
+	 * @param Queries		agents to compute velocities for
+	 * @param DeltaTime		prediction time, same as for GetAvoidanceVelocity
+	 * @param OutVelocities	receives one velocity per query, in the same order
+	 */
+	void GetAvoidanceVelocitiesForBatch(const TArray<FNavAvoidanceBatchQuery>& Queries, float DeltaTime, TArray<FVector>& OutVelocities);
+
 	/** Inform the avoidance manager of your current information, using the ID you were given as a key. */
 	void UpdateRVO(int32 AvoidanceUID, FVector Center, float Radius, float Height, FVector Velocity, float Weight = 0.5f, int32 GroupMask = 1, int32 AvoidMask = 0xFFFFFFFF, int32 IgnoreMask = 0);
 
@@ -144,6 +176,8 @@ class ENGINE_API UAvoidanceManager : public UObject, public FSelfRegisteringExec
 
 private:
 
+	friend struct FAvoidanceBatchTask;
+
 	/** Cleanup AvoidanceObjects, called by timer */
 	void RemoveOutdatedObjects();
 
@@ -156,6 +190,28 @@ private:
 	/** This is called by our blueprint-accessible functions, and permits the user to ignore self, or not. Important in case the user isn't in the avoidance manager. */
 	FVector GetAvoidanceVelocity_Internal(const FNavAvoidanceData& AvoidanceData, float DeltaTime, int32 *IgnoreThisUID = NULL);
 
+	/** 
+	 * Does the actual RVO work for a single agent. Only reads shared state, so it can run on any thread as long as AvoidanceObjects
+	 * and the grid are not modified at the same time. All scratch memory is provided by the caller.
+	 */
+	FVector ComputeAvoidanceVelocity(const FNavAvoidanceData& AvoidanceData, float DeltaTime, const int32* IgnoreThisUID, float CurrentTime,
+		TArray<FVelocityAvoidanceCone>& Cones, TArray<int32>& NeighborUIDs) const;
+
+	/** Runs ComputeAvoidanceVelocity for a contiguous range of batched queries, using local scratch memory */
+	void ComputeAvoidanceVelocityRange(const FNavAvoidanceBatchQuery* Queries, FVector* OutVelocities, int32 NumQueries, float DeltaTime, float CurrentTime) const;
+
+	/** Gathers UIDs of all objects that may be within Radius (2D) of Center, sorted so results don't depend on grid layout */
+	void GatherNeighbors(const FVector& Center, float Radius, TArray<int32>& OutUIDs) const;
+
+	/** Rebuilds the spatial hash if it hasn't been built this frame yet */
+	void UpdateAvoidanceGrid();
+
+	/** Returns grid cell containing given location */
+	FORCEINLINE FIntPoint GetGridCell(const FVector& Location) const
+	{
+		return FIntPoint(FMath::Floor(Location.X / GridCellSizeInUse), FMath::Floor(Location.Y / GridCellSizeInUse));
+	}
+
 	/** All objects currently part of the avoidance solution. This is pretty transient stuff. */
 	TMap<int32, FNavAvoidanceData> AvoidanceObjects;
 
@@ -165,6 +221,27 @@ private:
 	/** Keeping this here to avoid constant allocation */
 	TArray<FVelocityAvoidanceCone> AllCones;
 
+	/** Same as AllCones, scratch list of obstacles found in the grid */
+	TArray<int32> NeighborUIDs;
+
+	/** Uniform 2D spatial hash of AvoidanceObjects, rebuilt once per frame and kept up to date by UpdateRVO */
+	TMap<FIntPoint, TArray<int32> > AvoidanceGrid;
+
+	/** Cell size used when AvoidanceGrid was built */
+	float GridCellSizeInUse;
+
+	/** Largest radius of any object in the grid, bounds neighbor queries */
+	float GridMaxRadius;
+
+	/** Largest 2D speed of any object in the grid, bounds neighbor queries */
+	float GridMaxSpeed2D;
+
+	/** Value of GFrameCounter when AvoidanceGrid was built */
+	uint64 GridFrameNumber;
+
+	/** set when AvoidanceGrid holds valid data */
+	uint32 bGridValid : 1;
+
 	/** set when RemoveOutdatedObjects timer is already requested */
 	uint32 bRequestedUpdateTimer : 1;
 
@@ -0,0 +1,59 @@
+// Copyright 1998-2014 Epic Games, Inc. All Rights Reserved.
+#pragma once
+
+#include "HierarchicalInstancedStaticMeshComponent.generated.h"
+
+/** A node of the cluster tree built over the instances of a hierarchical instanced static mesh component */
+struct FInstanceClusterNode
+{
+	/** Bounds of all the instances below the node */
+	FVector BoundMin;
+	FVector BoundMax;
+
+	/** Range of child nodes, INDEX_NONE for leaves */
+	int32 FirstChild;
+	int32 LastChild;
+
+	/** Range of SortedInstances covered by the node, inclusive */
+	int32 FirstInstance;
+	int32 LastInstance;
+
+	FInstanceClusterNode(int32 InFirstInstance, int32 InLastInstance)
+		: BoundMin(FVector::ZeroVector)
+		, BoundMax(FVector::ZeroVector)
+		, FirstChild(INDEX_NONE)
+		, LastChild(INDEX_NONE)
+		, FirstInstance(InFirstInstance)
+		, LastInstance(InLastInstance)
+	{
+	}
+};
+
+/**
+ * An instanced static mesh that keeps its instances in a cluster tree, so that clusters of instances
+ * can be culled and pick their LOD independently of each other. Suited to large numbers of instances
+ * spread over a big area, such as foliage.
+ */
+UCLASS(HeaderGroup=Component, ClassGroup=Rendering, meta=(BlueprintSpawnableComponent), MinimalAPI)
+class UHierarchicalInstancedStaticMeshComponent : public UInstancedStaticMeshComponent
+{
+	GENERATED_UCLASS_BODY()
+
+	/** Largest number of instances in a cluster. Smaller clusters are culled more tightly, but need more draw calls */
+	UPROPERTY(EditAnywhere, AdvancedDisplay, Category=Culling, meta=(ClampMin=1, UIMin=1))
+	int32 MaxInstancesPerLeaf;
+
+	/** The cluster tree in component space, the root is the first node. Rebuilt whenever the scene proxy is created. */
+	TArray<FInstanceClusterNode> ClusterTree;
+
+	/** Instance indices in tree order, each node of the tree covers a contiguous range of this array */
+	TArray<int32> SortedInstances;
+
+	// Begin UPrimitiveComponent Interface
+	virtual FPrimitiveSceneProxy* CreateSceneProxy() OVERRIDE;
+	// End UPrimitiveComponent Interface
+
+	/** Rebuilds the cluster tree from the current instances */
+	ENGINE_API void BuildTree();
+};
+
@@ -53,6 +53,7 @@ enum EMoveComponentFlags
 	MOVECOMP_NoFlags					= 0x0000,	// no flags
 	MOVECOMP_IgnoreBases				= 0x0001,	// ignore collisions with things the Actor is based on
 	MOVECOMP_SkipPhysicsMove			= 0x0002,	// when moving this component, do not move the physics representation. Used internally to avoid looping updates when syncing with physics.
+	MOVECOMP_SkipOverlapUpdate			= 0x0004,	// do not update overlaps after a non-swept move. The caller is responsible for calling UpdateOverlaps() afterwards. Used to batch overlap updates when syncing with physics.
 };
 
 FORCEINLINE EMoveComponentFlags operator|(EMoveComponentFlags Arg1,EMoveComponentFlags Arg2)	{ return EMoveComponentFlags(uint32(Arg1) | uint32(Arg2)); }
@@ -154,6 +154,17 @@ public:
 	/** If false, this tick will run on the game thread, otherwise it will run on any thread in parallel with the game thread and in parallel with other "async ticks" **/
 	uint32 bRunOnAnyThread:1;
 
+	/** If true, the tick manager's significance callback may stretch TickInterval, see FTickTaskManagerInterface::SetTickSignificanceDelegate **/
+	UPROPERTY()
+	uint32 bAllowIntervalScaling:1;
+
+	/** 
+	 * Seconds between ticks, 0 ticks every frame. A tick that skips frames is passed all the time that went by since it last ran.
+	 * Ticks that skip a frame don't hold up the tick functions that have them as a prerequisite.
+	 **/
+	UPROPERTY()
+	float TickInterval;
+
 private:
 	/** If true, means that this tick function is in the master array of tick functions **/
 	uint32 bRegistered:1;
@@ -170,6 +181,12 @@ private:
 	/** Internal data to track if we have finshed visiting this tick function yet this frame **/
 	int32 TickQueuedGFrameCounter;
 
+	/** Time left until the next tick, when ticking at an interval **/
+	float TimeUntilNextTick;
+
+	/** Frame time that went by since the last tick, handed to the next one **/
+	float AccumulatedDeltaSeconds;
+
 protected:
 	/** Internal data that indicates the tick group we actually executed in (it may have been delayed due to prerequisites) **/
 	TEnumAsByte<enum ETickingGroup> ActualTickGroup;
@@ -210,6 +227,12 @@ public:
 	/** Returns whether the tick function is currently enabled */
 	bool IsTickFunctionEnabled() const { return bTickEnabled; }
 
+	/** Object this function ticks, for the tick significance callback. NULL if there isn't a single one. **/
+	virtual class UObject* GetTickTarget() const
+	{
+		return NULL;
+	}
+
 	/**
 	* Gets the current completion handle of this tick function, so it can be delayed until a later point when some additional
 	* tasks have been completed.  Only valid after TG_PreAsyncWork has started and then only until the TickFunction itself has
@@ -288,6 +311,13 @@ private:
 		check(0); // you cannot make this pure virtual in script because it wants to create constructors.
 		return FString(TEXT("invalid"));
 	}
+
+	/**
+	 * Counts down the tick interval and accumulates frame time for ticks that don't run every frame.
+	 * @param TickContext - context to tick in
+	 * @return true if the tick is due this frame
+	 */
+	bool UpdateTickInterval(const struct FTickContext& TickContext);
 	
 	friend class FTickTaskSequencer;
 	friend class FTickTaskManager;
@@ -315,6 +345,8 @@ struct FActorTickFunction : public FTickFunction
 	ENGINE_API virtual void ExecuteTick(float DeltaTime, enum ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) OVERRIDE;
 	/** Abstract function to describe this tick. Used to print messages about illegal cycles in the dependency graph **/
 	ENGINE_API virtual FString DiagnosticMessage();
+	/** Object this function ticks, passed on to the tick significance callback **/
+	ENGINE_API virtual class UObject* GetTickTarget() const OVERRIDE;
 };
 
 /** 
@@ -338,6 +370,8 @@ struct FActorComponentTickFunction : public FTickFunction
 	virtual void ExecuteTick(float DeltaTime, enum ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) OVERRIDE;
 	/** Abstract function to describe this tick. Used to print messages about illegal cycles in the dependency graph **/
 	virtual FString DiagnosticMessage();
+	/** Object this function ticks, passed on to the tick significance callback **/
+	virtual class UObject* GetTickTarget() const OVERRIDE;
 };
 
 /** 
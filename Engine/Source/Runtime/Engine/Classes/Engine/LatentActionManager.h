@@ -34,6 +34,14 @@ struct ENGINE_API FLatentActionInfo
 		, CallbackTarget(NULL)
 	{
 	}
+
+	FLatentActionInfo(int32 InLinkage, int32 InUUID, const TCHAR* InFunctionName, UObject* InCallbackTarget)
+		: Linkage(InLinkage)
+		, UUID(InUUID)
+		, ExecutionFunction(InFunctionName)
+		, CallbackTarget(InCallbackTarget)
+	{
+	}
 };
 
 
@@ -20,9 +20,20 @@ class UNiagaraScript : public UObject
 	/** Attributes used by this script. */
 	TArray<FName> Attributes;
 
+	/** ByteCode translated to native code, used in place of the interpreter when it could be built. */
+	class FVectorVMNativeProgram* NativeProgram;
+
 #if WITH_EDITORONLY_DATA
 	/** 'Source' data/graphs for this script */
 	UPROPERTY()
 	class UNiagaraScriptSourceBase*	Source;
 #endif
+
+	// Begin UObject interface
+	virtual void PostLoad() OVERRIDE;
+	virtual void FinishDestroy() OVERRIDE;
+	// End UObject interface
+
+	/** Rebuilds NativeProgram from ByteCode, needs calling whenever ByteCode changes. */
+	ENGINE_API void BuildNativeProgram();
 };
\ No newline at end of file
@@ -32,6 +32,10 @@ class ULandscapeHeightfieldCollisionComponent : public UPrimitiveComponent
 	UPROPERTY()
 	float CollisionScale;
 
+	/** Size of component in simplified collision quads, 0 if there is no simplified collision */
+	UPROPERTY()
+	int32 SimpleCollisionSizeQuads;
+
 	/** The flags for each collision quad. See ECollisionQuadFlags. */
 	UPROPERTY()
 	TArray<uint8> CollisionQuadFlags;
@@ -91,6 +95,24 @@ class ULandscapeHeightfieldCollisionComponent : public UPrimitiveComponent
 	/** Indices into the ComponentLayers array for the per-vertex dominant layer. */
 	FByteBulkData								DominantLayerData;
 
+	/** The height values of the simplified collision used while the component is far from any viewer. */
+	FWordBulkData								SimpleCollisionHeightData;
+
+	/** Per-vertex dominant layer of the simplified collision. */
+	FByteBulkData								SimpleDominantLayerData;
+
+	/** Full resolution height values read in by the collision streaming, used in place of CollisionHeightData */
+	TArray<uint16>								StreamedCollisionHeights;
+
+	/** Full resolution dominant layers read in by the collision streaming, used in place of DominantLayerData */
+	TArray<uint8>								StreamedDominantLayers;
+
+	/** Number of reads into the streamed data still in flight */
+	FThreadSafeCounter							PendingCollisionStreamingRequests;
+
+	/** True while the physics state is built from the simplified collision data */
+	uint32										bSimpleCollisionActive:1;
+
 	/** Physics engine version of heightfield data. */
 	TRefCountPtr<struct FPhysXHeightfieldRef>	HeightfieldRef;
 
@@ -123,6 +145,7 @@ class ULandscapeHeightfieldCollisionComponent : public UPrimitiveComponent
 	// Begin UObject Interface.
 	virtual void Serialize(FArchive& Ar) OVERRIDE;
 	virtual void BeginDestroy() OVERRIDE;
+	virtual bool IsReadyForFinishDestroy() OVERRIDE;
 #if WITH_EDITOR
 	virtual void ExportCustomProperties(FOutputDevice& Out, uint32 Indent) OVERRIDE;
 	virtual void ImportCustomProperties(const TCHAR* SourceText, FFeedbackContext* Warn) OVERRIDE;
@@ -135,6 +158,12 @@ class ULandscapeHeightfieldCollisionComponent : public UPrimitiveComponent
 	// Update Collision object for add LandscapeComponent tool
 	ENGINE_API void UpdateAddCollisions();
 
+	/**
+	 * Builds the simplified collision data from the full resolution collision data
+	 * @param SimpleCollisionMipLevel - number of mips below the full resolution collision to build it at, 0 removes the simplified collision
+	 */
+	void UpdateSimpleCollisionData(int32 SimpleCollisionMipLevel);
+
 	// @todo document
 	class ULandscapeInfo* GetLandscapeInfo(bool bSpawnNewActor = true) const;
 #endif
@@ -158,6 +187,22 @@ class ULandscapeHeightfieldCollisionComponent : public UPrimitiveComponent
 	/** Modify a sub-region of the PhysX heightfield. Note that this does not update the physical material */
 	void UpdateHeightfieldRegion(int32 ComponentX1, int32 ComponentY1, int32 ComponentX2, int32 ComponentY2);
 
+	/** @return true if the collision can have a simplified version, collision with XY offsets can't */
+	virtual bool SupportsSimpleCollision() const { return true; }
+
+	/** @return true if the full resolution collision can be dropped for the simplified one and read back in from disk */
+	bool CanStreamCollision() const;
+
+	/**
+	 * Switches between the simplified and the full resolution collision, reading the full resolution data in asynchronously.
+	 * @param bWantFullCollision - whether the full resolution collision is needed, e.g. because a viewer is close
+	 */
+	void UpdateCollisionStreaming(bool bWantFullCollision);
+
+private:
+	/** Starts reading the full resolution collision data into the streamed data */
+	void StartStreamingCollisionData();
+
 };
 
 
@@ -76,6 +76,7 @@ class ULandscapeMeshCollisionComponent : public ULandscapeHeightfieldCollisionCo
 
 	// Begin ULandscapeHeightfieldCollisionComponent Interface
 	virtual void RecreateCollision(bool bUpdateAddCollision = true) OVERRIDE;
+	virtual bool SupportsSimpleCollision() const OVERRIDE { return false; }
 
 	FByteBulkData* GetCookedData(FName Format, bool bIsMirrored);
 	// End ULandscapeHeightfieldCollisionComponent Interface
@@ -254,6 +254,14 @@ public:
 	UPROPERTY(EditAnywhere, Category=Landscape)
 	float CollisionThickness;
 
+	/** Number of mips below CollisionMipLevel the collision of distant components drops to, while the full resolution collision is streamed out. 0 keeps full resolution collision for all components */
+	UPROPERTY(EditAnywhere, Category=Landscape, meta=(ClampMin=0, ClampMax=5))
+	int32 SimpleCollisionMipLevel;
+
+	/** Components within this distance of a view or a pawn stream in their full resolution collision, in unreal units */
+	UPROPERTY(EditAnywhere, Category=Landscape)
+	float CollisionStreamingDistance;
+
 	/** Collision profile settings for this landscape */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category=Collision, meta=(ShowOnlyInnerProperties))
 	FBodyInstance BodyInstance;
@@ -311,6 +319,7 @@ public:
 	virtual bool IsLevelBoundsRelevant() const OVERRIDE { return true; }
 	virtual bool UpdateNavigationRelevancy() OVERRIDE;
 	virtual FBox GetComponentsBoundingBox(bool bNonColliding = false) const OVERRIDE;
+	virtual void Tick(float DeltaSeconds) OVERRIDE;
 #if WITH_EDITOR
 	virtual void Destroyed() OVERRIDE;
 	virtual void EditorApplyScale(const FVector& DeltaScale, const FVector* PivotLocation, bool bAltDown, bool bShiftDown, bool bCtrlDown) OVERRIDE;
@@ -378,6 +387,9 @@ public:
 	/** Recreate all collision components based on render component */
 	ENGINE_API void RecreateCollisionComponents();
 
+	/** Switches collision components between full resolution and simplified collision, based on their distance to the views and pawns */
+	void UpdateCollisionStreaming();
+
 	ENGINE_API static ULandscapeMaterialInstanceConstant* GetLayerThumbnailMIC(UMaterialInterface* LandscapeMaterial, FName LayerName, UTexture2D* ThumbnailWeightmap, UTexture2D* ThumbnailHeightmap, ALandscapeProxy* Proxy);
 
 	ENGINE_API void Import(FGuid Guid, int32 VertsX, int32 VertsY, 
@@ -86,6 +86,10 @@ class UParticleModuleAttractorParticle : public UParticleModuleAttractorBase
 	virtual void Spawn(FParticleEmitterInstance* Owner, int32 Offset, float SpawnTime, FBaseParticle* ParticleBase) OVERRIDE;
 	virtual void Update(FParticleEmitterInstance* Owner, int32 Offset, float DeltaTime) OVERRIDE;
 	virtual uint32 RequiredBytes(FParticleEmitterInstance* Owner = NULL) OVERRIDE;
+	virtual bool CanTickInParallelWithOtherEmitters() OVERRIDE
+	{
+		return false;
+	}
 	//End UParticleModule Interface
 };
 
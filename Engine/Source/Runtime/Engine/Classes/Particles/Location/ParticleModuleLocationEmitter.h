@@ -62,6 +62,10 @@ class UParticleModuleLocationEmitter : public UParticleModuleLocationBase
 	// Begin UParticleModule Interface
 	virtual void	Spawn(FParticleEmitterInstance* Owner, int32 Offset, float SpawnTime, FBaseParticle* ParticleBase) OVERRIDE;
 	virtual uint32	RequiredBytesPerInstance(FParticleEmitterInstance* Owner = NULL) OVERRIDE;
+	virtual bool CanTickInParallelWithOtherEmitters() OVERRIDE
+	{
+		return false;
+	}
 	// End UParticleModule Interface
 };
 
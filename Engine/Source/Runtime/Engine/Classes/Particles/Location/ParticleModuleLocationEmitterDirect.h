@@ -24,6 +24,10 @@ class UParticleModuleLocationEmitterDirect : public UParticleModuleLocationBase
 	// Begin UParticleModule Interface
 	virtual void	Spawn(FParticleEmitterInstance* Owner, int32 Offset, float SpawnTime, FBaseParticle* ParticleBase) OVERRIDE;
 	virtual void	Update(FParticleEmitterInstance* Owner, int32 Offset, float DeltaTime) OVERRIDE;
+	virtual bool CanTickInParallelWithOtherEmitters() OVERRIDE
+	{
+		return false;
+	}
 	// End UParticleModule Interface
 
 };
@@ -533,6 +533,12 @@ class UParticleModule : public UObject
 		return true;
 	}
 
+	/** Return false if this module reads the state of other emitter instances in the system, so the emitters can't tick in parallel **/
+	virtual bool CanTickInParallelWithOtherEmitters()
+	{
+		return true;
+	}
+
 	/** Returns whether this module is used in any GPU emitters. */
 	ENGINE_API bool IsUsedInGPUEmitter()const;
 
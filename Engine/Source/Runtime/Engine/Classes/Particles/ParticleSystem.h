@@ -251,6 +251,8 @@ private:
 	uint32 bIsElligibleForAsyncTick:1;
 	/** if true, bIsElligibleForAsyncTick is set up **/
 	uint32 bIsElligibleForAsyncTickComputed:1;
+	/** if true, the emitters of this psys can tick in parallel with each other, set up with bIsElligibleForAsyncTick **/
+	uint32 bIsElligibleForParallelEmitterTick:1;
 public:
 
 #if WITH_EDITORONLY_DATA
@@ -427,6 +429,16 @@ public:
 	/** Decide if this psys can tick in any thread, and set bIsElligibleForAsyncTick */
 	ENGINE_API void ComputeCanTickInAnyThread();
 
+	/** return true if the emitters of this psys can tick as separate tasks in parallel */
+	FORCEINLINE bool CanTickEmittersInParallel()
+	{
+		if (!bIsElligibleForAsyncTickComputed)
+		{
+			ComputeCanTickInAnyThread();
+		}
+		return bIsElligibleForParallelEmitterTick;
+	}
+
 };
 
 
@@ -229,6 +229,25 @@ struct FParticleEventKismetData : public FParticleEventData
 {
 };
 
+/**
+ *	Events generated by a single emitter instance while the emitters of a component tick in parallel.
+ *	They are handed to the component in emitter order when the tick is finalized, so the component
+ *	sees the same events in the same order as it would with a serial tick.
+ */
+struct FParticleEmitterEventBuffer
+{
+	TArray<FParticleEventSpawnData> SpawnEvents;
+	TArray<FParticleEventDeathData> DeathEvents;
+	TArray<FParticleEventBurstData> BurstEvents;
+
+	ENGINE_API void ReportEventSpawn(const FName InEventName, const float InEmitterTime, const FVector InLocation, 
+		const FVector InVelocity, const TArray<class UParticleModuleEventSendToGame*>& InEventData);
+	ENGINE_API void ReportEventDeath(const FName InEventName, const float InEmitterTime, const FVector InLocation, 
+		const FVector InVelocity, const TArray<class UParticleModuleEventSendToGame*>& InEventData, const float InParticleTime);
+	ENGINE_API void ReportEventBurst(const FName InEventName, const float InEmitterTime, const int32 InParticleCount,
+		const FVector InLocation, const TArray<class UParticleModuleEventSendToGame*>& InEventData);
+};
+
 /** 
  * A particle emmitter.
  */
@@ -626,6 +645,10 @@ private:
 	int32 TotalActiveParticles;
 	/** If true, it means the ASync work is done and the finalize is not */
 	bool bNeedsFinalize;
+	/** If true, the emitters were ticked as separate tasks and FinalizeTickComponent has to gather their results */
+	bool bTickedEmittersInParallel;
+	/** Per emitter event storage used while emitters tick in parallel, indexed like EmitterInstances */
+	TArray<FParticleEmitterEventBuffer> EmitterEventBuffers;
 public:
 
 	// Begin UActorComponent interface.
@@ -672,6 +695,14 @@ private:
 	/** Possibly parallel phase of TickComponent **/
 	void ComputeTickComponent_Concurrent();
 
+	/** Ticks a single emitter instance, returns true if it was ticked. May run in parallel with other emitters of this component **/
+	bool TickEmitter_Concurrent(int32 EmitterIndex);
+
+	/** Dispatches one task per emitter instance, returns an event which completes when all of them are done **/
+	FGraphEventRef DispatchParallelEmitterTicks();
+
+	friend struct FParticleEmitterTickTask;
+
 	/** After the possibly parallel phase of TickComponent, we fire events, etc **/
 	void FinalizeTickComponent();
 	/** Wait on the async task and call finalize on the tick **/
@@ -12,6 +12,11 @@ class UParticleModuleTypeDataBase : public UParticleModule
 
 	// Begin UParticleModule Interface
 	virtual EModuleType	GetModuleType() const OVERRIDE {	return EPMT_TypeData;	}
+	/** Beam, ribbon and anim trail emitters resolve their sources against other emitters and write to the component */
+	virtual bool CanTickInParallelWithOtherEmitters() OVERRIDE
+	{
+		return false;
+	}
 	// End UParticleModule Interface
 
 	/**
@@ -400,6 +400,13 @@ class UParticleModuleTypeDataGpu : public UParticleModuleTypeDataBase
 	virtual void BeginDestroy() OVERRIDE;
 	// End UObject Interface
 
+	// Begin UParticleModule Interface
+	virtual bool CanTickInParallelWithOtherEmitters() OVERRIDE
+	{
+		return true;
+	}
+	// End UParticleModule Interface
+
 	// Begin UParticleModuleTypeDataBase Interface
 	virtual void Build( struct FParticleEmitterBuildInfo& EmitterBuildInfo ) OVERRIDE;
 	virtual bool RequiresBuild() const { return true; }
@@ -173,6 +173,10 @@ class UParticleModuleTypeDataMesh : public UParticleModuleTypeDataBase
 
 	// Begin UParticleModule Interface
 	virtual void	SetToSensibleDefaults(UParticleEmitter* Owner) OVERRIDE;
+	virtual bool	CanTickInParallelWithOtherEmitters() OVERRIDE
+	{
+		return true;
+	}
 	// End UParticleModule Interface
 
 	// Begin UParticleModuleTypeDataBase Interface
@@ -208,6 +208,15 @@ public class Engine : ModuleRules
 				);
         }
 
+		if (Target.Platform == UnrealTargetPlatform.Linux)
+		{
+			AddThirdPartyPrivateStaticDependencies(Target,
+				"UEOgg",
+				"Vorbis",
+				"VorbisFile"
+				);
+		}
+
 		if (UEBuildConfiguration.bCompileRecast)
 		{
 			AddThirdPartyPrivateStaticDependencies(Target, "Recast");
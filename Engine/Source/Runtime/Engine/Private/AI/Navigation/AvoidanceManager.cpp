@@ -35,8 +35,16 @@ UAvoidanceManager::UAvoidanceManager(const class FPostConstructInitializePropert
 	ArtificialRadiusExpansion = 1.5f;
 	TestRadius2D = 500.0f;
 	TestHeightDifference = 500.0f;
+	GridCellSize = 0.0f;
+	AgentsPerBatchTask = 32;
 	bRequestedUpdateTimer = false;
 
+	GridCellSizeInUse = 1.0f;
+	GridMaxRadius = 0.0f;
+	GridMaxSpeed2D = 0.0f;
+	GridFrameNumber = 0;
+	bGridValid = false;
+
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
 	bDebugAll = false;
 #endif
@@ -152,6 +160,26 @@ void UAvoidanceManager::UpdateRVO_Internal(int32 inAvoidanceUID, const FNavAvoid
 {
 	if (FNavAvoidanceData* existingData = AvoidanceObjects.Find(inAvoidanceUID))
 	{
+		if (bGridValid)
+		{
+			//Keep the grid in sync, objects move between cells during the frame.
+			const FIntPoint OldCell = GetGridCell(existingData->Center);
+			const FIntPoint NewCell = GetGridCell(inAvoidanceData.Center);
+			if (OldCell != NewCell)
+			{
+				if (TArray<int32>* OldCellUIDs = AvoidanceGrid.Find(OldCell))
+				{
+					OldCellUIDs->RemoveSingleSwap(inAvoidanceUID);
+					if (OldCellUIDs->Num() == 0)
+					{
+						//Don't keep cells of areas nobody is in anymore, the grid would grow with every cell ever visited.
+						AvoidanceGrid.Remove(OldCell);
+					}
+				}
+				AvoidanceGrid.FindOrAdd(NewCell).Add(inAvoidanceUID);
+			}
+		}
+
 		float OverrideWeightTime = existingData->OverrideWeightTime;		//Hold onto this one value
 		*existingData = inAvoidanceData;
 		existingData->OverrideWeightTime = OverrideWeightTime;
@@ -159,7 +187,79 @@ void UAvoidanceManager::UpdateRVO_Internal(int32 inAvoidanceUID, const FNavAvoid
 	else
 	{
 		AvoidanceObjects.Add(inAvoidanceUID, inAvoidanceData);
+
+		if (bGridValid)
+		{
+			AvoidanceGrid.FindOrAdd(GetGridCell(inAvoidanceData.Center)).Add(inAvoidanceUID);
+		}
+	}
+
+	if (bGridValid)
+	{
+		GridMaxRadius = FMath::Max(GridMaxRadius, inAvoidanceData.Radius);
+		GridMaxSpeed2D = FMath::Max(GridMaxSpeed2D, inAvoidanceData.Velocity.Size2D());
+	}
+}
+
+void UAvoidanceManager::UpdateAvoidanceGrid()
+{
+	const float DesiredCellSize = (GridCellSize > 0.0f) ? GridCellSize : FMath::Max(TestRadius2D, 1.0f);
+	if (bGridValid && GridFrameNumber == GFrameCounter && GridCellSizeInUse == DesiredCellSize)
+	{
+		return;
+	}
+
+	//Empty the cells but keep them around, agents tend to stay in the same area between frames. Cells left empty are removed below.
+	for (auto& Cell : AvoidanceGrid)
+	{
+		Cell.Value.Reset();
+	}
+
+	GridCellSizeInUse = DesiredCellSize;
+	GridMaxRadius = 0.0f;
+	GridMaxSpeed2D = 0.0f;
+
+	//Expired objects are kept in the grid too, they are reused as soon as a new agent is registered.
+	for (auto& AvoidanceObj : AvoidanceObjects)
+	{
+		const FNavAvoidanceData& AvoidanceData = AvoidanceObj.Value;
+		AvoidanceGrid.FindOrAdd(GetGridCell(AvoidanceData.Center)).Add(AvoidanceObj.Key);
+
+		GridMaxRadius = FMath::Max(GridMaxRadius, AvoidanceData.Radius);
+		GridMaxSpeed2D = FMath::Max(GridMaxSpeed2D, AvoidanceData.Velocity.Size2D());
+	}
+
+	for (auto It = AvoidanceGrid.CreateIterator(); It; ++It)
+	{
+		if (It.Value().Num() == 0)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	GridFrameNumber = GFrameCounter;
+	bGridValid = true;
+}
+
+void UAvoidanceManager::GatherNeighbors(const FVector& Center, float Radius, TArray<int32>& OutUIDs) const
+{
+	OutUIDs.Reset();
+
+	const FIntPoint MinCell = GetGridCell(Center - FVector(Radius, Radius, 0.0f));
+	const FIntPoint MaxCell = GetGridCell(Center + FVector(Radius, Radius, 0.0f));
+	for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+	{
+		for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+		{
+			if (const TArray<int32>* CellUIDs = AvoidanceGrid.Find(FIntPoint(CellX, CellY)))
+			{
+				OutUIDs.Append(*CellUIDs);
+			}
+		}
 	}
+
+	//Order of cells (and of UIDs within a cell) depends on update order, but the cone solver is order dependent. Sorting keeps results deterministic.
+	OutUIDs.Sort();
 }
 
 FVector AvoidCones(TArray<FVelocityAvoidanceCone>& AllCones, const FVector& BasePosition, const FVector& DesiredPosition, const int NumConesToTest)
@@ -230,55 +330,37 @@ FVector AvoidCones(TArray<FVelocityAvoidanceCone>& AllCones, const FVector& Base
 }
 
 //RickH - We could probably significantly improve speed if we put separate Z checks in place and did everything else in 2D.
-FVector UAvoidanceManager::GetAvoidanceVelocity_Internal(const FNavAvoidanceData& inAvoidanceData, float DeltaTime, int32* inIgnoreThisUID)
+FVector UAvoidanceManager::ComputeAvoidanceVelocity(const FNavAvoidanceData& inAvoidanceData, float DeltaTime, const int32* inIgnoreThisUID, float CurrentTime,
+	TArray<FVelocityAvoidanceCone>& Cones, TArray<int32>& Neighbors) const
 {
-#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
-	if (!bSystemActive)
-	{
-		return inAvoidanceData.Velocity;
-	}
-#endif
-	if (DeltaTime <= 0.0f)
-	{
-		return inAvoidanceData.Velocity;
-	}
-
 	FVector ReturnVelocity = inAvoidanceData.Velocity * DeltaTime;
 	float MaxSpeed = ReturnVelocity.Size2D();
-	float CurrentTime;
-
-	UWorld* MyWorld = Cast<UWorld>(GetOuter());
-	if (MyWorld)
-	{
-		CurrentTime = MyWorld->TimeSeconds;
-	}
-	else
-	{
-		//No world? OK, just quietly back out and don't alter anything.
-		return inAvoidanceData.Velocity;
-	}
-
 	bool Unobstructed = true;
-#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
-	bool DebugMode = IsDebugOnForAll() || (inIgnoreThisUID ? IsDebugOnForUID(*inIgnoreThisUID) : false);
-#endif
 
 	//If we're moving very slowly, just push forward. Not sure it's worth avoiding at this speed, though I could be wrong.
 	if (MaxSpeed < 0.01f)
 	{
 		return inAvoidanceData.Velocity;
 	}
-	AllCones.Empty(AllCones.Max());
+	Cones.Reset();
 
-	//DrawDebugDirectionalArrow(GetWorld(), inAvoidanceData.Center, inAvoidanceData.Center + inAvoidanceData.Velocity, 2.5f, FColor(0,255,255), true, 0.05f, SDPG_MAX);
+	//Nothing further than this can get close enough to us within DeltaTime to matter.
+	const float MaxReach = inAvoidanceData.Radius + GridMaxRadius + MaxSpeed + (GridMaxSpeed2D * DeltaTime);
+	GatherNeighbors(inAvoidanceData.Center, FMath::Min(TestRadius2D, MaxReach), Neighbors);
 
-	for (auto& AvoidanceObj : AvoidanceObjects)
+	for (int32 NeighborIdx = 0; NeighborIdx < Neighbors.Num(); ++NeighborIdx)
 	{
-		if ((inIgnoreThisUID) && (*inIgnoreThisUID == AvoidanceObj.Key))
+		const int32 OtherUID = Neighbors[NeighborIdx];
+		if ((inIgnoreThisUID) && (*inIgnoreThisUID == OtherUID))
 		{
 			continue;
 		}
-		FNavAvoidanceData& OtherObject = AvoidanceObj.Value;
+		const FNavAvoidanceData* OtherObjectPtr = AvoidanceObjects.Find(OtherUID);
+		if (OtherObjectPtr == NULL)
+		{
+			continue;
+		}
+		const FNavAvoidanceData& OtherObject = *OtherObjectPtr;
 
 		//
 		//Start with a few fast-rejects
@@ -296,9 +378,14 @@ FVector UAvoidanceManager::GetAvoidanceVelocity_Internal(const FNavAvoidanceData
 			continue;
 		}
 
-		//RickH - We should have a max-radius parameter/option here, so I'm just going to hardcode one for now.
-		//if ((OtherObject.Radius + _AvoidanceData.Radius + MaxSpeed + OtherObject.Velocity.Size2D()) < FVector::Dist(OtherObject.Center, _AvoidanceData.Center))
-		if (FVector2D(OtherObject.Center - inAvoidanceData.Center).SizeSquared() > FMath::Square(TestRadius2D))
+		//Reject objects outside of the test radius, or too far away to reach each other within DeltaTime.
+		const float DistSq2D = FVector2D(OtherObject.Center - inAvoidanceData.Center).SizeSquared();
+		if (DistSq2D > FMath::Square(TestRadius2D))
+		{
+			continue;
+		}
+
+		if (DistSq2D > FMath::Square(OtherObject.Radius + inAvoidanceData.Radius + MaxSpeed + (OtherObject.Velocity.Size2D() * DeltaTime)))
 		{
 			continue;
 		}
@@ -356,25 +443,12 @@ FVector UAvoidanceManager::GetAvoidanceVelocity_Internal(const FNavAvoidanceData
 				PointPlane[1].Set(PointPlane[0].X, PointPlane[0].Y, PointPlane[0].Z + 100.0f);
 				NewCone.ConePlane[0] = FPlane(EffectiveVelocityB, PointPlane[0], PointPlane[1]);		//First point is relative to A, which is ZeroVector in this implementation
 				checkSlow((((PointBRelative+EffectiveVelocityB)|NewCone.ConePlane[0]) - NewCone.ConePlane[0].W) > 0.0f);
-#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
-				if (DebugMode)
-				{
-//					DrawDebugDirectionalArrow(MyWorld, EffectiveVelocityB + PointAWorld, PointPlane[0] + PointAWorld, 50.0f, FColor(64,64,64), true, 0.05f, SDPG_MAX);
-//					DrawDebugLine(MyWorld, PointAWorld, EffectiveVelocityB + PointAWorld, FColor(64,64,64), true, 0.05f, SDPG_MAX, 5.0f);
-				}
-#endif
 
 				//Make the right plane
 				PointPlane[0] = EffectiveVelocityB + (PointBRelative - (SidewaysFromB * RadiusB));
 				PointPlane[1].Set(PointPlane[0].X, PointPlane[0].Y, PointPlane[0].Z - 100.0f);
 				NewCone.ConePlane[1] = FPlane(EffectiveVelocityB, PointPlane[0], PointPlane[1]);		//First point is relative to A, which is ZeroVector in this implementation
 				checkSlow((((PointBRelative+EffectiveVelocityB)|NewCone.ConePlane[1]) - NewCone.ConePlane[1].W) > 0.0f);
-#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
-				if (DebugMode)
-				{
-//					DrawDebugDirectionalArrow(MyWorld, EffectiveVelocityB + PointAWorld, PointPlane[0] + PointAWorld, 50.0f, FColor(64,64,64), true, 0.05f, SDPG_MAX);
-				}
-#endif
 
 				if ((((ReturnVelocity|NewCone.ConePlane[0]) - NewCone.ConePlane[0].W) > 0.0f)
 					&& (((ReturnVelocity|NewCone.ConePlane[1]) - NewCone.ConePlane[1].W) > 0.0f))
@@ -382,7 +456,7 @@ FVector UAvoidanceManager::GetAvoidanceVelocity_Internal(const FNavAvoidanceData
 					Unobstructed = false;
 				}
 
-				AllCones.Add(NewCone);
+				Cones.Add(NewCone);
 			}
 		}
 	}
@@ -393,7 +467,7 @@ FVector UAvoidanceManager::GetAvoidanceVelocity_Internal(const FNavAvoidanceData
 	}
 
 	//Find a good velocity that isn't inside a cone.
-	if (AllCones.Num())
+	if (Cones.Num())
 	{
 		float AngleCurrent;
 		float AngleF = ReturnVelocity.HeadingAngle();
@@ -423,7 +497,7 @@ FVector UAvoidanceManager::GetAvoidanceVelocity_Internal(const FNavAvoidanceData
 			BestScorePotential = (VelSpacePoint|ReturnVelocity) * (VelSpacePoint|VelSpacePoint);
 			if (BestScorePotential > BestScore)
 			{
-				FVector CandidateVelocity = AvoidCones(AllCones, FVector::ZeroVector, VelSpacePoint, AllCones.Num());
+				FVector CandidateVelocity = AvoidCones(Cones, FVector::ZeroVector, VelSpacePoint, Cones.Num());
 				float CandidateScore = (CandidateVelocity|ReturnVelocity) * (CandidateVelocity|CandidateVelocity);
 
 				//Vectors are rated by their length and their overall forward movement.
@@ -435,15 +509,174 @@ FVector UAvoidanceManager::GetAvoidanceVelocity_Internal(const FNavAvoidanceData
 			}
 		}
 		ReturnVelocity = BestVelocity;
+	}
+
+	return ReturnVelocity / DeltaTime;		//Remove prediction-time scaling
+}
+
+FVector UAvoidanceManager::GetAvoidanceVelocity_Internal(const FNavAvoidanceData& inAvoidanceData, float DeltaTime, int32* inIgnoreThisUID)
+{
+#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+	if (!bSystemActive)
+	{
+		return inAvoidanceData.Velocity;
+	}
+#endif
+	if (DeltaTime <= 0.0f)
+	{
+		return inAvoidanceData.Velocity;
+	}
+
+	UWorld* MyWorld = Cast<UWorld>(GetOuter());
+	if (!MyWorld)
+	{
+		//No world? OK, just quietly back out and don't alter anything.
+		return inAvoidanceData.Velocity;
+	}
+
+	UpdateAvoidanceGrid();
+
+	const FVector ReturnVelocity = ComputeAvoidanceVelocity(inAvoidanceData, DeltaTime, inIgnoreThisUID, MyWorld->TimeSeconds, AllCones, NeighborUIDs);
+
+#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+	const bool DebugMode = IsDebugOnForAll() || (inIgnoreThisUID ? IsDebugOnForUID(*inIgnoreThisUID) : false);
+	if (DebugMode && !ReturnVelocity.Equals(inAvoidanceData.Velocity))
+	{
+		DrawDebugDirectionalArrow(MyWorld, inAvoidanceData.Center + inAvoidanceData.Velocity, inAvoidanceData.Center + ReturnVelocity, 75.0f, FColor(64,255,64), true, 2.0f, SDPG_MAX);
+	}
+#endif
+
+	return ReturnVelocity;
+}
+
+/** Shared, read-only description of a batched avoidance request. Lives on the stack of GetAvoidanceVelocitiesForBatch until all tasks are done. */
+struct FAvoidanceBatchContext
+{
+	const UAvoidanceManager* Manager;
+	const FNavAvoidanceBatchQuery* Queries;
+	FVector* OutVelocities;
+	float DeltaTime;
+	float CurrentTime;
+};
+
+/** Task graph task computing avoidance velocities for a contiguous range of a batch */
+struct FAvoidanceBatchTask
+{
+	const FAvoidanceBatchContext* Context;
+	int32 StartIndex;
+	int32 NumQueries;
+
+	FAvoidanceBatchTask(const FAvoidanceBatchContext* InContext, int32 InStartIndex, int32 InNumQueries)
+		: Context(InContext)
+		, StartIndex(InStartIndex)
+		, NumQueries(InNumQueries)
+	{
+	}
+
+	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+	{
+		Context->Manager->ComputeAvoidanceVelocityRange(Context->Queries + StartIndex, Context->OutVelocities + StartIndex, NumQueries, Context->DeltaTime, Context->CurrentTime);
+	}
+
+	static const TCHAR* GetTaskName()
+	{
+		return TEXT("FAvoidanceBatchTask");
+	}
+
+	FORCEINLINE static TStatId GetStatId()
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FAvoidanceBatchTask, STATGROUP_TaskGraphTasks);
+	}
+
+	static ENamedThreads::Type GetDesiredThread()
+	{
+		return ENamedThreads::AnyThread;
+	}
+
+	static ESubsequentsMode::Type GetSubsequentsMode()
+	{
+		return ESubsequentsMode::TrackSubsequents;
+	}
+};
+
+void UAvoidanceManager::ComputeAvoidanceVelocityRange(const FNavAvoidanceBatchQuery* Queries, FVector* OutVelocities, int32 NumQueries, float DeltaTime, float CurrentTime) const
+{
+	//Every range gets its own scratch memory, so ranges can run in parallel.
+	TArray<FVelocityAvoidanceCone> Cones;
+	TArray<int32> Neighbors;
+
+	for (int32 Idx = 0; Idx < NumQueries; ++Idx)
+	{
+		const FNavAvoidanceBatchQuery& Query = Queries[Idx];
+		OutVelocities[Idx] = ComputeAvoidanceVelocity(Query.AvoidanceData, DeltaTime, (Query.IgnoreThisUID != INDEX_NONE) ? &Query.IgnoreThisUID : NULL, CurrentTime, Cones, Neighbors);
+	}
+}
+
+void UAvoidanceManager::GetAvoidanceVelocitiesForBatch(const TArray<FNavAvoidanceBatchQuery>& Queries, float DeltaTime, TArray<FVector>& OutVelocities)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AI_ObstacleAvoidance);
+	check(IsInGameThread());
+
+	OutVelocities.Reset(Queries.Num());
+	for (int32 Idx = 0; Idx < Queries.Num(); ++Idx)
+	{
+		OutVelocities.Add(Queries[Idx].AvoidanceData.Velocity);
+	}
+
+	UWorld* MyWorld = Cast<UWorld>(GetOuter());
+	if (DeltaTime <= 0.0f || MyWorld == NULL || Queries.Num() == 0)
+	{
+		return;
+	}
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
-		if (DebugMode)
+	if (!bSystemActive)
+	{
+		return;
+	}
+#endif
+
+	//Grid has to be ready before any task starts reading it.
+	UpdateAvoidanceGrid();
+
+	const float CurrentTime = MyWorld->TimeSeconds;
+	const int32 BatchSize = FMath::Max(AgentsPerBatchTask, 1);
+	if (Queries.Num() <= BatchSize || !FApp::ShouldUseThreadingForPerformance())
+	{
+		ComputeAvoidanceVelocityRange(Queries.GetData(), OutVelocities.GetData(), Queries.Num(), DeltaTime, CurrentTime);
+	}
+	else
+	{
+		FAvoidanceBatchContext Context;
+		Context.Manager = this;
+		Context.Queries = Queries.GetData();
+		Context.OutVelocities = OutVelocities.GetData();
+		Context.DeltaTime = DeltaTime;
+		Context.CurrentTime = CurrentTime;
+
+		FGraphEventArray BatchTasks;
+		for (int32 StartIdx = BatchSize; StartIdx < Queries.Num(); StartIdx += BatchSize)
 		{
-			DrawDebugDirectionalArrow(MyWorld, inAvoidanceData.Center + inAvoidanceData.Velocity, inAvoidanceData.Center + (ReturnVelocity / DeltaTime), 75.0f, FColor(64,255,64), true, 2.0f, SDPG_MAX);
+			const int32 NumInBatch = FMath::Min(BatchSize, Queries.Num() - StartIdx);
+			BatchTasks.Add(TGraphTask<FAvoidanceBatchTask>::CreateTask().ConstructAndDispatchWhenReady(&Context, StartIdx, NumInBatch));
 		}
-#endif
+
+		//The first batch is done here, game thread would be waiting anyway.
+		ComputeAvoidanceVelocityRange(Queries.GetData(), OutVelocities.GetData(), BatchSize, DeltaTime, CurrentTime);
+
+		FTaskGraphInterface::Get().WaitUntilTasksComplete(BatchTasks, ENamedThreads::GameThread);
 	}
 
-	return ReturnVelocity / DeltaTime;		//Remove prediction-time scaling
+#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+	for (int32 Idx = 0; Idx < Queries.Num(); ++Idx)
+	{
+		const FNavAvoidanceBatchQuery& Query = Queries[Idx];
+		const bool DebugMode = IsDebugOnForAll() || (Query.IgnoreThisUID != INDEX_NONE && IsDebugOnForUID(Query.IgnoreThisUID));
+		if (DebugMode && !OutVelocities[Idx].Equals(Query.AvoidanceData.Velocity))
+		{
+			DrawDebugDirectionalArrow(MyWorld, Query.AvoidanceData.Center + Query.AvoidanceData.Velocity, Query.AvoidanceData.Center + OutVelocities[Idx], 75.0f, FColor(64,255,64), true, 2.0f, SDPG_MAX);
+		}
+	}
+#endif
 }
 
 void UAvoidanceManager::OverrideToMaxWeight(int32 AvoidanceUID, float Duration)
@@ -185,6 +185,11 @@ FString FActorTickFunction::DiagnosticMessage()
 	return Target->GetFullName() + TEXT("[TickActor]");
 }
 
+UObject* FActorTickFunction::GetTickTarget() const
+{
+	return Target;
+}
+
 
 void AActor::CheckActorComponents()
 {
@@ -435,6 +435,11 @@ FString FActorComponentTickFunction::DiagnosticMessage()
 	return Target->GetFullName() + TEXT("[TickComponent]");
 }
 
+UObject* FActorComponentTickFunction::GetTickTarget() const
+{
+	return Target;
+}
+
 bool UActorComponent::SetupActorComponentTickFunction(struct FTickFunction* TickFunction)
 {
 	AActor* Owner = GetOwner();
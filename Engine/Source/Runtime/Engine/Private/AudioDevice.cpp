@@ -1662,7 +1662,8 @@ int32 FAudioDevice::GetSortedActiveWaveInstances(TArray<FWaveInstance*>& WaveIns
 
 	// Tick all the active audio components.  Use a copy as some operations may remove elements from the list, but we want
 	// to evaluate in the order they were added
-	TArray<FActiveSound*> ActiveSoundsCopy = ActiveSounds;
+	FMemMark Mark(FMemStack::Get());
+	TArray<FActiveSound*, TMemStackAllocator<> > ActiveSoundsCopy(ActiveSounds);
 	for( int32 i = 0; i < ActiveSoundsCopy.Num(); ++i )
 	{
 		FActiveSound* ActiveSound = ActiveSoundsCopy[i];
@@ -1878,7 +1879,7 @@ void FAudioDevice::Update( bool bGameTicking )
 		}
 
 		// Poll audio components for active wave instances (== paths in node tree that end in a USoundWave)
-		TArray<FWaveInstance*> WaveInstances;
+		TArray<FWaveInstance*>& WaveInstances = GatheredWaveInstances;
 		int32 FirstActiveIndex = GetSortedActiveWaveInstances( WaveInstances, (bGameTicking ? ESortedActiveWaveGetType::FullUpdate : ESortedActiveWaveGetType::PausedUpdate));
 
 		// Stop sources that need to be stopped, and touch the ones that need to be kept alive
@@ -1894,6 +1895,9 @@ void FAudioDevice::Update( bool bGameTicking )
 		INC_DWORD_STAT_BY( STAT_AudioSources, MaxChannels - FreeSources.Num() );
 		INC_DWORD_STAT_BY( STAT_WavesDroppedDueToPriority, FMath::Max( WaveInstances.Num() - MaxChannels, 0 ) );
 		INC_DWORD_STAT_BY( STAT_ActiveSounds, ActiveSounds.Num() );
+
+		// Don't hold on to the wave instances, they are owned by the active sounds
+		WaveInstances.Reset();
 	}
 
 	// now let the platform perform anything it needs to handle
@@ -98,8 +98,9 @@ public:
 	 * Initializes the buffer with the component's data.
 	 * @param InComponent - The owning component
 	 * @param InHitProxies - Array of hit proxies for each instance, if desired.
+	 * @param InInstanceOrder - The instance to store in each slot of the buffer, if the buffer isn't in instance order.
 	 */
-	void Init(UInstancedStaticMeshComponent* InComponent, const TArray<TRefCountPtr<HHitProxy> >& InHitProxies);
+	void Init(UInstancedStaticMeshComponent* InComponent, const TArray<TRefCountPtr<HHitProxy> >& InHitProxies, const TArray<int32>* InInstanceOrder = NULL);
 
 	/** Serializer. */
 	friend FArchive& operator<<(FArchive& Ar, FStaticMeshInstanceBuffer& VertexBuffer);
@@ -162,10 +163,12 @@ void FStaticMeshInstanceBuffer::CleanUp()
 /**
  * Initializes the buffer with the component's data.
  * @param InComponent - The owning component
+ * @param InInstanceOrder - The instance to store in each slot of the buffer, if the buffer isn't in instance order.
  */
-void FStaticMeshInstanceBuffer::Init(UInstancedStaticMeshComponent* InComponent, const TArray<TRefCountPtr<HHitProxy> >& InHitProxies)
+void FStaticMeshInstanceBuffer::Init(UInstancedStaticMeshComponent* InComponent, const TArray<TRefCountPtr<HHitProxy> >& InHitProxies, const TArray<int32>* InInstanceOrder)
 {
 	NumInstances = InComponent->PerInstanceSMData.Num();
+	check( InInstanceOrder == NULL || InInstanceOrder->Num() == NumInstances );
 
 	// Allocate the vertex data storage type.
 	AllocateData();
@@ -174,7 +177,17 @@ void FStaticMeshInstanceBuffer::Init(UInstancedStaticMeshComponent* InComponent,
 	// so we make a TArray of the right type, then assign it
 	TArray<FVector4> RawData;
 	check( GetStride() % sizeof(FVector4) == 0 );
-	RawData.Empty(NumInstances * GetStride() / sizeof(FVector));
+	const uint32 VectorsPerInstance = GetStride() / sizeof(FVector4);
+	RawData.AddUninitialized(NumInstances * VectorsPerInstance);
+
+	// Work out which slot of the buffer each instance goes to. The instances are still visited in their
+	// own order below, so the per-instance random numbers don't change when the buffer is reordered.
+	TArray<uint32> InstanceSlots;
+	InstanceSlots.AddUninitialized(NumInstances);
+	for (uint32 SlotIndex = 0; SlotIndex < NumInstances; SlotIndex++)
+	{
+		InstanceSlots[InInstanceOrder ? (*InInstanceOrder)[SlotIndex] : SlotIndex] = SlotIndex;
+	}
 
 	// @todo: Make LD-customizable per component?
 	const float RandomInstanceIDBase = 0.0f;
@@ -189,6 +202,7 @@ void FStaticMeshInstanceBuffer::Init(UInstancedStaticMeshComponent* InComponent,
 	for (uint32 InstanceIndex = 0; InstanceIndex < NumInstances; InstanceIndex++)
 	{
 		const FInstancedStaticMeshInstanceData& Instance = InComponent->PerInstanceSMData[InstanceIndex];
+		FVector4* InstanceVectors = &RawData[InstanceSlots[InstanceIndex] * VectorsPerInstance];
 
 		// X, Y	: Shadow map UV bias
 		// Z, W : Encoded HitProxy ID.
@@ -207,7 +221,7 @@ void FStaticMeshInstanceBuffer::Init(UInstancedStaticMeshComponent* InComponent,
 			Z += 256.f;
 		}
 #endif
-		RawData.Add( FVector4( Instance.ShadowmapUVBias.X, Instance.ShadowmapUVBias.Y, Z, W ) );
+		InstanceVectors[0] = FVector4( Instance.ShadowmapUVBias.X, Instance.ShadowmapUVBias.Y, Z, W );
 
 		// Grab the instance -> local matrix.  Every mesh instance has it's own transformation into
 		// the actor's coordinate space.
@@ -220,9 +234,9 @@ void FStaticMeshInstanceBuffer::Init(UInstancedStaticMeshComponent* InComponent,
 		// Instance to world transform matrix
 		{
 			const FMatrix Transpose = InstanceToWorld.GetTransposed();
-			RawData.Add( FVector4(Transpose.M[0][0], Transpose.M[0][1], Transpose.M[0][2], Transpose.M[0][3]) );
-			RawData.Add( FVector4(Transpose.M[1][0], Transpose.M[1][1], Transpose.M[1][2], Transpose.M[1][3]) );
-			RawData.Add( FVector4(Transpose.M[2][0], Transpose.M[2][1], Transpose.M[2][2], Transpose.M[2][3]) );
+			InstanceVectors[1] = FVector4(Transpose.M[0][0], Transpose.M[0][1], Transpose.M[0][2], Transpose.M[0][3]);
+			InstanceVectors[2] = FVector4(Transpose.M[1][0], Transpose.M[1][1], Transpose.M[1][2], Transpose.M[1][3]);
+			InstanceVectors[3] = FVector4(Transpose.M[2][0], Transpose.M[2][1], Transpose.M[2][2], Transpose.M[2][3]);
 		}
 
 		// World to instance rotation matrix (3x3)
@@ -234,9 +248,9 @@ void FStaticMeshInstanceBuffer::Init(UInstancedStaticMeshComponent* InComponent,
 
 			// hide the offset (bias) of the lightmap and the per-instance random id in the matrix's w
 			const FMatrix Transpose = WorldToInstance.GetTransposed();
-			RawData.Add( FVector4(Transpose.M[0][0], Transpose.M[0][1], Transpose.M[0][2], Instance.LightmapUVBias.X) );
-			RawData.Add( FVector4(Transpose.M[1][0], Transpose.M[1][1], Transpose.M[1][2], Instance.LightmapUVBias.Y) );
-			RawData.Add( FVector4(Transpose.M[2][0], Transpose.M[2][1], Transpose.M[2][2], RandomInstanceID) );
+			InstanceVectors[4] = FVector4(Transpose.M[0][0], Transpose.M[0][1], Transpose.M[0][2], Instance.LightmapUVBias.X);
+			InstanceVectors[5] = FVector4(Transpose.M[1][0], Transpose.M[1][1], Transpose.M[1][2], Instance.LightmapUVBias.Y);
+			InstanceVectors[6] = FVector4(Transpose.M[2][0], Transpose.M[2][1], Transpose.M[2][2], RandomInstanceID);
 		}
 	}
 
@@ -304,6 +318,9 @@ struct FInstancingUserData
 
 	bool bRenderSelected;
 	bool bRenderUnselected;
+
+	/** First instance of the buffer drawn by the batch element, only used by factories that draw instance ranges */
+	uint32 FirstInstance;
 };
 
 /**
@@ -313,6 +330,12 @@ struct FInstancedStaticMeshVertexFactory : public FLocalVertexFactory
 {
 	DECLARE_VERTEX_FACTORY_TYPE(FInstancedStaticMeshVertexFactory);
 public:
+	FInstancedStaticMeshVertexFactory()
+		: bDrawsInstanceRanges(false)
+		, InstanceStreamIndex(INDEX_NONE)
+	{
+	}
+
 	struct DataType : public FLocalVertexFactory::DataType
 	{
 		/** The stream to read shadow map bias (and random instance ID) from. */
@@ -359,8 +382,41 @@ public:
 
 	static FVertexFactoryShaderParameters* ConstructShaderParameters(EShaderFrequency ShaderFrequency);
 
+	/**
+	 * Makes the factory draw ranges of its instance buffer rather than the whole buffer. Such factories
+	 * don't provide a position only stream, as the instance stream is rebound for every batch element.
+	 * Must be called before the resource is initialized.
+	 */
+	void SetDrawsInstanceRanges(bool bInDrawsInstanceRanges)
+	{
+		check(!IsInitialized());
+		bDrawsInstanceRanges = bInDrawsInstanceRanges;
+	}
+
+	bool DrawsInstanceRanges() const
+	{
+		return bDrawsInstanceRanges;
+	}
+
+	/**
+	 * Rebinds the instance stream so that the first instance of the draw call reads FirstInstance from the buffer.
+	 * @param FirstInstance - Index of the first instance in the instance buffer
+	 */
+	void SetFirstInstance(uint32 FirstInstance) const
+	{
+		check(bDrawsInstanceRanges && InstanceStreamIndex != INDEX_NONE);
+		const FVertexStreamComponent& InstanceComponent = Data.InstancedShadowMapBiasComponent;
+		RHISetStreamSource(InstanceStreamIndex, InstanceComponent.VertexBuffer->VertexBufferRHI, InstanceComponent.Stride, FirstInstance * InstanceComponent.Stride);
+	}
+
 private:
 	DataType Data;
+
+	/** Whether batch elements draw a range of the instance buffer */
+	bool bDrawsInstanceRanges;
+
+	/** The stream the instance buffer is bound to */
+	int32 InstanceStreamIndex;
 };
 
 
@@ -396,7 +452,7 @@ void FInstancedStaticMeshVertexFactory::InitRHI()
 {
 	// If the vertex buffer containing position is not the same vertex buffer containing the rest of the data,
 	// then initialize PositionStream and PositionDeclaration.
-	if(Data.PositionComponent.VertexBuffer != Data.TangentBasisComponents[0].VertexBuffer)
+	if(Data.PositionComponent.VertexBuffer != Data.TangentBasisComponents[0].VertexBuffer && !bDrawsInstanceRanges)
 	{
 		FVertexDeclarationElementList PositionOnlyStreamElements;
 		PositionOnlyStreamElements.Add(AccessPositionStreamComponent(Data.PositionComponent,0));
@@ -465,8 +521,10 @@ void FInstancedStaticMeshVertexFactory::InitRHI()
 		Elements.Add(AccessStreamComponent(Data.TextureCoordinates[0],15));
 	}
 
-	// toss in the instanced location stream
-	Elements.Add(AccessStreamComponent(Data.InstancedShadowMapBiasComponent,8));
+	// toss in the instanced location stream, all the instance components share one stream
+	const FVertexElement InstanceElement = AccessStreamComponent(Data.InstancedShadowMapBiasComponent,8);
+	InstanceStreamIndex = InstanceElement.StreamIndex;
+	Elements.Add(InstanceElement);
 	Elements.Add(AccessStreamComponent(Data.InstancedTransformComponent[0],9));
 	Elements.Add(AccessStreamComponent(Data.InstancedTransformComponent[1],10));
 	Elements.Add(AccessStreamComponent(Data.InstancedTransformComponent[2],11));
@@ -488,6 +546,14 @@ class FInstancedStaticMeshVertexFactoryShaderParameters : public FVertexFactoryS
 
 	virtual void SetMesh(FShader* VertexShader,const class FVertexFactory* VertexFactory,const class FSceneView& View,const struct FMeshBatchElement& BatchElement,uint32 DataFlags) const OVERRIDE
 	{
+		const FInstancedStaticMeshVertexFactory* InstancedVertexFactory = (const FInstancedStaticMeshVertexFactory*)VertexFactory;
+		if( InstancedVertexFactory->DrawsInstanceRanges() )
+		{
+			// The streams were set up by the drawing policy, point the instance stream at this element's range
+			const FInstancingUserData* InstancingUserData = (FInstancingUserData*)BatchElement.UserData;
+			InstancedVertexFactory->SetFirstInstance(InstancingUserData ? InstancingUserData->FirstInstance : 0);
+		}
+
 		if( InstancedViewTranslationParameter.IsBound() )
 		{
 			FVector4 InstancedViewTranslation(View.ViewMatrices.PreViewTranslation, 0.f);
@@ -560,14 +626,20 @@ class FInstancedStaticMeshRenderData
 {
 public:
 
-	FInstancedStaticMeshRenderData(UInstancedStaticMeshComponent* InComponent)
+	/**
+	 * @param InComponent - The component to take the instances from
+	 * @param InInstanceOrder - If set, the order the instances are stored in the instance buffer. The vertex
+	 *							factories then draw ranges of the instance buffer, set up by the batch elements.
+	 */
+	FInstancedStaticMeshRenderData(UInstancedStaticMeshComponent* InComponent, const TArray<int32>* InInstanceOrder = NULL)
 	  : Component(InComponent)
 	  , LODModels(Component->StaticMesh->RenderData->LODResources)
 	{
 		// Allocate the vertex factories for each LOD
 		for( int32 LODIndex=0;LODIndex<LODModels.Num();LODIndex++ )
 		{
-			new(VertexFactories) FInstancedStaticMeshVertexFactory;
+			FInstancedStaticMeshVertexFactory* VertexFactory = new(VertexFactories) FInstancedStaticMeshVertexFactory;
+			VertexFactory->SetDrawsInstanceRanges(InInstanceOrder != NULL);
 		}
 
 		// Create hit proxies for each instance if the component wants
@@ -580,7 +652,7 @@ public:
 		}
 
 		// initialize the instance buffer from the component's instances
-		InstanceBuffer.Init(Component, HitProxies);
+		InstanceBuffer.Init(Component, HitProxies, InInstanceOrder);
 		InitResources();
 	}
 
@@ -794,9 +866,9 @@ class FInstancedStaticMeshSceneProxy : public FStaticMeshSceneProxy
 {
 public:
 
-	FInstancedStaticMeshSceneProxy(UInstancedStaticMeshComponent* InComponent)
+	FInstancedStaticMeshSceneProxy(UInstancedStaticMeshComponent* InComponent, const TArray<int32>* InInstanceOrder = NULL)
 	:	FStaticMeshSceneProxy(InComponent)
-	,	InstancedRenderData(InComponent)
+	,	InstancedRenderData(InComponent, InInstanceOrder)
 #if WITH_EDITOR
 	,	bHasSelectedInstances(InComponent->SelectedInstances.Num() > 0)
 #else
@@ -845,6 +917,7 @@ public:
 		UserData_AllInstances.EndCullDistance = InComponent->InstanceEndCullDistance;
 		UserData_AllInstances.bRenderSelected = true;
 		UserData_AllInstances.bRenderUnselected = true;
+		UserData_AllInstances.FirstInstance = 0;
 
 		// selected only
 		UserData_SelectedInstances = UserData_AllInstances;
@@ -941,7 +1014,7 @@ public:
 		}
 	}
 
-private:
+protected:
 
 	/** Array of per-instance static mesh rendering data for the scene proxy */
 	TArray< FInstancedStaticMeshSceneProxyInstanceData > PerInstanceSMData;
@@ -1045,6 +1118,324 @@ bool FInstancedStaticMeshSceneProxy::GetWireframeMeshElement(int32 LODIndex, con
 	return false;
 }
 
+/*-----------------------------------------------------------------------------
+	FHierarchicalStaticMeshSceneProxy
+-----------------------------------------------------------------------------*/
+
+/** The batch element mask used by dynamic draws has a bit per element, so batches can't have more elements than this */
+static const int32 HierarchicalInstancedMeshMaxBatchElements = 31;
+
+class FHierarchicalStaticMeshSceneProxy : public FInstancedStaticMeshSceneProxy
+{
+public:
+
+	FHierarchicalStaticMeshSceneProxy(UHierarchicalInstancedStaticMeshComponent* InComponent)
+	:	FInstancedStaticMeshSceneProxy(InComponent, &InComponent->SortedInstances)
+	,	ClusterTree(InComponent->ClusterTree)
+	{
+		// The tree is built in component space, move it to world space once rather than for every view
+		const FMatrix LocalToWorld = InComponent->GetComponentToWorld().ToMatrixWithScale();
+		for( int32 NodeIndex = 0; NodeIndex < ClusterTree.Num(); NodeIndex++ )
+		{
+			FInstanceClusterNode& Node = ClusterTree[NodeIndex];
+			const FBox WorldBox = FBox(Node.BoundMin, Node.BoundMax).TransformBy(LocalToWorld);
+			Node.BoundMin = WorldBox.Min;
+			Node.BoundMax = WorldBox.Max;
+		}
+	}
+
+	// FPrimitiveSceneProxy interface.
+
+	virtual FPrimitiveViewRelevance GetViewRelevance(const FSceneView* View) OVERRIDE
+	{
+		FPrimitiveViewRelevance Result = FInstancedStaticMeshSceneProxy::GetViewRelevance(View);
+
+		// Clusters are culled and pick their LOD for each view, so everything is drawn dynamically
+		if( Result.bStaticRelevance || Result.bDynamicRelevance )
+		{
+			Result.bStaticRelevance = false;
+			Result.bDynamicRelevance = true;
+		}
+		return Result;
+	}
+
+	virtual void DrawStaticElements(FStaticPrimitiveDrawInterface* PDI) OVERRIDE
+	{
+		// Nothing is drawn through the static draw lists
+	}
+
+	virtual void DrawDynamicElements(FPrimitiveDrawInterface* PDI,const FSceneView* View) OVERRIDE
+	{
+		DrawDynamicElements(PDI, View, 0);
+	}
+
+	virtual void DrawDynamicElements(FPrimitiveDrawInterface* PDI,const FSceneView* View, uint32 DrawDynamicFlags) OVERRIDE;
+
+	virtual uint32 GetMemoryFootprint() const OVERRIDE
+	{
+		return sizeof(*this) + GetAllocatedSize();
+	}
+
+	uint32 GetAllocatedSize() const
+	{
+		return FInstancedStaticMeshSceneProxy::GetAllocatedSize() + ClusterTree.GetAllocatedSize();
+	}
+
+private:
+
+	/** A contiguous range of the instance buffer drawn at one LOD */
+	struct FInstanceRange
+	{
+		int32 FirstInstance;
+		int32 NumInstances;
+
+		FInstanceRange(int32 InFirstInstance, int32 InNumInstances)
+			: FirstInstance(InFirstInstance)
+			, NumInstances(InNumInstances)
+		{
+		}
+	};
+
+	typedef TArray<FInstanceRange, TMemStackAllocator<> > FInstanceRangeArray;
+
+	/**
+	 * Returns the LOD used at a distance from the view, or INDEX_NONE if the distance is beyond all the LODs.
+	 * This must match FStaticMeshSceneProxy::GetLOD.
+	 */
+	int32 GetLODForDistanceSquared(float DistanceSquared) const
+	{
+		for( int32 LODIndex = LODs.Num() - 1; LODIndex >= 0; LODIndex-- )
+		{
+			if( DistanceSquared >= FMath::Square(GetMinLODDist(LODIndex)) && DistanceSquared < FMath::Square(GetMaxLODDist(LODIndex)) )
+			{
+				return LODIndex;
+			}
+		}
+		return INDEX_NONE;
+	}
+
+	/**
+	 * Walks the cluster tree, gathering the visible instance ranges for each LOD.
+	 * @param ForcedLOD - LOD all the clusters use, or INDEX_NONE to pick it from the distance of each cluster
+	 */
+	void GatherInstanceRanges(const FSceneView* View, bool bFrustumCull, int32 ForcedLOD, int32 NumLODs, FInstanceRangeArray* OutRanges) const;
+
+	/** The cluster tree in world space */
+	TArray<FInstanceClusterNode> ClusterTree;
+};
+
+void FHierarchicalStaticMeshSceneProxy::GatherInstanceRanges(const FSceneView* View, bool bFrustumCull, int32 ForcedLOD, int32 NumLODs, FInstanceRangeArray* OutRanges) const
+{
+	// Note: These distance calculations must match up with the main renderer!
+#if !WITH_EDITOR
+	const FVector ViewOriginForDistance = View->ViewMatrices.ViewOrigin;
+#else
+	const FVector ViewOriginForDistance = View->IsPerspectiveProjection() ? View->ViewMatrices.ViewOrigin : View->OverrideLODViewOrigin;
+#endif
+	const float LODDistanceScaleSquared = FMath::Square(View->LODDistanceFactor);
+	const float EndCullDistanceSquared = UserData_AllInstances.EndCullDistance > 0 ? FMath::Square((float)UserData_AllInstances.EndCullDistance) : FLT_MAX;
+
+	struct FNodeToVisit
+	{
+		int32 NodeIndex;
+		bool bInsideFrustum;
+	};
+
+	TArray<FNodeToVisit, TInlineAllocator<64> > NodesToVisit;
+	FNodeToVisit& Root = *new(NodesToVisit) FNodeToVisit;
+	Root.NodeIndex = 0;
+	Root.bInsideFrustum = !bFrustumCull;
+
+	while( NodesToVisit.Num() )
+	{
+		const FNodeToVisit Visit = NodesToVisit.Pop();
+		const FInstanceClusterNode& Node = ClusterTree[Visit.NodeIndex];
+		const bool bIsLeaf = Node.FirstChild == INDEX_NONE;
+
+		bool bInsideFrustum = Visit.bInsideFrustum;
+		if( !bInsideFrustum )
+		{
+			const FVector Center = (Node.BoundMax + Node.BoundMin) * 0.5f;
+			const FVector Extent = (Node.BoundMax - Node.BoundMin) * 0.5f;
+			if( !View->ViewFrustum.IntersectBox(Center, Extent, bInsideFrustum) )
+			{
+				continue;
+			}
+		}
+
+		// Each instance fades out by itself, the clusters only need culling once all their instances are gone
+		const float NearestDistanceSquared = ComputeSquaredDistanceFromBoxToPoint(Node.BoundMin, Node.BoundMax, ViewOriginForDistance);
+		if( NearestDistanceSquared > EndCullDistanceSquared )
+		{
+			continue;
+		}
+
+		int32 LODIndex = ForcedLOD;
+		bool bSingleLOD = true;
+		if( LODIndex == INDEX_NONE )
+		{
+			LODIndex = GetLODForDistanceSquared(NearestDistanceSquared * LODDistanceScaleSquared);
+			if( !bIsLeaf )
+			{
+				// The node can only be drawn as a whole if its farthest point uses the same LOD as its nearest
+				const FVector FarthestPoint(
+					ViewOriginForDistance.X < (Node.BoundMin.X + Node.BoundMax.X) * 0.5f ? Node.BoundMax.X : Node.BoundMin.X,
+					ViewOriginForDistance.Y < (Node.BoundMin.Y + Node.BoundMax.Y) * 0.5f ? Node.BoundMax.Y : Node.BoundMin.Y,
+					ViewOriginForDistance.Z < (Node.BoundMin.Z + Node.BoundMax.Z) * 0.5f ? Node.BoundMax.Z : Node.BoundMin.Z
+					);
+				bSingleLOD = GetLODForDistanceSquared((FarthestPoint - ViewOriginForDistance).SizeSquared() * LODDistanceScaleSquared) == LODIndex;
+			}
+		}
+
+		if( !bIsLeaf && (!bInsideFrustum || !bSingleLOD) )
+		{
+			// Push the children in reverse so they are visited in instance order, which lets adjacent ranges merge
+			for( int32 ChildIndex = Node.LastChild; ChildIndex >= Node.FirstChild; ChildIndex-- )
+			{
+				FNodeToVisit& Child = *new(NodesToVisit) FNodeToVisit;
+				Child.NodeIndex = ChildIndex;
+				Child.bInsideFrustum = bInsideFrustum;
+			}
+			continue;
+		}
+
+		// A leaf's nearest point may be beyond every LOD
+		if( LODIndex == INDEX_NONE || LODIndex >= NumLODs )
+		{
+			continue;
+		}
+
+		FInstanceRangeArray& LODRanges = OutRanges[LODIndex];
+		const int32 NumInstances = Node.LastInstance - Node.FirstInstance + 1;
+		if( LODRanges.Num() && LODRanges.Last().FirstInstance + LODRanges.Last().NumInstances == Node.FirstInstance )
+		{
+			LODRanges.Last().NumInstances += NumInstances;
+		}
+		else
+		{
+			new(LODRanges) FInstanceRange(Node.FirstInstance, NumInstances);
+		}
+	}
+}
+
+void FHierarchicalStaticMeshSceneProxy::DrawDynamicElements(FPrimitiveDrawInterface* PDI,const FSceneView* View, uint32 DrawDynamicFlags)
+{
+	QUICK_SCOPE_CYCLE_COUNTER( STAT_HierarchicalStaticMeshSceneProxy_DrawDynamicElements );
+
+	if( ClusterTree.Num() == 0 || !View->Family->EngineShowFlags.StaticMeshes )
+	{
+		return;
+	}
+
+	const int32 NumLODs = FMath::Min(LODs.Num(), InstancedRenderData.VertexFactories.Num());
+	check(NumLODs <= MAX_STATIC_MESH_LODS);
+
+	// Any forced LOD applies to all the clusters
+	int32 ForcedLOD = INDEX_NONE;
+	if( DrawDynamicFlags & EDrawDynamicFlags::ForceLowestLOD )
+	{
+		ForcedLOD = NumLODs - 1;
+	}
+	else if( GetCVarForceLOD() >= 0 || ForcedLodModel > 0 )
+	{
+		ForcedLOD = GetLOD(View);
+	}
+#if WITH_EDITOR
+	else if( View->Family->EngineShowFlags.LOD == 0 )
+	{
+		ForcedLOD = 0;
+	}
+#endif
+
+	// Shadow depths are drawn with the main view, whose frustum doesn't bound the shadow casters
+	const bool bFrustumCull = (DrawDynamicFlags & EDrawDynamicFlags::ShadowDepth) == 0;
+
+	FInstanceRangeArray Ranges[MAX_STATIC_MESH_LODS];
+	GatherInstanceRanges(View, bFrustumCull, ForcedLOD, NumLODs, Ranges);
+
+#if WITH_EDITOR
+	const bool bSelectionRenderEnabled = GIsEditor && View->Family->EngineShowFlags.Selection;
+
+	// If the first pass rendered selected instances only, we need to render the deselected instances in a second pass
+	const int32 NumPasses = (bSelectionRenderEnabled && bHasSelectedInstances && !PDI->IsRenderingSelectionOutline()) ? 2 : 1;
+
+	const FInstancingUserData* PassUserData[2] =
+	{
+		bHasSelectedInstances && bSelectionRenderEnabled ? &UserData_SelectedInstances : &UserData_AllInstances,
+		&UserData_DeselectedInstances
+	};
+
+	const bool PassRenderSelection[2] = 
+	{
+		bSelectionRenderEnabled && IsSelected(),
+		false
+	};
+#else
+	const int32 NumPasses = 1;
+	const FInstancingUserData* PassUserData[1] = { &UserData_AllInstances };
+	const bool PassRenderSelection[1] = { false };
+#endif
+
+	const FLinearColor UtilColor( LevelColor );
+	const bool bIsWireframe = View->Family->EngineShowFlags.Wireframe;
+
+	for( int32 Pass = 0; Pass < NumPasses; Pass++ )
+	{
+		for( int32 LODIndex = 0; LODIndex < NumLODs; LODIndex++ )
+		{
+			const FInstanceRangeArray& LODRanges = Ranges[LODIndex];
+			if( LODRanges.Num() == 0 )
+			{
+				continue;
+			}
+
+			// The batch elements point at their user data, which has to live until the end of the frame
+			FInstancingUserData* RangeUserData = new(FMemStack::Get(), LODRanges.Num()) FInstancingUserData;
+			for( int32 RangeIndex = 0; RangeIndex < LODRanges.Num(); RangeIndex++ )
+			{
+				RangeUserData[RangeIndex] = *PassUserData[Pass];
+				RangeUserData[RangeIndex].FirstInstance = LODRanges[RangeIndex].FirstInstance;
+			}
+
+			const FStaticMeshLODResources& LODModel = RenderData->LODResources[LODIndex];
+			for( int32 SectionIndex = 0; SectionIndex < LODModel.Sections.Num(); SectionIndex++ )
+			{
+				for( int32 FirstRange = 0; FirstRange < LODRanges.Num(); FirstRange += HierarchicalInstancedMeshMaxBatchElements )
+				{
+					FMeshBatch MeshElement;
+					if( !GetMeshElement(LODIndex, SectionIndex, GetDepthPriorityGroup(View), MeshElement, PassRenderSelection[Pass], IsHovered()) )
+					{
+						break;
+					}
+
+					// One batch element for each range, they only differ in which instances they draw
+					const int32 NumBatchRanges = FMath::Min(HierarchicalInstancedMeshMaxBatchElements, LODRanges.Num() - FirstRange);
+					const FMeshBatchElement TemplateElement = MeshElement.Elements[0];
+					MeshElement.Elements.Empty(NumBatchRanges);
+					for( int32 RangeIndex = FirstRange; RangeIndex < FirstRange + NumBatchRanges; RangeIndex++ )
+					{
+						FMeshBatchElement& BatchElement = MeshElement.Elements[MeshElement.Elements.Add(TemplateElement)];
+						BatchElement.NumInstances = LODRanges[RangeIndex].NumInstances;
+						BatchElement.UserData = &RangeUserData[RangeIndex];
+					}
+
+					const int32 NumCalls = DrawRichMesh(
+						PDI,
+						MeshElement,
+						WireframeColor,
+						UtilColor,
+						PropertyColor,
+						this,
+						PassRenderSelection[Pass],
+						bIsWireframe
+						);
+					INC_DWORD_STAT_BY(STAT_StaticMeshTriangles,MeshElement.GetNumPrimitives() * NumCalls);
+				}
+			}
+		}
+	}
+}
+
 /*-----------------------------------------------------------------------------
 	FInstancedStaticMeshStaticLightingTextureMapping
 -----------------------------------------------------------------------------*/
@@ -1474,3 +1865,121 @@ void UInstancedStaticMeshComponent::SelectInstance(bool bInSelected, int32 InIns
 	}
 #endif
 }
+
+/*-----------------------------------------------------------------------------
+	UHierarchicalInstancedStaticMeshComponent
+-----------------------------------------------------------------------------*/
+
+UHierarchicalInstancedStaticMeshComponent::UHierarchicalInstancedStaticMeshComponent(const class FPostConstructInitializeProperties& PCIP)
+	: Super(PCIP)
+	, MaxInstancesPerLeaf(16)
+{
+}
+
+/** Orders instances by the position of their center along one axis */
+struct FCompareInstanceCenters
+{
+	const TArray<FVector>& InstanceCenters;
+	const int32 Axis;
+
+	FCompareInstanceCenters(const TArray<FVector>& InInstanceCenters, int32 InAxis)
+		: InstanceCenters(InInstanceCenters)
+		, Axis(InAxis)
+	{
+	}
+
+	FORCEINLINE bool operator()(int32 A, int32 B) const
+	{
+		return InstanceCenters[A][Axis] < InstanceCenters[B][Axis];
+	}
+};
+
+void UHierarchicalInstancedStaticMeshComponent::BuildTree()
+{
+	ClusterTree.Empty();
+	SortedInstances.Empty();
+
+	const int32 NumInstances = PerInstanceSMData.Num();
+	if( NumInstances == 0 || StaticMesh == NULL )
+	{
+		return;
+	}
+
+	// Component space bounds of each instance
+	const FBox MeshBox = StaticMesh->GetBounds().GetBox();
+	TArray<FBox> InstanceBoxes;
+	TArray<FVector> InstanceCenters;
+	InstanceBoxes.AddUninitialized(NumInstances);
+	InstanceCenters.AddUninitialized(NumInstances);
+	SortedInstances.AddUninitialized(NumInstances);
+	for( int32 InstanceIndex = 0; InstanceIndex < NumInstances; InstanceIndex++ )
+	{
+		InstanceBoxes[InstanceIndex] = MeshBox.TransformBy(PerInstanceSMData[InstanceIndex].Transform);
+		InstanceCenters[InstanceIndex] = InstanceBoxes[InstanceIndex].GetCenter();
+		SortedInstances[InstanceIndex] = InstanceIndex;
+	}
+
+	const int32 LeafSize = FMath::Max(MaxInstancesPerLeaf, 1);
+	ClusterTree.Empty(FMath::Max(1, 2 * NumInstances / LeafSize));
+	new(ClusterTree) FInstanceClusterNode(0, NumInstances - 1);
+
+	// Nodes are split breadth first, so the children of a node are next to each other in the tree
+	for( int32 NodeIndex = 0; NodeIndex < ClusterTree.Num(); NodeIndex++ )
+	{
+		const int32 FirstInstance = ClusterTree[NodeIndex].FirstInstance;
+		const int32 LastInstance = ClusterTree[NodeIndex].LastInstance;
+
+		FBox NodeBox(0);
+		FBox CenterBox(0);
+		for( int32 SortedIndex = FirstInstance; SortedIndex <= LastInstance; SortedIndex++ )
+		{
+			NodeBox += InstanceBoxes[SortedInstances[SortedIndex]];
+			CenterBox += InstanceCenters[SortedInstances[SortedIndex]];
+		}
+		ClusterTree[NodeIndex].BoundMin = NodeBox.Min;
+		ClusterTree[NodeIndex].BoundMax = NodeBox.Max;
+
+		const int32 NodeInstances = LastInstance - FirstInstance + 1;
+		if( NodeInstances <= LeafSize )
+		{
+			continue;
+		}
+
+		// Split the instances in half along the axis their centers are most spread out on
+		const FVector CenterExtent = CenterBox.GetExtent();
+		const int32 SplitAxis = CenterExtent.X >= CenterExtent.Y && CenterExtent.X >= CenterExtent.Z ? 0 : (CenterExtent.Y >= CenterExtent.Z ? 1 : 2);
+		Sort(&SortedInstances[FirstInstance], NodeInstances, FCompareInstanceCenters(InstanceCenters, SplitAxis));
+
+		const int32 SplitInstance = FirstInstance + NodeInstances / 2;
+		const int32 FirstChild = ClusterTree.Num();
+		new(ClusterTree) FInstanceClusterNode(FirstInstance, SplitInstance - 1);
+		new(ClusterTree) FInstanceClusterNode(SplitInstance, LastInstance);
+
+		ClusterTree[NodeIndex].FirstChild = FirstChild;
+		ClusterTree[NodeIndex].LastChild = FirstChild + 1;
+	}
+}
+
+FPrimitiveSceneProxy* UHierarchicalInstancedStaticMeshComponent::CreateSceneProxy()
+{
+	// We don't support instancing on ES2
+	if( GRHIFeatureLevel == ERHIFeatureLevel::ES2 )
+	{
+		return NULL;
+	}
+
+	if( PerInstanceSMData.Num() > 0 && StaticMesh && StaticMesh->HasValidRenderData() )
+	{
+		// Same as the instanced static mesh, the seed is saved with the component
+		while( InstancingRandomSeed == 0 )
+		{
+			InstancingRandomSeed = FMath::Rand();
+		}
+
+		// The instances may have been changed in place since the last proxy was created, so always rebuild
+		BuildTree();
+
+		return ::new FHierarchicalStaticMeshSceneProxy(this);
+	}
+	return NULL;
+}
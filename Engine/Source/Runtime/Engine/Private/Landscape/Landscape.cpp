@@ -507,11 +507,17 @@ ALandscapeProxy::ALandscapeProxy(const class FPostConstructInitializeProperties&
 	bCastStaticShadow = true;
 	bUsedForNavigation = true;
 	CollisionThickness = 16;
+	SimpleCollisionMipLevel = 2;
+	CollisionStreamingDistance = 50000.0f;
 	BodyInstance.SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
 #if WITH_EDITORONLY_DATA
 	MaxPaintedLayersPerComponent = 0;
 #endif
 
+	// Only drives the collision streaming, which doesn't need to react every frame
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.TickInterval = 0.25f;
+
 	if (DataLayer==NULL)
 	{
 		DataLayer = ConstructorStatics.DataLayer.Get();
@@ -763,6 +769,61 @@ bool ALandscapeProxy::UpdateNavigationRelevancy()
 	return bUsedForNavigation; 
 }
 
+void ALandscapeProxy::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	UpdateCollisionStreaming();
+}
+
+void ALandscapeProxy::UpdateCollisionStreaming()
+{
+	UWorld* World = GetWorld();
+	if (World == NULL || !World->IsGameWorld())
+	{
+		return;
+	}
+
+	// Collision is needed around the views, and around pawns that move on the landscape without being looked at, e.g. on servers
+	TArray<FVector> StreamingOrigins;
+	if (GStreamingManager)
+	{
+		for (int32 ViewIndex = 0; ViewIndex < GStreamingManager->GetNumViews(); ViewIndex++)
+		{
+			StreamingOrigins.Add(GStreamingManager->GetViewInformation(ViewIndex).ViewOrigin);
+		}
+	}
+	for (FConstPawnIterator Iterator = World->GetPawnIterator(); Iterator; ++Iterator)
+	{
+		APawn* Pawn = *Iterator;
+		if (Pawn != NULL)
+		{
+			StreamingOrigins.Add(Pawn->GetActorLocation());
+		}
+	}
+
+	static const auto CVarCollisionStreaming = IConsoleManager::Get().FindTConsoleVariableDataInt(TEXT("landscape.CollisionStreaming"));
+	const bool bStreamingEnabled = CVarCollisionStreaming->GetValueOnGameThread() != 0;
+	const float StreamingDistanceSquared = FMath::Square(CollisionStreamingDistance);
+
+	for (int32 ComponentIndex = 0; ComponentIndex < CollisionComponents.Num(); ComponentIndex++)
+	{
+		ULandscapeHeightfieldCollisionComponent* Component = CollisionComponents[ComponentIndex];
+		if (Component == NULL || !Component->IsRegistered() || !Component->CanStreamCollision())
+		{
+			continue;
+		}
+
+		bool bWantFullCollision = !bStreamingEnabled;
+		const FBox ComponentBox = Component->Bounds.GetBox();
+		for (int32 OriginIndex = 0; OriginIndex < StreamingOrigins.Num() && !bWantFullCollision; OriginIndex++)
+		{
+			bWantFullCollision = ComponentBox.ComputeSquaredDistanceToPoint(StreamingOrigins[OriginIndex]) <= StreamingDistanceSquared;
+		}
+		Component->UpdateCollisionStreaming(bWantFullCollision);
+	}
+}
+
 FBox ALandscapeProxy::GetComponentsBoundingBox(bool bNonColliding) const 
 {
 	FBox Bounds = Super::GetComponentsBoundingBox(bNonColliding);
@@ -1290,6 +1351,8 @@ void ALandscapeProxy::GetSharedProperties(ALandscapeProxy* Landscape)
 		SubsectionSizeQuads = Landscape->SubsectionSizeQuads;
 		MaxLODLevel = Landscape->MaxLODLevel;
 		LODDistanceFactor = Landscape->LODDistanceFactor;
+		SimpleCollisionMipLevel = Landscape->SimpleCollisionMipLevel;
+		CollisionStreamingDistance = Landscape->CollisionStreamingDistance;
 		if (!LandscapeMaterial)
 		{
 			LandscapeMaterial = Landscape->LandscapeMaterial;
@@ -15,6 +15,10 @@ LandscapeCollision.cpp: Landscape collision
 
 TMap<FGuid, ULandscapeHeightfieldCollisionComponent::FPhysXHeightfieldRef* > GSharedHeightfieldRefs;
 
+static TAutoConsoleVariable<int32> CVarLandscapeCollisionStreaming(
+	TEXT("landscape.CollisionStreaming"),1,
+	TEXT("If 1, distant landscape components use their simplified collision and stream the full resolution collision in when a view or pawn gets close."));
+
 ULandscapeHeightfieldCollisionComponent::FPhysXHeightfieldRef::~FPhysXHeightfieldRef()
 {
 #if WITH_PHYSX
@@ -80,7 +84,10 @@ void ULandscapeHeightfieldCollisionComponent::CreatePhysicsState()
 	if( !BodyInstance.IsValidBodyInstance())
 	{
 #if WITH_PHYSX
-		int32 CollisionSizeVerts = CollisionSizeQuads+1;
+		// Distant components use the simplified collision, which covers the same area with fewer quads
+		const int32 ActiveCollisionSizeQuads = bSimpleCollisionActive ? SimpleCollisionSizeQuads : CollisionSizeQuads;
+		const float ActiveCollisionScale = CollisionScale * (float)CollisionSizeQuads / (float)ActiveCollisionSizeQuads;
+		int32 CollisionSizeVerts = ActiveCollisionSizeQuads+1;
 
 		// Make transform for this landscape component PxActor
 		FTransform LandscapeComponentTransform = GetComponentToWorld();
@@ -139,10 +146,15 @@ void ULandscapeHeightfieldCollisionComponent::CreatePhysicsState()
 				// Necessary for background navimesh building
 				FScopeLock ScopeLock(&CollisionDataSyncObject);
 
+				// The full resolution data comes from the collision streaming when it has been read in
+				FWordBulkData& HeightData = bSimpleCollisionActive ? SimpleCollisionHeightData : CollisionHeightData;
+				FByteBulkData& LayerData = bSimpleCollisionActive ? SimpleDominantLayerData : DominantLayerData;
+				const bool bUseStreamedData = !bSimpleCollisionActive && StreamedCollisionHeights.Num() > 0;
+
 				// Look up the physical materials we'll need
 				HeightfieldRef->UsedPhysicalMaterialArray.Empty();
 				uint8* DominantLayers = NULL;
-				if( Proxy != NULL && DominantLayerData.GetElementCount() > 0 )
+				if( Proxy != NULL && LayerData.GetElementCount() > 0 )
 				{
 					for( int32 Idx=0;Idx<ComponentLayerInfos.Num();Idx++ )
 					{
@@ -165,7 +177,7 @@ void ULandscapeHeightfieldCollisionComponent::CreatePhysicsState()
 						}
 					}
 
-					DominantLayers = (uint8*)DominantLayerData.Lock(LOCK_READ_ONLY);
+					DominantLayers = bUseStreamedData ? StreamedDominantLayers.GetTypedData() : (uint8*)LayerData.Lock(LOCK_READ_ONLY);
 				}
 				else
 				{
@@ -174,8 +186,8 @@ void ULandscapeHeightfieldCollisionComponent::CreatePhysicsState()
 				}
 
 
-				uint16* Heights = (uint16*)CollisionHeightData.Lock(LOCK_READ_ONLY);
-				check(CollisionHeightData.GetElementCount()==FMath::Square(CollisionSizeVerts));
+				uint16* Heights = bUseStreamedData ? StreamedCollisionHeights.GetTypedData() : (uint16*)HeightData.Lock(LOCK_READ_ONLY);
+				check(HeightData.GetElementCount()==FMath::Square(CollisionSizeVerts));
 
 				TArray<PxHeightFieldSample> Samples;
 				Samples.AddZeroed(FMath::Square(CollisionSizeVerts));
@@ -249,10 +261,13 @@ void ULandscapeHeightfieldCollisionComponent::CreatePhysicsState()
 
 				HeightfieldRef->RBHeightfield = GPhysXSDK->createHeightField(HFDesc);
 
-				CollisionHeightData.Unlock();
-				if( DominantLayers )
+				if( !bUseStreamedData )
 				{
-					DominantLayerData.Unlock();
+					HeightData.Unlock();
+					if( DominantLayers )
+					{
+						LayerData.Unlock();
+					}
 				}
 
 				// When a component is totally hole
@@ -267,7 +282,7 @@ void ULandscapeHeightfieldCollisionComponent::CreatePhysicsState()
 		check( IsValidRef(HeightfieldRef) );
 
 		// Create the geometry
-		PxHeightFieldGeometry LandscapeComponentGeom( HeightfieldRef->RBHeightfield, PxMeshGeometryFlags(), LandscapeScale.Z * LANDSCAPE_ZSCALE, LandscapeScale.Y * CollisionScale, LandscapeScale.X * CollisionScale );
+		PxHeightFieldGeometry LandscapeComponentGeom( HeightfieldRef->RBHeightfield, PxMeshGeometryFlags(), LandscapeScale.Z * LANDSCAPE_ZSCALE, LandscapeScale.Y * ActiveCollisionScale, LandscapeScale.X * ActiveCollisionScale );
 		check(LandscapeComponentGeom.isValid());
 
 		// Creating both a sync and async actor, since this object is static
@@ -711,7 +726,7 @@ void ULandscapeHeightfieldCollisionComponent::UpdateHeightfieldRegion(int32 Comp
 			return;
 		}
 
-		if (BodyInstance.RigidActorSync == NULL)
+		if (BodyInstance.RigidActorSync == NULL || bSimpleCollisionActive)
 		{
 			return;
 		}
@@ -821,6 +836,12 @@ void ULandscapeHeightfieldCollisionComponent::BeginDestroy()
 	Super::BeginDestroy();
 }
 
+bool ULandscapeHeightfieldCollisionComponent::IsReadyForFinishDestroy()
+{
+	// The streamed data can't be freed while reads into it are in flight
+	return Super::IsReadyForFinishDestroy() && PendingCollisionStreamingRequests.GetValue() == 0;
+}
+
 void ULandscapeMeshCollisionComponent::BeginDestroy()
 {
 	MeshRef = NULL;
@@ -845,6 +866,126 @@ void ULandscapeHeightfieldCollisionComponent::RecreateCollision(bool bUpdateAddC
 	}
 }
 
+bool ULandscapeHeightfieldCollisionComponent::CanStreamCollision() const
+{
+	// The full resolution data is read back in straight from the package file, which only works for lazy loaded bulk data
+	return SupportsSimpleCollision() && SimpleCollisionSizeQuads > 0
+		&& CollisionHeightData.GetFilename().Len() > 0
+		&& (DominantLayerData.GetElementCount() == 0 || DominantLayerData.GetFilename().Len() > 0);
+}
+
+/** Reads bulk data into Dest asynchronously, decrementing Counter when done */
+static void LoadCollisionBulkDataAsync(const FUntypedBulkData& BulkData, void* Dest, FThreadSafeCounter* Counter)
+{
+	Counter->Increment();
+	if( BulkData.IsStoredCompressedOnDisk() )
+	{
+		FIOSystem::Get().LoadCompressedData(
+			BulkData.GetFilename(),
+			BulkData.GetBulkDataOffsetInFile(),
+			BulkData.GetBulkDataSizeOnDisk(),
+			BulkData.GetBulkDataSize(),
+			Dest,
+			BulkData.GetDecompressionFlags(),
+			Counter,
+			AIOP_BelowNormal
+			);
+	}
+	else
+	{
+		FIOSystem::Get().LoadData(
+			BulkData.GetFilename(),
+			BulkData.GetBulkDataOffsetInFile(),
+			BulkData.GetBulkDataSize(),
+			Dest,
+			Counter,
+			AIOP_BelowNormal
+			);
+	}
+}
+
+void ULandscapeHeightfieldCollisionComponent::StartStreamingCollisionData()
+{
+	check(PendingCollisionStreamingRequests.GetValue() == 0);
+
+	StreamedCollisionHeights.Empty(CollisionHeightData.GetElementCount());
+	StreamedCollisionHeights.AddUninitialized(CollisionHeightData.GetElementCount());
+	StreamedDominantLayers.Empty(DominantLayerData.GetElementCount());
+	StreamedDominantLayers.AddUninitialized(DominantLayerData.GetElementCount());
+
+	// Data that happens to be resident already doesn't need another read
+	if( CollisionHeightData.IsBulkDataLoaded() )
+	{
+		FMemory::Memcpy(StreamedCollisionHeights.GetTypedData(), CollisionHeightData.LockReadOnly(), CollisionHeightData.GetBulkDataSize());
+		CollisionHeightData.Unlock();
+	}
+	else
+	{
+		LoadCollisionBulkDataAsync(CollisionHeightData, StreamedCollisionHeights.GetTypedData(), &PendingCollisionStreamingRequests);
+	}
+
+	if( DominantLayerData.GetElementCount() > 0 )
+	{
+		if( DominantLayerData.IsBulkDataLoaded() )
+		{
+			FMemory::Memcpy(StreamedDominantLayers.GetTypedData(), DominantLayerData.LockReadOnly(), DominantLayerData.GetBulkDataSize());
+			DominantLayerData.Unlock();
+		}
+		else
+		{
+			LoadCollisionBulkDataAsync(DominantLayerData, StreamedDominantLayers.GetTypedData(), &PendingCollisionStreamingRequests);
+		}
+	}
+}
+
+void ULandscapeHeightfieldCollisionComponent::UpdateCollisionStreaming(bool bWantFullCollision)
+{
+	check(IsInGameThread());
+
+	// The streamed data can't be touched until the reads into it are done
+	if( PendingCollisionStreamingRequests.GetValue() > 0 )
+	{
+		return;
+	}
+
+	if( bWantFullCollision )
+	{
+		if( bSimpleCollisionActive )
+		{
+			if( StreamedCollisionHeights.Num() == 0 )
+			{
+				StartStreamingCollisionData();
+				if( PendingCollisionStreamingRequests.GetValue() > 0 )
+				{
+					return;
+				}
+			}
+
+			{
+				// Necessary for background navimesh building
+				FScopeLock ScopeLock(&CollisionDataSyncObject);
+				bSimpleCollisionActive = false;
+			}
+			RecreateCollision(false);
+		}
+	}
+	else if( CanStreamCollision() )
+	{
+		const bool bWasSimpleCollisionActive = bSimpleCollisionActive;
+		{
+			// Necessary for background navimesh building
+			FScopeLock ScopeLock(&CollisionDataSyncObject);
+			bSimpleCollisionActive = true;
+			StreamedCollisionHeights.Empty();
+			StreamedDominantLayers.Empty();
+		}
+		if( !bWasSimpleCollisionActive )
+		{
+			RecreateCollision(false);
+		}
+	}
+}
+
 void ULandscapeMeshCollisionComponent::RecreateCollision(bool bUpdateAddCollision/*= true*/)
 {
 	if (!HasAnyFlags(RF_ClassDefaultObject))
@@ -864,6 +1005,18 @@ void ULandscapeHeightfieldCollisionComponent::Serialize(FArchive& Ar)
 	FScopeLock ScopeLock(&CollisionDataSyncObject);
 	CollisionHeightData.Serialize(Ar,this);
 	DominantLayerData.Serialize(Ar,this);
+
+	if (Ar.UE4Ver() >= VER_UE4_LANDSCAPE_SIMPLE_COLLISION)
+	{
+		SimpleCollisionHeightData.Serialize(Ar,this);
+		SimpleDominantLayerData.Serialize(Ar,this);
+	}
+
+	if (Ar.IsLoading())
+	{
+		// Start out with the simplified collision, the owning proxy streams the full resolution collision in where it's needed
+		bSimpleCollisionActive = CanStreamCollision() && CVarLandscapeCollisionStreaming.GetValueOnAnyThread() != 0;
+	}
 }
 
 void ULandscapeMeshCollisionComponent::Serialize(FArchive& Ar)
@@ -944,39 +1097,123 @@ void ULandscapeHeightfieldCollisionComponent::PreSave()
 			RecreateCollision(false);
 		}
 	}
+
+	ALandscapeProxy* Proxy = GetLandscapeProxy();
+	UpdateSimpleCollisionData(Proxy ? Proxy->SimpleCollisionMipLevel : 0);
 };
+
+void ULandscapeHeightfieldCollisionComponent::UpdateSimpleCollisionData(int32 SimpleCollisionMipLevel)
+{
+	// Necessary for background navimesh building
+	FScopeLock ScopeLock(&CollisionDataSyncObject);
+
+	const int32 CollisionSizeVerts = CollisionSizeQuads+1;
+	const int32 SimpleSizeVerts = CollisionSizeVerts >> FMath::Max(SimpleCollisionMipLevel, 0);
+	if( SimpleCollisionMipLevel <= 0 || SimpleSizeVerts < 2 || !SupportsSimpleCollision() || CollisionHeightData.GetElementCount() != FMath::Square(CollisionSizeVerts) )
+	{
+		SimpleCollisionSizeQuads = 0;
+		SimpleCollisionHeightData.RemoveBulkData();
+		SimpleDominantLayerData.RemoveBulkData();
+		return;
+	}
+
+	SimpleCollisionSizeQuads = SimpleSizeVerts-1;
+
+	// Vertex counts aren't powers of two, so the simplified vertices fall between the full resolution ones.
+	// The edge vertices still land exactly on the edges, so neighboring components keep lining up.
+	const float SampleStep = (float)CollisionSizeQuads / (float)SimpleCollisionSizeQuads;
+
+	const uint16* Heights = (const uint16*)CollisionHeightData.LockReadOnly();
+	SimpleCollisionHeightData.Lock(LOCK_READ_WRITE);
+	uint16* SimpleHeights = (uint16*)SimpleCollisionHeightData.Realloc(FMath::Square(SimpleSizeVerts));
+	for( int32 Y=0;Y<SimpleSizeVerts;Y++ )
+	{
+		const float SrcY = (float)Y * SampleStep;
+		const int32 Y0 = FMath::Min(FMath::Trunc(SrcY), CollisionSizeQuads-1);
+		const float FracY = SrcY - (float)Y0;
+		for( int32 X=0;X<SimpleSizeVerts;X++ )
+		{
+			const float SrcX = (float)X * SampleStep;
+			const int32 X0 = FMath::Min(FMath::Trunc(SrcX), CollisionSizeQuads-1);
+			const float FracX = SrcX - (float)X0;
+
+			const float Height = FMath::BiLerp<float>(
+				Heights[X0 + Y0*CollisionSizeVerts], Heights[X0+1 + Y0*CollisionSizeVerts],
+				Heights[X0 + (Y0+1)*CollisionSizeVerts], Heights[X0+1 + (Y0+1)*CollisionSizeVerts],
+				FracX, FracY);
+			SimpleHeights[X + Y*SimpleSizeVerts] = (uint16)FMath::Clamp<int32>(FMath::Round(Height), 0, 65535);
+		}
+	}
+	SimpleCollisionHeightData.Unlock();
+	CollisionHeightData.Unlock();
+
+	if( DominantLayerData.GetElementCount() == FMath::Square(CollisionSizeVerts) )
+	{
+		// Layers can't be blended, take the nearest full resolution vertex
+		const uint8* DominantLayers = (const uint8*)DominantLayerData.LockReadOnly();
+		SimpleDominantLayerData.Lock(LOCK_READ_WRITE);
+		uint8* SimpleDominantLayers = (uint8*)SimpleDominantLayerData.Realloc(FMath::Square(SimpleSizeVerts));
+		for( int32 Y=0;Y<SimpleSizeVerts;Y++ )
+		{
+			const int32 SrcY = FMath::Min(FMath::Round((float)Y * SampleStep), CollisionSizeQuads);
+			for( int32 X=0;X<SimpleSizeVerts;X++ )
+			{
+				const int32 SrcX = FMath::Min(FMath::Round((float)X * SampleStep), CollisionSizeQuads);
+				SimpleDominantLayers[X + Y*SimpleSizeVerts] = DominantLayers[SrcX + SrcY*CollisionSizeVerts];
+			}
+		}
+		SimpleDominantLayerData.Unlock();
+		DominantLayerData.Unlock();
+	}
+	else
+	{
+		SimpleDominantLayerData.RemoveBulkData();
+	}
+}
 #endif
 
 void ULandscapeHeightfieldCollisionComponent::GetCollisionTriangles(TArray<FVector>& OutVertexBuffer, TArray<int32>& OutIndexBuffer) const
 {
+	int32 SizeQuads = CollisionSizeQuads;
+
 	// Necessary for background navimesh building
 	{
 		FScopeLock ScopeLock(&CollisionDataSyncObject);
-		uint16* Heights = (uint16*)CollisionHeightData.LockReadOnly();
-		int32 NumHeights = FMath::Square(CollisionSizeQuads+1);
-		check(CollisionHeightData.GetElementCount()==NumHeights);
 
-		OutVertexBuffer.Empty( FMath::Square(CollisionSizeQuads+1) );
-		OutIndexBuffer.Empty( 6 * FMath::Square(CollisionSizeQuads) );
+		// Match the collision that is in the physics scene, rather than read the full resolution data back in
+		const FWordBulkData& HeightData = bSimpleCollisionActive ? SimpleCollisionHeightData : CollisionHeightData;
+		const bool bUseStreamedData = !bSimpleCollisionActive && StreamedCollisionHeights.Num() > 0;
+		SizeQuads = bSimpleCollisionActive ? SimpleCollisionSizeQuads : CollisionSizeQuads;
+		const float Scale = CollisionScale * (float)CollisionSizeQuads / (float)SizeQuads;
+
+		const uint16* Heights = bUseStreamedData ? StreamedCollisionHeights.GetTypedData() : (const uint16*)HeightData.LockReadOnly();
+		int32 NumHeights = FMath::Square(SizeQuads+1);
+		check(HeightData.GetElementCount()==NumHeights);
+
+		OutVertexBuffer.Empty( FMath::Square(SizeQuads+1) );
+		OutIndexBuffer.Empty( 6 * FMath::Square(SizeQuads) );
 
-		for( int32 Y=0;Y<=CollisionSizeQuads;Y++ )
+		for( int32 Y=0;Y<=SizeQuads;Y++ )
 		{
-			for( int32 X=0;X<=CollisionSizeQuads;X++ )
+			for( int32 X=0;X<=SizeQuads;X++ )
 			{
-				OutVertexBuffer.Add(FVector((float)X * CollisionScale, (float)Y * CollisionScale, ((float)Heights[X + Y*(CollisionSizeQuads+1)] - 32768.f) * LANDSCAPE_ZSCALE));
+				OutVertexBuffer.Add(FVector((float)X * Scale, (float)Y * Scale, ((float)Heights[X + Y*(SizeQuads+1)] - 32768.f) * LANDSCAPE_ZSCALE));
 			}
 		}
-		CollisionHeightData.Unlock();
+		if (!bUseStreamedData)
+		{
+			HeightData.Unlock();
+		}
 	}
 
-	for( int32 Y=0;Y<CollisionSizeQuads;Y++ )
+	for( int32 Y=0;Y<SizeQuads;Y++ )
 	{
-		for( int32 X=0;X<CollisionSizeQuads;X++ )
+		for( int32 X=0;X<SizeQuads;X++ )
 		{
-			int32 I00 = X+0 + (Y+0)*(CollisionSizeQuads+1);
-			int32 I01 = X+0 + (Y+1)*(CollisionSizeQuads+1);
-			int32 I10 = X+1 + (Y+0)*(CollisionSizeQuads+1);
-			int32 I11 = X+1 + (Y+1)*(CollisionSizeQuads+1);
+			int32 I00 = X+0 + (Y+0)*(SizeQuads+1);
+			int32 I01 = X+0 + (Y+1)*(SizeQuads+1);
+			int32 I10 = X+1 + (Y+0)*(SizeQuads+1);
+			int32 I11 = X+1 + (Y+1)*(SizeQuads+1);
 
 			OutIndexBuffer.Add(I00);
 			OutIndexBuffer.Add(I11);
@@ -1524,4 +1761,6 @@ ULandscapeHeightfieldCollisionComponent::ULandscapeHeightfieldCollisionComponent
 	bCanEverAffectNavigation = true;
 	bHasCustomNavigableGeometry = EHasCustomNavigableGeometry::Yes;
 	bHeightFieldDataHasHole = true;
+	SimpleCollisionSizeQuads = 0;
+	bSimpleCollisionActive = false;
 }
@@ -440,7 +440,8 @@ private:
 			OutputRegisters,
 			NumAttr,
 			ConstantTable.GetData(),
-			NumVectors
+			NumVectors,
+			UpdateScript.NativeProgram
 			);
 	}
 
@@ -1,13 +1,48 @@
 // Copyright 1998-2014 Epic Games, Inc. All Rights Reserved.
 
 #include "EnginePrivate.h"
+#include "VectorVM.h"
 
 UNiagaraScript::UNiagaraScript(const class FPostConstructInitializeProperties& PCIP)
 	: Super(PCIP)
+	, NativeProgram(NULL)
 {
 
 }
 
+void UNiagaraScript::PostLoad()
+{
+	Super::PostLoad();
+
+	BuildNativeProgram();
+}
+
+void UNiagaraScript::FinishDestroy()
+{
+	delete NativeProgram;
+	NativeProgram = NULL;
+
+	Super::FinishDestroy();
+}
+
+void UNiagaraScript::BuildNativeProgram()
+{
+	if (NativeProgram == NULL)
+	{
+		NativeProgram = new FVectorVMNativeProgram();
+	}
+
+	// Scripts the code generator can't handle keep an invalid program and are interpreted.
+	if (ByteCode.Num())
+	{
+		NativeProgram->Build(ByteCode.GetData(), ByteCode.Num());
+	}
+	else
+	{
+		NativeProgram->Release();
+	}
+}
+
 UNiagaraScriptSourceBase::UNiagaraScriptSourceBase(const class FPostConstructInitializeProperties& PCIP)
 	: Super(PCIP)
 {
@@ -49,6 +49,7 @@ namespace FXConsoleVariables
 	int32 bFreezeGPUSimulation = false;
 	int32 bFreezeParticleSimulation = false;
 	int32 bAllowAsyncTick = false;
+	int32 bAllowParallelEmitterTick = true;
 	float ParticleSlackGPU = 0.02f;
 	int32 MaxParticleTilePreAllocation = 100;
 	int32 MaxCPUParticlesPerEmitter = 1000;
@@ -91,6 +92,12 @@ namespace FXConsoleVariables
 		TEXT("allow parallel ticking of particle systems."),
 		ECVF_Cheat
 		);
+	FAutoConsoleVariableRef CVarAllowParallelEmitterTick(
+		TEXT("FX.AllowParallelEmitterTick"),
+		bAllowParallelEmitterTick,
+		TEXT("allow the emitters of an async ticking particle system to tick in parallel with each other."),
+		ECVF_Cheat
+		);
 	FAutoConsoleVariableRef CVarParticleSlackGPU(
 		TEXT("FX.ParticleSlackGPU"),
 		ParticleSlackGPU,
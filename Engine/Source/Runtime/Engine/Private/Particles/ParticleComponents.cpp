@@ -2813,6 +2813,7 @@ void UParticleSystem::ComputeCanTickInAnyThread()
 	bIsElligibleForAsyncTickComputed = true;
 
 	bIsElligibleForAsyncTick = true; // assume everything is async
+	bIsElligibleForParallelEmitterTick = true;
 	int32 EmitterIndex;
 	for (EmitterIndex = 0; EmitterIndex < Emitters.Num(); EmitterIndex++)
 	{
@@ -2824,14 +2825,25 @@ void UParticleSystem::ComputeCanTickInAnyThread()
 				UParticleLODLevel* LODLevel	= Emitter->LODLevels[LevelIndex];
 				if (LODLevel)
 				{
+					// the type data module is not part of the module list
+					if (LODLevel->TypeDataModule && !LODLevel->TypeDataModule->CanTickInParallelWithOtherEmitters())
+					{
+						bIsElligibleForParallelEmitterTick = false;
+					}
+
 					for (int32 ModuleIndex = 0; ModuleIndex < LODLevel->Modules.Num(); ModuleIndex++)
 					{
 						UParticleModule* Module	= LODLevel->Modules[ModuleIndex];
 						if (Module && !Module->CanTickInAnyThread())
 						{
 							bIsElligibleForAsyncTick = false;
+							bIsElligibleForParallelEmitterTick = false;
 							return;
 						}
+						if (Module && !Module->CanTickInParallelWithOtherEmitters())
+						{
+							bIsElligibleForParallelEmitterTick = false;
+						}
 					}
 				}
 			}
@@ -3840,13 +3852,20 @@ void UParticleSystemComponent::TickComponent(float DeltaTime, enum ELevelTick Ti
 	}
 	else
 	{
-		// set up async task and the game thread task to finalize the results.
-		AsyncWork = FSimpleDelegateGraphTask::CreateAndDispatchWhenReady(
-			FSimpleDelegateGraphTask::FDelegate::CreateUObject(this, &UParticleSystemComponent::ComputeTickComponent_Concurrent)
-			, TEXT("AsyncParticleTick")
-			, NULL
-			, ENamedThreads::AnyThread
-			);
+		// set up async task(s) and the game thread task to finalize the results.
+		if (FXConsoleVariables::bAllowParallelEmitterTick && EmitterInstances.Num() > 1 && Template->CanTickEmittersInParallel())
+		{
+			AsyncWork = DispatchParallelEmitterTicks();
+		}
+		else
+		{
+			AsyncWork = FSimpleDelegateGraphTask::CreateAndDispatchWhenReady(
+				FSimpleDelegateGraphTask::FDelegate::CreateUObject(this, &UParticleSystemComponent::ComputeTickComponent_Concurrent)
+				, TEXT("AsyncParticleTick")
+				, NULL
+				, ENamedThreads::AnyThread
+				);
+		}
 		FGraphEventRef Finalize = FSimpleDelegateGraphTask::CreateAndDispatchWhenReady(
 			FSimpleDelegateGraphTask::FDelegate::CreateUObject(this, &UParticleSystemComponent::FinalizeTickComponent)
 			, TEXT("FinalizeParticleTick")
@@ -3879,34 +3898,109 @@ void UParticleSystemComponent::ComputeTickComponent_Concurrent()
 	int32 EmitterIndex;
 	for (EmitterIndex = 0; EmitterIndex < EmitterInstances.Num(); EmitterIndex++)
 	{
-		FParticleEmitterInstance* Instance = EmitterInstances[EmitterIndex];
-
 		if (EmitterIndex + 1 < EmitterInstances.Num())
 		{
 			FParticleEmitterInstance* NextInstance = EmitterInstances[EmitterIndex+1];
 			FPlatformMisc::Prefetch(NextInstance);
 		}
 
-		if (Instance && Instance->SpriteTemplate)
+		if (TickEmitter_Concurrent(EmitterIndex))
 		{
-			check(Instance->SpriteTemplate->LODLevels.Num() > 0);
+			TotalActiveParticles += EmitterInstances[EmitterIndex]->ActiveParticles;
+		}
+	}
+}
 
-			UParticleLODLevel* LODLevel = Instance->SpriteTemplate->GetCurrentLODLevel(Instance);
-			if (LODLevel && LODLevel->bEnabled)
-			{
-				Instance->Tick(DeltaTimeTick, bSuppressSpawning);
+bool UParticleSystemComponent::TickEmitter_Concurrent(int32 EmitterIndex)
+{
+	FParticleEmitterInstance* Instance = EmitterInstances[EmitterIndex];
+	if (Instance && Instance->SpriteTemplate)
+	{
+		check(Instance->SpriteTemplate->LODLevels.Num() > 0);
+
+		UParticleLODLevel* LODLevel = Instance->SpriteTemplate->GetCurrentLODLevel(Instance);
+		if (LODLevel && LODLevel->bEnabled)
+		{
+			Instance->Tick(DeltaTimeTick, bSuppressSpawning);
 
-				if (EmitterMaterials.IsValidIndex(EmitterIndex))
+			if (EmitterMaterials.IsValidIndex(EmitterIndex))
+			{
+				if (EmitterMaterials[EmitterIndex])
 				{
-					if (EmitterMaterials[EmitterIndex])
-					{
-						Instance->CurrentMaterial = EmitterMaterials[EmitterIndex];
-					}
+					Instance->CurrentMaterial = EmitterMaterials[EmitterIndex];
 				}
-				TotalActiveParticles += Instance->ActiveParticles;
 			}
+			return true;
 		}
 	}
+	return false;
+}
+
+/**
+ *	Ticks a single emitter instance of a particle system component on a worker thread.
+ *	Only used for systems whose modules don't look at other emitters, see UParticleModule::CanTickInParallelWithOtherEmitters.
+ */
+struct FParticleEmitterTickTask
+{
+	/** Component owning the emitter */
+	UParticleSystemComponent* Component;
+	/** Index into Component->EmitterInstances */
+	int32 EmitterIndex;
+
+	FParticleEmitterTickTask(UParticleSystemComponent* InComponent, int32 InEmitterIndex)
+		: Component(InComponent)
+		, EmitterIndex(InEmitterIndex)
+	{
+	}
+
+	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_ParticleComputeTickTime);
+		FScopeCycleCounterUObject AdditionalScope(Component->AdditionalStatObject());
+		Component->TickEmitter_Concurrent(EmitterIndex);
+	}
+
+	static const TCHAR* GetTaskName()
+	{
+		return TEXT("FParticleEmitterTickTask");
+	}
+	FORCEINLINE static TStatId GetStatId()
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FParticleEmitterTickTask, STATGROUP_TaskGraphTasks);
+	}
+
+	static ENamedThreads::Type GetDesiredThread()
+	{
+		return ENamedThreads::AnyThread;
+	}
+
+	static ESubsequentsMode::Type GetSubsequentsMode() 
+	{ 
+		return ESubsequentsMode::TrackSubsequents; 
+	}
+};
+
+FGraphEventRef UParticleSystemComponent::DispatchParallelEmitterTicks()
+{
+	check(IsInGameThread());
+
+	// Events can't go straight to the component while emitters tick in parallel, each emitter gets its own buffer.
+	EmitterEventBuffers.SetNum(EmitterInstances.Num());
+
+	FGraphEventArray EmitterTasks;
+	for (int32 EmitterIndex = 0; EmitterIndex < EmitterInstances.Num(); EmitterIndex++)
+	{
+		FParticleEmitterInstance* Instance = EmitterInstances[EmitterIndex];
+		if (Instance && Instance->SpriteTemplate)
+		{
+			Instance->DeferredEvents = &EmitterEventBuffers[EmitterIndex];
+			EmitterTasks.Add(TGraphTask<FParticleEmitterTickTask>::CreateTask(NULL, ENamedThreads::GameThread).ConstructAndDispatchWhenReady(this, EmitterIndex));
+		}
+	}
+	bTickedEmittersInParallel = true;
+
+	// Gather the emitter tasks into a single event, so ForceAsyncWorkCompletion and the finalize task only have one thing to wait for.
+	return TGraphTask<FNullGraphTask>::CreateTask(&EmitterTasks, ENamedThreads::GameThread).ConstructAndDispatchWhenReady(TEXT("ParticleEmitterTickGather"));
 }
 
 void UParticleSystemComponent::FinalizeTickComponent()
@@ -3918,6 +4012,36 @@ void UParticleSystemComponent::FinalizeTickComponent()
 	}
 	AsyncWork = NULL; // this task is done
 	bNeedsFinalize = false;
+	if (bTickedEmittersInParallel)
+	{
+		// Gather the results of the emitter tasks in emitter order, this matches what a serial tick would have produced.
+		bTickedEmittersInParallel = false;
+		for (int32 EmitterIndex = 0; EmitterIndex < EmitterInstances.Num(); EmitterIndex++)
+		{
+			FParticleEmitterInstance* Instance = EmitterInstances[EmitterIndex];
+			if (Instance && Instance->SpriteTemplate)
+			{
+				Instance->DeferredEvents = NULL;
+
+				UParticleLODLevel* LODLevel = Instance->SpriteTemplate->GetCurrentLODLevel(Instance);
+				if (LODLevel && LODLevel->bEnabled)
+				{
+					TotalActiveParticles += Instance->ActiveParticles;
+				}
+			}
+
+			if (EmitterEventBuffers.IsValidIndex(EmitterIndex))
+			{
+				FParticleEmitterEventBuffer& EventBuffer = EmitterEventBuffers[EmitterIndex];
+				SpawnEvents.Append(EventBuffer.SpawnEvents);
+				DeathEvents.Append(EventBuffer.DeathEvents);
+				BurstEvents.Append(EventBuffer.BurstEvents);
+				EventBuffer.SpawnEvents.Reset();
+				EventBuffer.DeathEvents.Reset();
+				EventBuffer.BurstEvents.Reset();
+			}
+		}
+	}
 	if (FXConsoleVariables::bFreezeParticleSimulation == false)
 	{
 		int32 EmitterIndex;
@@ -5621,6 +5745,43 @@ void UParticleSystemComponent::ReportEventBurst(const FName InEventName, const f
 	BurstData->EventData = InEventData;
 }
 
+void FParticleEmitterEventBuffer::ReportEventSpawn(const FName InEventName, const float InEmitterTime, 
+	const FVector InLocation, const FVector InVelocity, const TArray<UParticleModuleEventSendToGame*>& InEventData)
+{
+	FParticleEventSpawnData* SpawnData = new(SpawnEvents)FParticleEventSpawnData;
+	SpawnData->Type = EPET_Spawn;
+	SpawnData->EventName = InEventName;
+	SpawnData->EmitterTime = InEmitterTime;
+	SpawnData->Location = InLocation;
+	SpawnData->Velocity = InVelocity;
+	SpawnData->EventData = InEventData;
+}
+
+void FParticleEmitterEventBuffer::ReportEventDeath(const FName InEventName, const float InEmitterTime, 
+	const FVector InLocation, const FVector InVelocity, const TArray<UParticleModuleEventSendToGame*>& InEventData, const float InParticleTime)
+{
+	FParticleEventDeathData* DeathData = new(DeathEvents)FParticleEventDeathData;
+	DeathData->Type = EPET_Death;
+	DeathData->EventName = InEventName;
+	DeathData->EmitterTime = InEmitterTime;
+	DeathData->Location = InLocation;
+	DeathData->Velocity = InVelocity;
+	DeathData->EventData = InEventData;
+	DeathData->ParticleTime = InParticleTime;
+}
+
+void FParticleEmitterEventBuffer::ReportEventBurst(const FName InEventName, const float InEmitterTime, const int32 InParticleCount,
+	const FVector InLocation, const TArray<UParticleModuleEventSendToGame*>& InEventData)
+{
+	FParticleEventBurstData* BurstData = new(BurstEvents)FParticleEventBurstData;
+	BurstData->Type = EPET_Burst;
+	BurstData->EventName = InEventName;
+	BurstData->EmitterTime = InEmitterTime;
+	BurstData->ParticleCount = InParticleCount;
+	BurstData->Location = InLocation;
+	BurstData->EventData = InEventData;
+}
+
 void UParticleSystemComponent::GenerateParticleEvent(const FName InEventName, const float InEmitterTime,
 	const FVector InLocation, const FVector InDirection, const FVector InVelocity)
 {
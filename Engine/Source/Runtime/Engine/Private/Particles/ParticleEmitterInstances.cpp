@@ -212,6 +212,7 @@ FParticleEmitterInstance::FParticleEmitterInstance() :
 	, MaxEventCount(0)
 #endif	//#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
 	, PositionOffsetThisTick(0)
+	, DeferredEvents(NULL)
 	, PivotOffset(-0.5f,-0.5f)
 {
 }
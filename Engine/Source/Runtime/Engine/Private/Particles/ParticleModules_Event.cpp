@@ -114,8 +114,16 @@ bool UParticleModuleEventGenerator::HandleParticleSpawned(FParticleEmitterInstan
 		{
 			if (EventGenInfo.Frequency == 0 || (EventPayload->SpawnTrackingCount % EventGenInfo.Frequency) == 0)
 			{
-				Owner->Component->ReportEventSpawn(EventGenInfo.CustomName, Owner->EmitterTime, 
-					NewParticle->Location, NewParticle->Velocity, EventGenInfo.ParticleModuleEventsToSendToGame);
+				if (Owner->DeferredEvents)
+				{
+					Owner->DeferredEvents->ReportEventSpawn(EventGenInfo.CustomName, Owner->EmitterTime, 
+						NewParticle->Location, NewParticle->Velocity, EventGenInfo.ParticleModuleEventsToSendToGame);
+				}
+				else
+				{
+					Owner->Component->ReportEventSpawn(EventGenInfo.CustomName, Owner->EmitterTime, 
+						NewParticle->Location, NewParticle->Velocity, EventGenInfo.ParticleModuleEventsToSendToGame);
+				}
 				bProcessed = true;
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
 				Owner->EventCount++;
@@ -142,9 +150,18 @@ bool UParticleModuleEventGenerator::HandleParticleKilled(FParticleEmitterInstanc
 		{
 			if (EventGenInfo.Frequency == 0 || (EventPayload->DeathTrackingCount % EventGenInfo.Frequency) == 0)
 			{
-				Owner->Component->ReportEventDeath(EventGenInfo.CustomName, 
-					Owner->EmitterTime, DeadParticle->Location, DeadParticle->Velocity, 
-					EventGenInfo.ParticleModuleEventsToSendToGame, DeadParticle->RelativeTime);
+				if (Owner->DeferredEvents)
+				{
+					Owner->DeferredEvents->ReportEventDeath(EventGenInfo.CustomName, 
+						Owner->EmitterTime, DeadParticle->Location, DeadParticle->Velocity, 
+						EventGenInfo.ParticleModuleEventsToSendToGame, DeadParticle->RelativeTime);
+				}
+				else
+				{
+					Owner->Component->ReportEventDeath(EventGenInfo.CustomName, 
+						Owner->EmitterTime, DeadParticle->Location, DeadParticle->Velocity, 
+						EventGenInfo.ParticleModuleEventsToSendToGame, DeadParticle->RelativeTime);
+				}
 				bProcessed = true;
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
 				Owner->EventCount++;
@@ -226,8 +243,16 @@ bool UParticleModuleEventGenerator::HandleParticleBurst(FParticleEmitterInstance
 		{
 			if (EventGenInfo.Frequency == 0 || (EventPayload->BurstTrackingCount % EventGenInfo.Frequency) == 0)
 			{
-				Owner->Component->ReportEventBurst(EventGenInfo.CustomName, Owner->EmitterTime, ParticleCount, 
-					Owner->Location, EventGenInfo.ParticleModuleEventsToSendToGame);
+				if (Owner->DeferredEvents)
+				{
+					Owner->DeferredEvents->ReportEventBurst(EventGenInfo.CustomName, Owner->EmitterTime, ParticleCount, 
+						Owner->Location, EventGenInfo.ParticleModuleEventsToSendToGame);
+				}
+				else
+				{
+					Owner->Component->ReportEventBurst(EventGenInfo.CustomName, Owner->EmitterTime, ParticleCount, 
+						Owner->Location, EventGenInfo.ParticleModuleEventsToSendToGame);
+				}
 				bProcessed = true;
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
 				Owner->EventCount++;
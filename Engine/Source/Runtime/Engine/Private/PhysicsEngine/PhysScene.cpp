@@ -15,6 +15,10 @@
 #define USE_SPECIAL_FRICTION_MODEL_FOR_ASYNC_SCENE	0
 
 static int32 PhysXSceneCount = 1;
+
+static FAutoConsoleVariable CVarBatchPhysicsSync(
+	TEXT("p.BatchPhysicsSync"), 1,
+	TEXT("0: move each simulated component and update its overlaps one at a time, 1: move all simulated components first, then update overlaps in a single pass\n"));
 static const int PhysXSlowRebuildRate = 10;
 
 FORCEINLINE EPhysicsSceneType SceneType(const FBodyInstance * BodyInstance)
@@ -472,11 +476,105 @@ void FPhysScene::ProcessPhysScene(uint32 SceneType)
 	bPhysXSceneExecuting[SceneType] = false;
 }
 
+/** Component that needs to be moved to match its physics body, gathered by SyncComponentsToBodies() */
+struct FPhysSyncEntry
+{
+	TWeakObjectPtr<UPrimitiveComponent> Component;
+	FTransform NewTransform;
+	bool bMoved;
+
+	FPhysSyncEntry(UPrimitiveComponent* InComponent, const FTransform& InNewTransform)
+		: Component(InComponent)
+		, NewTransform(InNewTransform)
+		, bMoved(false)
+	{
+	}
+};
+
 void FPhysScene::SyncComponentsToBodies(uint32 SceneType)
 {
 #if WITH_PHYSX
 	PxScene* PScene = GetPhysXScene(SceneType);
 	check(PScene);
+
+	if (CVarBatchPhysicsSync->GetInt() == 0)
+	{
+		SyncComponentsToBodies_Unbatched(PScene);
+		return;
+	}
+
+	// Gather all the new transforms under a single lock. The active transforms already hold the final pose of each actor, so there is no need to ask the body for it again.
+	TArray<FPhysSyncEntry> SyncEntries;
+
+	SCENE_LOCK_READ(PScene);
+	{
+		PxU32 NumTransforms = 0;
+		const PxActiveTransform* PActiveTransforms = PScene->getActiveTransforms(NumTransforms);
+		SyncEntries.Reserve(NumTransforms);
+
+		for(PxU32 TransformIdx=0; TransformIdx<NumTransforms; TransformIdx++)
+		{
+			const PxActiveTransform& PActiveTransform = PActiveTransforms[TransformIdx];
+			FBodyInstance* BodyInst = FPhysxUserData::Get<FBodyInstance>(PActiveTransform.userData);
+			if(	BodyInst != NULL && 
+				BodyInst->InstanceBodyIndex == INDEX_NONE && 
+				BodyInst->OwnerComponent != NULL &&
+				BodyInst->IsInstanceSimulatingPhysics() )
+			{
+				check(BodyInst->OwnerComponent->IsRegistered()); // shouldn't have a physics body for a non-registered component!
+				new(SyncEntries) FPhysSyncEntry(BodyInst->OwnerComponent.Get(), P2UTransform(PActiveTransform.actor2World));
+			}
+		}
+	}
+	SCENE_UNLOCK_READ(PScene);
+
+	if(SyncEntries.Num() == 0)
+	{
+		return;
+	}
+
+	// Move all the components first. Overlaps are skipped here, so no gameplay events can fire until every component is in its final place.
+	for(int32 EntryIdx=0; EntryIdx<SyncEntries.Num(); EntryIdx++)
+	{
+		FPhysSyncEntry& Entry = SyncEntries[EntryIdx];
+		UPrimitiveComponent* Component = Entry.Component.Get();
+		if(Component != NULL && !Entry.NewTransform.EqualsNoScale(Component->ComponentToWorld))
+		{
+			const FVector MoveBy = Entry.NewTransform.GetLocation() - Component->ComponentToWorld.GetLocation();
+			const FRotator NewRotation = Entry.NewTransform.Rotator();
+
+			Entry.bMoved = Component->MoveComponent(MoveBy, NewRotation, false, NULL, MOVECOMP_SkipPhysicsMove | MOVECOMP_SkipOverlapUpdate);
+		}
+	}
+
+	// Now update overlaps and check world bounds, in the same order the bodies were reported in. Events fired from here may destroy components further down the list, hence the weak pointers.
+	for(int32 EntryIdx=0; EntryIdx<SyncEntries.Num(); EntryIdx++)
+	{
+		const FPhysSyncEntry& Entry = SyncEntries[EntryIdx];
+		UPrimitiveComponent* Component = Entry.Component.Get();
+		if(Component == NULL || Component->IsPendingKill())
+		{
+			continue;
+		}
+
+		if(Entry.bMoved)
+		{
+			Component->UpdateOverlaps();
+		}
+
+		// Check if we didn't fall out of the world
+		AActor* Owner = Component->GetOwner();
+		if(Owner != NULL && !Owner->IsPendingKill())
+		{
+			Owner->CheckStillInWorld();
+		}
+	}
+#endif
+}
+
+#if WITH_PHYSX
+void FPhysScene::SyncComponentsToBodies_Unbatched(PxScene* PScene)
+{
 	SCENE_LOCK_READ(PScene);
 
 	PxU32 NumTransforms = 0;
@@ -518,8 +616,8 @@ void FPhysScene::SyncComponentsToBodies(uint32 SceneType)
 			}
 		}
 	}
-#endif
 }
+#endif
 
 void FPhysScene::DispatchPhysCollisionNotifies()
 {
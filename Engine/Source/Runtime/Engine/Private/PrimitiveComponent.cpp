@@ -1443,7 +1443,7 @@ bool UPrimitiveComponent::MoveComponent( const FVector& Delta, const FRotator& N
 			check(ScopedUpdate != NULL);
 			ScopedUpdate->AppendOverlaps(PendingOverlaps, OverlapsAtEndLocationPtr);
 		}
-		else
+		else if (bSweep || (MoveFlags & MOVECOMP_SkipOverlapUpdate) == MOVECOMP_NoFlags)
 		{
 			// still need to do this even if bGenerateOverlapEvents is false for this component, since we could have child components where it is true
 			UpdateOverlaps(&PendingOverlaps, true, OverlapsAtEndLocationPtr);
@@ -1961,7 +1961,8 @@ void UPrimitiveComponent::UpdateOverlaps(TArray<FOverlapInfo> const* PendingOver
 
 			// now generate full list of new touches, so we can compare to existing list and
 			// determine what changed
-			TArray<FOverlapInfo> NewOverlappingComponents;
+			FMemMark Mark(FMemStack::Get());
+			TArray<FOverlapInfo, TMemStackAllocator<> > NewOverlappingComponents;
 
 			// Might be able to avoid testing for new overlaps at the end location.
 			if (OverlapsAtEndLocation != NULL && CVarAllowCachedOverlaps->GetInt())
@@ -1998,7 +1999,7 @@ void UPrimitiveComponent::UpdateOverlaps(TArray<FOverlapInfo> const* PendingOver
 			}
 
 			// make a copy of the old that we can manipulate to avoid n^2 searching later
-			TArray< FOverlapInfo > OldOverlappingComponents = OverlappingComponents;
+			TArray< FOverlapInfo, TMemStackAllocator<> > OldOverlappingComponents(OverlappingComponents);
 
 			// Now we want to compare the old and new overlap lists to determine 
 			// what overlaps are in old and not in new (need end overlap notifies), and 
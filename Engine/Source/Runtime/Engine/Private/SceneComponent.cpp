@@ -1205,8 +1205,8 @@ bool USceneComponent::MoveComponent( const FVector& Delta, const FRotator& NewRo
 	// just teleport, sweep is supported for PrimitiveComponents.  this will update child components as well.
 	InternalSetWorldLocationAndRotation(GetComponentLocation() + Delta, NewRotation);
 
-	// Only update overlaps if not deferring updates within a scope
-	if (!IsDeferringMovementUpdates())
+	// Only update overlaps if not deferring updates within a scope, and the caller isn't going to do it for us
+	if (!IsDeferringMovementUpdates() && (MoveFlags & MOVECOMP_SkipOverlapUpdate) == MOVECOMP_NoFlags)
 	{
 		// need to update overlap detection in case PrimitiveComponents are attached.
 		UpdateOverlaps();
@@ -34,7 +34,7 @@ enum
 // In case of merge conflicts with DDC versions, you MUST generate a new GUID and set this new
 // guid as version
 
-#define TEXTURE_DERIVEDDATA_VER		TEXT("4F83E7F4EC4E4AB788364F736C9E4311")
+#define TEXTURE_DERIVEDDATA_VER		TEXT("B1E3C6F29A7D4C0E8F25D7A4163B9E52")
 
 /*------------------------------------------------------------------------------
 	Timing of derived data operations.
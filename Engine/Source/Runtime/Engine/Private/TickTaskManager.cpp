@@ -28,6 +28,14 @@ static TAutoConsoleVariable<int32> CVarAllowAsyncComponentTicks(
 	EXPERIMENTAL_PARALLEL_CODE ? 1  : 0,
 	TEXT("Used to control async component ticks."));
 
+static TAutoConsoleVariable<int32> CVarAllowTickIntervals(
+	TEXT("tick.AllowIntervals"),1,
+	TEXT("If 0, tick functions with a TickInterval tick every frame."));
+
+static TAutoConsoleVariable<int32> CVarTickIntervalBuckets(
+	TEXT("tick.IntervalBuckets"),16,
+	TEXT("Number of frame offsets newly enabled interval ticks are spread over, so that functions sharing an interval don't all tick in the same frame."));
+
 struct FTickContext
 {
 	/** Delta time to tick **/
@@ -114,6 +122,9 @@ public:
 		checkSlow(TickFunction->ActualTickGroup >=0 && TickFunction->ActualTickGroup < TG_MAX);
 
 		FTickContext UseContext = TickContext;
+		// Hand over all the time since the last tick, for ticks that skipped frames
+		UseContext.DeltaSeconds = TickFunction->AccumulatedDeltaSeconds;
+		TickFunction->AccumulatedDeltaSeconds = 0.0f;
 	   
 		bool bIsOriginalTickGroup = (TickFunction->ActualTickGroup == TickFunction->TickGroup);
 
@@ -334,6 +345,7 @@ public:
 	FTickTaskLevel()
 		: TickTaskSequencer(FTickTaskSequencer::Get())
 		, bTickNewlySpawned(false)
+		, NextTickBucket(0)
 	{
 	}
 	~FTickTaskLevel()
@@ -434,6 +446,14 @@ public:
 		check(!HasTickFunction(TickFunction));
 		if (TickFunction->bTickEnabled)
 		{
+			// Stagger the first tick so that functions sharing an interval don't all tick in the same frame
+			TickFunction->AccumulatedDeltaSeconds = 0.0f;
+			TickFunction->TimeUntilNextTick = 0.0f;
+			if (TickFunction->TickInterval > 0.0f)
+			{
+				const int32 NumBuckets = FMath::Max(CVarTickIntervalBuckets.GetValueOnGameThread(), 1);
+				TickFunction->TimeUntilNextTick = TickFunction->TickInterval * float(NextTickBucket++ % NumBuckets) / float(NumBuckets);
+			}
 			AllEnabledTickFunctions.Add(TickFunction);
 			if (bTickNewlySpawned)
 			{
@@ -450,11 +470,12 @@ public:
 	FORCEINLINE void DumpTickFunction(FOutputDevice& Ar, FTickFunction* Function, UEnum* TickGroupEnum)
 	{
 		// Info about the function.
-		Ar.Logf(TEXT("%s, %s, ActualTickGroup: %s, Prerequesities: %d"),
+		Ar.Logf(TEXT("%s, %s, ActualTickGroup: %s, Prerequesities: %d, TickInterval: %.3f"),
 			*Function->DiagnosticMessage(),
 			Function->IsTickFunctionEnabled() ? TEXT("Enabled") : TEXT("Disabled"),
 			*TickGroupEnum->GetEnumName(Function->ActualTickGroup),			
-			Function->Prerequisites.Num());
+			Function->Prerequisites.Num(),
+			Function->TickInterval);
 
 		// List all prerequisities
 		for (int32 Index = 0; Index < Function->Prerequisites.Num(); ++Index)
@@ -524,6 +545,8 @@ private:
 	FTickContext								Context;
 	/** true during the tick phase, when true, tick function adds also go to the newly spawned list. **/
 	bool										bTickNewlySpawned;
+	/** Bucket the next interval tick function added is staggered into **/
+	uint32										NextTickBucket;
 };
 
 /** Helper struct to hold completion items from parallel task. They are moved into a separate place for cache coherency **/
@@ -782,6 +805,26 @@ public:
 		Level->RemoveTickFunction(TickFunction);
 	}
 
+	/** Sets the callback that scales the interval of tick functions that allow it **/
+	virtual void SetTickSignificanceDelegate(const FTickSignificanceDelegate& InDelegate) OVERRIDE
+	{
+		check(IsInGameThread());
+		TickSignificanceDelegate = InDelegate;
+	}
+
+	/** 
+	 * Returns the factor to scale the interval of a tick function by, 1 when no significance callback is bound
+	 * @param TickFunction - tick function that is due
+	**/
+	float GetTickIntervalScale(const FTickFunction& TickFunction) const
+	{
+		if (TickSignificanceDelegate.IsBound())
+		{
+			return FMath::Max(TickSignificanceDelegate.Execute(World, TickFunction), 0.0f);
+		}
+		return 1.0f;
+	}
+
 private:
 	/** Default constructor **/
 	FTickTaskManager()
@@ -948,6 +991,8 @@ private:
 	TArray<FTickFunction*> AllTickFunctions;
 	TArray<FTickGroupCompletionItem> AllCompletionEvents;
 
+	/** Scales the interval of tick functions that allow it **/
+	FTickSignificanceDelegate					TickSignificanceDelegate;
 };
 
 
@@ -958,10 +1003,14 @@ FTickFunction::FTickFunction()
 	, bCanEverTick(false)
 	, bAllowTickOnDedicatedServer(true)
 	, bRunOnAnyThread(false)
+	, bAllowIntervalScaling(false)
+	, TickInterval(0.0f)
 	, bRegistered(false)
 	, bTickEnabled(true)
 	, TickVisitedGFrameCounter(0)
 	, TickQueuedGFrameCounter(0)
+	, TimeUntilNextTick(0.0f)
+	, AccumulatedDeltaSeconds(0.0f)
 	, ActualTickGroup(TG_PrePhysics)
 	, EnableParent(NULL)
 	, TickTaskLevel(NULL)
@@ -1047,6 +1096,29 @@ void FTickFunction::RemovePrerequisite(UObject* TargetObject, struct FTickFuncti
 	Prerequisites.Remove(FTickPrerequisite(TargetObject, TargetTickFunction));
 }
 
+/**
+ * Accumulates the frame's delta time and checks whether the tick interval has elapsed
+ * @param TickContext - context to tick in
+ * @return true if the tick function is due this frame
+**/
+bool FTickFunction::UpdateTickInterval(const struct FTickContext& TickContext)
+{
+	AccumulatedDeltaSeconds += TickContext.DeltaSeconds;
+	if (TickInterval <= 0.0f || !CVarAllowTickIntervals.GetValueOnAnyThread())
+	{
+		return true;
+	}
+	TimeUntilNextTick -= TickContext.DeltaSeconds;
+	if (TimeUntilNextTick > 0.0f)
+	{
+		return false;
+	}
+	const float Interval = bAllowIntervalScaling ? TickInterval * FTickTaskManager::Get().GetTickIntervalScale(*this) : TickInterval;
+	// Carry the overshoot into the next interval, but never owe more than one tick
+	TimeUntilNextTick = FMath::Max(TimeUntilNextTick + Interval, 0.0f);
+	return true;
+}
+
 /**
 	* Queues a tick function for execution from the game thread
 	* @param TickContext - context to tick in
@@ -1060,7 +1132,7 @@ void FTickFunction::QueueTickFunction(const struct FTickContext& TickContext)
 	{
 		TickVisitedGFrameCounter = GFrameCounter;
 		CompletionHandle = NULL; // allow the old completion handle to be recycled
-		if (bTickEnabled && (!EnableParent || EnableParent->bTickEnabled))
+		if (bTickEnabled && (!EnableParent || EnableParent->bTickEnabled) && UpdateTickInterval(TickContext))
 		{
 			ETickingGroup MaxPrerequisiteTickGroup =  ETickingGroup(0);
 
@@ -1134,7 +1206,7 @@ void FTickFunction::QueueTickFunctionParallel(const FTickContext& TickContext, T
 	{
 		check(bRegistered);
 		CompletionHandle = NULL; // allow the old completion handle to be recycled
-		if (bTickEnabled && (!EnableParent || EnableParent->bTickEnabled))
+		if (bTickEnabled && (!EnableParent || EnableParent->bTickEnabled) && UpdateTickInterval(TickContext))
 		{
 			ETickingGroup MaxPrerequisiteTickGroup =  ETickingGroup(0);
 
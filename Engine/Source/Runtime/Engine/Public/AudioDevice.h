@@ -749,6 +749,9 @@ private:
 
 	/** List of passive SoundMixes active last frame */
 	TArray<class USoundMix*> PrevPassiveSoundMixModifiers;
+
+	/** Wave instances gathered by Update(), kept around to reuse the allocation from frame to frame */
+	TArray<struct FWaveInstance*> GatheredWaveInstances;
 };
 
 
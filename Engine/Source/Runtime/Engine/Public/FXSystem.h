@@ -54,6 +54,8 @@ namespace FXConsoleVariables
 	extern int32 bFreezeParticleSimulation;
 	/** true if we allow async ticks */
 	extern int32 bAllowAsyncTick;
+	/** true if emitters of an async ticking system may tick as separate tasks */
+	extern int32 bAllowParallelEmitterTick;
 	/** Amount of slack to allocate for GPU particles to prevent tile churn as percentage of total particles. */
 	extern float ParticleSlackGPU;
 	/** Maximum tile preallocation for GPU particles. */
@@ -299,6 +299,9 @@ public:
 
 	/** Position offset for each particle. Will be reset to zero at the end of the tick	*/
 	FVector PositionOffsetThisTick;
+
+	/** If set, events generated while ticking are stored here instead of on the component (emitters ticking in parallel). */
+	struct FParticleEmitterEventBuffer* DeferredEvents;
 	
 	/** The PivotOffset applied to the vertex positions 			*/
 	FVector2D PivotOffset;
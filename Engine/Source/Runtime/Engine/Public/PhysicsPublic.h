@@ -325,6 +325,11 @@ public:
 	/** Sync components in the scene to physics bodies that changed */
 	void SyncComponentsToBodies(uint32 SceneType);
 
+#if WITH_PHYSX
+	/** Legacy path for SyncComponentsToBodies, moving and updating overlaps for one component at a time */
+	void SyncComponentsToBodies_Unbatched(physx::PxScene* PScene);
+#endif
+
 	/** Call after WaitPhysScene on the synchronous scene to make deferred OnRigidBodyCollision calls.  */
 	void DispatchPhysCollisionNotifies();
 
@@ -23,7 +23,9 @@ namespace EDrawDynamicFlags
 {
 	enum Type
 	{
-		ForceLowestLOD = 0x1
+		ForceLowestLOD = 0x1,
+		/** The elements are drawn into a shadow depth map, the view's frustum doesn't bound what ends up in it */
+		ShadowDepth = 0x2
 	};
 }
 
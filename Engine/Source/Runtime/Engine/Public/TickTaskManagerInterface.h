@@ -4,6 +4,13 @@
 #ifndef __TickTaskManagerInterface_h__
 #define __TickTaskManagerInterface_h__
 
+/** 
+ * Returns the factor to scale the TickInterval of a tick function by, e.g. larger for actors far from any view.
+ * Only called for tick functions with bAllowIntervalScaling, when they tick. With AllowConcurrentTickQueue this is called
+ * from worker threads, so it must not modify the world.
+ **/
+DECLARE_DELEGATE_RetVal_TwoParams(float, FTickSignificanceDelegate, UWorld* /*World*/, const struct FTickFunction& /*TickFunction*/);
+
 /** 
  * Interface for the tick task manager
  **/
@@ -48,6 +55,9 @@ public:
 	/** Finish a frame of ticks **/
 	virtual void EndFrame() = 0;
 
+	/** Sets the callback that scales the interval of tick functions that allow it, unbind to tick at the plain TickInterval **/
+	virtual void SetTickSignificanceDelegate(const FTickSignificanceDelegate& InDelegate) = 0;
+
 	/** Dumps all registered tick functions to output device. */
 	virtual void DumpAllTickFunctions(FOutputDevice& Ar, UWorld* InWorld, bool bEnabled, bool bDisabled) = 0;
 
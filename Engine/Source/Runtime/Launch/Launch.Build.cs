@@ -158,6 +158,11 @@ public class Launch : ModuleRules
 			DynamicallyLoadedModuleNames.Add("AndroidRuntimeSettings");
 		}
 
+		if (Target.Platform == UnrealTargetPlatform.Linux)
+		{
+			DynamicallyLoadedModuleNames.Add("AudioMixer");
+		}
+
 		if ((Target.Platform == UnrealTargetPlatform.Win32) ||
 			(Target.Platform == UnrealTargetPlatform.Win64) ||
 			(Target.Platform == UnrealTargetPlatform.Mac))
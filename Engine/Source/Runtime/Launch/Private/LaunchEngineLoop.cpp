@@ -1861,6 +1861,9 @@ void FEngineLoop::Tick()
 	{ 
 		SCOPE_CYCLE_COUNTER( STAT_FrameTime );	
 
+		// Scratch memory allocated on the game thread is released at the end of the frame at the latest.
+		FMemMark FrameMemMark(FMemStack::Get());
+
 		ENQUEUE_UNIQUE_RENDER_COMMAND(
 				BeginFrame,
 			{
@@ -2049,9 +2052,12 @@ void FEngineLoop::Tick()
 		{
 			RHIEndFrame();
 			GDynamicRHI->PopEvent();
+			FMemStack::Get().Tick();
 		});
 	} 
 
+	FMemStack::Get().Tick();
+
 	// Check for async platform hardware survey results
 	GEngine->TickHardwareSurvey();
 
@@ -70,6 +70,11 @@ public:
 		return MakeShareable(new FMessageBus(RecipientAuthorizer));
 	}
 
+	virtual ISerializeMessagesPtr CreateBsonMessageSerializer( ) OVERRIDE
+	{
+		return MakeShareable(new FBsonMessageSerializer());
+	}
+
 	virtual ISerializeMessagesPtr CreateJsonMessageSerializer( ) OVERRIDE
 	{
 		return MakeShareable(new FJsonMessageSerializer());
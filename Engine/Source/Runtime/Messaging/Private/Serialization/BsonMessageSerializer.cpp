@@ -0,0 +1,401 @@
+// Copyright 1998-2014 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	BsonMessageSerializer.cpp: Implements the FBsonMessageSerializer structure.
+=============================================================================*/
+
+#include "MessagingPrivatePCH.h"
+
+
+DEFINE_LOG_CATEGORY_STATIC(LogBsonMessageSerializer, Log, All);
+
+
+namespace BsonMessageSerializer
+{
+	/** Defines the version of the binary encoding. Increment when the wire format changes. */
+	const uint8 FormatVersion = 1;
+}
+
+
+/* FBsonMessageSerializer structors
+ *****************************************************************************/
+
+FBsonMessageSerializer::~FBsonMessageSerializer( )
+{
+	for (TMap<UStruct*, FBsonStructSchema*>::TIterator It(Schemas); It; ++It)
+	{
+		delete It.Value();
+	}
+}
+
+
+/* ISerializeMessages interface
+ *****************************************************************************/
+
+bool FBsonMessageSerializer::DeserializeMessage( FArchive& Archive, IMutableMessageContextRef& OutContext )
+{
+	// deserialize context
+	FMessageAddress Sender;
+	Archive << Sender;
+	OutContext->SetSender(Sender);
+
+	TArray<FMessageAddress> Recipients;
+	Archive << Recipients;
+
+	for (int32 RecipientIndex = 0; RecipientIndex < Recipients.Num(); ++RecipientIndex)
+	{
+		OutContext->AddRecipient(Recipients[RecipientIndex]);
+	}
+
+	TEnumAsByte<EMessageScope::Type> Scope;
+	Archive << Scope;
+	OutContext->SetScope(Scope);
+
+	FDateTime TimeSent;
+	Archive << TimeSent;
+	OutContext->SetTimeSent(TimeSent);
+
+	FDateTime Expiration;
+	Archive << Expiration;
+	OutContext->SetExpiration(Expiration);
+
+	TMap<FName, FString> Headers;
+	Archive << Headers;
+
+	for (TMap<FName, FString>::TConstIterator It(Headers); It; ++It)
+	{
+		OutContext->SetHeader(It.Key(), It.Value());
+	}
+
+	// deserialize message type header
+	uint8 Version = 0;
+	Archive << Version;
+
+	if (Archive.IsError() || (Version != BsonMessageSerializer::FormatVersion))
+	{
+		UE_LOG(LogBsonMessageSerializer, Verbose, TEXT("Unsupported message format version %i"), Version);
+
+		return false;
+	}
+
+	FString TypeName;
+	Archive << TypeName;
+
+	uint32 SchemaHash = 0;
+	Archive << SchemaHash;
+
+	if (Archive.IsError())
+	{
+		return false;
+	}
+
+	UScriptStruct* ScriptStruct = FMessageTypeMap::MessageTypeMap.Find(*TypeName);
+
+	if (ScriptStruct == nullptr)
+	{
+		UE_LOG(LogBsonMessageSerializer, Verbose, TEXT("The message type %s could not be found"), *TypeName);
+
+		return false;
+	}
+
+	const FBsonStructSchema* Schema = GetSchema(ScriptStruct);
+
+	if (Schema->Hash != SchemaHash)
+	{
+		UE_LOG(LogBsonMessageSerializer, Warning, TEXT("The layout of message type %s does not match the sender's (0x%08x, expected 0x%08x)"), *TypeName, SchemaHash, Schema->Hash);
+
+		return false;
+	}
+
+	// deserialize message
+	void* Data = FMemory::Malloc(ScriptStruct->PropertiesSize);
+	ScriptStruct->InitializeScriptStruct(Data);
+
+	if (!SerializeStruct(Data, *Schema, Archive) || Archive.IsError())
+	{
+		UE_LOG(LogBsonMessageSerializer, Verbose, TEXT("Malformed message of type %s"), *TypeName);
+
+		ScriptStruct->DestroyScriptStruct(Data);
+		FMemory::Free(Data);
+
+		return false;
+	}
+
+	OutContext->SetMessage(Data, ScriptStruct);
+
+	return true;
+}
+
+
+bool FBsonMessageSerializer::SerializeMessage( const IMessageContextRef& Context, FArchive& Archive )
+{
+	if (!Context->IsValid())
+	{
+		return false;
+	}
+
+	// serialize context
+	FMessageAddress Sender = Context->GetSender();
+	Archive << Sender;
+
+	TArray<FMessageAddress> Recipients = Context->GetRecipients();
+	Archive << Recipients;
+
+	TEnumAsByte<EMessageScope::Type> Scope = Context->GetScope();
+	Archive << Scope;
+
+	FDateTime TimeSent = Context->GetTimeSent();
+	Archive << TimeSent;
+
+	FDateTime Expiration = Context->GetExpiration();
+	Archive << Expiration;
+
+	TMap<FName, FString> Headers = Context->GetHeaders();
+	Archive << Headers;
+
+	// serialize message type header
+	UScriptStruct* TypeInfo = Context->GetMessageTypeInfo().Get();
+	const FBsonStructSchema* Schema = GetSchema(TypeInfo);
+
+	uint8 Version = BsonMessageSerializer::FormatVersion;
+	Archive << Version;
+
+	FString TypeName = TypeInfo->GetFName().ToString();
+	Archive << TypeName;
+
+	uint32 SchemaHash = Schema->Hash;
+	Archive << SchemaHash;
+
+	// serialize message; the archive is saving, so the data is not modified
+	return SerializeStruct(const_cast<void*>(Context->GetMessage()), *Schema, Archive);
+}
+
+
+/* FBsonMessageSerializer implementation
+ *****************************************************************************/
+
+bool FBsonMessageSerializer::BuildFieldSchema( UProperty* Property, FBsonFieldSchema& OutSchema )
+{
+	OutSchema.Property = Property;
+	OutSchema.ElementSize = Property->ElementSize;
+	OutSchema.StructSchema = nullptr;
+
+	if (Property->IsA(UBoolProperty::StaticClass()))
+	{
+		OutSchema.Type = EBsonFieldType::Bool;
+	}
+	else if (Property->IsA(UNumericProperty::StaticClass()))
+	{
+		OutSchema.Type = EBsonFieldType::Numeric;
+	}
+	else if (Property->GetClass() == UNameProperty::StaticClass())
+	{
+		OutSchema.Type = EBsonFieldType::Name;
+	}
+	else if (Property->GetClass() == UStrProperty::StaticClass())
+	{
+		OutSchema.Type = EBsonFieldType::String;
+	}
+	else if (Property->GetClass() == UStructProperty::StaticClass())
+	{
+		static const UScriptStruct* GuidStruct = FindObjectChecked<UScriptStruct>(UObject::StaticClass(), TEXT("Guid"));
+		UStructProperty* StructProperty = Cast<UStructProperty>(Property);
+
+		if (StructProperty->Struct == GuidStruct)
+		{
+			OutSchema.Type = EBsonFieldType::Guid;
+		}
+		else
+		{
+			OutSchema.Type = EBsonFieldType::Struct;
+			OutSchema.StructSchema = GetSchema(StructProperty->Struct);
+		}
+	}
+	else if (Property->GetClass() == UArrayProperty::StaticClass())
+	{
+		OutSchema.Type = EBsonFieldType::Array;
+		OutSchema.InnerSchema = MakeShareable(new FBsonFieldSchema());
+
+		if (!BuildFieldSchema(Cast<UArrayProperty>(Property)->Inner, *OutSchema.InnerSchema))
+		{
+			return false;
+		}
+	}
+	else
+	{
+		// object references and other types cannot be sent to remote endpoints
+		return false;
+	}
+
+	return true;
+}
+
+
+const FBsonStructSchema* FBsonMessageSerializer::GetSchema( UStruct* TypeInfo )
+{
+	FScopeLock Lock(&SchemasCriticalSection);
+
+	FBsonStructSchema* Schema = Schemas.FindRef(TypeInfo);
+
+	if (Schema == nullptr)
+	{
+		// register the schema before building it, so that self-referencing types terminate
+		Schema = new FBsonStructSchema();
+		Schema->Hash = FCrc::StrCrc32(*TypeInfo->GetName());
+		Schemas.Add(TypeInfo, Schema);
+
+		for (TFieldIterator<UProperty> It(TypeInfo, EFieldIteratorFlags::IncludeSuper); It; ++It)
+		{
+			FBsonFieldSchema Field;
+
+			if (!BuildFieldSchema(*It, Field))
+			{
+				UE_LOG(LogBsonMessageSerializer, Verbose, TEXT("Skipping unsupported property %s of type %s in %s"), *It->GetName(), *It->GetClass()->GetName(), *TypeInfo->GetName());
+
+				continue;
+			}
+
+			// the hash covers names, types and nested layouts of all encoded fields
+			int32 ArrayDim = It->ArrayDim;
+
+			Schema->Hash = FCrc::StrCrc32(*It->GetName(), Schema->Hash);
+			Schema->Hash = FCrc::StrCrc32(*It->GetClass()->GetName(), Schema->Hash);
+			Schema->Hash = FCrc::MemCrc32(&ArrayDim, sizeof(ArrayDim), Schema->Hash);
+
+			for (const FBsonFieldSchema* Inner = &Field; Inner != nullptr; Inner = Inner->InnerSchema.Get())
+			{
+				int32 FieldType = Inner->Type;
+				Schema->Hash = FCrc::MemCrc32(&FieldType, sizeof(FieldType), Schema->Hash);
+
+				// only numeric values are encoded with their in-memory size, which is the same on all platforms
+				if (Inner->Type == EBsonFieldType::Numeric)
+				{
+					Schema->Hash = FCrc::MemCrc32(&Inner->ElementSize, sizeof(Inner->ElementSize), Schema->Hash);
+				}
+
+				if (Inner->StructSchema != nullptr)
+				{
+					Schema->Hash = FCrc::MemCrc32(&Inner->StructSchema->Hash, sizeof(Inner->StructSchema->Hash), Schema->Hash);
+				}
+			}
+
+			Schema->Fields.Add(Field);
+		}
+	}
+
+	return Schema;
+}
+
+
+bool FBsonMessageSerializer::SerializeValue( void* Value, const FBsonFieldSchema& Field, FArchive& Archive ) const
+{
+	switch (Field.Type)
+	{
+	case EBsonFieldType::Bool:
+		{
+			UBoolProperty* BoolProperty = (UBoolProperty*)Field.Property;
+			uint8 BoolValue = BoolProperty->GetPropertyValue(Value) ? 1 : 0;
+
+			Archive << BoolValue;
+
+			if (Archive.IsLoading())
+			{
+				BoolProperty->SetPropertyValue(Value, BoolValue != 0);
+			}
+		}
+		break;
+
+	case EBsonFieldType::Numeric:
+		Archive.ByteOrderSerialize(Value, Field.ElementSize);
+		break;
+
+	case EBsonFieldType::Name:
+		{
+			FName& NameValue = *(FName*)Value;
+			FString NameString = NameValue.ToString();
+
+			Archive << NameString;
+
+			if (Archive.IsLoading())
+			{
+				NameValue = *NameString;
+			}
+		}
+		break;
+
+	case EBsonFieldType::String:
+		Archive << *(FString*)Value;
+		break;
+
+	case EBsonFieldType::Guid:
+		Archive << *(FGuid*)Value;
+		break;
+
+	case EBsonFieldType::Struct:
+		return SerializeStruct(Value, *Field.StructSchema, Archive);
+
+	case EBsonFieldType::Array:
+		{
+			const FBsonFieldSchema& Inner = *Field.InnerSchema;
+			FScriptArrayHelper ArrayHelper((UArrayProperty*)Field.Property, Value);
+
+			int32 ArrayNum = ArrayHelper.Num();
+			Archive << ArrayNum;
+
+			if (Archive.IsLoading())
+			{
+				// reject counts that can't possibly fit into the remaining data
+				const int64 RemainingSize = Archive.TotalSize() - Archive.Tell();
+				const bool bHasEmptyElements = (Inner.Type == EBsonFieldType::Struct) && (Inner.StructSchema->Fields.Num() == 0);
+
+				if (Archive.IsError() || (ArrayNum < 0) || (!bHasEmptyElements && (RemainingSize >= 0) && (ArrayNum > RemainingSize)))
+				{
+					return false;
+				}
+
+				ArrayHelper.EmptyAndAddValues(ArrayNum);
+			}
+
+			if ((Inner.Type == EBsonFieldType::Numeric) && (Inner.ElementSize == 1))
+			{
+				// byte arrays are copied in bulk
+				Archive.Serialize(ArrayHelper.GetRawPtr(), ArrayNum);
+			}
+			else
+			{
+				for (int32 Index = 0; Index < ArrayNum; ++Index)
+				{
+					if (!SerializeValue(ArrayHelper.GetRawPtr(Index), Inner, Archive))
+					{
+						return false;
+					}
+				}
+			}
+		}
+		break;
+
+	default:
+		return false;
+	}
+
+	return !Archive.IsError();
+}
+
+
+bool FBsonMessageSerializer::SerializeStruct( void* Data, const FBsonStructSchema& Schema, FArchive& Archive ) const
+{
+	for (int32 FieldIndex = 0; FieldIndex < Schema.Fields.Num(); ++FieldIndex)
+	{
+		const FBsonFieldSchema& Field = Schema.Fields[FieldIndex];
+
+		for (int32 ArrayIndex = 0; ArrayIndex < Field.Property->ArrayDim; ++ArrayIndex)
+		{
+			if (!SerializeValue(Field.Property->ContainerPtrToValuePtr<void>(Data, ArrayIndex), Field, Archive))
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
@@ -8,24 +8,144 @@
 
 
 /**
- * Implements a message serializer that serializes from and to Binary Json encoded data.
+ * Enumerates the kinds of fields that the binary message serializer can encode.
+ */
+namespace EBsonFieldType
+{
+	enum Type
+	{
+		/** Boolean stored as a single byte. */
+		Bool,
+
+		/** Fixed size numeric value stored in little endian byte order. */
+		Numeric,
+
+		/** Name stored as a string. */
+		Name,
+
+		/** Length prefixed string. */
+		String,
+
+		/** Globally unique identifier. */
+		Guid,
+
+		/** Nested structure described by its own schema. */
+		Struct,
+
+		/** Length prefixed dynamic array. */
+		Array
+	};
+}
+
+
+/**
+ * Describes how a single property of a message type is encoded.
+ */
+struct FBsonFieldSchema
+{
+	/** Holds the property being encoded (the inner property for array elements). */
+	UProperty* Property;
+
+	/** Holds the kind of field. */
+	EBsonFieldType::Type Type;
+
+	/** Holds the size of numeric values, in bytes. */
+	int32 ElementSize;
+
+	/** Holds the schema of the nested structure, if any. */
+	const struct FBsonStructSchema* StructSchema;
+
+	/** Holds the schema of the array elements, if any. */
+	TSharedPtr<FBsonFieldSchema> InnerSchema;
+};
+
+
+/**
+ * Describes the binary layout of a message type.
+ */
+struct FBsonStructSchema
+{
+	/** Holds the encoded fields in serialization order. */
+	TArray<FBsonFieldSchema> Fields;
+
+	/** Holds a hash of the layout, used to detect mismatching message types between endpoints. */
+	uint32 Hash;
+};
+
+
+/**
+ * Implements a message serializer that serializes from and to a compact binary encoding.
+ *
+ * The payload is written by walking the message type's properties in declaration order, so
+ * property names are not transmitted. Instead, each message carries a hash of the type's layout
+ * that is verified by the receiver. Layouts are computed once per type and cached.
  */
 class FBsonMessageSerializer
 	: public ISerializeMessages
 {
+public:
+
+	/** Destructor. */
+	~FBsonMessageSerializer( );
+
+public:
+
 	// Begin ISerializeMessages interface
 
-	virtual bool DeserializeMessage( FArchive& Archive, IMutableMessageContextRef& OutContext ) OVERRIDE
-	{
-		// not implemented yet
-		return false;
-	}
+	virtual bool DeserializeMessage( FArchive& Archive, IMutableMessageContextRef& OutContext ) OVERRIDE;
 
-	virtual bool SerializeMessage( const IMessageContextRef& Context, FArchive& Archive ) OVERRIDE
-	{
-		// not implemented yet
-		return false;
-	}
+	virtual bool SerializeMessage( const IMessageContextRef& Context, FArchive& Archive ) OVERRIDE;
 
 	// End ISerializeMessages interface
+
+protected:
+
+	/**
+	 * Builds the schema for a field.
+	 *
+	 * @param Property - The property to build the schema for.
+	 * @param OutSchema - Will hold the field's schema.
+	 *
+	 * @return true if the property can be encoded, false otherwise.
+	 */
+	bool BuildFieldSchema( UProperty* Property, FBsonFieldSchema& OutSchema );
+
+	/**
+	 * Gets the cached schema for the specified type, building it if needed.
+	 *
+	 * @param TypeInfo - The type to get the schema for.
+	 *
+	 * @return The type's schema.
+	 */
+	const FBsonStructSchema* GetSchema( UStruct* TypeInfo );
+
+	/**
+	 * Serializes a single value from or to the given archive.
+	 *
+	 * @param Value - The value to serialize.
+	 * @param Field - The value's field schema.
+	 * @param Archive - The archive to serialize from or to.
+	 *
+	 * @return true on success, false if the data is malformed.
+	 */
+	bool SerializeValue( void* Value, const FBsonFieldSchema& Field, FArchive& Archive ) const;
+
+	/**
+	 * Serializes a structure from or to the given archive.
+	 *
+	 * @param Data - The structured data to serialize.
+	 * @param Schema - The data's schema.
+	 * @param Archive - The archive to serialize from or to.
+	 *
+	 * @return true on success, false if the data is malformed.
+	 */
+	bool SerializeStruct( void* Data, const FBsonStructSchema& Schema, FArchive& Archive ) const;
+
+private:
+
+	// Holds the cached type schemas.
+	TMap<UStruct*, FBsonStructSchema*> Schemas;
+
+	// Holds a critical section for the schema cache, as messages are serialized on task graph threads.
+	FCriticalSection SchemasCriticalSection;
 };
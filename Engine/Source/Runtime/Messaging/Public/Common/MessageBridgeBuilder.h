@@ -21,6 +21,7 @@ public:
 		: Address(FMessageAddress::NewGuid())
 		, BusPtr(IMessagingModule::Get().GetDefaultBus())
 		, Disabled(false)
+		, Serializer(IMessagingModule::Get().CreateBsonMessageSerializer())
 		, Transport(NULL)
 	{ }
 
@@ -33,6 +34,7 @@ public:
 		: Address(FMessageAddress::NewGuid())
 		, BusPtr(Bus)
 		, Disabled(false)
+		, Serializer(IMessagingModule::Get().CreateBsonMessageSerializer())
 		, Transport(NULL)
 	{ }
 
@@ -51,7 +53,7 @@ public:
 	}
 
 	/**
-	 * Configures the bridge to use a custom message serializer.\
+	 * Configures the bridge to use a custom message serializer.
 	 *
 	 * @param CustomSerializer - The custom serializer.
 	 *
@@ -79,7 +81,21 @@ public:
 	}
 
 	/**
-	 * Configures the bridge to use a binary message serializer.
+	 * Configures the bridge to use the binary message serializer.
+	 *
+	 * This is the default serializer.
+	 *
+	 * @return This instance (for method chaining).
+	 */
+	FMessageBridgeBuilder& UsingBsonSerializer( )
+	{
+		Serializer = IMessagingModule::Get().CreateBsonMessageSerializer();
+
+		return *this;
+	}
+
+	/**
+	 * Configures the bridge to use a Json message serializer.
 	 *
 	 * @return This instance (for method chaining).
 	 */
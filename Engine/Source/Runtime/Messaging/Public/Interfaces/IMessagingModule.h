@@ -43,6 +43,13 @@ public:
 	 */
 	virtual IMessageBusPtr CreateBus( const IAuthorizeMessageRecipientsPtr& RecipientAuthorizer ) = 0;
 
+	/**
+	 * Creates a binary message serializer.
+	 *
+	 * @return A new serializer.
+	 */
+	virtual ISerializeMessagesPtr CreateBsonMessageSerializer( ) = 0;
+
 	/**
 	 * Creates a Json message serializer (deprecated).
 	 *
@@ -194,6 +194,14 @@ void FNetworkFileServerClientConnection::ProcessPayload( FArchive& Ar )
 		ProcessReadFile(Ar, Out);
 		break;
 
+	case NFS_Messages::ReadAt:
+		ProcessReadFileAt(Ar, Out);
+		break;
+
+	case NFS_Messages::OpenReadAndPrefetch:
+		ProcessOpenReadAndPrefetch(Ar, Out);
+		break;
+
 	case NFS_Messages::Write:
 		ProcessWriteFile(Ar, Out);
 		break;
@@ -400,6 +408,125 @@ void FNetworkFileServerClientConnection::ProcessReadFile( FArchive& In, FArchive
 }
 
 
+void FNetworkFileServerClientConnection::ProcessReadFileAt( FArchive& In, FArchive& Out )
+{
+	// Get Handle ID
+	uint64 HandleId = 0;
+	In << HandleId;
+
+	int64 Offset = 0;
+	In << Offset;
+
+	int64 BytesToRead = 0;
+	In << BytesToRead;
+
+	bool bAllowCompression = false;
+	In << bAllowCompression;
+
+	ReadFileBlock(FindOpenFile(HandleId), Offset, BytesToRead, bAllowCompression, Out);
+}
+
+
+void FNetworkFileServerClientConnection::ProcessOpenReadAndPrefetch( FArchive& In, FArchive& Out )
+{
+	// Get filename
+	FString Filename;
+	In << Filename;
+
+	int64 PrefetchSize = 0;
+	In << PrefetchSize;
+
+	bool bAllowCompression = false;
+	In << bAllowCompression;
+
+	ConvertClientFilenameToServerFilename(Filename);
+
+	TArray<FString> NewUnsolictedFiles;
+	FileRequestDelegate.ExecuteIfBound(Filename, NewUnsolictedFiles);
+
+	FDateTime ServerTimeStamp = Sandbox->GetTimeStamp(*Filename);
+	int64 ServerFileSize = 0;
+	IFileHandle* File = Sandbox->OpenRead(*Filename);
+	if (!File)
+	{
+		UE_LOG(LogFileServer, Display, TEXT("Open request for Reading failed for file %s."), *Filename);
+		ServerTimeStamp = FDateTime::MinValue(); // if this was a directory, this will make sure it is not confused with a zero byte file
+	}
+	else
+	{
+		ServerFileSize = File->Size();
+	}
+
+	uint64 HandleId = ++LastHandleId;
+	OpenFiles.Add( HandleId, File );
+
+	Out << HandleId;
+	Out << ServerTimeStamp;
+	Out << ServerFileSize;
+
+	// send the file info along, so the client doesn't need to ask for it separately
+	FFileInfo Info;
+	Info.FileExists = Sandbox->FileExists(*Filename);
+	Info.ReadOnly = Sandbox->IsReadOnly(*Filename);
+	Info.Size = Sandbox->FileSize(*Filename);
+	Info.TimeStamp = Sandbox->GetTimeStamp(*Filename);
+	Info.AccessTimeStamp = Sandbox->GetAccessTimeStamp(*Filename);
+
+	Out << Info.FileExists;
+	Out << Info.ReadOnly;
+	Out << Info.Size;
+	Out << Info.TimeStamp;
+	Out << Info.AccessTimeStamp;
+
+	// and the first block of the file
+	ReadFileBlock(File, 0, FMath::Min(PrefetchSize, ServerFileSize), bAllowCompression, Out);
+}
+
+
+void FNetworkFileServerClientConnection::ReadFileBlock( IFileHandle* File, int64 Offset, int64 BytesToRead, bool bAllowCompression, FArchive& Out )
+{
+	int64 BytesRead = 0;
+	int32 CompressedSize = 0;
+
+	TArray<uint8> Data;
+	TArray<uint8> CompressedData;
+
+	if (File && (BytesToRead > 0) && File->Seek(Offset))
+	{
+		Data.AddUninitialized(BytesToRead);
+
+		if (File->Read(Data.GetData(), BytesToRead))
+		{
+			BytesRead = BytesToRead;
+
+			// only send compressed data if it actually saves bandwidth
+			if (bAllowCompression && (BytesRead <= FCompression::MaxUncompressedSize))
+			{
+				CompressedData.AddUninitialized(BytesRead);
+				CompressedSize = (int32)BytesRead;
+
+				if (!FCompression::CompressMemory(COMPRESS_ZLIB, CompressedData.GetData(), CompressedSize, Data.GetData(), (int32)BytesRead) || (CompressedSize >= BytesRead))
+				{
+					CompressedSize = 0;
+				}
+			}
+		}
+	}
+
+	Out << BytesRead;
+	Out << CompressedSize;
+
+	if (CompressedSize > 0)
+	{
+		Out.Serialize(CompressedData.GetData(), CompressedSize);
+	}
+	else
+	{
+		Out.Serialize(Data.GetData(), BytesRead);
+	}
+}
+
+
 void FNetworkFileServerClientConnection::ProcessWriteFile( FArchive& In, FArchive& Out )
 {
 	// Get Handle ID
@@ -91,6 +91,15 @@ protected:
 	/** Reads from file. */
 	void ProcessReadFile(FArchive& In, FArchive& Out);
 
+	/** Reads a block from file at the given offset, leaving the file position undefined. */
+	void ProcessReadFileAt(FArchive& In, FArchive& Out);
+
+	/** Opens a file for reading and sends its info and first block along with the handle. */
+	void ProcessOpenReadAndPrefetch(FArchive& In, FArchive& Out);
+
+	/** Reads a block from file and writes it to the response, compressed if allowed and worthwhile. */
+	void ReadFileBlock(IFileHandle* File, int64 Offset, int64 BytesToRead, bool bAllowCompression, FArchive& Out);
+
 	/** Writes to file. */
 	void ProcessWriteFile(FArchive& In, FArchive& Out);
 
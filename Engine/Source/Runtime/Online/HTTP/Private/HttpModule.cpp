@@ -44,7 +44,7 @@ void FHttpModule::StartupModule()
 
 void FHttpModule::ShutdownModule()
 {
-#ifdef PLATFORM_WINDOWS
+#if PLATFORM_WINDOWS
 
 	// due to pecularities of some platforms (notably Windows) we need to shutdown platform http first,
 	// then delete the manager. It is more logical to have reverse order of their creation though. Proper fix
@@ -55,7 +55,8 @@ void FHttpModule::ShutdownModule()
 
 #else
 
-	// at least on Linux, the code in HTTP manager (e.g. request destructors) expects platform to be initialized yet
+	// at least on Linux, the code in HTTP manager (e.g. request destructors) expects platform to be initialized yet,
+	// and the manager's HTTP thread has to be stopped before the platform releases the handles it is using
 	delete HttpManager;	// can be passed NULLs
 
 	FPlatformHttp::Shutdown();
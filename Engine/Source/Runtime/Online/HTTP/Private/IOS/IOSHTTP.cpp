@@ -208,6 +208,12 @@ FHttpRequestProgressDelegate& FIOSHttpRequest::OnRequestProgress()
 	return RequestProgressDelegate;
 }
 
+FHttpRequestChunkReceivedDelegate& FIOSHttpRequest::OnRequestChunkReceived() 
+{
+	UE_LOG(LogHttp, Verbose, TEXT("FIOSHttpRequest::OnRequestChunkReceived()"));
+	return RequestChunkReceivedDelegate;
+}
+
 bool FIOSHttpRequest::StartRequest()
 {
 	UE_LOG(LogHttp, Verbose, TEXT("FIOSHttpRequest::StartRequest()"));
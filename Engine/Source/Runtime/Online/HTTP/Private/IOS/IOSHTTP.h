@@ -41,6 +41,7 @@ public:
 	virtual bool ProcessRequest() OVERRIDE;
 	virtual FHttpRequestCompleteDelegate& OnProcessRequestComplete() OVERRIDE;
 	virtual FHttpRequestProgressDelegate& OnRequestProgress() OVERRIDE;
+	virtual FHttpRequestChunkReceivedDelegate& OnRequestChunkReceived() OVERRIDE;
 	virtual void CancelRequest() OVERRIDE;
 	virtual EHttpRequestStatus::Type GetStatus() OVERRIDE;
 	virtual void Tick(float DeltaSeconds) OVERRIDE;
@@ -91,6 +92,8 @@ private:
 
 	/** Delegate that will get called once per tick with bytes downloaded so far */
 	FHttpRequestProgressDelegate RequestProgressDelegate;
+	/** Delegate that will get called once per tick with the response bytes received since the last tick */
+	FHttpRequestChunkReceivedDelegate RequestChunkReceivedDelegate;
 
 	/** Current status of request being processed */
 	EHttpRequestStatus::Type CompletionStatus;
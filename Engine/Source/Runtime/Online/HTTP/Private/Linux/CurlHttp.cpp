@@ -2,26 +2,26 @@
 
 #include "HttpPrivatePCH.h"
 #include "CurlHttp.h"
+#include "LinuxHttpManager.h"
 #include "EngineVersion.h"
 
 // FCurlHttpRequest
 
-FCurlHttpRequest::FCurlHttpRequest(CURLM * InMultiHandle)
-	:	MultiHandle(InMultiHandle)
-	,	EasyHandle(NULL)
+FCurlHttpRequest::FCurlHttpRequest(CURLSH * InShareHandle)
+	:	EasyHandle(NULL)
 	,	HeaderList(NULL)
 	,	bCanceled(false)
 	,	bCompleted(false)
 	,	CurlCompletionResult(CURLE_OK)
-	,	bEasyHandleAddedToMulti(false)
+	,	bAbortRequested(false)
+	,	ProgressBytesReported(0)
 	,	BytesSent(0)
 	,	CompletionStatus(EHttpRequestStatus::NotStarted)
 	,	ElapsedTime(0.0f)
 {
-	check(MultiHandle);
-	if (MultiHandle)
+	EasyHandle = curl_easy_init();
+	if (EasyHandle)
 	{
-		EasyHandle = curl_easy_init();
 
 #if !UE_BUILD_SHIPPING && !UE_BUILD_TEST
 
@@ -52,10 +52,21 @@ FCurlHttpRequest::FCurlHttpRequest(CURLM * InMultiHandle)
 			}
 		}
 
-		if (!FParse::Param(FCommandLine::Get(), TEXT("reuseconn")))
+		// share DNS and TLS session caches, so that new connections to known hosts skip the lookups and full handshakes
+		if (InShareHandle)
+		{
+			curl_easy_setopt(EasyHandle, CURLOPT_SHARE, InShareHandle);
+		}
+
+		// connections are pooled by the multi handle and kept alive between requests
+		if (FParse::Param(FCommandLine::Get(), TEXT("noreuseconn")))
 		{
 			curl_easy_setopt(EasyHandle, CURLOPT_FORBID_REUSE, 1L);
 		}
+		else
+		{
+			curl_easy_setopt(EasyHandle, CURLOPT_TCP_KEEPALIVE, 1L);
+		}
 	}
 }
 
@@ -63,11 +74,7 @@ FCurlHttpRequest::~FCurlHttpRequest()
 {
 	if (EasyHandle)
 	{
-		// we remove handle earlier if request is canceled
-		if (MultiHandle && bEasyHandleAddedToMulti)
-		{
-			curl_multi_remove_handle(MultiHandle, EasyHandle);
-		}
+		// the HTTP manager keeps the request alive until the HTTP thread is done with the handle, so it's not in the multi handle anymore
 
 		// cleanup the handle first (that order is used in howtos)
 		curl_easy_cleanup(EasyHandle);
@@ -271,6 +278,17 @@ size_t FCurlHttpRequest::ReceiveResponseHeaderCallback(void * Ptr, size_t SizeIn
 			if (Header.Split(TEXT(": "), &HeaderName, &Param))
 			{
 				Response->Headers.Add(HeaderName, Param);
+
+				// size the payload up front, so that the body can be streamed in without reallocating
+				if (HeaderName == TEXT("Content-Length"))
+				{
+					const int32 ExpectedLength = FCString::Atoi(*Param);
+					if (ExpectedLength > 0)
+					{
+						FScopeLock ScopeLock(&Response->PayloadCriticalSection);
+						Response->Payload.Reserve(Response->TotalBytesRead + ExpectedLength);
+					}
+				}
 			}
 			return HeaderSize;
 		}
@@ -297,6 +315,8 @@ size_t FCurlHttpRequest::ReceiveResponseBodyCallback(void * Ptr, size_t SizeInBl
 		// note that we can be passed 0 bytes if file transmitted has 0 length
 		if (SizeToDownload > 0)
 		{
+			// the game thread copies received chunks out of the payload, so it can't be reallocated under it
+			FScopeLock ScopeLock(&Response->PayloadCriticalSection);
 			Response->Payload.AddUninitialized(SizeToDownload);
 
 			// save
@@ -545,10 +565,13 @@ bool FCurlHttpRequest::StartRequest()
 		curl_easy_setopt(EasyHandle, CURLOPT_HTTPHEADER, HeaderList);
 	}
 
-	// add the handle for real processing
-	bEasyHandleAddedToMulti = (curl_multi_add_handle(MultiHandle, EasyHandle) == 0);
+	// the handle is added for real processing by the HTTP manager
+	bCompleted = false;
+	bAbortRequested = false;
+	ProgressBytesReported = 0;
+	CurlCompletionResult = CURLE_OK;
 
-	return bEasyHandleAddedToMulti;
+	return true;
 }
 
 bool FCurlHttpRequest::ProcessRequest()
@@ -591,6 +614,11 @@ FHttpRequestProgressDelegate& FCurlHttpRequest::OnRequestProgress()
 	return RequestProgressDelegate;
 }
 
+FHttpRequestChunkReceivedDelegate& FCurlHttpRequest::OnRequestChunkReceived()
+{
+	return RequestChunkReceivedDelegate;
+}
+
 void FCurlHttpRequest::CancelRequest()
 {
 	bCanceled = true;
@@ -603,23 +631,64 @@ EHttpRequestStatus::Type FCurlHttpRequest::GetStatus()
 
 void FCurlHttpRequest::Tick(float DeltaSeconds)
 {
-	// check for true completion/cancellation
-	if (bCompleted || bCanceled)
+	// report the response body as it streams in, including the tail end of a completed request
+	if (Response.IsValid())
+	{
+		const int32 ResponseBytes = Response->TotalBytesRead;
+		if (ResponseBytes > ProgressBytesReported)
+		{
+			if (OnRequestChunkReceived().IsBound())
+			{
+				TArray<uint8> Chunk;
+				Chunk.AddUninitialized(ResponseBytes - ProgressBytesReported);
+				{
+					FScopeLock ScopeLock(&Response->PayloadCriticalSection);
+					FMemory::Memcpy(Chunk.GetData(), Response->Payload.GetData() + ProgressBytesReported, Chunk.Num());
+				}
+				OnRequestChunkReceived().Execute(SharedThis(this), Chunk);
+			}
+
+			ProgressBytesReported = ResponseBytes;
+			OnRequestProgress().ExecuteIfBound(SharedThis(this), ResponseBytes);
+		}
+	}
+
+	// check for true completion
+	if (bCompleted)
 	{
 		FinishedRequest();
 		return;
 	}
 
+	// the HTTP thread has to let go of the handle before a canceled request can finish
+	if (bCanceled)
+	{
+		AbortRequest(CURLE_ABORTED_BY_CALLBACK);
+		return;
+	}
+
 	// keep track of elapsed seconds
 	ElapsedTime += DeltaSeconds;
 	const float HttpTimeout = FHttpModule::Get().GetHttpTimeout();
 	if (HttpTimeout > 0 && ElapsedTime >= HttpTimeout)
 	{
-		UE_LOG(LogHttp, Warning, TEXT("Timeout processing Http request. %p"),
-			this);
+		if (!bAbortRequested)
+		{
+			UE_LOG(LogHttp, Warning, TEXT("Timeout processing Http request. %p"),
+				this);
+		}
 
 		// finish it off since it is timeout
-		FinishedRequest();
+		AbortRequest(CURLE_OPERATION_TIMEDOUT);
+	}
+}
+
+void FCurlHttpRequest::AbortRequest(CURLcode Result)
+{
+	if (!bAbortRequested)
+	{
+		bAbortRequested = true;
+		static_cast< FLinuxHttpManager& >( FHttpModule::Get().GetHttpManager() ).AbortRequest(EasyHandle, Result);
 	}
 }
 
@@ -684,10 +753,12 @@ void FCurlHttpRequest::FinishedRequest()
 
 void FCurlHttpRequest::CleanupRequest()
 {
-	// remove the handle from multi
-	if (curl_multi_remove_handle(MultiHandle, EasyHandle) == 0)
+	// once completed, the handle is not in the multi handle anymore, so the headers can go (they are rebuilt if the request is processed again)
+	if (HeaderList && (bCompleted || CompletionStatus != EHttpRequestStatus::Processing))
 	{
-		bEasyHandleAddedToMulti = false;
+		curl_easy_setopt(EasyHandle, CURLOPT_HTTPHEADER, NULL);
+		curl_slist_free_all(HeaderList);
+		HeaderList = NULL;
 	}
 }
 
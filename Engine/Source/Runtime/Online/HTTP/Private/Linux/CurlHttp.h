@@ -34,6 +34,7 @@ public:
 	virtual bool ProcessRequest() OVERRIDE;
 	virtual FHttpRequestCompleteDelegate& OnProcessRequestComplete() OVERRIDE;
 	virtual FHttpRequestProgressDelegate& OnRequestProgress() OVERRIDE;
+	virtual FHttpRequestChunkReceivedDelegate& OnRequestChunkReceived() OVERRIDE;
 	virtual void CancelRequest() OVERRIDE;
 	virtual EHttpRequestStatus::Type GetStatus() OVERRIDE;
 	virtual void Tick(float DeltaSeconds) OVERRIDE;
@@ -50,7 +51,7 @@ public:
 	}
 
 	/**
-	 * Marks request as completed (set by HTTP manager).
+	 * Marks request as completed (set by HTTP manager on the game thread, once the HTTP thread no longer uses the easy handle).
 	 *
 	 * Note that this method is intended to be lightweight,
 	 * more processing will be done in Tick()
@@ -65,8 +66,10 @@ public:
 
 	/**
 	 * Constructor
+	 *
+	 * @param InShareHandle share handle used to share DNS and TLS session caches between requests
 	 */
-	FCurlHttpRequest(CURLM * InMultiHandle);
+	FCurlHttpRequest(CURLSH * InShareHandle);
 
 	/**
 	 * Destructor. Clean up any connection/request handles
@@ -184,10 +187,16 @@ private:
 	 */
 	void CleanupRequest();
 
+	/**
+	 * Asks the HTTP manager to take the request out of the transfer in progress.
+	 * The request will complete with the given result on a later tick.
+	 *
+	 * @param Result result code the request will be completed with
+	 */
+	void AbortRequest(CURLcode Result);
+
 private:
 
-	/** Pointer to parent multi handle that groups all individual easy handles */
-	CURLM *			MultiHandle;
 	/** Pointer to an easy handle specific to this request */
 	CURL *			EasyHandle;	
 	/** List of custom headers to be passed to CURL */
@@ -202,8 +211,10 @@ private:
 	bool			bCompleted;
 	/** Operation result code as returned by libcurl */
 	CURLcode		CurlCompletionResult;
-	/** Set to true when easy handle has been added to a multi handle */
-	bool			bEasyHandleAddedToMulti;
+	/** Set to true once the HTTP manager has been asked to abort the transfer */
+	bool			bAbortRequested;
+	/** Number of response bytes reported through the progress delegate */
+	int32			ProgressBytesReported;
 	/** Number of bytes sent already */
 	uint32			BytesSent;
 	/** The response object which we will use to pair with this request */
@@ -214,6 +225,8 @@ private:
 	FHttpRequestCompleteDelegate RequestCompleteDelegate;
 	/** Delegate that will get called once per tick with bytes downloaded so far */
 	FHttpRequestProgressDelegate RequestProgressDelegate;
+	/** Delegate that will get called once per tick with the response bytes received since the last tick */
+	FHttpRequestChunkReceivedDelegate RequestChunkReceivedDelegate;
 	/** Current status of request being processed */
 	EHttpRequestStatus::Type CompletionStatus;
 	/** Mapping of header section to values. */
@@ -275,10 +288,12 @@ public:
 
 private:
 
-	/** BYTE array to fill in as the response is read via didReceiveData */
+	/** BYTE array to fill in as the response is read via didReceiveData (written by the HTTP thread until the response is ready) */
 	TArray<uint8> Payload;
 	/** Caches how many bytes of the response we've read so far */
-	int32 TotalBytesRead;
+	int32 volatile TotalBytesRead;
+	/** Guards the payload while the HTTP thread appends to it and the game thread copies received chunks out */
+	FCriticalSection PayloadCriticalSection;
 	/** Cached key/value header pairs. Parsed once request completes */
 	TMap<FString, FString> Headers;
 	/** Cached code from completed response */
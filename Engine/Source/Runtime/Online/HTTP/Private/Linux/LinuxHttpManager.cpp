@@ -4,12 +4,55 @@
 #include "LinuxHttpManager.h"
 #include "CurlHttp.h"
 
+namespace LinuxHttpManager
+{
+	/** Maximum time in milliseconds the HTTP thread waits for socket activity before it looks at the incoming queues again */
+	const int32 MaxWaitTimeMs = 5;
+
+	/** Time in milliseconds the HTTP thread sleeps when there is no transfer in progress */
+	const uint32 IdleWaitTimeMs = 100;
+}
+
 FLinuxHttpManager::FLinuxHttpManager(CURLM * InMultiHandle)
 	:	FHttpManager()
 	,	MultiHandle(InMultiHandle)
-	,	LastRunningRequests(0)
+	,	WorkEvent(NULL)
+	,	Thread(NULL)
+	,	bRequestingExit(0)
 {
 	check(MultiHandle);
+
+	WorkEvent = FPlatformProcess::CreateSynchEvent();
+	Thread = FRunnableThread::Create(this, TEXT("HttpManagerThread"), false, false, 128 * 1024, TPri_Normal);
+	check(Thread);
+}
+
+FLinuxHttpManager::~FLinuxHttpManager()
+{
+	// this has to run before FLinuxPlatformHttp::Shutdown() releases the multi and share handles
+	if (Thread != NULL)
+	{
+		Thread->Kill(true);
+		delete Thread;
+		Thread = NULL;
+	}
+
+	// the HTTP thread is gone, so it is safe to release the remaining handles here
+	for (int32 Idx = 0; Idx < RunningHandles.Num(); ++Idx)
+	{
+		curl_multi_remove_handle(MultiHandle, RunningHandles[Idx]);
+	}
+	RunningHandles.Empty();
+	HandlesToAdd.Empty();
+	HandlesToAbort.Empty();
+	CompletedHandles.Empty();
+
+	// release the requests (and their easy handles) while the share handle is still alive
+	HandlesToRequests.Empty();
+	MultiHandle = NULL;
+
+	delete WorkEvent;
+	WorkEvent = NULL;
 }
 
 // note that we cannot call parent implementation because lock might be possible non-multiple
@@ -20,7 +63,16 @@ void FLinuxHttpManager::AddRequest(TSharedRef<class IHttpRequest> Request)
 	Requests.AddUnique(Request);
 
 	FCurlHttpRequest* CurlRequest = static_cast< FCurlHttpRequest* >( &Request.Get() );
-	HandlesToRequests.Add(CurlRequest->GetEasyHandle(), Request);
+	CURL* EasyHandle = CurlRequest->GetEasyHandle();
+
+	// the request is kept alive until the HTTP thread has let go of its handle
+	HandlesToRequests.Add(EasyHandle, Request);
+
+	{
+		FScopeLock QueueScopeLock(&QueueLock);
+		HandlesToAdd.Add(EasyHandle);
+	}
+	WorkEvent->Trigger();
 }
 
 // note that we cannot call parent implementation because lock might be possible non-multiple
@@ -31,59 +83,167 @@ void FLinuxHttpManager::RemoveRequest(TSharedRef<class IHttpRequest> Request)
 	// Keep track of requests that have been removed to be destroyed later
 	PendingDestroyRequests.AddUnique(FRequestPendingDestroy(DeferredDestroyDelay,Request));
 
+	// requests are normally given back by the HTTP thread before they finish, but make sure it lets go of this one
 	FCurlHttpRequest* CurlRequest = static_cast< FCurlHttpRequest* >( &Request.Get() );
-	HandlesToRequests.Remove(CurlRequest->GetEasyHandle());
+	if (HandlesToRequests.Contains(CurlRequest->GetEasyHandle()))
+	{
+		AbortRequest(CurlRequest->GetEasyHandle(), CURLE_ABORTED_BY_CALLBACK);
+	}
 
 	Requests.RemoveSingle(Request);
 }
 
+void FLinuxHttpManager::AbortRequest(CURL* EasyHandle, CURLcode Result)
+{
+	{
+		FScopeLock QueueScopeLock(&QueueLock);
+		HandlesToAbort.Add(FCompletedHandle(EasyHandle, Result));
+	}
+	WorkEvent->Trigger();
+}
+
 bool FLinuxHttpManager::Tick(float DeltaSeconds)
 {
-	check(MultiHandle);
-	if (Requests.Num() > 0)
+	TArray<FCompletedHandle> HandlesToComplete;
 	{
-		FScopeLock ScopeLock(&RequestLock);
+		FScopeLock QueueScopeLock(&QueueLock);
+		Exchange(HandlesToComplete, CompletedHandles);
+	}
 
-		int RunningRequests = -1;
-		curl_multi_perform(MultiHandle, &RunningRequests);
+	if (HandlesToComplete.Num() > 0)
+	{
+		FScopeLock ScopeLock(&RequestLock);
 
-		// read more info if number of requests changed or if there's zero running
-		// (note that some requests might have never be "running" from libcurl's point of view)
-		if (RunningRequests == 0 || RunningRequests != LastRunningRequests)
+		for (int32 Idx = 0; Idx < HandlesToComplete.Num(); ++Idx)
 		{
-			for(;;)
+			const FCompletedHandle& Completed = HandlesToComplete[Idx];
+
+			TSharedRef<IHttpRequest> * RequestRefPtr = HandlesToRequests.Find(Completed.EasyHandle);
+			if (RequestRefPtr)
+			{
+				FCurlHttpRequest* CurlRequest = static_cast< FCurlHttpRequest* >( &RequestRefPtr->Get() );
+				CurlRequest->MarkAsCompleted(Completed.Result);
+
+				UE_LOG(LogHttp, Verbose, TEXT("Request %p (easy handle:%p) has completed (code:%d) and has been marked as such"), CurlRequest, Completed.EasyHandle, Completed.Result);
+
+				// the request is still referenced by the list of active requests until it has been ticked
+				HandlesToRequests.Remove(Completed.EasyHandle);
+			}
+			else
 			{
-				int MsgsStillInQueue = 0;	// may use that to impose some upper limit we may spend in that loop
-				CURLMsg * Message = curl_multi_info_read(MultiHandle, &MsgsStillInQueue);
-
-				if (Message == NULL)
-				{
-					break;
-				}
-
-				// find out which requests have completed
-				if (Message->msg == CURLMSG_DONE)
-				{
-					CURL* CompletedHandle = Message->easy_handle;
-					TSharedRef<IHttpRequest> * RequestRefPtr = HandlesToRequests.Find(CompletedHandle);
-					if (RequestRefPtr)
-					{
-						FCurlHttpRequest* CurlRequest = static_cast< FCurlHttpRequest* >( &RequestRefPtr->Get() );
-						CurlRequest->MarkAsCompleted(Message->data.result);
-
-						UE_LOG(LogHttp, Verbose, TEXT("Request %p (easy handle:%p) has completed (code:%d) and has been marked as such"), CurlRequest, CompletedHandle, Message->data.result);
-					}
-					else
-					{
-						UE_LOG(LogHttp, Warning, TEXT("Could not find mapping for completed request (easy handle: %p)"), CompletedHandle);
-					}
-				}
+				UE_LOG(LogHttp, Warning, TEXT("Could not find mapping for completed request (easy handle: %p)"), Completed.EasyHandle);
 			}
 		}
-
-		LastRunningRequests = RunningRequests;
 	}
 
 	// we should be outside scope lock here to be able to call parent!
 	return FHttpManager::Tick(DeltaSeconds);
 }
+
+bool FLinuxHttpManager::Init()
+{
+	return true;
+}
+
+uint32 FLinuxHttpManager::Run()
+{
+	while (!bRequestingExit)
+	{
+		ProcessPendingHandles();
+
+		if (RunningHandles.Num() > 0)
+		{
+			PerformTransfers();
+
+			// wait for socket activity, but not for long as new requests may be queued meanwhile
+			int NumFds = 0;
+			curl_multi_wait(MultiHandle, NULL, 0, LinuxHttpManager::MaxWaitTimeMs, &NumFds);
+		}
+		else
+		{
+			WorkEvent->Wait(LinuxHttpManager::IdleWaitTimeMs);
+		}
+	}
+
+	return 0;
+}
+
+void FLinuxHttpManager::Stop()
+{
+	FPlatformAtomics::InterlockedExchange(&bRequestingExit, 1);
+	WorkEvent->Trigger();
+}
+
+void FLinuxHttpManager::ProcessPendingHandles()
+{
+	TArray<CURL*> NewHandles;
+	TArray<FCompletedHandle> AbortedHandles;
+	{
+		FScopeLock QueueScopeLock(&QueueLock);
+		Exchange(NewHandles, HandlesToAdd);
+		Exchange(AbortedHandles, HandlesToAbort);
+	}
+
+	for (int32 Idx = 0; Idx < NewHandles.Num(); ++Idx)
+	{
+		CURL* EasyHandle = NewHandles[Idx];
+		CURLMcode AddResult = curl_multi_add_handle(MultiHandle, EasyHandle);
+
+		if (AddResult == CURLM_OK)
+		{
+			RunningHandles.Add(EasyHandle);
+		}
+		else
+		{
+			UE_LOG(LogHttp, Warning, TEXT("Could not add easy handle %p to multi handle (code:%d)"), EasyHandle, AddResult);
+
+			FScopeLock QueueScopeLock(&QueueLock);
+			CompletedHandles.Add(FCompletedHandle(EasyHandle, CURLE_FAILED_INIT));
+		}
+	}
+
+	// handles that are not running anymore have already been completed, nothing to do for them
+	for (int32 Idx = 0; Idx < AbortedHandles.Num(); ++Idx)
+	{
+		const FCompletedHandle& Aborted = AbortedHandles[Idx];
+
+		if (RunningHandles.Remove(Aborted.EasyHandle) > 0)
+		{
+			curl_multi_remove_handle(MultiHandle, Aborted.EasyHandle);
+
+			FScopeLock QueueScopeLock(&QueueLock);
+			CompletedHandles.Add(Aborted);
+		}
+	}
+}
+
+void FLinuxHttpManager::PerformTransfers()
+{
+	int RunningRequests = -1;
+	curl_multi_perform(MultiHandle, &RunningRequests);
+
+	for(;;)
+	{
+		int MsgsStillInQueue = 0;	// may use that to impose some upper limit we may spend in that loop
+		CURLMsg * Message = curl_multi_info_read(MultiHandle, &MsgsStillInQueue);
+
+		if (Message == NULL)
+		{
+			break;
+		}
+
+		// find out which requests have completed
+		if (Message->msg == CURLMSG_DONE)
+		{
+			CURL* CompletedHandle = Message->easy_handle;
+			CURLcode Result = Message->data.result;
+
+			// the connection goes back into the multi handle's pool for reuse by the next request to the same host
+			curl_multi_remove_handle(MultiHandle, CompletedHandle);
+			RunningHandles.Remove(CompletedHandle);
+
+			FScopeLock QueueScopeLock(&QueueLock);
+			CompletedHandles.Add(FCompletedHandle(CompletedHandle, Result));
+		}
+	}
+}
@@ -5,26 +5,97 @@
 #include <curl/curl.h>
 #include "HttpManager.h"
 
-class FLinuxHttpManager : public FHttpManager
+/**
+ * Curl based HTTP manager.
+ *
+ * The multi handle is owned by a dedicated HTTP thread, which performs all transfers
+ * and keeps idle connections alive for reuse. Requests are handed over to the thread
+ * and completions are handed back through locked queues, so that requests are only
+ * ever touched by the game thread, with the exception of the libcurl data callbacks.
+ */
+class FLinuxHttpManager : public FHttpManager, public FRunnable
 {
 protected:
 
-	/** multi handle that groups all the requests - not owned by this class */
-	CURLM * MultiHandle;
+	/** Describes an easy handle that has been taken out of the multi handle by the HTTP thread */
+	struct FCompletedHandle
+	{
+		FCompletedHandle(CURL* InEasyHandle, CURLcode InResult)
+			:	EasyHandle(InEasyHandle)
+			,	Result(InResult)
+		{
+		}
+
+		/** libcurl's easy handle */
+		CURL* EasyHandle;
+		/** Operation result code as returned by libcurl */
+		CURLcode Result;
+	};
 
-	/** Cached value of running request to reduce number of read info calls*/
-	int LastRunningRequests;
+	/** multi handle that groups all the requests - not owned by this class, only used on the HTTP thread */
+	CURLM * MultiHandle;
 
-	/** Mapping of libcurl easy handles to HTTP requests */
+	/** Mapping of libcurl easy handles to HTTP requests that have been handed over to the HTTP thread (game thread only) */
 	TMap<CURL*, TSharedRef<class IHttpRequest> > HandlesToRequests;
 
+	/** Easy handles that are being processed by the multi handle (HTTP thread only) */
+	TArray<CURL*> RunningHandles;
+
+	/** Easy handles that need to be added to the multi handle */
+	TArray<CURL*> HandlesToAdd;
+
+	/** Easy handles that need to be taken out of the multi handle before they complete */
+	TArray<FCompletedHandle> HandlesToAbort;
+
+	/** Easy handles that have been taken out of the multi handle and can be given back to their requests */
+	TArray<FCompletedHandle> CompletedHandles;
+
+	/** Critical section for the queues shared between the game thread and the HTTP thread */
+	FCriticalSection QueueLock;
+
+	/** Event used to wake up the HTTP thread when there is no transfer in progress */
+	FEvent* WorkEvent;
+
+	/** The thread performing the transfers */
+	FRunnableThread* Thread;
+
+	/** Set when the HTTP thread should exit */
+	volatile int32 bRequestingExit;
+
+	/**
+	 * Moves handles from the incoming queues into or out of the multi handle (HTTP thread only).
+	 */
+	void ProcessPendingHandles();
+
+	/**
+	 * Performs the transfers and queues the handles of completed requests (HTTP thread only).
+	 */
+	void PerformTransfers();
+
 public:
 
+	/**
+	 * Takes a request that has not completed yet out of the multi handle.
+	 * The request will be marked as completed with the given result once the HTTP thread let go of it.
+	 *
+	 * @param EasyHandle libcurl's easy handle of the request
+	 * @param Result result code the request will be completed with
+	 */
+	void AbortRequest(CURL* EasyHandle, CURLcode Result);
+
 	// Begin HttpManager interface
 	virtual void AddRequest(TSharedRef<class IHttpRequest> Request) OVERRIDE;
 	virtual void RemoveRequest(TSharedRef<class IHttpRequest> Request) OVERRIDE;
 	virtual bool Tick(float DeltaSeconds) OVERRIDE;
 	// End HttpManager interface
 
+	// Begin FRunnable interface
+	virtual bool Init() OVERRIDE;
+	virtual uint32 Run() OVERRIDE;
+	virtual void Stop() OVERRIDE;
+	// End FRunnable interface
+
 	FLinuxHttpManager(CURLM * InMultiHandle);
-};
\ No newline at end of file
+
+	virtual ~FLinuxHttpManager();
+};
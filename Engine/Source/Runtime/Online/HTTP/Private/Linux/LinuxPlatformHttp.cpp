@@ -5,9 +5,41 @@
 #include "LinuxHttpManager.h"
 
 CURLM * GMultiHandle = NULL;
+CURLSH * GShareHandle = NULL;
 
 namespace
 {
+	/** Maximum number of idle connections kept alive by the multi handle */
+	const long MaxPooledConnections = 16;
+
+	/** Critical sections guarding the data shared between easy handles, one per curl_lock_data */
+	FCriticalSection ShareLocks[CURL_LOCK_DATA_LAST];
+
+	/** 
+	 * A callback that libcurl will use to lock shared data
+	 *
+	 * @param Handle easy handle accessing the shared data
+	 * @param Data kind of data being accessed
+	 * @param Access kind of access (ignored, all accesses are exclusive)
+	 * @param UserData user pointer (unused)
+	 */
+	void CurlShareLock(CURL * Handle, curl_lock_data Data, curl_lock_access Access, void * UserData)
+	{
+		ShareLocks[Data].Lock();
+	}
+
+	/** 
+	 * A callback that libcurl will use to unlock shared data
+	 *
+	 * @param Handle easy handle accessing the shared data
+	 * @param Data kind of data being accessed
+	 * @param UserData user pointer (unused)
+	 */
+	void CurlShareUnlock(CURL * Handle, curl_lock_data Data, void * UserData)
+	{
+		ShareLocks[Data].Unlock();
+	}
+
 	/** 
 	 * A callback that libcurl will use to allocate memory
 	 *
@@ -146,8 +178,26 @@ void FLinuxPlatformHttp::Init()
 		{
 			UE_LOG(LogInit, Fatal, TEXT("Could not initialize create libcurl multi handle! HTTP transfers will not function properly."));
 		}
+		else
+		{
+			curl_multi_setopt(GMultiHandle, CURLMOPT_MAXCONNECTS, MaxPooledConnections);
+		}
+
+		// DNS and TLS session caches are shared between all requests
+		GShareHandle = curl_share_init();
+		if (NULL != GShareHandle)
+		{
+			curl_share_setopt(GShareHandle, CURLSHOPT_LOCKFUNC, CurlShareLock);
+			curl_share_setopt(GShareHandle, CURLSHOPT_UNLOCKFUNC, CurlShareUnlock);
+			curl_share_setopt(GShareHandle, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+			curl_share_setopt(GShareHandle, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+		}
+		else
+		{
+			UE_LOG(LogInit, Warning, TEXT("Could not initialize libcurl share handle, DNS and TLS sessions will not be shared between requests."));
+		}
 
-		UE_LOG(LogInit, Log, TEXT("Libcurl will %s"), FParse::Param(FCommandLine::Get(), TEXT("reuseconn")) ? TEXT("reuse connections") : TEXT("NOT reuse connections"));
+		UE_LOG(LogInit, Log, TEXT("Libcurl will %s"), FParse::Param(FCommandLine::Get(), TEXT("noreuseconn")) ? TEXT("NOT reuse connections") : TEXT("reuse connections"));
 	}
 	else
 	{
@@ -165,6 +215,12 @@ class FHttpManager * FLinuxPlatformHttp::CreatePlatformHttpManager()
 
 void FLinuxPlatformHttp::Shutdown()
 {
+	if (NULL != GShareHandle)
+	{
+		curl_share_cleanup(GShareHandle);
+		GShareHandle = NULL;
+	}
+
 	if (NULL != GMultiHandle)
 	{
 		curl_multi_cleanup(GMultiHandle);
@@ -176,6 +232,6 @@ void FLinuxPlatformHttp::Shutdown()
 
 IHttpRequest* FLinuxPlatformHttp::ConstructRequest()
 {
-	return new FCurlHttpRequest(GMultiHandle);
+	return new FCurlHttpRequest(GShareHandle);
 }
 
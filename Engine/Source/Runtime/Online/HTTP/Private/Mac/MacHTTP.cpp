@@ -202,6 +202,12 @@ FHttpRequestProgressDelegate& FMacHttpRequest::OnRequestProgress()
 	return RequestProgressDelegate;
 }
 
+FHttpRequestChunkReceivedDelegate& FMacHttpRequest::OnRequestChunkReceived() 
+{
+	UE_LOG(LogHttp, Verbose, TEXT("FMacHttpRequest::OnRequestChunkReceived()"));
+	return RequestChunkReceivedDelegate;
+}
+
 
 bool FMacHttpRequest::StartRequest()
 {
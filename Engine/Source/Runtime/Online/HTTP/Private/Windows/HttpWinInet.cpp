@@ -651,6 +651,11 @@ FHttpRequestProgressDelegate& FHttpRequestWinInet::OnRequestProgress()
 	return RequestProgressDelegate;
 }
 
+FHttpRequestChunkReceivedDelegate& FHttpRequestWinInet::OnRequestChunkReceived()
+{
+	return RequestChunkReceivedDelegate;
+}
+
 void FHttpRequestWinInet::CancelRequest()
 {
 	UE_LOG(LogHttp, Log, TEXT("Canceling Http request. %p url=%s"),
@@ -40,6 +40,14 @@ DECLARE_DELEGATE_ThreeParams(FHttpRequestCompleteDelegate, FHttpRequestPtr, FHtt
  */
 DECLARE_DELEGATE_TwoParams(FHttpRequestProgressDelegate, FHttpRequestPtr, int32);
 
+/**
+ * Delegate called per tick with the part of the response body received since the last call
+ *
+ * @param first parameter - original Http request that started things
+ * @param second parameter - the newly received bytes, in the order they arrived.
+ */
+DECLARE_DELEGATE_TwoParams(FHttpRequestChunkReceivedDelegate, FHttpRequestPtr, const TArray<uint8>&);
+
 /**
  * Interface for Http requests (created using FHttpFactory)
  */
@@ -119,6 +127,12 @@ public:
 	 */
 	virtual FHttpRequestProgressDelegate& OnRequestProgress() = 0;
 
+	/**
+	 * Delegate called as the response body streams in. See FHttpRequestChunkReceivedDelegate
+	 * Only implementations that receive the body incrementally call it, currently the libcurl one.
+	 */
+	virtual FHttpRequestChunkReceivedDelegate& OnRequestChunkReceived() = 0;
+
 	/**
 	 * Called to cancel a request that is still being processed
 	 */
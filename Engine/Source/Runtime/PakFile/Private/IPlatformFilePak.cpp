@@ -15,6 +15,7 @@ DEFINE_LOG_CATEGORY(LogPakFile);
 
 FPakFile::FPakFile(const TCHAR* Filename, bool bIsSigned)
 	: PakFilename(Filename)
+	, bTriedMapping(false)
 	, bSigned(bIsSigned)
 	, bIsValid(false)
 {
@@ -28,6 +29,7 @@ FPakFile::FPakFile(const TCHAR* Filename, bool bIsSigned)
 
 FPakFile::FPakFile(IPlatformFile* LowerLevel, const TCHAR* Filename, bool bIsSigned)
 	: PakFilename(Filename)
+	, bTriedMapping(false)
 	, bSigned(bIsSigned)
 	, bIsValid(false)
 {
@@ -55,11 +57,18 @@ FArchive* FPakFile::CreatePakReader(IFileHandle& InHandle, const TCHAR* Filename
 	return SetupSignedPakReader(ReaderArchive);
 }
 
-FArchive* FPakFile::SetupSignedPakReader(FArchive* ReaderArchive)
+bool FPakFile::IsSigned() const
 {
-#if !USING_SIGNED_CONTENT
-	if (bSigned || FParse::Param(FCommandLine::Get(), TEXT("signedpak")) || FParse::Param(FCommandLine::Get(), TEXT("signed")))
+#if USING_SIGNED_CONTENT
+	return true;
+#else
+	return bSigned || FParse::Param(FCommandLine::Get(), TEXT("signedpak")) || FParse::Param(FCommandLine::Get(), TEXT("signed"));
 #endif
+}
+
+FArchive* FPakFile::SetupSignedPakReader(FArchive* ReaderArchive)
+{
+	if (IsSigned())
 	{	
 		if (!Decryptor.IsValid())
 		{
@@ -211,6 +220,24 @@ FArchive* FPakFile::GetSharedReader(IPlatformFile* LowerLevel)
 	return PakReader;
 }
 
+TSharedPtr<IMappedFileHandle, ESPMode::ThreadSafe> FPakFile::GetMappedPak(IPlatformFile* LowerLevel)
+{
+	FScopeLock ScopedLock(&CriticalSection);
+	if (!bTriedMapping)
+	{
+		bTriedMapping = true;
+		if (LowerLevel != NULL && !IsSigned())
+		{
+			IMappedFileHandle* PakMapping = LowerLevel->OpenMapped(*GetFilename());
+			if (PakMapping != NULL)
+			{
+				MappedPak = MakeShareable(PakMapping);
+			}
+		}
+	}
+	return MappedPak;
+}
+
 #if !UE_BUILD_SHIPPING
 class FPakExec : private FSelfRegisteringExec
 {
@@ -520,6 +547,50 @@ IFileHandle* FPakPlatformFile::OpenRead(const TCHAR* Filename)
 	return Result;
 }
 
+IMappedFileHandle* FPakPlatformFile::OpenMapped(const TCHAR* Filename)
+{
+	IMappedFileHandle* Result = NULL;
+	FPakFile* PakFile = NULL;
+	const FPakEntry* FileEntry = FindFileInPakFiles(Filename, &PakFile);
+	if (FileEntry != NULL)
+	{
+		// Compressed entries have to be inflated, so they can only be read through OpenRead.
+		TSharedPtr<IMappedFileHandle, ESPMode::ThreadSafe> PakMapping;
+		if (FileEntry->CompressionMethod == COMPRESS_None)
+		{
+			PakMapping = PakFile->GetMappedPak(LowerLevel);
+		}
+		if (PakMapping.IsValid())
+		{
+			// Same corruption check as CreatePakFileHandle, reading the header through the mapping.
+			const int64 HeaderSize = FileEntry->GetSerializedSize(PakFile->GetInfo().Version);
+			TAutoPtr<IMappedFileRegion> HeaderRegion(PakMapping->MapRegion(FileEntry->Offset, HeaderSize));
+			if (HeaderRegion.IsValid() && HeaderRegion->GetMappedSize() == HeaderSize)
+			{
+				FPakEntry FileHeader;
+				FBufferReader HeaderReader((void*)HeaderRegion->GetMappedPtr(), HeaderSize, false);
+				FileHeader.Serialize(HeaderReader, PakFile->GetInfo().Version);
+				if (VerifyHeaderAndPakEntry(*FileEntry, FileHeader))
+				{
+					Result = new FPakMappedFileHandle(*PakFile, *FileEntry, PakMapping);
+				}
+				else
+				{
+					UE_LOG(LogPakFile, Fatal, TEXT("Pak file \"%s\" corruption detected when trying to map \"%s\"."), *PakFile->GetFilename(), Filename);
+				}
+			}
+		}
+	}
+#if !USING_SIGNED_CONTENT
+	else if (!bSigned)
+	{
+		// Default to wrapped file but only if we don't force use signed content
+		Result = LowerLevel->OpenMapped(Filename);
+	}
+#endif
+	return Result;
+}
+
 bool FPakPlatformFile::BufferedCopyFile(IFileHandle& Dest, IFileHandle& Source, const int64 FileSize, uint8* Buffer, const int64 BufferSize) const
 {	
 	int64 RemainingSizeToCopy = FileSize;
@@ -185,8 +185,12 @@ class PAKFILE_API FPakFile
 	TAutoPtr<class FChunkCacheWorker> Decryptor;
 	/** Map of readers assigned to threads. */
 	TMap<uint32, TAutoPtr<FArchive>> ReaderMap;
-	/** Critical section for accessing ReaderMap. */
+	/** Critical section for accessing ReaderMap and MappedPak. */
 	FCriticalSection CriticalSection;
+	/** Memory mappable handle to the whole pak, shared by all mapped entries so it outlives an unmount while they are open. */
+	TSharedPtr<IMappedFileHandle, ESPMode::ThreadSafe> MappedPak;
+	/** True once mapping the pak has been attempted, so a failure is only tried once. */
+	bool bTriedMapping;
 	/** Pak file info (trailer). */
 	FPakInfo Info;
 	/** Mount point. */
@@ -205,6 +209,7 @@ class PAKFILE_API FPakFile
 	FArchive* CreatePakReader(const TCHAR* Filename);
 	FArchive* CreatePakReader(IFileHandle& InHandle, const TCHAR* Filename);
 	FArchive* SetupSignedPakReader(FArchive* Reader);
+	bool IsSigned() const;
 
 public:
 
@@ -264,6 +269,15 @@ public:
 	 */
 	FArchive* GetSharedReader(IPlatformFile* LowerLevel);
 
+	/**
+	 * Gets a memory mappable handle to the whole pak file, opening it on first use.
+	 * Signed paks are never mapped, their data has to go through signature verification.
+	 *
+	 * @param LowerLevel Lower level platform file to map the pak with.
+	 * @return Handle shared by everyone mapping from this pak, or an invalid pointer if the pak can't be mapped.
+	 */
+	TSharedPtr<IMappedFileHandle, ESPMode::ThreadSafe> GetMappedPak(IPlatformFile* LowerLevel);
+
 	/**
 	 * Finds an entry in the pak file matching the given filename.
 	 *
@@ -602,6 +616,57 @@ public:
 	/// END IFileHandle Interface
 };
 
+/**
+ * Memory mappable handle to an uncompressed file stored in a pak file. Regions are mapped straight
+ * out of the pak's own mapping.
+ */
+class PAKFILE_API FPakMappedFileHandle : public IMappedFileHandle
+{
+	/** Mapping of the whole pak file, shared with the pak so unmounting it doesn't pull the mapping from under us. */
+	TSharedPtr<IMappedFileHandle, ESPMode::ThreadSafe> PakMapping;
+	/** Offset to the file data in pak (past the file header). */
+	int64 OffsetToFile;
+	/** Size of the file. */
+	int64 FileSize;
+
+public:
+
+	/**
+	 * Constructs a mapped handle for a pak entry.
+	 *
+	 * @param PakFile Pak file the entry is stored in.
+	 * @param InPakEntry Entry in the pak file.
+	 * @param InPakMapping Mappable handle to the whole pak.
+	 */
+	FPakMappedFileHandle(const FPakFile& PakFile, const FPakEntry& InPakEntry, const TSharedPtr<IMappedFileHandle, ESPMode::ThreadSafe>& InPakMapping)
+		: PakMapping(InPakMapping)
+		, FileSize(InPakEntry.Size)
+	{
+		OffsetToFile = InPakEntry.Offset + InPakEntry.GetSerializedSize(PakFile.GetInfo().Version);
+	}
+
+	// BEGIN IMappedFileHandle Interface
+	virtual int64 GetFileSize() OVERRIDE
+	{
+		return FileSize;
+	}
+	virtual IMappedFileRegion* MapRegion(int64 Offset, int64 BytesToMap) OVERRIDE
+	{
+		check(Offset >= 0);
+		if (BytesToMap < 0 || BytesToMap > FileSize - Offset)
+		{
+			BytesToMap = FileSize - Offset;
+		}
+		if (BytesToMap <= 0)
+		{
+			return NULL;
+		}
+		// Never let a region reach into the neighbouring entries.
+		return PakMapping->MapRegion(OffsetToFile + Offset, BytesToMap);
+	}
+	// END IMappedFileHandle Interface
+};
+
 /**
  * Platform file wrapper to be able to use pak files.
  **/
@@ -903,6 +968,8 @@ public:
 
 	virtual IFileHandle* OpenRead(const TCHAR* Filename) OVERRIDE;
 
+	virtual IMappedFileHandle* OpenMapped(const TCHAR* Filename) OVERRIDE;
+
 	virtual IFileHandle* OpenWrite(const TCHAR* Filename, bool bAppend = false, bool bAllowRead = false) OVERRIDE
 	{
 		// No modifications allowed on pak files.
@@ -49,5 +49,5 @@ public:
 
 private:
 	/** list of prims added from the scene */
-	TArray<FPrimitiveSceneProxy*> Prims;
+	TArray<FPrimitiveSceneProxy*,SceneRenderingAllocator> Prims;
 };
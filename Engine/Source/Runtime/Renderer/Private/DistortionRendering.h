@@ -47,5 +47,5 @@ public:
 
 private:
 	/** list of distortion prims added from the scene */
-	TArray<FPrimitiveSceneProxy*> Prims;
+	TArray<FPrimitiveSceneProxy*,SceneRenderingAllocator> Prims;
 };
@@ -373,6 +373,22 @@ public:
 		return LowerLevel->OpenWrite( *ConvertToSandboxPath( Filename ), bAppend, bAllowRead );
 	}
 
+	virtual IMappedFileHandle*	OpenMapped(const TCHAR* Filename) OVERRIDE
+	{
+		// A NULL result doesn't mean the file is missing here, so check for the sandboxed copy explicitly rather than
+		// risk mapping the inner file it shadows
+		FString SandboxFilename( ConvertToSandboxPath( Filename ) );
+		if( LowerLevel->FileExists( *SandboxFilename ) )
+		{
+			return LowerLevel->OpenMapped( *SandboxFilename );
+		}
+		else if( OkForInnerAccess(Filename) )
+		{
+			return LowerLevel->OpenMapped( Filename );
+		}
+		return NULL;
+	}
+
 	virtual bool		DirectoryExists(const TCHAR* Directory) OVERRIDE
 	{
 		bool Result = LowerLevel->DirectoryExists( *ConvertToSandboxPath( Directory ) );
@@ -40,6 +40,8 @@ namespace NFS_Messages
 		GetFileList,
 		Heartbeat,
 		RecompileShaders,
+		ReadAt,
+		OpenReadAndPrefetch,
 	};
 }
 
@@ -30,7 +30,52 @@ public:
 	}
 };
 
-static const int32 GBufferCacheSize = 64 * 1024;
+/** Size of the blocks that file handles read from the server */
+static const int64 GReadBlockSize = 64 * 1024;
+
+/** Maximum number of blocks a file handle keeps cached or in flight */
+static const int32 GMaxCachedBlocks = 8;
+
+/** Number of blocks that are requested ahead of sequential reads */
+static const int32 GPrefetchBlocks = 4;
+
+/** Reads of at least this size bypass the block cache */
+static const int64 GDirectReadSize = 4 * GReadBlockSize;
+
+/**
+ * Reads the payload of a ReadAt or OpenReadAndPrefetch response into a read request
+ */
+static bool SerializeReadResponse(FArchive& Response, FStreamingNetworkReadRequest& Request)
+{
+	// Get the server number of bytes read.
+	int64 ServerBytesRead = 0;
+	Response << ServerBytesRead;
+
+	// Get the compressed size (0 = not compressed).
+	int32 CompressedSize = 0;
+	Response << CompressedSize;
+
+	if (ServerBytesRead != Request.Size)
+	{
+		return false;
+	}
+
+	Request.Data.Empty(Request.Size);
+	Request.Data.AddUninitialized(Request.Size);
+
+	if (CompressedSize > 0)
+	{
+		TArray<uint8> CompressedData;
+		CompressedData.AddUninitialized(CompressedSize);
+		Response.Serialize(CompressedData.GetData(), CompressedSize);
+
+		return FCompression::UncompressMemory(COMPRESS_ZLIB, Request.Data.GetData(), Request.Size, CompressedData.GetData(), CompressedSize);
+	}
+
+	Response.Serialize(Request.Data.GetData(), Request.Size);
+
+	return !Response.IsError();
+}
 
 class FStreamingNetworkFileHandle : public IFileHandle
 {
@@ -41,15 +86,62 @@ class FStreamingNetworkFileHandle : public IFileHandle
 	int64						FileSize;
 	bool						bWritable;
 	bool						bReadable;
-	uint8						BufferCache[2][GBufferCacheSize];
-	int64						CacheStart[2];
-	int64						CacheEnd[2];
-	bool						LazySeek;
-	int32						CurrentCache;
+	/** Blocks that are cached or still being received, oldest first */
+	TArray<TSharedRef<FStreamingNetworkReadRequest> >	Blocks;
+	/** End of the previous read, used to detect sequential reads */
+	int64						LastReadEnd;
+
+	/** Finds the block containing the given file position */
+	TSharedPtr<FStreamingNetworkReadRequest> FindBlock(int64 Position) const
+	{
+		for (int32 BlockIndex = 0; BlockIndex < Blocks.Num(); BlockIndex++)
+		{
+			const TSharedRef<FStreamingNetworkReadRequest>& Block = Blocks[BlockIndex];
+			if (Position >= Block->Offset && Position < Block->Offset + Block->Size)
+			{
+				return Block;
+			}
+		}
+		return NULL;
+	}
+
+	/** Requests the block starting at the given file position, evicting the oldest block if the cache is full */
+	TSharedRef<FStreamingNetworkReadRequest> RequestBlock(int64 BlockOffset)
+	{
+		if (Blocks.Num() >= GMaxCachedBlocks)
+		{
+			// never evict the block at the current position, it is about to be read from
+			const TSharedRef<FStreamingNetworkReadRequest>& Oldest = Blocks[0];
+			const bool bOldestIsCurrent = FilePos >= Oldest->Offset && FilePos < Oldest->Offset + Oldest->Size;
+			Blocks.RemoveAt(bOldestIsCurrent ? 1 : 0);
+		}
+
+		TSharedRef<FStreamingNetworkReadRequest> Block = Network.SendReadAtMessage(HandleId, BlockOffset, FMath::Min(GReadBlockSize, FileSize - BlockOffset));
+		Blocks.Add(Block);
+		return Block;
+	}
+
+	/** Requests the blocks following the given position, so they are in flight while the caller processes the current one */
+	void PrefetchBlocks(int64 Position)
+	{
+		const int64 CurrentBlockOffset = Position - (Position % GReadBlockSize);
+		for (int32 PrefetchIndex = 1; PrefetchIndex <= GPrefetchBlocks; PrefetchIndex++)
+		{
+			const int64 BlockOffset = CurrentBlockOffset + PrefetchIndex * GReadBlockSize;
+			if (BlockOffset >= FileSize)
+			{
+				break;
+			}
+			if (!FindBlock(BlockOffset).IsValid())
+			{
+				RequestBlock(BlockOffset);
+			}
+		}
+	}
 
 public:
 
-	FStreamingNetworkFileHandle(FStreamingNetworkPlatformFile& InNetwork, const TCHAR* InFilename, uint64 InHandleId, int64 InFileSize, bool bWriting)
+	FStreamingNetworkFileHandle(FStreamingNetworkPlatformFile& InNetwork, const TCHAR* InFilename, uint64 InHandleId, int64 InFileSize, bool bWriting, const TSharedPtr<FStreamingNetworkReadRequest>& FirstBlock = NULL)
 		: Network(InNetwork)
 		, Filename(InFilename)
 		, HandleId(InHandleId)
@@ -57,11 +149,12 @@ public:
 		, FileSize(InFileSize)
 		, bWritable(bWriting)
 		, bReadable(!bWriting)
-		, LazySeek(false)
-		,CurrentCache(0)
+		, LastReadEnd(0)
 	{
-		CacheStart[0] = CacheStart[1] = -1;
-		CacheEnd[0] = CacheEnd[1] = -1;
+		if (FirstBlock.IsValid() && FirstBlock->bSuccess)
+		{
+			Blocks.Add(FirstBlock.ToSharedRef());
+		}
 	}
 
 	~FStreamingNetworkFileHandle()
@@ -81,35 +174,13 @@ public:
 	{
 		if (NewPosition >= 0 && NewPosition <= FileSize)
 		{
-			if (NewPosition < CacheStart[0] || NewPosition >= CacheEnd[0] || CacheStart[0] == -1)
+			// reads are positional, only writes depend on the position of the server handle
+			if (bWritable && !Network.SendSeekMessage(HandleId, NewPosition))
 			{
-				if (NewPosition < CacheStart[1] || NewPosition >= CacheEnd[1] || CacheStart[1] == -1)
-				{
-					LazySeek = true;
-					FilePos = NewPosition;
-					if (CacheStart[CurrentCache] != -1)
-					{
-						CurrentCache++;
-						CurrentCache %= 2;
-						CacheStart[CurrentCache] = -1; // Invalidate the cache
-					}
-					return true;
-				}
-				else
-				{
-					LazySeek = false;
-					FilePos = NewPosition;
-					CurrentCache = 1;
-					return true;
-				}
-			}
-			else
-			{
-				LazySeek = false;
-				FilePos = NewPosition;
-				CurrentCache = 0;
-				return true;
+				return false;
 			}
+			FilePos = NewPosition;
+			return true;
 		}
 		return false;
 	}
@@ -119,98 +190,60 @@ public:
 	}
 	virtual bool		Read(uint8* Destination, int64 BytesToRead) OVERRIDE
 	{
-		bool Result = false;
-		if (bReadable && BytesToRead >= 0 && BytesToRead + FilePos <= FileSize)
+		if (!bReadable || BytesToRead < 0 || BytesToRead + FilePos > FileSize)
 		{
-			if (BytesToRead == 0)
-			{
-				Result = true;
-			}
-			else
+			return false;
+		}
+
+		const bool bSequential = (FilePos == LastReadEnd);
+
+		while (BytesToRead > 0)
+		{
+			TSharedPtr<FStreamingNetworkReadRequest> Block = FindBlock(FilePos);
+
+			if (!Block.IsValid())
 			{
-				if (BytesToRead > GBufferCacheSize) // reading more than we cache
+				if (BytesToRead >= GDirectReadSize)
 				{
-					// if the file position is within the cache, copy out the remainder of the cache
-					if (CacheStart[CurrentCache] != -1 && FilePos >= CacheStart[CurrentCache] && FilePos < CacheEnd[CurrentCache])
-					{
-						int64 CopyBytes = CacheEnd[CurrentCache]-FilePos;
-						FMemory::Memcpy(Destination, BufferCache[CurrentCache]+(FilePos-CacheStart[CurrentCache]), CopyBytes);
-						FilePos += CopyBytes;
-						BytesToRead -= CopyBytes;
-						Destination += CopyBytes;
-					}
-
-					if (Network.SendSeekMessage(HandleId, FilePos))
+					// large reads are requested in one go, with the following blocks prefetched behind them
+					TSharedRef<FStreamingNetworkReadRequest> Request = Network.SendReadAtMessage(HandleId, FilePos, BytesToRead);
+					if (bSequential)
 					{
-						Result = Network.SendReadMessage(HandleId, Destination, BytesToRead);
+						PrefetchBlocks(FilePos + BytesToRead - 1);
 					}
-					if (Result)
+					if (!Network.WaitForReadRequest(Request))
 					{
-						FilePos += BytesToRead;
-						CurrentCache++;
-						CurrentCache %= 2;
-						CacheStart[CurrentCache] = -1; // Invalidate the cache
+						return false;
 					}
+					FMemory::Memcpy(Destination, Request->Data.GetData(), BytesToRead);
+					FilePos += BytesToRead;
+					break;
 				}
-				else
-				{
-					Result = true;
 
-					// need to update the cache
-					if (CacheStart[CurrentCache] == -1 && FileSize < GBufferCacheSize)
-					{
-						Result = Network.SendReadMessage(HandleId, BufferCache[CurrentCache], FileSize);
-						if (Result)
-						{
-							CacheStart[CurrentCache] = 0;
-							CacheEnd[CurrentCache] = FileSize;
-						}
-					}
-					else if (FilePos + BytesToRead > CacheEnd[CurrentCache] || CacheStart[CurrentCache] == -1 || FilePos < CacheStart[CurrentCache])
-					{
-						// copy the data from FilePos to the end of the Cache to the destination as long as it is in the cache
-						if (CacheStart[CurrentCache] != -1 && FilePos >= CacheStart[CurrentCache] && FilePos < CacheEnd[CurrentCache])
-						{
-							int64 CopyBytes = CacheEnd[CurrentCache]-FilePos;
-							FMemory::Memcpy(Destination, BufferCache[CurrentCache]+(FilePos-CacheStart[CurrentCache]), CopyBytes);
-							FilePos += CopyBytes;
-							BytesToRead -= CopyBytes;
-							Destination += CopyBytes;
-						}
-
-						// switch to the other cache
-						if (CacheStart[CurrentCache] != -1)
-						{
-							CurrentCache++;
-							CurrentCache %= 2;
-						}
-
-						int64 SizeToRead = GBufferCacheSize;
-						if (FilePos + SizeToRead > FileSize)
-						{
-							SizeToRead = FileSize-FilePos;
-						}
-						if (Network.SendSeekMessage(HandleId, FilePos))
-						{
-							Result = Network.SendReadMessage(HandleId, BufferCache[CurrentCache], SizeToRead);
-						}
-						if (Result)
-						{
-							CacheStart[CurrentCache] = FilePos;
-							CacheEnd[CurrentCache] = FilePos + SizeToRead;
-						}
-					}
+				Block = RequestBlock(FilePos - (FilePos % GReadBlockSize));
+			}
 
-					// copy from the cache to the destination
-					if (Result)
-					{
-						FMemory::Memcpy(Destination, BufferCache[CurrentCache]+(FilePos-CacheStart[CurrentCache]), BytesToRead);
-						FilePos += BytesToRead;
-					}
-				}
+			if (bSequential)
+			{
+				PrefetchBlocks(FilePos);
 			}
+
+			if (!Network.WaitForReadRequest(Block.ToSharedRef()))
+			{
+				Blocks.Remove(Block.ToSharedRef());
+				return false;
+			}
+
+			// copy out of the block
+			const int64 CopyBytes = FMath::Min(BytesToRead, Block->Offset + Block->Size - FilePos);
+			FMemory::Memcpy(Destination, Block->Data.GetData() + (FilePos - Block->Offset), CopyBytes);
+			FilePos += CopyBytes;
+			BytesToRead -= CopyBytes;
+			Destination += CopyBytes;
 		}
-		return Result;
+
+		LastReadEnd = FilePos;
+		return true;
 	}
 	virtual bool		Write(const uint8* Source, int64 BytesToWrite) OVERRIDE
 	{
@@ -276,6 +309,9 @@ bool FStreamingNetworkPlatformFile::InitializeInternal(IPlatformFile* Inner, con
 		FileServerPort = OverridePort;
 	}
 
+	// compressing payloads trades server CPU time for bandwidth, which only pays off on slow networks
+	bAllowCompression = FParse::Param(FCommandLine::Get(), TEXT("NetworkFileCompression"));
+
 	// convert the string to a ip addr structure
 	TSharedRef<FInternetAddr> Addr = SSS->CreateInternetAddr(0, FileServerPort);
 	bool bIsValid;
@@ -454,7 +490,7 @@ IFileHandle* FStreamingNetworkPlatformFile::OpenRead(const TCHAR* Filename)
 	FString RelativeFilename = Filename;
 	FPaths::MakeStandardFilename(RelativeFilename);
 
-	FStreamingNetworkFileHandle* FileHandle = SendOpenMessage(RelativeFilename, false, false, false);
+	FStreamingNetworkFileHandle* FileHandle = SendOpenReadAndPrefetchMessage(RelativeFilename);
 	return FileHandle;
 }
 
@@ -739,6 +775,61 @@ FStreamingNetworkFileHandle* FStreamingNetworkPlatformFile::SendOpenMessage(cons
 	}
 }
 
+FStreamingNetworkFileHandle* FStreamingNetworkPlatformFile::SendOpenReadAndPrefetchMessage(const FString& Filename)
+{
+	FScopeLock ScopeLock(&SynchronizationObject);
+
+	FStreamingNetworkFileArchive Payload(NFS_Messages::OpenReadAndPrefetch);
+	Payload << const_cast<FString&>(Filename);
+	int64 PrefetchSize = GReadBlockSize;
+	Payload << PrefetchSize;
+	Payload << bAllowCompression;
+
+	// Send the filename over
+	FArrayReader Response;
+	if (SendPayloadAndReceiveResponse(Payload, Response) == false)
+	{
+		return NULL;
+	}
+
+	// This server handle ID which will be used to perform operations on this file.
+	uint64 HandleId = 0;
+	Response << HandleId;
+
+	// Get the server file timestamp
+	FDateTime ServerTimeStamp;
+	Response << ServerTimeStamp;
+
+	// Get the server file size
+	int64 ServerFileSize = 0;
+	Response << ServerFileSize;
+
+	// Get the file info, which saves a GetFileInfo round trip later on
+	FFileInfo Info;
+	Response << Info.FileExists;
+	Response << Info.ReadOnly;
+	Response << Info.Size;
+	Response << Info.TimeStamp;
+	Response << Info.AccessTimeStamp;
+
+	CachedFileInfo.Add(Filename, Info);
+
+	// Get the first block of the file
+	TSharedRef<FStreamingNetworkReadRequest> FirstBlock = MakeShareable(new FStreamingNetworkReadRequest(HandleId, 0, FMath::Min(ServerFileSize, GReadBlockSize)));
+	FirstBlock->bSuccess = SerializeReadResponse(Response, *FirstBlock);
+	FirstBlock->bCompleted = true;
+
+	if (ServerFileSize > 0)
+	{
+		FStreamingNetworkFileHandle* FileHandle = new FStreamingNetworkFileHandle(*this, *Filename, HandleId, ServerFileSize, false, FirstBlock);
+		return FileHandle;
+	}
+	else
+	{
+		return NULL;
+	}
+}
+
 bool FStreamingNetworkPlatformFile::SendReadMessage(uint64 HandleId, uint8* Destination, int64 BytesToRead)
 {
 	FScopeLock ScopeLock(&SynchronizationObject);
@@ -769,6 +860,46 @@ bool FStreamingNetworkPlatformFile::SendReadMessage(uint64 HandleId, uint8* Dest
 	return bSuccess;
 }
 
+TSharedRef<FStreamingNetworkReadRequest> FStreamingNetworkPlatformFile::SendReadAtMessage(uint64 HandleId, int64 Offset, int64 BytesToRead)
+{
+	FScopeLock ScopeLock(&SynchronizationObject);
+
+	TSharedRef<FStreamingNetworkReadRequest> Request = MakeShareable(new FStreamingNetworkReadRequest(HandleId, Offset, BytesToRead));
+
+	FStreamingNetworkFileArchive Payload(NFS_Messages::ReadAt);
+	Payload << HandleId;
+	Payload << Offset;
+	Payload << BytesToRead;
+	Payload << bAllowCompression;
+
+	// the response is picked up by whoever needs it first, responses arrive in the order the requests were sent
+	if (SendPayload(Payload))
+	{
+		OutstandingReads.Add(Request);
+	}
+	else
+	{
+		Request->bCompleted = true;
+	}
+
+	return Request;
+}
+
+bool FStreamingNetworkPlatformFile::WaitForReadRequest(const TSharedRef<FStreamingNetworkReadRequest>& Request)
+{
+	FScopeLock ScopeLock(&SynchronizationObject);
+
+	while (!Request->bCompleted)
+	{
+		if (ReceiveReadResponse() == false)
+		{
+			return false;
+		}
+	}
+
+	return Request->bSuccess;
+}
+
 bool FStreamingNetworkPlatformFile::SendWriteMessage(uint64 HandleId, const uint8* Source, int64 BytesToWrite)
 {
 	FScopeLock ScopeLock(&SynchronizationObject);
@@ -827,10 +958,26 @@ bool FStreamingNetworkPlatformFile::SendCloseMessage(uint64 HandleId)
 
 bool FStreamingNetworkPlatformFile::SendPayloadAndReceiveResponse(FStreamingNetworkFileArchive& Payload, FArrayReader& Response)
 {
+	FScopeLock ScopeLock(&SynchronizationObject);
+
+	if (SendPayload(Payload) == false)
+	{
+		return false;
+	}
+
+	// responses arrive in the order the requests were sent, so outstanding reads have to be received first
+	while (OutstandingReads.Num() > 0)
+	{
+		if (ReceiveReadResponse() == false)
+		{
+			return false;
+		}
+	}
+
 #if USE_MCSOCKET_FOR_NFS
-	if (FNFSMessageHeader::SendPayloadAndReceiveResponse(Payload, Response, FSimpleAbstractSocket_FMultichannelTCPSocket(MCSocket, NFS_Channels::Main)) == false)
+	if (FNFSMessageHeader::ReceivePayload(Response, FSimpleAbstractSocket_FMultichannelTCPSocket(MCSocket, NFS_Channels::Main)) == false)
 #else
-	if (FNFSMessageHeader::SendPayloadAndReceiveResponse(Payload, Response, FSimpleAbstractSocket_FSocket(FileSocket)) == false)
+	if (FNFSMessageHeader::ReceivePayload(Response, FSimpleAbstractSocket_FSocket(FileSocket)) == false)
 #endif
 	{
 		UE_LOG(LogStreamingPlatformFile, Fatal, TEXT("Receive failure!"));
@@ -839,17 +986,53 @@ bool FStreamingNetworkPlatformFile::SendPayloadAndReceiveResponse(FStreamingNetw
 	return true;
 }
 
-void FStreamingNetworkPlatformFile::PerformHeartbeat()
+bool FStreamingNetworkPlatformFile::SendPayload(FStreamingNetworkFileArchive& Payload)
 {
-	FNetworkFileArchive Payload(NFS_Messages::Heartbeat);
+#if USE_MCSOCKET_FOR_NFS
+	if (FNFSMessageHeader::WrapAndSendPayload(Payload, FSimpleAbstractSocket_FMultichannelTCPSocket(MCSocket, NFS_Channels::Main)) == false)
+#else
+	if (FNFSMessageHeader::WrapAndSendPayload(Payload, FSimpleAbstractSocket_FSocket(FileSocket)) == false)
+#endif
+	{
+		UE_LOG(LogStreamingPlatformFile, Fatal, TEXT("Send failure!"));
+		return false;
+	}
+	return true;
+}
+
+bool FStreamingNetworkPlatformFile::ReceiveReadResponse()
+{
+	check(OutstandingReads.Num() > 0);
+
+	TSharedPtr<FStreamingNetworkReadRequest> Request = OutstandingReads[0];
+	OutstandingReads.RemoveAt(0);
 
-	// send the filename over
 	FArrayReader Response;
 #if USE_MCSOCKET_FOR_NFS
-	if (FNFSMessageHeader::SendPayloadAndReceiveResponse(Payload, Response, FSimpleAbstractSocket_FMultichannelTCPSocket(MCSocket, NFS_Channels::Main)) == false)
+	if (FNFSMessageHeader::ReceivePayload(Response, FSimpleAbstractSocket_FMultichannelTCPSocket(MCSocket, NFS_Channels::Main)) == false)
 #else
-	if (FNFSMessageHeader::SendPayloadAndReceiveResponse(Payload, Response, FSimpleAbstractSocket_FSocket(FileSocket)) == false)
+	if (FNFSMessageHeader::ReceivePayload(Response, FSimpleAbstractSocket_FSocket(FileSocket)) == false)
 #endif
+	{
+		UE_LOG(LogStreamingPlatformFile, Fatal, TEXT("Receive failure!"));
+		Request->bCompleted = true;
+		return false;
+	}
+
+	Request->bSuccess = SerializeReadResponse(Response, *Request);
+	Request->bCompleted = true;
+	return true;
+}
+
+void FStreamingNetworkPlatformFile::PerformHeartbeat()
+{
+	FScopeLock ScopeLock(&SynchronizationObject);
+
+	FStreamingNetworkFileArchive Payload(NFS_Messages::Heartbeat);
+
+	// send the filename over
+	FArrayReader Response;
+	if (SendPayloadAndReceiveResponse(Payload, Response) == false)
 	{
 		return;
 	}
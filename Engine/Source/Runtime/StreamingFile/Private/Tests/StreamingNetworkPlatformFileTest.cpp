@@ -0,0 +1,117 @@
+// Copyright 1998-2014 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	StreamingNetworkPlatformFileTest.cpp: Loopback test for pipelined streaming file reads.
+=============================================================================*/
+
+#include "StreamingFilePrivatePCH.h"
+#include "StreamingNetworkPlatformFile.h"
+#include "AutomationTest.h"
+#include "Sockets.h"
+#include "INetworkFileServer.h"
+#include "INetworkFileSystemModule.h"
+
+
+/**
+ * Streaming network file that connects to a file server on a given port instead of the default one
+ */
+class FLoopbackStreamingNetworkPlatformFile : public FStreamingNetworkPlatformFile
+{
+public:
+
+	FLoopbackStreamingNetworkPlatformFile(int32 InFileServerPort)
+	{
+		FileServerPort = InFileServerPort;
+	}
+};
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStreamingNetworkPlatformFileTest, "Engine.Networking.StreamingFile.PipelinedReads", EAutomationTestFlags::ATF_Editor)
+
+
+bool FStreamingNetworkPlatformFileTest::RunTest( const FString& Parameters )
+{
+	// the same file the client syncs when it connects, read locally to compare against
+	const FString TestFilename = FPaths::Combine(*(FPaths::EngineDir()), TEXT("Config/BaseEngine.ini"));
+	TArray<uint8> Expected;
+	if (!FFileHelper::LoadFileToArray(Expected, *TestFilename))
+	{
+		AddError(FString::Printf(TEXT("Could not read %s locally."), *TestFilename));
+		return false;
+	}
+
+	// start a file server on any free port
+	INetworkFileServer* Server = FModuleManager::LoadModuleChecked<INetworkFileSystemModule>("NetworkFileSystem").CreateNetworkFileServer(0);
+	TArray<TSharedPtr<FInternetAddr> > ServerAddresses;
+	if (Server == NULL || !Server->GetAddressList(ServerAddresses))
+	{
+		AddError(TEXT("Could not start the file server."));
+		delete Server;
+		return false;
+	}
+
+	FLoopbackStreamingNetworkPlatformFile* Client = new FLoopbackStreamingNetworkPlatformFile(ServerAddresses[0]->GetPort());
+	if (Client->Initialize(&FPlatformFileManager::Get().GetPlatformFile(), TEXT("-FileHostIP=127.0.0.1")))
+	{
+		IFileHandle* First = Client->OpenRead(*TestFilename);
+		IFileHandle* Second = Client->OpenRead(*TestFilename);
+		TestTrue(TEXT("Files must open over the network"), First != NULL && Second != NULL);
+
+		if (First != NULL && Second != NULL)
+		{
+			TestEqual(TEXT("Network file size must match the local file"), First->Size(), (int64)Expected.Num());
+
+			// Small sequential reads on two handles at once leave prefetches for both in flight, so every read
+			// has to wait for responses that were sent before its own.
+			const int64 ChunkSize = 4 * 1024;
+			const int64 SecondStart = Expected.Num() / 2;
+			TArray<uint8> FirstData;
+			TArray<uint8> SecondData;
+			FirstData.AddZeroed(Expected.Num());
+			SecondData.AddZeroed(Expected.Num() - SecondStart);
+
+			bool bReadsSucceeded = Second->Seek(SecondStart);
+			for (int64 Offset = 0; bReadsSucceeded && Offset < FirstData.Num(); Offset += ChunkSize)
+			{
+				bReadsSucceeded = First->Read(FirstData.GetData() + Offset, FMath::Min<int64>(ChunkSize, FirstData.Num() - Offset));
+
+				if (bReadsSucceeded && Offset < SecondData.Num())
+				{
+					bReadsSucceeded = Second->Read(SecondData.GetData() + Offset, FMath::Min<int64>(ChunkSize, SecondData.Num() - Offset));
+				}
+			}
+			TestTrue(TEXT("Interleaved reads must succeed"), bReadsSucceeded);
+			TestTrue(TEXT("Interleaved reads must return the file contents in order"), FMemory::Memcmp(FirstData.GetData(), Expected.GetData(), Expected.Num()) == 0);
+			TestTrue(TEXT("Interleaved reads from a seek must return the file contents in order"), FMemory::Memcmp(SecondData.GetData(), Expected.GetData() + SecondStart, SecondData.Num()) == 0);
+
+			// Reading backwards defeats the prefetch, and a large unaligned read spans several blocks.
+			TArray<uint8> Block;
+			Block.AddZeroed(ChunkSize);
+			for (int64 Offset = Expected.Num() - ChunkSize; Offset >= 0; Offset -= 7 * ChunkSize)
+			{
+				TestTrue(TEXT("Backward reads must succeed"), First->Seek(Offset) && First->Read(Block.GetData(), ChunkSize));
+				TestTrue(TEXT("Backward reads must return the right data"), FMemory::Memcmp(Block.GetData(), Expected.GetData() + Offset, ChunkSize) == 0);
+			}
+
+			const int64 LargeOffset = 123;
+			const int64 LargeSize = Expected.Num() - LargeOffset;
+			TArray<uint8> LargeData;
+			LargeData.AddZeroed(LargeSize);
+			TestTrue(TEXT("Large reads must succeed"), Second->Seek(LargeOffset) && Second->Read(LargeData.GetData(), LargeSize));
+			TestTrue(TEXT("Large reads must return the right data"), FMemory::Memcmp(LargeData.GetData(), Expected.GetData() + LargeOffset, LargeSize) == 0);
+		}
+
+		delete First;
+		delete Second;
+	}
+	else
+	{
+		AddError(TEXT("Could not connect to the file server on 127.0.0.1."));
+	}
+
+	delete Client;
+	Server->Shutdown();
+	delete Server;
+
+	return true;
+}
@@ -110,6 +110,39 @@ public:
 };
 #endif
 
+/**
+ * A positional read that was sent to the server, and whose response may still be outstanding
+ */
+struct FStreamingNetworkReadRequest
+{
+	/** Server handle of the file being read */
+	uint64 HandleId;
+
+	/** Offset of the data in the file */
+	int64 Offset;
+
+	/** Number of bytes requested */
+	int64 Size;
+
+	/** The data, once the response has been received */
+	TArray<uint8> Data;
+
+	/** Whether the response has been received */
+	bool bCompleted;
+
+	/** Whether the server read all requested bytes */
+	bool bSuccess;
+
+	FStreamingNetworkReadRequest(uint64 InHandleId, int64 InOffset, int64 InSize)
+		: HandleId(InHandleId)
+		, Offset(InOffset)
+		, Size(InSize)
+		, bCompleted(false)
+		, bSuccess(false)
+	{
+	}
+};
+
 /**
  * Wrapper to redirect the low level file system to a server
  */
@@ -128,7 +161,10 @@ public:
 	}
 
 	/** Constructor */
-	FStreamingNetworkPlatformFile() {};
+	FStreamingNetworkPlatformFile()
+		: bAllowCompression(false)
+	{
+	}
 
 	/** Destructor */
 	virtual ~FStreamingNetworkPlatformFile();
@@ -190,9 +226,18 @@ public:
 	/** Sends Open message to the server and creates a new file handle if successful. */
 	class FStreamingNetworkFileHandle* SendOpenMessage(const FString& Filename, bool bIsWriting, bool bAppend, bool bAllowRead);
 
+	/** Sends OpenReadAndPrefetch message to the server, which opens the file, returns its info and its first block. */
+	class FStreamingNetworkFileHandle* SendOpenReadAndPrefetchMessage(const FString& Filename);
+
 	/** Sends Read message to the server. */
 	bool SendReadMessage(uint64 HandleId, uint8* Destination, int64 BytesToRead);
 
+	/** Sends ReadAt message to the server without waiting for the response, so that several reads can be in flight. */
+	TSharedRef<FStreamingNetworkReadRequest> SendReadAtMessage(uint64 HandleId, int64 Offset, int64 BytesToRead);
+
+	/** Waits until the response to the given read request has been received. */
+	bool WaitForReadRequest(const TSharedRef<FStreamingNetworkReadRequest>& Request);
+
 	/** Sends Write message to the server. */
 	bool SendWriteMessage(uint64 HandleId, const uint8* Source, int64 BytesToWrite);	
 
@@ -216,6 +261,12 @@ private:
 	/** Helper for handling network errors during send/receive. */
 	bool SendPayloadAndReceiveResponse(class FStreamingNetworkFileArchive& Payload, FArrayReader& Response);
 
+	/** Sends a payload without waiting for its response. */
+	bool SendPayload(class FStreamingNetworkFileArchive& Payload);
+
+	/** Receives the response to the oldest outstanding read request. */
+	bool ReceiveReadResponse();
+
 
 private:
 
@@ -224,6 +275,12 @@ private:
 
 	/** Stored information about the files we have already cached */
 	TMap<FString, FFileInfo> CachedFileInfo;
+
+	/** Read requests that were sent, but whose responses haven't been received yet, in the order they were sent */
+	TArray<TSharedPtr<FStreamingNetworkReadRequest> > OutstandingReads;
+
+	/** Whether the server may compress read payloads */
+	bool bAllowCompression;
 };
 
 
@@ -7,6 +7,7 @@ public class StreamingFile : ModuleRules
 	public StreamingFile(TargetInfo Target)
 	{
         PublicIncludePathModuleNames.Add("NetworkFile");
+        PrivateIncludePathModuleNames.Add("NetworkFileSystem");
 
         PrivateDependencyModuleNames.AddRange(new string[] { "Core", "Sockets", "NetworkFile" });
 	}
@@ -6,6 +6,7 @@
 
 #include "VectorVMPrivate.h"
 #include "ModuleManager.h"
+#include "TaskGraphInterfaces.h"
 
 IMPLEMENT_MODULE(FDefaultModuleImpl, VectorVM);
 
@@ -378,16 +379,131 @@ struct FVectorKernelPow : public TBinaryVectorKernel<FVectorKernelPow>
 };
 struct FVectorKernelPowi : public TBinaryVectorKernelWithConstant<FVectorKernelPow> {};
 
-void VectorVM::Exec(
-	uint8 const* Code,
-	VectorRegister** InputRegisters,
-	int32 NumInputRegisters,
-	VectorRegister** OutputRegisters,
-	int32 NumOutputRegisters,
-	float const* ConstantTable,
-	int32 NumVectors
-	)
+/** Interprets the whole program over the vectors of one chunk. */
+static void ExecInterpreted(FVectorVMContext& Context)
+{
+	using namespace VectorVM;
+
+	EOp::Type Op = EOp::done;
+
+	// Execute VM on all vectors in this chunk.
+	do 
+	{
+		Op = DecodeOp(Context);
+		switch (Op)
+		{
+		// Dispatch kernel ops.
+		case EOp::add: FVectorKernelAdd::Exec(Context); break;
+		case EOp::addi: FVectorKernelAddi::Exec(Context); break;
+		case EOp::sub: FVectorKernelSub::Exec(Context); break;
+		case EOp::subi: FVectorKernelSubi::Exec(Context); break;
+		case EOp::mul: FVectorKernelMul::Exec(Context); break;
+		case EOp::muli: FVectorKernelMuli::Exec(Context); break;
+		case EOp::mad: FVectorKernelMad::Exec(Context); break;
+		case EOp::madrri: FVectorKernelMadrri::Exec(Context); break;
+		case EOp::madrir: FVectorKernelMadrir::Exec(Context); break;
+		case EOp::madrii: FVectorKernelMadrii::Exec(Context); break;
+		case EOp::madiir: FVectorKernelMadiir::Exec(Context); break;
+		case EOp::madiii: FVectorKernelMadiii::Exec(Context); break;
+		case EOp::lerp: FVectorKernelLerp::Exec(Context); break;
+		case EOp::lerpirr: FVectorKernelLerpirr::Exec(Context); break;
+		case EOp::lerprir: FVectorKernelLerprir::Exec(Context); break;
+		case EOp::lerprri: FVectorKernelLerprri::Exec(Context); break;
+		case EOp::lerprii: FVectorKernelLerprii::Exec(Context); break;
+		case EOp::rcp: FVectorKernelRcp::Exec(Context); break;
+		case EOp::rsq: FVectorKernelRsq::Exec(Context); break;
+		case EOp::sqrt: FVectorKernelSqrt::Exec(Context); break;
+		case EOp::neg: FVectorKernelNeg::Exec(Context); break;
+		case EOp::abs: FVectorKernelAbs::Exec(Context); break;
+		case EOp::clamp: FVectorKernelClamp::Exec(Context); break;
+		case EOp::clampir: FVectorKernelClampir::Exec(Context); break;
+		case EOp::clampri: FVectorKernelClampri::Exec(Context); break;
+		case EOp::clampii: FVectorKernelClampii::Exec(Context); break;
+		case EOp::min: FVectorKernelMin::Exec(Context); break;
+		case EOp::mini: FVectorKernelMini::Exec(Context); break;
+		case EOp::max: FVectorKernelMax::Exec(Context); break;
+		case EOp::maxi: FVectorKernelMaxi::Exec(Context); break;
+		case EOp::pow: FVectorKernelPow::Exec(Context); break;
+		case EOp::powi: FVectorKernelPowi::Exec(Context); break;
+
+		// Execution always terminates with a "done" opcode.
+		case EOp::done:
+			break;
+
+		// Opcode not recognized / implemented.
+		default:
+			UE_LOG(LogVectorVM, Fatal, TEXT("Unknown op code 0x%02x"), (uint32)Op);
+			break;
+		}
+	} while (Op != EOp::done);
+}
+
+/**
+ * Everything a batch of chunks needs to run a program, shared by all the tasks of one Exec call.
+ */
+struct FVectorVMExecParams
+{
+	uint8 const* Code;
+	VectorRegister** InputRegisters;
+	int32 NumInputRegisters;
+	VectorRegister** OutputRegisters;
+	int32 NumOutputRegisters;
+	float const* ConstantTable;
+	int32 NumVectors;
+	/** Native code to run instead of interpreting, NULL to interpret. */
+	FVectorVMNativeProgram::FFunction NativeFunction;
+	/** Whether to check the native code against the interpreter, see vm.JitVerify. */
+	bool bVerifyNative;
+};
+
+/**
+ * Reruns a chunk the native code has just processed through the interpreter and checks the outputs
+ * match bit for bit. Outputs must not alias inputs, which holds for Niagara's double buffered particles.
+ */
+static void VerifyNativeChunk(const FVectorVMExecParams& Params, VectorRegister** RegisterTable, int32 NumVectors, int32 ChunkIndex)
 {
+	using namespace VectorVM;
+
+	const int32 NumFloats = NumVectors * ElementsPerVector;
+	TArray<float> NativeOutputs;
+	NativeOutputs.AddUninitialized(Params.NumOutputRegisters * NumFloats);
+	for (int32 i = 0; i < Params.NumOutputRegisters; ++i)
+	{
+		FMemory::Memcpy(&NativeOutputs[i * NumFloats], RegisterTable[FirstOutputRegister + i], NumFloats * sizeof(float));
+	}
+
+	FVectorVMContext Context(Params.Code, RegisterTable, Params.ConstantTable, NumVectors);
+	ExecInterpreted(Context);
+
+	for (int32 i = 0; i < Params.NumOutputRegisters; ++i)
+	{
+		const float* Expected = reinterpret_cast<const float*>(RegisterTable[FirstOutputRegister + i]);
+		const float* Native = &NativeOutputs[i * NumFloats];
+		for (int32 j = 0; j < NumFloats; ++j)
+		{
+			if (FMemory::Memcmp(&Native[j], &Expected[j], sizeof(float)) != 0)
+			{
+				UE_LOG(LogVectorVM, Error, TEXT("Native code output register %d vector %d element %d doesn't match the interpreter. Has %f expected %f"),
+					i,
+					ChunkIndex * VectorsPerChunk + j / ElementsPerVector,
+					j % ElementsPerVector,
+					Native[j],
+					Expected[j]
+					);
+				return;
+			}
+		}
+	}
+}
+
+/**
+ * Runs the whole program over a range of chunks. Temporary registers live on the stack of the
+ * executing thread and are only ever one chunk wide, so they stay in cache between ops.
+ */
+static void ExecChunks(const FVectorVMExecParams& Params, int32 FirstChunk, int32 NumChunks)
+{
+	using namespace VectorVM;
+
 	VectorRegister TempRegisters[NumTempRegisters][VectorsPerChunk];
 	VectorRegister* RegisterTable[MaxRegisters] = {0};
 
@@ -398,77 +514,149 @@ void VectorVM::Exec(
 	}
 
 	// Process one chunk at a time.
-	int32 NumChunks = (NumVectors + VectorsPerChunk - 1) / VectorsPerChunk;
-	for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ++ChunkIndex)
+	for (int32 ChunkIndex = FirstChunk; ChunkIndex < FirstChunk + NumChunks; ++ChunkIndex)
 	{
 		// Map input and output registers.
-		for (int32 i = 0; i < NumInputRegisters; ++i)
+		for (int32 i = 0; i < Params.NumInputRegisters; ++i)
 		{
-			RegisterTable[NumTempRegisters + i] = InputRegisters[i] + ChunkIndex * VectorsPerChunk;
+			RegisterTable[NumTempRegisters + i] = Params.InputRegisters[i] + ChunkIndex * VectorsPerChunk;
 		}
-		for (int32 i = 0; i < NumOutputRegisters; ++i)
+		for (int32 i = 0; i < Params.NumOutputRegisters; ++i)
 		{
-			RegisterTable[NumTempRegisters + MaxInputRegisters + i] = OutputRegisters[i] + ChunkIndex * VectorsPerChunk;
+			RegisterTable[NumTempRegisters + MaxInputRegisters + i] = Params.OutputRegisters[i] + ChunkIndex * VectorsPerChunk;
 		}
 
 		// Setup execution context.
-		int32 VectorsThisChunk = FMath::Min<int32>(NumVectors, VectorsPerChunk);
-		FVectorVMContext Context(Code, RegisterTable, ConstantTable, VectorsThisChunk);
-		EOp::Type Op = EOp::done;
-
-		// Execute VM on all vectors in this chunk.
-		do 
+		int32 VectorsThisChunk = FMath::Min<int32>(Params.NumVectors - ChunkIndex * VectorsPerChunk, VectorsPerChunk);
+		if (Params.NativeFunction)
 		{
-			Op = DecodeOp(Context);
-			switch (Op)
+			Params.NativeFunction(RegisterTable, Params.ConstantTable, VectorsThisChunk);
+			if (Params.bVerifyNative)
 			{
-			// Dispatch kernel ops.
-			case EOp::add: FVectorKernelAdd::Exec(Context); break;
-			case EOp::addi: FVectorKernelAddi::Exec(Context); break;
-			case EOp::sub: FVectorKernelSub::Exec(Context); break;
-			case EOp::subi: FVectorKernelSubi::Exec(Context); break;
-			case EOp::mul: FVectorKernelMul::Exec(Context); break;
-			case EOp::muli: FVectorKernelMuli::Exec(Context); break;
-			case EOp::mad: FVectorKernelMad::Exec(Context); break;
-			case EOp::madrri: FVectorKernelMadrri::Exec(Context); break;
-			case EOp::madrir: FVectorKernelMadrir::Exec(Context); break;
-			case EOp::madrii: FVectorKernelMadrii::Exec(Context); break;
-			case EOp::madiir: FVectorKernelMadiir::Exec(Context); break;
-			case EOp::madiii: FVectorKernelMadiii::Exec(Context); break;
-			case EOp::lerp: FVectorKernelLerp::Exec(Context); break;
-			case EOp::lerpirr: FVectorKernelLerpirr::Exec(Context); break;
-			case EOp::lerprir: FVectorKernelLerprir::Exec(Context); break;
-			case EOp::lerprri: FVectorKernelLerprri::Exec(Context); break;
-			case EOp::lerprii: FVectorKernelLerprii::Exec(Context); break;
-			case EOp::rcp: FVectorKernelRcp::Exec(Context); break;
-			case EOp::rsq: FVectorKernelRsq::Exec(Context); break;
-			case EOp::sqrt: FVectorKernelSqrt::Exec(Context); break;
-			case EOp::neg: FVectorKernelNeg::Exec(Context); break;
-			case EOp::abs: FVectorKernelAbs::Exec(Context); break;
-			case EOp::clamp: FVectorKernelClamp::Exec(Context); break;
-			case EOp::clampir: FVectorKernelClampir::Exec(Context); break;
-			case EOp::clampri: FVectorKernelClampri::Exec(Context); break;
-			case EOp::clampii: FVectorKernelClampii::Exec(Context); break;
-			case EOp::min: FVectorKernelMin::Exec(Context); break;
-			case EOp::mini: FVectorKernelMini::Exec(Context); break;
-			case EOp::max: FVectorKernelMax::Exec(Context); break;
-			case EOp::maxi: FVectorKernelMaxi::Exec(Context); break;
-			case EOp::pow: FVectorKernelPow::Exec(Context); break;
-			case EOp::powi: FVectorKernelPowi::Exec(Context); break;
-
-			// Execution always terminates with a "done" opcode.
-			case EOp::done:
-				break;
-
-			// Opcode not recognized / implemented.
-			default:
-				UE_LOG(LogVectorVM, Fatal, TEXT("Unknown op code 0x%02x"), (uint32)Op);
-				break;
+				VerifyNativeChunk(Params, RegisterTable, VectorsThisChunk, ChunkIndex);
 			}
-		} while (Op != EOp::done);
+		}
+		else
+		{
+			FVectorVMContext Context(Params.Code, RegisterTable, Params.ConstantTable, VectorsThisChunk);
+			ExecInterpreted(Context);
+		}
+	}
+}
 
-		NumVectors -= VectorsPerChunk;
+/**
+ * Runs a range of chunks of a VM program on a task graph worker.
+ */
+class FVectorVMExecTask
+{
+	/** Parameters of the Exec call, owned by the thread waiting on this task. */
+	const FVectorVMExecParams* Params;
+	/** Range of chunks to execute. */
+	int32 FirstChunk;
+	int32 NumChunks;
+
+public:
+	FVectorVMExecTask(const FVectorVMExecParams* InParams, int32 InFirstChunk, int32 InNumChunks)
+		: Params(InParams)
+		, FirstChunk(InFirstChunk)
+		, NumChunks(InNumChunks)
+	{
+	}
+
+	static const TCHAR* GetTaskName()
+	{
+		return TEXT("FVectorVMExecTask");
+	}
+	FORCEINLINE static TStatId GetStatId()
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FVectorVMExecTask, STATGROUP_TaskGraphTasks);
+	}
+
+	static ENamedThreads::Type GetDesiredThread()
+	{
+		return ENamedThreads::AnyThread;
+	}
+
+	static ESubsequentsMode::Type GetSubsequentsMode()
+	{
+		return ESubsequentsMode::TrackSubsequents;
+	}
+
+	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+	{
+		ExecChunks(*Params, FirstChunk, NumChunks);
+	}
+};
+
+static TAutoConsoleVariable<int32> CVarVectorVMParallelChunks(
+	TEXT("vm.ParallelChunks"),
+	VectorVM::MinChunksPerTask,
+	TEXT("Number of chunks each task graph worker is given when a vector VM program is split across threads.\n")
+	TEXT("0: always execute on the calling thread"));
+
+static TAutoConsoleVariable<int32> CVarVectorVMJit(
+	TEXT("vm.Jit"),
+	1,
+	TEXT("Whether vector VM programs that have been translated to native code run it, rather than being interpreted."));
+
+static TAutoConsoleVariable<int32> CVarVectorVMJitVerify(
+	TEXT("vm.JitVerify"),
+	0,
+	TEXT("When set, every chunk run through native code is run through the interpreter as well and the outputs compared bit for bit."));
+
+void VectorVM::Exec(
+	uint8 const* Code,
+	VectorRegister** InputRegisters,
+	int32 NumInputRegisters,
+	VectorRegister** OutputRegisters,
+	int32 NumOutputRegisters,
+	float const* ConstantTable,
+	int32 NumVectors,
+	FVectorVMNativeProgram const* NativeProgram
+	)
+{
+	const bool bUseNative = NativeProgram && NativeProgram->IsValid() && CVarVectorVMJit.GetValueOnAnyThread() != 0;
+
+	FVectorVMExecParams Params;
+	Params.Code = Code;
+	Params.InputRegisters = InputRegisters;
+	Params.NumInputRegisters = NumInputRegisters;
+	Params.OutputRegisters = OutputRegisters;
+	Params.NumOutputRegisters = NumOutputRegisters;
+	Params.ConstantTable = ConstantTable;
+	Params.NumVectors = NumVectors;
+	Params.NativeFunction = bUseNative ? NativeProgram->GetFunction() : NULL;
+	Params.bVerifyNative = bUseNative && CVarVectorVMJitVerify.GetValueOnAnyThread() != 0;
+
+	const int32 NumChunks = (NumVectors + VectorsPerChunk - 1) / VectorsPerChunk;
+	const int32 ChunksPerTask = CVarVectorVMParallelChunks.GetValueOnAnyThread();
+
+	// Chunks never share registers, so large programs are spread across the task graph. Small ones
+	// aren't worth the dispatch cost and run inline.
+	int32 NumTasks = 1;
+	if (ChunksPerTask > 0 && NumChunks >= ChunksPerTask * 2 && FPlatformProcess::SupportsMultithreading())
+	{
+		NumTasks = FMath::Min(NumChunks / ChunksPerTask, FTaskGraphInterface::Get().GetNumWorkerThreads() + 1);
 	}
+
+	if (NumTasks <= 1)
+	{
+		ExecChunks(Params, 0, NumChunks);
+		return;
+	}
+
+	// The calling thread takes the last batch itself rather than sitting idle.
+	FGraphEventArray Tasks;
+	int32 FirstChunk = 0;
+	for (int32 TaskIndex = 0; TaskIndex < NumTasks - 1; ++TaskIndex)
+	{
+		const int32 NumChunksThisTask = NumChunks / NumTasks + (TaskIndex < NumChunks % NumTasks ? 1 : 0);
+		Tasks.Add(TGraphTask<FVectorVMExecTask>::CreateTask().ConstructAndDispatchWhenReady(&Params, FirstChunk, NumChunksThisTask));
+		FirstChunk += NumChunksThisTask;
+	}
+	ExecChunks(Params, FirstChunk, NumChunks - FirstChunk);
+
+	FTaskGraphInterface::Get().WaitUntilTasksComplete(Tasks);
 }
 
 namespace VectorVM
@@ -642,5 +830,28 @@ bool FVectorVMTest::RunTest(const FString& Parameters)
 		}
 	}
 
+	// Native code has to match the interpreter bit for bit.
+	FVectorVMNativeProgram NativeProgram;
+	if (NativeProgram.Build(TestCode, sizeof(TestCode)))
+	{
+		VectorRegister NativeOutput[VectorVM::VectorsPerChunk];
+		VectorRegister* NativeOutputRegisters[1] = { NativeOutput };
+
+		VectorVM::Exec(
+			TestCode,
+			InputRegisters, 3,
+			NativeOutputRegisters, 1,
+			ConstantTable,
+			VectorVM::VectorsPerChunk,
+			&NativeProgram
+			);
+
+		if (FMemory::Memcmp(NativeOutput, OutputRegisters[0], sizeof(NativeOutput)) != 0)
+		{
+			UE_LOG(LogVectorVM,Error,TEXT("Native code output doesn't match the interpreter."));
+			return false;
+		}
+	}
+
 	return true;
 }
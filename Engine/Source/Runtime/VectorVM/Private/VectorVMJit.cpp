@@ -0,0 +1,769 @@
+// Copyright 1998-2014 Epic Games, Inc. All Rights Reserved.
+
+/*==============================================================================
+	VectorVMJit.cpp: Translation of vector VM bytecode to native x86-64 code.
+==============================================================================*/
+
+#include "VectorVMPrivate.h"
+
+#if VECTORVM_SUPPORTS_JIT
+#if PLATFORM_WINDOWS
+	#include "AllowWindowsPlatformTypes.h"
+	#include <windows.h>
+	#include "HideWindowsPlatformTypes.h"
+#else
+	#include <sys/mman.h>
+#endif
+
+DEFINE_LOG_CATEGORY_STATIC(LogVectorVMJit, Log, All);
+
+namespace VectorVMJit
+{
+	/** x86-64 general purpose registers, in encoding order. */
+	enum EGpr
+	{
+		RAX, RCX, RDX, RBX, RSP, RBP, RSI, RDI,
+		R8, R9, R10, R11, R12, R13, R14, R15,
+	};
+
+	/**
+	 * Register usage of the generated code.
+	 *
+	 * The VM's temporary registers live in XMM0-7 for the whole program. Input and output registers
+	 * are addressed through base pointers loaded from the register table once per call, indexed by
+	 * the byte offset of the current vector. A few of the most used constants are splatted into
+	 * registers up front, the rest are splatted from the constant table when used.
+	 */
+	enum
+	{
+		/** Register table argument. */
+		GprRegisterTable = R9,
+		/** Constant table argument. */
+		GprConstantTable = R8,
+		/** Byte offset of the current vector, and the offset to stop at. */
+		GprOffset = R11,
+		GprEndOffset = R10,
+		/** Loads base pointers that didn't get a register of their own. */
+		GprScratch = RAX,
+
+		/** Result of the current op before it is written to its destination. */
+		XmmResult = 8,
+		/** Intermediate values for ops that need more than one instruction. */
+		XmmTemp = 9,
+		/** Sources that aren't already in a register are loaded here, one per operand. */
+		XmmFirstSource = 10,
+		/** Registers holding splatted constants. */
+		XmmFirstConstant = 13,
+		NumXmmConstants = 3,
+	};
+
+	/** Registers base pointers of input and output registers are cached in. */
+	static const EGpr GBaseGprs[] = { RCX, RDX, RBX, RSI, RDI, R12, R13, R14, R15 };
+
+	/** Callee saved registers the generated code uses, the XMM ones only on Windows. */
+	static const EGpr GSavedGprs[] = { RBX, RSI, RDI, R12, R13, R14, R15 };
+	enum { FirstSavedXmm = 6, NumSavedXmms = 10 };
+
+	/** Minimal x86-64 encoder for the handful of instructions the code generator needs. */
+	class FAssembler
+	{
+	public:
+		TArray<uint8> Bytes;
+
+		void Byte(uint8 Value)
+		{
+			Bytes.Add(Value);
+		}
+
+		void Int32(int32 Value)
+		{
+			for (int32 i = 0; i < 4; ++i)
+			{
+				Byte((uint8)(Value >> (i * 8)));
+			}
+		}
+
+		/** REX prefix, only emitted when one of its bits is needed. */
+		void Rex(bool bWide, int32 Reg, int32 Index, int32 Base)
+		{
+			const uint8 Prefix = 0x40
+				| (bWide ? 0x08 : 0)
+				| (Reg >= 8 ? 0x04 : 0)
+				| (Index >= 8 ? 0x02 : 0)
+				| (Base >= 8 ? 0x01 : 0);
+			if (Prefix != 0x40)
+			{
+				Byte(Prefix);
+			}
+		}
+
+		/** ModRM for a register operand. */
+		void ModRMReg(int32 Reg, int32 Rm)
+		{
+			Byte(0xC0 | ((Reg & 7) << 3) | (Rm & 7));
+		}
+
+		/** ModRM, SIB and displacement for a [Base + Index + Disp] operand, Index is INDEX_NONE if unused. */
+		void ModRMMem(int32 Reg, int32 Base, int32 Index, int32 Disp)
+		{
+			const bool bNeedsSib = Index != INDEX_NONE || (Base & 7) == RSP;
+			uint8 Mod = 0x80;
+			if (Disp == 0 && (Base & 7) != RBP)
+			{
+				Mod = 0x00;
+			}
+			else if (Disp >= -128 && Disp < 128)
+			{
+				Mod = 0x40;
+			}
+			Byte(Mod | ((Reg & 7) << 3) | (bNeedsSib ? 4 : (Base & 7)));
+			if (bNeedsSib)
+			{
+				Byte((((Index != INDEX_NONE ? Index : RSP) & 7) << 3) | (Base & 7));
+			}
+			if (Mod == 0x40)
+			{
+				Byte((uint8)Disp);
+			}
+			else if (Mod == 0x80)
+			{
+				Int32(Disp);
+			}
+		}
+
+		/** Packed single op between two XMM registers, Dst = Dst op Src. */
+		void SseReg(uint8 Prefix, uint8 Opcode, int32 Dst, int32 Src)
+		{
+			if (Prefix)
+			{
+				Byte(Prefix);
+			}
+			Rex(false, Dst, INDEX_NONE, Src);
+			Byte(0x0F);
+			Byte(Opcode);
+			ModRMReg(Dst, Src);
+		}
+
+		/** SSE op between an XMM register and memory. */
+		void SseMem(uint8 Prefix, uint8 Opcode, int32 Reg, int32 Base, int32 Index, int32 Disp)
+		{
+			if (Prefix)
+			{
+				Byte(Prefix);
+			}
+			Rex(false, Reg, Index, Base);
+			Byte(0x0F);
+			Byte(Opcode);
+			ModRMMem(Reg, Base, Index, Disp);
+		}
+
+		void MovapsReg(int32 Dst, int32 Src)					{ if (Dst != Src) { SseReg(0, 0x28, Dst, Src); } }
+		void MovapsLoad(int32 Dst, int32 Base, int32 Index, int32 Disp)	{ SseMem(0, 0x28, Dst, Base, Index, Disp); }
+		void MovapsStore(int32 Src, int32 Base, int32 Index, int32 Disp)	{ SseMem(0, 0x29, Src, Base, Index, Disp); }
+		void MovssLoad(int32 Dst, int32 Base, int32 Disp)			{ SseMem(0xF3, 0x10, Dst, Base, INDEX_NONE, Disp); }
+		void Shufps(int32 Dst, int32 Src, uint8 Mask)			{ SseReg(0, 0xC6, Dst, Src); Byte(Mask); }
+		void Addps(int32 Dst, int32 Src)						{ SseReg(0, 0x58, Dst, Src); }
+		void Subps(int32 Dst, int32 Src)						{ SseReg(0, 0x5C, Dst, Src); }
+		void Mulps(int32 Dst, int32 Src)						{ SseReg(0, 0x59, Dst, Src); }
+		void Minps(int32 Dst, int32 Src)						{ SseReg(0, 0x5D, Dst, Src); }
+		void Maxps(int32 Dst, int32 Src)						{ SseReg(0, 0x5F, Dst, Src); }
+		void Rcpps(int32 Dst, int32 Src)						{ SseReg(0, 0x53, Dst, Src); }
+		void Rsqrtps(int32 Dst, int32 Src)						{ SseReg(0, 0x52, Dst, Src); }
+		void Sqrtps(int32 Dst, int32 Src)						{ SseReg(0, 0x51, Dst, Src); }
+		void Andps(int32 Dst, int32 Src)						{ SseReg(0, 0x54, Dst, Src); }
+		void Xorps(int32 Dst, int32 Src)						{ SseReg(0, 0x57, Dst, Src); }
+		void Pcmpeqd(int32 Dst, int32 Src)						{ SseReg(0x66, 0x76, Dst, Src); }
+
+		void PsrldImm(int32 Dst, uint8 Shift)
+		{
+			Byte(0x66);
+			Rex(false, 0, INDEX_NONE, Dst);
+			Byte(0x0F);
+			Byte(0x72);
+			ModRMReg(2, Dst);
+			Byte(Shift);
+		}
+
+		void Push(int32 Reg)
+		{
+			Rex(false, 0, INDEX_NONE, Reg);
+			Byte(0x50 + (Reg & 7));
+		}
+
+		void Pop(int32 Reg)
+		{
+			Rex(false, 0, INDEX_NONE, Reg);
+			Byte(0x58 + (Reg & 7));
+		}
+
+		void MovReg64(int32 Dst, int32 Src)
+		{
+			Rex(true, Src, INDEX_NONE, Dst);
+			Byte(0x89);
+			ModRMReg(Src, Dst);
+		}
+
+		/** 32 bit move, zero extends into the upper half of Dst. */
+		void MovReg32(int32 Dst, int32 Src)
+		{
+			Rex(false, Src, INDEX_NONE, Dst);
+			Byte(0x89);
+			ModRMReg(Src, Dst);
+		}
+
+		void MovLoad64(int32 Dst, int32 Base, int32 Disp)
+		{
+			Rex(true, Dst, INDEX_NONE, Base);
+			Byte(0x8B);
+			ModRMMem(Dst, Base, INDEX_NONE, Disp);
+		}
+
+		void XorReg32(int32 Dst, int32 Src)
+		{
+			Rex(false, Src, INDEX_NONE, Dst);
+			Byte(0x31);
+			ModRMReg(Src, Dst);
+		}
+
+		void TestReg64(int32 A, int32 B)
+		{
+			Rex(true, B, INDEX_NONE, A);
+			Byte(0x85);
+			ModRMReg(B, A);
+		}
+
+		/** Sets flags from A - B. */
+		void CmpReg64(int32 A, int32 B)
+		{
+			Rex(true, B, INDEX_NONE, A);
+			Byte(0x39);
+			ModRMReg(B, A);
+		}
+
+		void ShlImm64(int32 Reg, uint8 Shift)
+		{
+			Rex(true, 0, INDEX_NONE, Reg);
+			Byte(0xC1);
+			ModRMReg(4, Reg);
+			Byte(Shift);
+		}
+
+		void AddImm64(int32 Reg, int32 Value)
+		{
+			Rex(true, 0, INDEX_NONE, Reg);
+			Byte(0x81);
+			ModRMReg(0, Reg);
+			Int32(Value);
+		}
+
+		void SubImm64(int32 Reg, int32 Value)
+		{
+			Rex(true, 0, INDEX_NONE, Reg);
+			Byte(0x81);
+			ModRMReg(5, Reg);
+			Int32(Value);
+		}
+
+		/** Conditional jump with a 32 bit displacement, returns the offset of the displacement for PatchJump. */
+		int32 Jcc(uint8 Condition)
+		{
+			Byte(0x0F);
+			Byte(0x80 | Condition);
+			Int32(0);
+			return Bytes.Num() - 4;
+		}
+
+		/** Points a jump emitted by Jcc at Target. */
+		void PatchJump(int32 DispOffset, int32 Target)
+		{
+			const int32 Disp = Target - (DispOffset + 4);
+			FMemory::Memcpy(&Bytes[DispOffset], &Disp, sizeof(Disp));
+		}
+
+		void Ret()
+		{
+			Byte(0xC3);
+		}
+	};
+
+	/** Condition codes for Jcc. */
+	enum
+	{
+		CondBelow = 0x2,
+		CondZero = 0x4,
+	};
+
+	/** A decoded VM instruction. */
+	struct FInstruction
+	{
+		VectorVM::EOp::Type BaseOp;
+		uint8 Dst;
+		uint8 Src[3];
+		bool bSrcConst[3];
+	};
+
+	/** Ops the code generator handles. Anything else makes the program fall back to the interpreter. */
+	static bool IsOpSupported(uint8 Op)
+	{
+		using namespace VectorVM;
+		switch (Op)
+		{
+		case EOp::add: case EOp::addi:
+		case EOp::sub: case EOp::subi:
+		case EOp::mul: case EOp::muli:
+		case EOp::mad: case EOp::madrri: case EOp::madrir: case EOp::madrii: case EOp::madiir: case EOp::madiii:
+		case EOp::lerp: case EOp::lerpirr: case EOp::lerprir: case EOp::lerprri: case EOp::lerprii:
+		case EOp::rcp: case EOp::rsq: case EOp::sqrt: case EOp::neg: case EOp::abs:
+		case EOp::clamp: case EOp::clampir: case EOp::clampri: case EOp::clampii:
+		case EOp::min: case EOp::mini:
+		case EOp::max: case EOp::maxi:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	/**
+	 * Translates a program to x86-64 code. Each op produces bit for bit the same result as the
+	 * interpreter's kernel, which is what the vm.JitVerify mode checks.
+	 */
+	class FCodeGenerator
+	{
+	public:
+		FAssembler Asm;
+
+		bool Generate(uint8 const* Code, int32 CodeLength)
+		{
+			if (!Decode(Code, CodeLength))
+			{
+				return false;
+			}
+			AssignRegisters();
+			EmitFunction();
+			return true;
+		}
+
+	private:
+		TArray<FInstruction> Instructions;
+		/** Base pointer register of each VM register that lives in memory, INDEX_NONE if it is loaded on use. */
+		int32 BaseGprs[VectorVM::MaxRegisters];
+		/** XMM register holding each constant, INDEX_NONE if it is splatted on use. */
+		int32 ConstantXmms[VectorVM::MaxConstants];
+		/** Memory registers in the order they were given a base register. */
+		TArray<int32> CachedRegisters;
+		/** Constants in the order they were given an XMM register. */
+		TArray<int32> CachedConstants;
+
+		bool Decode(uint8 const* Code, int32 CodeLength)
+		{
+			int32 Offset = 0;
+			while (Offset < CodeLength)
+			{
+				const uint8 Op = Code[Offset++];
+				if (Op == VectorVM::EOp::done)
+				{
+					return Instructions.Num() > 0;
+				}
+				if (!IsOpSupported(Op))
+				{
+					UE_LOG(LogVectorVMJit, Verbose, TEXT("Op code 0x%02x isn't supported, the program will be interpreted."), (uint32)Op);
+					return false;
+				}
+
+				VectorVM::FVectorVMOpInfo const& OpInfo = VectorVM::GetOpCodeInfo(Op);
+				FInstruction Instruction;
+				FMemory::Memzero(&Instruction, sizeof(Instruction));
+				Instruction.BaseOp = OpInfo.BaseOpcode;
+				if (Offset >= CodeLength)
+				{
+					return false;
+				}
+				Instruction.Dst = Code[Offset++];
+				if (Instruction.Dst >= VectorVM::MaxRegisters)
+				{
+					return false;
+				}
+				for (int32 SrcIndex = 0; SrcIndex < 3 && OpInfo.SrcTypes[SrcIndex] != VectorVM::EOpSrc::Invalid; ++SrcIndex)
+				{
+					if (Offset >= CodeLength)
+					{
+						return false;
+					}
+					Instruction.Src[SrcIndex] = Code[Offset++];
+					Instruction.bSrcConst[SrcIndex] = OpInfo.SrcTypes[SrcIndex] == VectorVM::EOpSrc::Const;
+					if (!Instruction.bSrcConst[SrcIndex] && Instruction.Src[SrcIndex] >= VectorVM::MaxRegisters)
+					{
+						return false;
+					}
+				}
+				Instructions.Add(Instruction);
+			}
+
+			// Ran off the end without a done opcode.
+			return false;
+		}
+
+		/** Gives the most used memory registers and constants a register of their own. */
+		void AssignRegisters()
+		{
+			int32 RegisterUses[VectorVM::MaxRegisters] = {0};
+			int32 ConstantUses[VectorVM::MaxConstants] = {0};
+			for (int32 InstIndex = 0; InstIndex < Instructions.Num(); ++InstIndex)
+			{
+				const FInstruction& Instruction = Instructions[InstIndex];
+				RegisterUses[Instruction.Dst]++;
+				for (int32 SrcIndex = 0; SrcIndex < 3; ++SrcIndex)
+				{
+					if (Instruction.bSrcConst[SrcIndex])
+					{
+						ConstantUses[Instruction.Src[SrcIndex]]++;
+					}
+					else if (GetNumSources(Instruction) > SrcIndex)
+					{
+						RegisterUses[Instruction.Src[SrcIndex]]++;
+					}
+				}
+			}
+
+			for (int32 i = 0; i < VectorVM::MaxRegisters; ++i)
+			{
+				BaseGprs[i] = INDEX_NONE;
+			}
+			for (int32 i = 0; i < VectorVM::MaxConstants; ++i)
+			{
+				ConstantXmms[i] = INDEX_NONE;
+			}
+
+			while (CachedRegisters.Num() < (int32)ARRAY_COUNT(GBaseGprs))
+			{
+				const int32 Register = FindMostUsed(RegisterUses, VectorVM::MaxRegisters, VectorVM::NumTempRegisters);
+				if (Register == INDEX_NONE)
+				{
+					break;
+				}
+				BaseGprs[Register] = GBaseGprs[CachedRegisters.Num()];
+				RegisterUses[Register] = 0;
+				CachedRegisters.Add(Register);
+			}
+
+			while (CachedConstants.Num() < NumXmmConstants)
+			{
+				const int32 Constant = FindMostUsed(ConstantUses, VectorVM::MaxConstants, 0);
+				if (Constant == INDEX_NONE)
+				{
+					break;
+				}
+				ConstantXmms[Constant] = XmmFirstConstant + CachedConstants.Num();
+				ConstantUses[Constant] = 0;
+				CachedConstants.Add(Constant);
+			}
+		}
+
+		static int32 FindMostUsed(const int32* Uses, int32 Num, int32 First)
+		{
+			int32 Best = INDEX_NONE;
+			for (int32 i = First; i < Num; ++i)
+			{
+				if (Uses[i] > 0 && (Best == INDEX_NONE || Uses[i] > Uses[Best]))
+				{
+					Best = i;
+				}
+			}
+			return Best;
+		}
+
+		static int32 GetNumSources(const FInstruction& Instruction)
+		{
+			switch (Instruction.BaseOp)
+			{
+			case VectorVM::EOp::rcp: case VectorVM::EOp::rsq: case VectorVM::EOp::sqrt: case VectorVM::EOp::neg: case VectorVM::EOp::abs:
+				return 1;
+			case VectorVM::EOp::mad: case VectorVM::EOp::lerp: case VectorVM::EOp::clamp:
+				return 3;
+			default:
+				return 2;
+			}
+		}
+
+		/** Base register to address a memory register through, loading it first if it isn't cached. */
+		int32 GetBaseGpr(int32 Register)
+		{
+			if (BaseGprs[Register] != INDEX_NONE)
+			{
+				return BaseGprs[Register];
+			}
+			Asm.MovLoad64(GprScratch, GprRegisterTable, Register * (int32)sizeof(VectorRegister*));
+			return GprScratch;
+		}
+
+		/** Returns the XMM register holding a source operand, loading it into the operand's scratch register if needed. */
+		int32 GetSource(const FInstruction& Instruction, int32 SrcIndex)
+		{
+			const int32 Operand = Instruction.Src[SrcIndex];
+			const int32 Scratch = XmmFirstSource + SrcIndex;
+			if (Instruction.bSrcConst[SrcIndex])
+			{
+				if (ConstantXmms[Operand] != INDEX_NONE)
+				{
+					return ConstantXmms[Operand];
+				}
+				Asm.MovssLoad(Scratch, GprConstantTable, Operand * (int32)sizeof(float));
+				Asm.Shufps(Scratch, Scratch, 0);
+				return Scratch;
+			}
+			if (Operand < VectorVM::NumTempRegisters)
+			{
+				return Operand;
+			}
+			Asm.MovapsLoad(Scratch, GetBaseGpr(Operand), GprOffset, 0);
+			return Scratch;
+		}
+
+		/** Emits one op, mirroring the instruction sequence of the matching interpreter kernel. */
+		void EmitInstruction(const FInstruction& Instruction)
+		{
+			const int32 NumSources = GetNumSources(Instruction);
+			int32 Src[3] = { INDEX_NONE, INDEX_NONE, INDEX_NONE };
+			for (int32 SrcIndex = 0; SrcIndex < NumSources; ++SrcIndex)
+			{
+				Src[SrcIndex] = GetSource(Instruction, SrcIndex);
+			}
+
+			switch (Instruction.BaseOp)
+			{
+			case VectorVM::EOp::add:
+				Asm.MovapsReg(XmmResult, Src[0]);
+				Asm.Addps(XmmResult, Src[1]);
+				break;
+			case VectorVM::EOp::sub:
+				Asm.MovapsReg(XmmResult, Src[0]);
+				Asm.Subps(XmmResult, Src[1]);
+				break;
+			case VectorVM::EOp::mul:
+				Asm.MovapsReg(XmmResult, Src[0]);
+				Asm.Mulps(XmmResult, Src[1]);
+				break;
+			case VectorVM::EOp::mad:
+				Asm.MovapsReg(XmmResult, Src[0]);
+				Asm.Mulps(XmmResult, Src[1]);
+				Asm.Addps(XmmResult, Src[2]);
+				break;
+			case VectorVM::EOp::lerp:
+				// Src1 * Src2 + Src0 * (0 - Src2), as FVectorKernelLerp computes it.
+				Asm.Xorps(XmmTemp, XmmTemp);
+				Asm.Subps(XmmTemp, Src[2]);
+				Asm.Mulps(XmmTemp, Src[0]);
+				Asm.MovapsReg(XmmResult, Src[1]);
+				Asm.Mulps(XmmResult, Src[2]);
+				Asm.Addps(XmmResult, XmmTemp);
+				break;
+			case VectorVM::EOp::rcp:
+				Asm.Rcpps(XmmResult, Src[0]);
+				break;
+			case VectorVM::EOp::rsq:
+				Asm.Rsqrtps(XmmResult, Src[0]);
+				break;
+			case VectorVM::EOp::sqrt:
+				Asm.Sqrtps(XmmResult, Src[0]);
+				break;
+			case VectorVM::EOp::neg:
+				Asm.Xorps(XmmResult, XmmResult);
+				Asm.Subps(XmmResult, Src[0]);
+				break;
+			case VectorVM::EOp::abs:
+				// All ones shifted right by one is the mask that clears the sign bit.
+				Asm.Pcmpeqd(XmmResult, XmmResult);
+				Asm.PsrldImm(XmmResult, 1);
+				Asm.Andps(XmmResult, Src[0]);
+				break;
+			case VectorVM::EOp::clamp:
+				Asm.MovapsReg(XmmResult, Src[0]);
+				Asm.Maxps(XmmResult, Src[1]);
+				Asm.Minps(XmmResult, Src[2]);
+				break;
+			case VectorVM::EOp::min:
+				Asm.MovapsReg(XmmResult, Src[0]);
+				Asm.Minps(XmmResult, Src[1]);
+				break;
+			case VectorVM::EOp::max:
+				Asm.MovapsReg(XmmResult, Src[0]);
+				Asm.Maxps(XmmResult, Src[1]);
+				break;
+			default:
+				check(0);
+				break;
+			}
+
+			if (Instruction.Dst < VectorVM::NumTempRegisters)
+			{
+				Asm.MovapsReg(Instruction.Dst, XmmResult);
+			}
+			else
+			{
+				Asm.MovapsStore(XmmResult, GetBaseGpr(Instruction.Dst), GprOffset, 0);
+			}
+		}
+
+		void EmitFunction()
+		{
+			// Prologue, save what the calling convention wants preserved.
+			for (int32 i = 0; i < (int32)ARRAY_COUNT(GSavedGprs); ++i)
+			{
+				Asm.Push(GSavedGprs[i]);
+			}
+#if PLATFORM_WINDOWS
+			// Seven pushes after the return address leave the stack 16 byte aligned.
+			Asm.SubImm64(RSP, NumSavedXmms * 16);
+			for (int32 i = 0; i < NumSavedXmms; ++i)
+			{
+				Asm.MovapsStore(FirstSavedXmm + i, RSP, INDEX_NONE, i * 16);
+			}
+
+			// Arguments arrive in RCX, RDX, R8.
+			Asm.MovReg32(GprEndOffset, R8);
+			Asm.MovReg64(GprRegisterTable, RCX);
+			Asm.MovReg64(GprConstantTable, RDX);
+#else
+			// Arguments arrive in RDI, RSI, RDX.
+			Asm.MovReg32(GprEndOffset, RDX);
+			Asm.MovReg64(GprRegisterTable, RDI);
+			Asm.MovReg64(GprConstantTable, RSI);
+#endif
+			Asm.ShlImm64(GprEndOffset, 4);
+			Asm.TestReg64(GprEndOffset, GprEndOffset);
+			const int32 SkipLoop = Asm.Jcc(CondZero);
+
+			// Everything that doesn't change between vectors is hoisted out of the loop.
+			for (int32 i = 0; i < CachedRegisters.Num(); ++i)
+			{
+				Asm.MovLoad64(BaseGprs[CachedRegisters[i]], GprRegisterTable, CachedRegisters[i] * (int32)sizeof(VectorRegister*));
+			}
+			for (int32 i = 0; i < CachedConstants.Num(); ++i)
+			{
+				const int32 Xmm = ConstantXmms[CachedConstants[i]];
+				Asm.MovssLoad(Xmm, GprConstantTable, CachedConstants[i] * (int32)sizeof(float));
+				Asm.Shufps(Xmm, Xmm, 0);
+			}
+			Asm.XorReg32(GprOffset, GprOffset);
+
+			// The whole program for one vector, then on to the next.
+			const int32 LoopStart = Asm.Bytes.Num();
+			for (int32 InstIndex = 0; InstIndex < Instructions.Num(); ++InstIndex)
+			{
+				EmitInstruction(Instructions[InstIndex]);
+			}
+			Asm.AddImm64(GprOffset, (int32)sizeof(VectorRegister));
+			Asm.CmpReg64(GprOffset, GprEndOffset);
+			Asm.PatchJump(Asm.Jcc(CondBelow), LoopStart);
+
+			// Epilogue.
+			Asm.PatchJump(SkipLoop, Asm.Bytes.Num());
+#if PLATFORM_WINDOWS
+			for (int32 i = 0; i < NumSavedXmms; ++i)
+			{
+				Asm.MovapsLoad(FirstSavedXmm + i, RSP, INDEX_NONE, i * 16);
+			}
+			Asm.AddImm64(RSP, NumSavedXmms * 16);
+#endif
+			for (int32 i = (int32)ARRAY_COUNT(GSavedGprs) - 1; i >= 0; --i)
+			{
+				Asm.Pop(GSavedGprs[i]);
+			}
+			Asm.Ret();
+		}
+	};
+
+	/** Copies code into newly allocated executable pages. */
+	static void* AllocateExecutableMemory(const TArray<uint8>& Code, SIZE_T& OutSize)
+	{
+		OutSize = Code.Num();
+#if PLATFORM_WINDOWS
+		void* Memory = VirtualAlloc(NULL, OutSize, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+		if (Memory == NULL)
+		{
+			return NULL;
+		}
+		FMemory::Memcpy(Memory, Code.GetData(), OutSize);
+		DWORD OldProtect = 0;
+		if (!VirtualProtect(Memory, OutSize, PAGE_EXECUTE_READ, &OldProtect))
+		{
+			VirtualFree(Memory, 0, MEM_RELEASE);
+			return NULL;
+		}
+		FlushInstructionCache(GetCurrentProcess(), Memory, OutSize);
+#else
+		void* Memory = mmap(NULL, OutSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+		if (Memory == MAP_FAILED)
+		{
+			return NULL;
+		}
+		FMemory::Memcpy(Memory, Code.GetData(), OutSize);
+		if (mprotect(Memory, OutSize, PROT_READ | PROT_EXEC) != 0)
+		{
+			munmap(Memory, OutSize);
+			return NULL;
+		}
+#endif
+		return Memory;
+	}
+
+	static void FreeExecutableMemory(void* Memory, SIZE_T Size)
+	{
+#if PLATFORM_WINDOWS
+		VirtualFree(Memory, 0, MEM_RELEASE);
+#else
+		munmap(Memory, Size);
+#endif
+	}
+} // namespace VectorVMJit
+
+#endif // VECTORVM_SUPPORTS_JIT
+
+FVectorVMNativeProgram::FVectorVMNativeProgram()
+	: Function(NULL)
+	, CodeMemory(NULL)
+	, CodeMemorySize(0)
+{
+}
+
+FVectorVMNativeProgram::~FVectorVMNativeProgram()
+{
+	Release();
+}
+
+bool FVectorVMNativeProgram::Build(uint8 const* Code, int32 CodeLength)
+{
+	Release();
+
+#if VECTORVM_SUPPORTS_JIT
+	VectorVMJit::FCodeGenerator Generator;
+	if (Generator.Generate(Code, CodeLength))
+	{
+		CodeMemory = VectorVMJit::AllocateExecutableMemory(Generator.Asm.Bytes, CodeMemorySize);
+		if (CodeMemory)
+		{
+			Function = reinterpret_cast<FFunction>(CodeMemory);
+			UE_LOG(LogVectorVMJit, Verbose, TEXT("Built %d bytes of native code from %d bytes of bytecode."), Generator.Asm.Bytes.Num(), CodeLength);
+		}
+		else
+		{
+			UE_LOG(LogVectorVMJit, Warning, TEXT("Failed to allocate executable memory, the program will be interpreted."));
+		}
+	}
+#endif
+
+	return IsValid();
+}
+
+void FVectorVMNativeProgram::Release()
+{
+#if VECTORVM_SUPPORTS_JIT
+	if (CodeMemory)
+	{
+		VectorVMJit::FreeExecutableMemory(CodeMemory, CodeMemorySize);
+	}
+#endif
+	Function = NULL;
+	CodeMemory = NULL;
+	CodeMemorySize = 0;
+}
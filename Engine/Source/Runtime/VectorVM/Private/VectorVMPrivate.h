@@ -7,13 +7,23 @@
 #pragma once
 #include "VectorVM.h"
 
+/** Whether VM programs can be translated to native code on this platform, see FVectorVMNativeProgram. */
+#if PLATFORM_ENABLE_VECTORINTRINSICS && (PLATFORM_WINDOWS || PLATFORM_MAC || PLATFORM_LINUX) && (defined(_M_X64) || defined(__x86_64__))
+	#define VECTORVM_SUPPORTS_JIT 1
+#else
+	#define VECTORVM_SUPPORTS_JIT 0
+#endif
+
 namespace VectorVM
 {
 	/** Constants. */
 	enum
 	{
-		ChunkSize = 64,
+		/** Instances processed by one pass over the bytecode, sized so a chunk's temporary registers fit in L1. */
+		ChunkSize = 512,
 		ElementsPerVector = 4,
 		VectorsPerChunk = ChunkSize / ElementsPerVector,
+		/** Default number of chunks handed to each task graph worker, see vm.ParallelChunks. */
+		MinChunksPerTask = 4,
 	};
 }
@@ -7,6 +7,48 @@
 #pragma once
 #include "Core.h"
 
+/**
+ * VM bytecode translated to native SSE code for the host CPU. The generated code runs the whole
+ * program for one vector at a time, keeping temporary registers in machine registers. Programs
+ * using ops the code generator doesn't handle, or built on platforms it doesn't support, are
+ * left invalid and VectorVM::Exec falls back to the interpreter.
+ */
+class VECTORVM_API FVectorVMNativeProgram
+{
+public:
+	/** Signature of the generated code, it runs the program over NumVectors vectors of one chunk. */
+	typedef void (*FFunction)(VectorRegister** RegisterTable, float const* ConstantTable, int32 NumVectors);
+
+	FVectorVMNativeProgram();
+	~FVectorVMNativeProgram();
+
+	/**
+	 * Translates bytecode to native code, replacing anything built before.
+	 * @return false if the program has to be interpreted.
+	 */
+	bool Build(uint8 const* Code, int32 CodeLength);
+
+	/** Frees the generated code. */
+	void Release();
+
+	/** True if there is native code to run. */
+	bool IsValid() const { return Function != NULL; }
+
+	/** Entry point of the generated code. */
+	FFunction GetFunction() const { return Function; }
+
+private:
+	/** Entry point of the generated code, NULL if there is none. */
+	FFunction Function;
+	/** Executable pages holding the generated code. */
+	void* CodeMemory;
+	SIZE_T CodeMemorySize;
+
+	/** The generated code is owned by a single program. */
+	FVectorVMNativeProgram(const FVectorVMNativeProgram&);
+	FVectorVMNativeProgram& operator=(const FVectorVMNativeProgram&);
+};
+
 namespace VectorVM
 {
 	/** Constants. */
@@ -145,6 +187,7 @@ namespace VectorVM
 
 	/**
 	 * Execute VectorVM bytecode.
+	 * @param NativeProgram - Optional native code built from Code, used instead of the interpreter when valid.
 	 */
 	VECTORVM_API void Exec(
 		uint8 const* Code,
@@ -153,7 +196,8 @@ namespace VectorVM
 		VectorRegister** OutputRegisters,
 		int32 NumOutputRegisters,
 		float const* ConstantTable,
-		int32 NumVectors
+		int32 NumVectors,
+		FVectorVMNativeProgram const* NativeProgram = NULL
 		);
 
 } // namespace VectorVM